@@ -17,16 +17,21 @@
 
 #include "application/application.h"
 
+#include "format/format_util.h"
+#include "util/date_time.h"
 #include "util/logging.h"
 
 #include <algorithm>
 #include <cassert>
+#include <limits>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(application)
 
 Application::Application(const std::string& name) :
-    file_processor_(nullptr), running_(false), paused_(false), name_(name)
+    file_processor_(nullptr), running_(false), paused_(false), name_(name), pause_frame_(0), loop_decoder_(nullptr),
+    loop_first_frame_(0), loop_last_frame_(0), loop_count_(0), loop_frame_count_(0), preload_first_frame_(0),
+    preload_last_frame_(0), preload_decompress_(false), preload_start_time_(0), statistics_(nullptr)
 {}
 
 Application::~Application()
@@ -85,8 +90,99 @@ bool Application::PlaySingleFrame()
 
     if (file_processor_)
     {
+        // Frames in the loop range are stored by the loop decoder as they are replayed from the file.
+        uint32_t frame_number = file_processor_->GetCurrentFrameNumber() + 1;
+        bool     loop_frame =
+            (loop_decoder_ != nullptr) && (frame_number >= loop_first_frame_) && (frame_number <= loop_last_frame_);
+
+        if (loop_frame && (frame_number == loop_first_frame_))
+        {
+            loop_decoder_->StartRecording();
+        }
+
+        bool preload_frame = (preload_last_frame_ != 0) && (frame_number >= preload_first_frame_) &&
+                             (frame_number <= preload_last_frame_);
+
+        if (preload_frame && (frame_number == preload_first_frame_))
+        {
+            // The frames are read before the start time is recorded, so that file reads are not included in the time.
+            if (!file_processor_->PreloadFrames(preload_last_frame_ - preload_first_frame_ + 1, preload_decompress_))
+            {
+                GFXRECON_LOG_WARNING("Failed to preload all frames in the range %u-%u",
+                                     preload_first_frame_,
+                                     preload_last_frame_);
+            }
+
+            GFXRECON_WRITE_CONSOLE("Preloaded frames %u-%u: %f MB",
+                                   preload_first_frame_,
+                                   preload_last_frame_,
+                                   static_cast<double>(file_processor_->GetPreloadSize()) / (1024.0 * 1024.0));
+
+            preload_start_time_ = util::datetime::GetTimestamp();
+        }
+
+        if (statistics_ != nullptr)
+        {
+            statistics_->BeginFrame();
+        }
+
         success = file_processor_->ProcessNextFrame();
 
+        // A partial frame at the end of the file is not recorded.
+        if ((statistics_ != nullptr) && success)
+        {
+            statistics_->EndFrame(frame_number);
+        }
+
+        if (preload_frame && success && (frame_number == preload_last_frame_))
+        {
+            uint32_t frame_count  = preload_last_frame_ - preload_first_frame_ + 1;
+            double   preload_time = util::datetime::ConvertTimestampToSeconds(
+                util::datetime::DiffTimestamps(preload_start_time_, util::datetime::GetTimestamp()));
+
+            GFXRECON_WRITE_CONSOLE("Preloaded frames %u-%u: %f fps, %f seconds",
+                                   preload_first_frame_,
+                                   preload_last_frame_,
+                                   static_cast<double>(frame_count) / preload_time,
+                                   preload_time);
+        }
+
+        if (loop_frame)
+        {
+            if (success)
+            {
+                loop_decoder_->EndRecordedFrame();
+            }
+            else
+            {
+                GFXRECON_LOG_WARNING("The capture file ended before the last frame of the frame loop");
+            }
+
+            if (!success || (frame_number == loop_last_frame_))
+            {
+                loop_decoder_->StopRecording();
+
+                if (success)
+                {
+                    if (loop_decoder_->IsRecordingLoopable())
+                    {
+                        PlayFrameLoop();
+                    }
+                    else
+                    {
+                        GFXRECON_LOG_ERROR("The frame loop range %u-%u contains %s, which creates, destroys, "
+                                           "allocates, or frees objects that cannot be restored between loops; the "
+                                           "frame range will not be looped",
+                                           loop_first_frame_,
+                                           loop_last_frame_,
+                                           format::GetApiCallName(loop_decoder_->GetUnloopableCall()));
+                    }
+                }
+
+                loop_decoder_->ClearRecording();
+            }
+        }
+
         if (success)
         {
             if (file_processor_->GetCurrentFrameNumber() == pause_frame_)
@@ -111,6 +207,79 @@ bool Application::PlaySingleFrame()
     return success;
 }
 
+void Application::SetFrameLoop(decode::FrameLoopDecoder* loop_decoder,
+                               uint32_t                  first_frame,
+                               uint32_t                  last_frame,
+                               uint32_t                  loop_count)
+{
+    loop_decoder_     = loop_decoder;
+    loop_first_frame_ = first_frame;
+    loop_last_frame_  = last_frame;
+    loop_count_       = loop_count;
+}
+
+void Application::SetPreloadFrames(uint32_t first_frame, uint32_t last_frame, bool decompress)
+{
+    preload_first_frame_ = first_frame;
+    preload_last_frame_  = last_frame;
+    preload_decompress_  = decompress;
+}
+
+void Application::PlayFrameLoop()
+{
+    assert(loop_decoder_ != nullptr);
+
+    uint32_t frame_count = loop_decoder_->GetRecordedFrameCount();
+
+    for (uint32_t i = 0; (i < loop_count_) && running_; ++i)
+    {
+        int64_t  start_time     = util::datetime::GetTimestamp();
+        int64_t  frame_start    = start_time;
+        int64_t  min_frame_time = std::numeric_limits<int64_t>::max();
+        int64_t  max_frame_time = 0;
+        uint32_t frame_number   = loop_first_frame_;
+
+        if (statistics_ != nullptr)
+        {
+            statistics_->BeginFrame();
+        }
+
+        loop_decoder_->ReplayRecording([&]() {
+            int64_t frame_end  = util::datetime::GetTimestamp();
+            int64_t frame_time = util::datetime::DiffTimestamps(frame_start, frame_end);
+
+            min_frame_time = std::min(min_frame_time, frame_time);
+            max_frame_time = std::max(max_frame_time, frame_time);
+            frame_start    = frame_end;
+
+            if (statistics_ != nullptr)
+            {
+                statistics_->EndFrame(frame_number++);
+                statistics_->BeginFrame();
+            }
+
+            // Keep processing window system events so that the window remains responsive while looping.
+            ProcessEvents(false);
+        });
+
+        double loop_time = util::datetime::ConvertTimestampToSeconds(
+            util::datetime::DiffTimestamps(start_time, util::datetime::GetTimestamp()));
+
+        loop_frame_count_ += frame_count;
+
+        GFXRECON_WRITE_CONSOLE("Frame loop %u: %f fps, %f seconds, frame time min %f ms, avg %f ms, max %f ms, "
+                               "framerange %u-%u",
+                               i + 1,
+                               static_cast<double>(frame_count) / loop_time,
+                               loop_time,
+                               util::datetime::ConvertTimestampToSeconds(min_frame_time) * 1000.0,
+                               (loop_time * 1000.0) / frame_count,
+                               util::datetime::ConvertTimestampToSeconds(max_frame_time) * 1000.0,
+                               loop_first_frame_,
+                               loop_last_frame_);
+    }
+}
+
 bool Application::RegisterWindow(decode::Window* window)
 {
     assert(window != nullptr);
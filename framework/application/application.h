@@ -19,6 +19,8 @@
 #define GFXRECON_APPLICATION_APPLICATION_H
 
 #include "decode/file_processor.h"
+#include "decode/frame_loop_decoder.h"
+#include "decode/replay_statistics.h"
 #include "decode/window.h"
 #include "util/defines.h"
 
@@ -51,6 +53,23 @@ class Application
 
     bool PlaySingleFrame();
 
+    // Replays the frames in the range [first_frame, last_frame] loop_count more times after they have been replayed
+    // from the capture file, with the frames stored in memory by the loop decoder, and reports the time of each loop.
+    void SetFrameLoop(decode::FrameLoopDecoder* loop_decoder,
+                      uint32_t                  first_frame,
+                      uint32_t                  last_frame,
+                      uint32_t                  loop_count);
+
+    // Reads the frames in the range [first_frame, last_frame] into memory before they are replayed, optionally with
+    // their blocks decompressed, so that the frames are replayed without file reads, and reports their replay time.
+    void SetPreloadFrames(uint32_t first_frame, uint32_t last_frame, bool decompress);
+
+    // Records the time of each replayed frame, including frames replayed by frame loops.
+    void SetReplayStatistics(decode::ReplayStatistics* statistics) { statistics_ = statistics; }
+
+    // Returns the number of frames that have been replayed by frame loops.
+    uint32_t GetLoopFrameCount() const { return loop_frame_count_; }
+
     bool RegisterWindow(decode::Window* window);
 
     bool UnregisterWindow(decode::Window* window);
@@ -62,18 +81,32 @@ class Application
 
     void SetFileProcessor(decode::FileProcessor* file_processor);
 
+  private:
+    void PlayFrameLoop();
+
   private:
     // clang-format off
-    std::vector<decode::Window*> windows_;          ///< List of windows that have been registered with the application.
-    decode::FileProcessor*       file_processor_;   ///< The FileProcessor object responsible for decoding and processing
-                                                    ///< capture file data.
-    bool                         running_;          ///< Indicates that the application is actively processing system
-                                                    ///< events for playback.
-    bool                         paused_;           ///< Indicates that the playback has been paused.  When paused the
-                                                    ///< application will stop rendering, but will continue processing
-                                                    ///< system events.
-    std::string                  name_;             ///< Application name to display in window title bar.
-    uint32_t                     pause_frame_;      ///< The number for a frame that replay should pause after.
+    std::vector<decode::Window*> windows_;             ///< List of windows that have been registered with the
+                                                        ///< application.
+    decode::FileProcessor*       file_processor_;      ///< The FileProcessor object responsible for decoding and
+                                                        ///< processing capture file data.
+    bool                         running_;             ///< Indicates that the application is actively processing
+                                                        ///< system events for playback.
+    bool                         paused_;              ///< Indicates that the playback has been paused.  When paused
+                                                        ///< the application will stop rendering, but will continue
+                                                        ///< processing system events.
+    std::string                  name_;                ///< Application name to display in window title bar.
+    uint32_t                     pause_frame_;         ///< The number for a frame that replay should pause after.
+    decode::FrameLoopDecoder*    loop_decoder_;        ///< Decoder that stores the frames to replay in a loop.
+    uint32_t                     loop_first_frame_;    ///< The number of the first frame to replay in a loop.
+    uint32_t                     loop_last_frame_;     ///< The number of the last frame to replay in a loop.
+    uint32_t                     loop_count_;          ///< The number of times to replay the frame loop.
+    uint32_t                     loop_frame_count_;    ///< The number of frames replayed by frame loops.
+    uint32_t                     preload_first_frame_; ///< The number of the first frame to preload into memory.
+    uint32_t                     preload_last_frame_;  ///< The number of the last frame to preload into memory.
+    bool                         preload_decompress_;  ///< Indicates that preloaded blocks should be decompressed.
+    int64_t                      preload_start_time_;  ///< The time that replay of the preloaded frames started.
+    decode::ReplayStatistics*    statistics_;          ///< Optional replay performance measurements.
     // clang-format on
 };
 
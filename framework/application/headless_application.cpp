@@ -0,0 +1,45 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+
+#include "application/headless_application.h"
+
+#include "util/logging.h"
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(application)
+
+HeadlessApplication::HeadlessApplication(const std::string& name) : Application(name) {}
+
+bool HeadlessApplication::Initialize(decode::FileProcessor* file_processor)
+{
+    SetFileProcessor(file_processor);
+
+    return true;
+}
+
+void HeadlessApplication::ProcessEvents(bool wait_for_input)
+{
+    if (wait_for_input)
+    {
+        // There is no input to wait for, so replay would never resume from the paused state.
+        GFXRECON_LOG_WARNING("Pausing is not supported for headless replay; resuming replay");
+        SetPaused(false);
+    }
+}
+
+GFXRECON_END_NAMESPACE(application)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,43 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+
+#ifndef GFXRECON_APPLICATION_HEADLESS_APPLICATION_H
+#define GFXRECON_APPLICATION_HEADLESS_APPLICATION_H
+
+#include "application/application.h"
+#include "util/defines.h"
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(application)
+
+// Application for replay without a window system, which has no window system events to process.
+class HeadlessApplication : public Application
+{
+  public:
+    HeadlessApplication(const std::string& name);
+
+    virtual ~HeadlessApplication() override {}
+
+    virtual bool Initialize(decode::FileProcessor* file_processor) override;
+
+    virtual void ProcessEvents(bool wait_for_input) override;
+};
+
+GFXRECON_END_NAMESPACE(application)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_APPLICATION_HEADLESS_APPLICATION_H
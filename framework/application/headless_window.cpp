@@ -0,0 +1,119 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+
+#include "application/headless_window.h"
+
+#include "util/logging.h"
+
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(application)
+
+HeadlessWindow::HeadlessWindow(HeadlessApplication* application) :
+    headless_application_(application), width_(0), height_(0), created_(false)
+{
+    assert(application != nullptr);
+}
+
+bool HeadlessWindow::Create(
+    const std::string& title, const int32_t xpos, const int32_t ypos, const uint32_t width, const uint32_t height)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(title);
+    GFXRECON_UNREFERENCED_PARAMETER(xpos);
+    GFXRECON_UNREFERENCED_PARAMETER(ypos);
+
+    width_   = width;
+    height_  = height;
+    created_ = headless_application_->RegisterWindow(this);
+
+    return created_;
+}
+
+bool HeadlessWindow::Destroy()
+{
+    if (created_)
+    {
+        headless_application_->UnregisterWindow(this);
+        created_ = false;
+        return true;
+    }
+
+    return false;
+}
+
+void HeadlessWindow::SetSize(const uint32_t width, const uint32_t height)
+{
+    width_  = width;
+    height_ = height;
+}
+
+bool HeadlessWindow::GetNativeHandle(HandleType type, void** handle)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(type);
+    GFXRECON_UNREFERENCED_PARAMETER(handle);
+
+    // There is no window system, so there are no native handles.
+    return false;
+}
+
+VkResult HeadlessWindow::CreateSurface(const encode::InstanceTable* table,
+                                       VkInstance                   instance,
+                                       VkFlags                      flags,
+                                       VkSurfaceKHR*                pSurface)
+{
+    VkHeadlessSurfaceCreateInfoEXT create_info{ VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT, nullptr, flags };
+
+    return table->CreateHeadlessSurfaceEXT(instance, &create_info, nullptr, pSurface);
+}
+
+HeadlessWindowFactory::HeadlessWindowFactory(HeadlessApplication* application) : headless_application_(application)
+{
+    assert(application != nullptr);
+}
+
+decode::Window*
+HeadlessWindowFactory::Create(const int32_t x, const int32_t y, const uint32_t width, const uint32_t height)
+{
+    auto window = new HeadlessWindow(headless_application_);
+    window->Create(headless_application_->GetName(), x, y, width, height);
+    return window;
+}
+
+void HeadlessWindowFactory::Destroy(decode::Window* window)
+{
+    if (window != nullptr)
+    {
+        window->Destroy();
+        delete window;
+    }
+}
+
+VkBool32 HeadlessWindowFactory::GetPhysicalDevicePresentationSupport(const encode::InstanceTable* table,
+                                                                     VkPhysicalDevice             physical_device,
+                                                                     uint32_t                     queue_family_index)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(table);
+    GFXRECON_UNREFERENCED_PARAMETER(physical_device);
+    GFXRECON_UNREFERENCED_PARAMETER(queue_family_index);
+
+    // Presentation is emulated by replay, so it is supported by all queue families.
+    return VK_TRUE;
+}
+
+GFXRECON_END_NAMESPACE(application)
+GFXRECON_END_NAMESPACE(gfxrecon)
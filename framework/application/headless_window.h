@@ -0,0 +1,96 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+
+#ifndef GFXRECON_APPLICATION_HEADLESS_WINDOW_H
+#define GFXRECON_APPLICATION_HEADLESS_WINDOW_H
+
+#include "application/headless_application.h"
+#include "decode/window.h"
+#include "util/defines.h"
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(application)
+
+// Window without a window system, with a VK_EXT_headless_surface surface.  Replay with a headless window replaces
+// swapchains with offscreen images, so the surface is only used for surface queries.
+class HeadlessWindow : public decode::Window
+{
+  public:
+    HeadlessWindow(HeadlessApplication* application);
+
+    virtual ~HeadlessWindow() override {}
+
+    uint32_t GetWidth() const { return width_; }
+
+    uint32_t GetHeight() const { return height_; }
+
+    virtual bool Create(const std::string& title,
+                        const int32_t      xpos,
+                        const int32_t      ypos,
+                        const uint32_t     width,
+                        const uint32_t     height) override;
+
+    virtual bool Destroy() override;
+
+    virtual void SetTitle(const std::string& title) override {}
+
+    virtual void SetPosition(const int32_t x, const int32_t y) override {}
+
+    virtual void SetSize(const uint32_t width, const uint32_t height) override;
+
+    virtual void SetVisibility(bool show) override {}
+
+    virtual void SetForeground() override {}
+
+    virtual bool GetNativeHandle(HandleType type, void** handle) override;
+
+    virtual VkResult CreateSurface(const encode::InstanceTable* table,
+                                   VkInstance                   instance,
+                                   VkFlags                      flags,
+                                   VkSurfaceKHR*                pSurface) override;
+
+  private:
+    HeadlessApplication* headless_application_;
+    uint32_t             width_;
+    uint32_t             height_;
+    bool                 created_;
+};
+
+class HeadlessWindowFactory : public decode::WindowFactory
+{
+  public:
+    HeadlessWindowFactory(HeadlessApplication* application);
+
+    virtual const char* GetSurfaceExtensionName() const override { return VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME; }
+
+    virtual decode::Window*
+    Create(const int32_t x, const int32_t y, const uint32_t width, const uint32_t height) override;
+
+    void Destroy(decode::Window* window) override;
+
+    virtual VkBool32 GetPhysicalDevicePresentationSupport(const encode::InstanceTable* table,
+                                                          VkPhysicalDevice             physical_device,
+                                                          uint32_t                     queue_family_index) override;
+
+  private:
+    HeadlessApplication* headless_application_;
+};
+
+GFXRECON_END_NAMESPACE(application)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_APPLICATION_HEADLESS_WINDOW_H
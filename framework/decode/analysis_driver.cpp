@@ -0,0 +1,92 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#include "decode/analysis_driver.h"
+
+#include "decode/fan_out_decoder.h"
+#include "generated/generated_vulkan_decoder.h"
+#include "util/logging.h"
+
+#include <memory>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+AnalysisDriver::AnalysisDriver(bool threaded, uint32_t decompression_thread_count) :
+    threaded_(threaded), decompression_thread_count_(decompression_thread_count), frame_count_(0), bytes_read_(0),
+    error_state_(FileProcessor::kErrorNone)
+{}
+
+bool AnalysisDriver::Process(const std::string& filename)
+{
+    FileProcessor file_processor;
+
+    frame_count_ = 0;
+    bytes_read_  = 0;
+
+    if (!file_processor.Initialize(filename))
+    {
+        error_state_ = file_processor.GetErrorState();
+        return false;
+    }
+
+    if (decompression_thread_count_ > 0)
+    {
+        file_processor.StartBlockPipeline(decompression_thread_count_);
+    }
+
+    if (threaded_ && (consumers_.size() > 1))
+    {
+        // The fan out decoder is declared after the decoders that it forwards to, so that its worker threads are
+        // joined before the decoders are destroyed.
+        std::vector<std::unique_ptr<VulkanDecoder>> decoders;
+        FanOutDecoder                               fan_out_decoder;
+
+        for (auto consumer : consumers_)
+        {
+            decoders.emplace_back(std::make_unique<VulkanDecoder>());
+            decoders.back()->AddConsumer(consumer);
+            fan_out_decoder.AddDecoder(decoders.back().get());
+        }
+
+        GFXRECON_LOG_INFO("Processing capture file with %zu consumer threads", consumers_.size());
+
+        file_processor.AddDecoder(&fan_out_decoder);
+        file_processor.ProcessAllFrames();
+        fan_out_decoder.Flush();
+    }
+    else
+    {
+        VulkanDecoder decoder;
+
+        for (auto consumer : consumers_)
+        {
+            decoder.AddConsumer(consumer);
+        }
+
+        file_processor.AddDecoder(&decoder);
+        file_processor.ProcessAllFrames();
+    }
+
+    frame_count_ = file_processor.GetCurrentFrameNumber();
+    bytes_read_  = file_processor.GetNumBytesRead();
+    error_state_ = file_processor.GetErrorState();
+
+    return (error_state_ == FileProcessor::kErrorNone);
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
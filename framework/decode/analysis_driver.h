@@ -0,0 +1,69 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#ifndef GFXRECON_DECODE_ANALYSIS_DRIVER_H
+#define GFXRECON_DECODE_ANALYSIS_DRIVER_H
+
+#include "decode/file_processor.h"
+#include "generated/generated_vulkan_consumer.h"
+#include "util/defines.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Processes a capture file with any number of consumers in a single pass over the file, so that a capture file that
+// is analyzed several ways is only read and decompressed once.  By default, all consumers are attached to one
+// VulkanDecoder and each block is decoded once, with the decoded call forwarded to every consumer in the order that
+// they were added.  With threaded processing, each consumer is attached to its own decoder and processes the blocks
+// on its own worker thread, so consumers with expensive processing, such as the ASCII converter, do not delay the
+// others; blocks are then decoded once for each consumer.
+class AnalysisDriver
+{
+  public:
+    // When decompression_thread_count is non-zero, compressed blocks are read ahead and decompressed by the specified
+    // number of worker threads.
+    AnalysisDriver(bool threaded = false, uint32_t decompression_thread_count = 0);
+
+    // Consumers must remain valid until Process returns.  Consumers are not processed concurrently with each other
+    // unless threaded processing is enabled, in which case they must not share state.
+    void AddConsumer(VulkanConsumer* consumer) { consumers_.push_back(consumer); }
+
+    // Returns false if processing failed.  Use GetErrorState() to determine the error condition for the failure case.
+    bool Process(const std::string& filename);
+
+    uint32_t GetFrameCount() const { return frame_count_; }
+
+    uint64_t GetNumBytesRead() const { return bytes_read_; }
+
+    FileProcessor::Error GetErrorState() const { return error_state_; }
+
+  private:
+    std::vector<VulkanConsumer*> consumers_;
+    bool                         threaded_;
+    uint32_t                     decompression_thread_count_;
+    uint32_t                     frame_count_;
+    uint64_t                     bytes_read_;
+    FileProcessor::Error         error_state_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_ANALYSIS_DRIVER_H
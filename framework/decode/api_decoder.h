@@ -41,6 +41,10 @@ class ApiDecoder
 
     virtual bool SupportsApiCall(format::ApiCallId id) = 0;
 
+    // Meta-data commands that are not supported by any decoder are skipped by the file processor without reading or
+    // decompressing their data.
+    virtual bool SupportsMetaDataCommand(format::MetaDataType meta_type) { return true; }
+
     virtual void DecodeFunctionCall(format::ApiCallId  id,
                                     const ApiCallInfo& call_info,
                                     const uint8_t*     buffer,
@@ -104,6 +108,26 @@ class ApiDecoder
 
     virtual void DispatchEndResourceInitCommand(format::ThreadId thread_id, format::HandleId device_id) = 0;
 
+    // Retrieve memory that the data for the next DispatchInitBufferCommand or DispatchInitImageCommand call can be read
+    // to directly, which is then provided as the data parameter of the dispatch call.  Decoders that retain or forward
+    // the data to more than one consumer return nullptr, to have the data read to memory managed by the file processor.
+    virtual uint8_t* GetInitBufferCommandData(format::ThreadId thread_id,
+                                              format::HandleId device_id,
+                                              format::HandleId buffer_id,
+                                              uint64_t         data_size)
+    {
+        return nullptr;
+    }
+
+    virtual uint8_t* GetInitImageCommandData(format::ThreadId thread_id,
+                                             format::HandleId device_id,
+                                             format::HandleId image_id,
+                                             uint64_t         data_size,
+                                             uint32_t         aspect)
+    {
+        return nullptr;
+    }
+
     virtual void DispatchInitBufferCommand(format::ThreadId thread_id,
                                            format::HandleId device_id,
                                            format::HandleId buffer_id,
@@ -0,0 +1,144 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#include "decode/block_index.h"
+
+#include "format/format_util.h"
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <cassert>
+#include <cinttypes>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+const char     kBlockIndexExtension[] = ".idx";
+const uint32_t kBlockIndexVersion     = 1;
+
+std::string GetBlockIndexFilename(const std::string& capture_filename)
+{
+    return capture_filename + kBlockIndexExtension;
+}
+
+uint32_t GetBlockIndexFrameCount(const std::vector<format::BlockIndexEntry>& block_index)
+{
+    for (auto entry = block_index.rbegin(); entry != block_index.rend(); ++entry)
+    {
+        if ((format::RemoveCompressedBlockBit(entry->block_type) != format::BlockType::kMetaDataBlock) ||
+            ((entry->block_id != format::MetaDataType::kFrameIndexCommand) &&
+             (entry->block_id != format::MetaDataType::kFrameIndexLocatorCommand)))
+        {
+            return entry->frame_number + 1;
+        }
+    }
+
+    return 0;
+}
+
+bool WriteBlockIndexFile(const std::string&                          filename,
+                         uint64_t                                    capture_file_size,
+                         const std::vector<format::BlockIndexEntry>& block_index)
+{
+    FILE*   file   = nullptr;
+    int32_t result = util::platform::FileOpen(&file, filename.c_str(), "wb");
+
+    if ((result != 0) || (file == nullptr))
+    {
+        GFXRECON_LOG_ERROR("Failed to open block index file %s for writing", filename.c_str());
+        return false;
+    }
+
+    format::BlockIndexFileHeader header;
+    header.fourcc            = GFXRECON_BLOCK_INDEX_FOURCC;
+    header.version           = kBlockIndexVersion;
+    header.capture_file_size = capture_file_size;
+    header.block_count       = block_index.size();
+    header.frame_count       = GetBlockIndexFrameCount(block_index);
+
+    size_t index_size = block_index.size() * sizeof(format::BlockIndexEntry);
+    bool   success    = (util::platform::FileWrite(&header, sizeof(header), 1, file) == 1);
+
+    if (success && (index_size > 0))
+    {
+        success = (util::platform::FileWrite(block_index.data(), index_size, 1, file) == 1);
+    }
+
+    util::platform::FileClose(file);
+
+    if (!success)
+    {
+        GFXRECON_LOG_ERROR("Failed to write block index file %s", filename.c_str());
+    }
+
+    return success;
+}
+
+bool ReadBlockIndexFile(const std::string&                    filename,
+                        uint64_t                              capture_file_size,
+                        std::vector<format::BlockIndexEntry>* block_index)
+{
+    assert(block_index != nullptr);
+
+    FILE*   file   = nullptr;
+    int32_t result = util::platform::FileOpen(&file, filename.c_str(), "rb");
+
+    if ((result != 0) || (file == nullptr))
+    {
+        return false;
+    }
+
+    format::BlockIndexFileHeader header;
+    bool                         success = false;
+
+    if ((util::platform::FileRead(&header, 1, sizeof(header), file) == sizeof(header)) &&
+        (header.fourcc == GFXRECON_BLOCK_INDEX_FOURCC) && (header.version == kBlockIndexVersion))
+    {
+        if (header.capture_file_size == capture_file_size)
+        {
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.block_count);
+
+            // Each block occupies at least a block header in the capture file, which bounds the entry count.
+            if (header.block_count <= (capture_file_size / sizeof(format::BlockHeader)))
+            {
+                size_t index_size = static_cast<size_t>(header.block_count) * sizeof(format::BlockIndexEntry);
+
+                block_index->resize(static_cast<size_t>(header.block_count));
+                success = (util::platform::FileRead(block_index->data(), 1, index_size, file) == index_size);
+            }
+        }
+        else
+        {
+            GFXRECON_LOG_WARNING("Ignoring block index file %s, which does not match the size of the capture file",
+                                 filename.c_str());
+            util::platform::FileClose(file);
+            return false;
+        }
+    }
+
+    if (!success)
+    {
+        block_index->clear();
+        GFXRECON_LOG_WARNING("Failed to read block index file %s", filename.c_str());
+    }
+
+    util::platform::FileClose(file);
+
+    return success;
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
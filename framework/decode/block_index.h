@@ -0,0 +1,50 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#ifndef GFXRECON_DECODE_BLOCK_INDEX_H
+#define GFXRECON_DECODE_BLOCK_INDEX_H
+
+#include "format/format.h"
+#include "util/defines.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Returns the name of the sidecar block index file for a capture file, which is the capture file name with an
+// additional extension.
+std::string GetBlockIndexFilename(const std::string& capture_filename);
+
+// Returns the number of frames described by a block index, excluding the frame index blocks that follow the last
+// frame.
+uint32_t GetBlockIndexFrameCount(const std::vector<format::BlockIndexEntry>& block_index);
+
+bool WriteBlockIndexFile(const std::string&                          filename,
+                         uint64_t                                    capture_file_size,
+                         const std::vector<format::BlockIndexEntry>& block_index);
+
+// Reads a block index file, which is rejected when it does not match the size of the capture file that it indexes.
+bool ReadBlockIndexFile(const std::string&                    filename,
+                        uint64_t                              capture_file_size,
+                        std::vector<format::BlockIndexEntry>* block_index);
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_BLOCK_INDEX_H
@@ -0,0 +1,361 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#include "decode/block_pipeline.h"
+
+#include "format/format_util.h"
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Limits for the amount of file data that the reader thread may read ahead of the block being processed.  A single
+// block that exceeds the size limit is always allowed.
+const size_t kMaxQueuedBlockSize  = 64 * 1024 * 1024;
+const size_t kMaxQueuedBlockCount = 4096;
+
+BlockPipeline::BlockPipeline() : queued_size_(0), stop_(false), end_of_file_(false), file_error_(false) {}
+
+BlockPipeline::~BlockPipeline()
+{
+    Stop();
+}
+
+bool BlockPipeline::Start(const std::string&      filename,
+                          uint64_t                file_offset,
+                          format::CompressionType compression_type,
+                          uint32_t                worker_count)
+{
+    Stop();
+
+    FILE*   file   = nullptr;
+    int32_t result = util::platform::FileOpen(&file, filename.c_str(), "rb");
+
+    if ((result != 0) || (file == nullptr))
+    {
+        GFXRECON_LOG_ERROR("Failed to open file %s for pipelined reads", filename.c_str());
+        return false;
+    }
+
+    if (!util::platform::FileSeek(file, static_cast<int64_t>(file_offset), util::platform::FileSeekSet))
+    {
+        GFXRECON_LOG_ERROR("Failed to seek file %s for pipelined reads", filename.c_str());
+        util::platform::FileClose(file);
+        return false;
+    }
+
+    stop_        = false;
+    end_of_file_ = false;
+    file_error_  = false;
+    queued_size_ = 0;
+
+    if (compression_type != format::CompressionType::kNone)
+    {
+        for (uint32_t i = 0; i < worker_count; ++i)
+        {
+            worker_threads_.emplace_back(&BlockPipeline::DecompressBlocks, this, compression_type);
+        }
+    }
+
+    reader_thread_ = std::thread(&BlockPipeline::ReadBlocks, this, file, file_offset);
+
+    return true;
+}
+
+void BlockPipeline::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+
+    reader_condition_.notify_all();
+    worker_condition_.notify_all();
+
+    if (reader_thread_.joinable())
+    {
+        reader_thread_.join();
+    }
+
+    for (auto& worker_thread : worker_threads_)
+    {
+        worker_thread.join();
+    }
+
+    worker_threads_.clear();
+    blocks_.clear();
+    pending_blocks_.clear();
+    current_block_.reset();
+    queued_size_ = 0;
+}
+
+const BlockPipeline::Block* BlockPipeline::GetNextBlock()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    current_block_.reset();
+
+    consumer_condition_.wait(lock, [this]() {
+        return (!blocks_.empty() && blocks_.front()->ready) || (blocks_.empty() && (end_of_file_ || file_error_));
+    });
+
+    if (blocks_.empty())
+    {
+        return nullptr;
+    }
+
+    current_block_ = blocks_.front();
+    blocks_.pop_front();
+
+    queued_size_ -= static_cast<size_t>(current_block_->file_size);
+
+    lock.unlock();
+    reader_condition_.notify_one();
+
+    return current_block_.get();
+}
+
+bool BlockPipeline::IsEndOfFile() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return (end_of_file_ && blocks_.empty());
+}
+
+bool BlockPipeline::IsFileError() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return (file_error_ && blocks_.empty());
+}
+
+void BlockPipeline::ReadBlocks(FILE* file, uint64_t file_offset)
+{
+    bool done = false;
+
+    while (!done)
+    {
+        format::BlockHeader block_header;
+        BlockPtr            block;
+
+        if (util::platform::FileRead(&block_header, 1, sizeof(block_header), file) == sizeof(block_header))
+        {
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+
+            size_t body_size = static_cast<size_t>(block_header.size);
+
+            block              = std::make_shared<Block>();
+            block->file_offset = file_offset;
+            block->ready       = true;
+            block->data.resize(sizeof(block_header) + body_size);
+
+            util::platform::MemoryCopy(block->data.data(), block->data.size(), &block_header, sizeof(block_header));
+
+            size_t bytes_read =
+                util::platform::FileRead(block->data.data() + sizeof(block_header), 1, body_size, file);
+
+            if (bytes_read != body_size)
+            {
+                // Incomplete block at end of file, which is provided to the consumer to report.
+                block->data.resize(sizeof(block_header) + bytes_read);
+                done = true;
+            }
+            else if (format::IsBlockCompressed(block_header.type) && !worker_threads_.empty())
+            {
+                block->ready = false;
+            }
+
+            block->file_size = block->data.size();
+            file_offset += block->file_size;
+        }
+        else
+        {
+            done = true;
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+
+            if (block)
+            {
+                reader_condition_.wait(lock, [this]() {
+                    return stop_ || blocks_.empty() ||
+                           ((queued_size_ < kMaxQueuedBlockSize) && (blocks_.size() < kMaxQueuedBlockCount));
+                });
+
+                if (stop_)
+                {
+                    break;
+                }
+
+                queued_size_ += static_cast<size_t>(block->file_size);
+                blocks_.push_back(block);
+
+                if (!block->ready)
+                {
+                    pending_blocks_.push_back(block);
+                    worker_condition_.notify_one();
+                }
+            }
+
+            if (done)
+            {
+                end_of_file_ = (feof(file) != 0);
+                file_error_  = !end_of_file_;
+            }
+        }
+
+        consumer_condition_.notify_one();
+    }
+
+    util::platform::FileClose(file);
+}
+
+void BlockPipeline::DecompressBlocks(format::CompressionType compression_type)
+{
+    std::unique_ptr<util::Compressor> compressor(format::CreateCompressor(compression_type));
+    std::vector<uint8_t>              compressed_data;
+
+    while (true)
+    {
+        BlockPtr block;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+
+            worker_condition_.wait(lock, [this]() { return stop_ || !pending_blocks_.empty(); });
+
+            if (stop_)
+            {
+                break;
+            }
+
+            block = pending_blocks_.front();
+            pending_blocks_.pop_front();
+        }
+
+        // Blocks that cannot be decompressed here are left in their compressed form, to be processed and reported by
+        // the consumer.
+        if (compressor != nullptr)
+        {
+            DecompressBlock(compressor.get(), block.get(), &compressed_data);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            block->ready = true;
+        }
+
+        consumer_condition_.notify_all();
+    }
+}
+
+bool BlockPipeline::DecompressBlock(util::Compressor* compressor, Block* block, std::vector<uint8_t>* compressed_data)
+{
+    assert((compressor != nullptr) && (block != nullptr) && (compressed_data != nullptr));
+
+    format::BlockHeader block_header;
+    const uint8_t*      data              = block->data.data();
+    size_t              data_size         = block->data.size();
+    size_t              prefix_size       = 0;
+    size_t              compressed_offset = 0;
+    uint64_t            uncompressed_size = 0;
+
+    util::platform::MemoryCopy(&block_header, sizeof(block_header), data, data_size);
+
+    format::BlockType block_type = format::RemoveCompressedBlockBit(block_header.type);
+
+    if (block_type == format::BlockType::kFunctionCallBlock)
+    {
+        // Compressed function call blocks have an uncompressed size field between the thread ID and the compressed
+        // parameter data, which is not present in the uncompressed block.
+        prefix_size       = sizeof(block_header) + sizeof(format::ApiCallId) + sizeof(format::ThreadId);
+        compressed_offset = prefix_size + sizeof(uncompressed_size);
+
+        if (data_size >= compressed_offset)
+        {
+            util::platform::MemoryCopy(
+                &uncompressed_size, sizeof(uncompressed_size), data + prefix_size, sizeof(uncompressed_size));
+        }
+    }
+    else if ((block_type == format::BlockType::kMetaDataBlock) && (data_size >= sizeof(format::MetaDataHeader)))
+    {
+        format::MetaDataHeader meta_header;
+        util::platform::MemoryCopy(&meta_header, sizeof(meta_header), data, sizeof(meta_header));
+
+        if ((meta_header.meta_data_type == format::MetaDataType::kFillMemoryCommand) &&
+            (data_size >= sizeof(format::FillMemoryCommandHeader)))
+        {
+            format::FillMemoryCommandHeader header;
+            util::platform::MemoryCopy(&header, sizeof(header), data, sizeof(header));
+
+            prefix_size       = sizeof(header);
+            uncompressed_size = header.memory_size;
+        }
+        else if ((meta_header.meta_data_type == format::MetaDataType::kInitBufferCommand) &&
+                 (data_size >= sizeof(format::InitBufferCommandHeader)))
+        {
+            format::InitBufferCommandHeader header;
+            util::platform::MemoryCopy(&header, sizeof(header), data, sizeof(header));
+
+            prefix_size       = sizeof(header);
+            uncompressed_size = header.data_size;
+        }
+        else if ((meta_header.meta_data_type == format::MetaDataType::kInitImageCommand) &&
+                 (data_size >= sizeof(format::InitImageCommandHeader)))
+        {
+            format::InitImageCommandHeader header;
+            util::platform::MemoryCopy(&header, sizeof(header), data, sizeof(header));
+
+            // The header is followed by the uncompressed mip level sizes.
+            prefix_size       = sizeof(header) + (header.level_count * sizeof(uint64_t));
+            uncompressed_size = header.data_size;
+        }
+
+        compressed_offset = prefix_size;
+    }
+
+    if ((prefix_size == 0) || (compressed_offset > data_size) || (uncompressed_size == 0))
+    {
+        return false;
+    }
+
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, uncompressed_size);
+
+    size_t compressed_size = data_size - compressed_offset;
+    compressed_data->assign(block->data.begin() + compressed_offset, block->data.end());
+    block->payload.resize(static_cast<size_t>(uncompressed_size));
+
+    if (compressor->Decompress(compressed_size, *compressed_data, block->payload.size(), &block->payload) !=
+        uncompressed_size)
+    {
+        block->payload.clear();
+        return false;
+    }
+
+    // Rewrite the block header to describe the uncompressed block.
+    block_header.type = block_type;
+    block_header.size = (prefix_size - sizeof(block_header)) + uncompressed_size;
+
+    block->data.resize(prefix_size);
+    util::platform::MemoryCopy(block->data.data(), block->data.size(), &block_header, sizeof(block_header));
+
+    return true;
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,106 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#ifndef GFXRECON_DECODE_BLOCK_PIPELINE_H
+#define GFXRECON_DECODE_BLOCK_PIPELINE_H
+
+#include "format/format.h"
+#include "util/compressor.h"
+#include "util/defines.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Reads capture file blocks ahead of the block currently being processed with a dedicated reader thread, and
+// decompresses compressed blocks with a pool of worker threads.  Blocks are retrieved in file order, with compressed
+// function call and meta-data blocks converted to their uncompressed form.
+class BlockPipeline
+{
+  public:
+    struct Block
+    {
+        std::vector<uint8_t> data;        // Block header and block body, excluding the payload of decompressed blocks.
+        std::vector<uint8_t> payload;     // Decompressed payload, which follows data when not empty.
+        uint64_t             file_offset; // Offset of the block header in the file.
+        uint64_t             file_size;   // Size of the block as stored in the file.
+        bool                 ready;       // Block has been read and, when necessary, decompressed.
+    };
+
+  public:
+    BlockPipeline();
+
+    ~BlockPipeline();
+
+    // Start reading blocks from the specified file offset, which must be the start of a block.
+    bool Start(const std::string&      filename,
+               uint64_t                file_offset,
+               format::CompressionType compression_type,
+               uint32_t                worker_count);
+
+    void Stop();
+
+    bool IsRunning() const { return reader_thread_.joinable(); }
+
+    // Waits for the next block in file order.  Returns nullptr when there are no more blocks, or when a file read error
+    // has occurred.  The returned block remains valid until the next call to GetNextBlock.
+    const Block* GetNextBlock();
+
+    bool IsEndOfFile() const;
+
+    bool IsFileError() const;
+
+    // Converts a compressed function call or meta-data block to its uncompressed form, with the rewritten block header
+    // and uncompressed fields in data and the decompressed data in payload.  Returns false and leaves the block
+    // unmodified when the block cannot be decompressed.
+    static bool DecompressBlock(util::Compressor* compressor, Block* block, std::vector<uint8_t>* compressed_data);
+
+  private:
+    void ReadBlocks(FILE* file, uint64_t file_offset);
+
+    void DecompressBlocks(format::CompressionType compression_type);
+
+  private:
+    typedef std::shared_ptr<Block> BlockPtr;
+
+    mutable std::mutex       mutex_;
+    std::condition_variable  reader_condition_;
+    std::condition_variable  worker_condition_;
+    std::condition_variable  consumer_condition_;
+    std::thread              reader_thread_;
+    std::vector<std::thread> worker_threads_;
+    std::deque<BlockPtr>     blocks_;
+    std::deque<BlockPtr>     pending_blocks_;
+    BlockPtr                 current_block_;
+    size_t                   queued_size_;
+    bool                     stop_;
+    bool                     end_of_file_;
+    bool                     file_error_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_BLOCK_PIPELINE_H
@@ -0,0 +1,390 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#include "decode/block_statistics.h"
+
+#include "decode/file_processor.h"
+#include "format/format_util.h"
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
+#include <limits>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+const format::ApiCallId kDrawCalls[] = { format::ApiCallId::ApiCall_vkCmdDraw,
+                                         format::ApiCallId::ApiCall_vkCmdDrawIndexed,
+                                         format::ApiCallId::ApiCall_vkCmdDrawIndirect,
+                                         format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirect,
+                                         format::ApiCallId::ApiCall_vkCmdDrawIndirectCount,
+                                         format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCount,
+                                         format::ApiCallId::ApiCall_vkCmdDrawIndirectCountKHR,
+                                         format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountKHR,
+                                         format::ApiCallId::ApiCall_vkCmdDrawIndirectByteCountEXT,
+                                         format::ApiCallId::ApiCall_vkCmdDrawIndirectCountAMD,
+                                         format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountAMD,
+                                         format::ApiCallId::ApiCall_vkCmdDrawMeshTasksNV,
+                                         format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectNV,
+                                         format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectCountNV };
+
+const format::ApiCallId kDispatchCalls[] = { format::ApiCallId::ApiCall_vkCmdDispatch,
+                                             format::ApiCallId::ApiCall_vkCmdDispatchIndirect,
+                                             format::ApiCallId::ApiCall_vkCmdDispatchBase,
+                                             format::ApiCallId::ApiCall_vkCmdDispatchBaseKHR };
+
+bool BlockStatistics::Scan(const std::string& filename)
+{
+    FileProcessor file_processor;
+
+    if (!file_processor.Initialize(filename))
+    {
+        return false;
+    }
+
+    // The sidecar block index, which is loaded automatically when it matches the capture file, provides the same
+    // information without reading the capture file.
+    if (file_processor.HasBlockIndex() && !collect_memory_fills_)
+    {
+        for (const auto& entry : file_processor.GetBlockIndex())
+        {
+            AddBlock(entry);
+        }
+
+        return true;
+    }
+
+    if (collect_memory_fills_)
+    {
+        return file_processor.ScanBlocks(
+            [this](const format::BlockIndexEntry& entry) { AddBlock(entry); },
+            [this](const format::BlockIndexEntry& entry, const format::FillMemoryCommandHeader& header) {
+                AddMemoryFill(entry, header);
+            });
+    }
+
+    return file_processor.ScanBlocks([this](const format::BlockIndexEntry& entry) { AddBlock(entry); });
+}
+
+void BlockStatistics::AddBlock(const format::BlockIndexEntry& entry)
+{
+    format::BlockType block_type = format::RemoveCompressedBlockBit(entry.block_type);
+
+    AddCounts(entry, &total_counts_);
+    AddCounts(entry, &block_type_counts_[block_type]);
+
+    if (block_type == format::BlockType::kFunctionCallBlock)
+    {
+        AddCounts(entry, &api_call_counts_[static_cast<format::ApiCallId>(entry.block_id)]);
+        ++thread_call_counts_[entry.thread_id];
+    }
+    else if (block_type == format::BlockType::kMetaDataBlock)
+    {
+        AddCounts(entry, &meta_data_counts_[static_cast<format::MetaDataType>(entry.block_id)]);
+    }
+
+    // The frame index follows the last frame, and is not counted as part of a frame.
+    if ((block_type != format::BlockType::kMetaDataBlock) ||
+        ((entry.block_id != format::MetaDataType::kFrameIndexCommand) &&
+         (entry.block_id != format::MetaDataType::kFrameIndexLocatorCommand)))
+    {
+        // Blocks are accumulated until the frame delimiter that completes the frame is reached.  Blocks that follow
+        // the last frame delimiter remain in the trailing counts, and are not reported as an additional frame.
+        AddCounts(entry, &trailing_counts_);
+
+        if ((block_type == format::BlockType::kFunctionCallBlock) &&
+            format::IsFrameDelimiter(static_cast<format::ApiCallId>(entry.block_id)))
+        {
+            frame_counts_.push_back(trailing_counts_);
+            trailing_counts_ = BlockCounts();
+            frame_count_     = static_cast<uint32_t>(frame_counts_.size());
+        }
+    }
+}
+
+void BlockStatistics::AddMemoryFill(const format::BlockIndexEntry& entry, const format::FillMemoryCommandHeader& header)
+{
+    MemoryFillCounts& counts = memory_fill_counts_[header.memory_id];
+
+    ++counts.count;
+    counts.stored_size += entry.block_size;
+    counts.fill_size += header.memory_size;
+}
+
+uint64_t BlockStatistics::GetApiCallCount(format::ApiCallId call_id) const
+{
+    auto entry = api_call_counts_.find(call_id);
+    if (entry != api_call_counts_.end())
+    {
+        return entry->second.count;
+    }
+
+    return 0;
+}
+
+uint64_t BlockStatistics::GetDrawCount() const
+{
+    uint64_t count = 0;
+
+    for (auto call_id : kDrawCalls)
+    {
+        count += GetApiCallCount(call_id);
+    }
+
+    return count;
+}
+
+uint64_t BlockStatistics::GetDispatchCount() const
+{
+    uint64_t count = 0;
+
+    for (auto call_id : kDispatchCalls)
+    {
+        count += GetApiCallCount(call_id);
+    }
+
+    return count;
+}
+
+std::vector<BlockStatistics::FrameSizeBucket> BlockStatistics::GetFrameSizeHistogram() const
+{
+    std::vector<FrameSizeBucket> histogram;
+
+    if (frame_counts_.empty())
+    {
+        return histogram;
+    }
+
+    // Frames are assigned to the bucket of the most significant bit of their size, with empty frames assigned to the
+    // first bucket.
+    auto get_bucket = [](uint64_t size) {
+        uint32_t bucket = 0;
+        while (size > 1)
+        {
+            size >>= 1;
+            ++bucket;
+        }
+        return bucket;
+    };
+
+    uint32_t first_bucket = std::numeric_limits<uint32_t>::max();
+    uint32_t last_bucket  = 0;
+
+    for (const auto& frame : frame_counts_)
+    {
+        uint32_t bucket = get_bucket(frame.stored_size);
+        first_bucket    = std::min(first_bucket, bucket);
+        last_bucket     = std::max(last_bucket, bucket);
+    }
+
+    histogram.resize(last_bucket - first_bucket + 1);
+
+    for (uint32_t i = first_bucket; i <= last_bucket; ++i)
+    {
+        FrameSizeBucket& bucket = histogram[i - first_bucket];
+        bucket.min_size         = (i == 0) ? 0 : (static_cast<uint64_t>(1) << i);
+        bucket.max_size =
+            (i == 63) ? std::numeric_limits<uint64_t>::max() : ((static_cast<uint64_t>(1) << (i + 1)) - 1);
+    }
+
+    for (const auto& frame : frame_counts_)
+    {
+        ++histogram[get_bucket(frame.stored_size) - first_bucket].frame_count;
+    }
+
+    return histogram;
+}
+
+std::vector<std::pair<format::HandleId, BlockStatistics::MemoryFillCounts>>
+BlockStatistics::GetLargestMemoryFills(size_t max_count) const
+{
+    std::vector<std::pair<format::HandleId, MemoryFillCounts>> fills(memory_fill_counts_.begin(),
+                                                                     memory_fill_counts_.end());
+
+    // Memory IDs with the same fill size are listed in order of increasing ID, so that the order is deterministic.
+    auto compare = [](const std::pair<format::HandleId, MemoryFillCounts>& lhs,
+                      const std::pair<format::HandleId, MemoryFillCounts>& rhs) {
+        return (lhs.second.fill_size > rhs.second.fill_size) ||
+               ((lhs.second.fill_size == rhs.second.fill_size) && (lhs.first < rhs.first));
+    };
+
+    if (fills.size() > max_count)
+    {
+        std::partial_sort(fills.begin(), fills.begin() + max_count, fills.end(), compare);
+        fills.resize(max_count);
+    }
+    else
+    {
+        std::sort(fills.begin(), fills.end(), compare);
+    }
+
+    return fills;
+}
+
+bool BlockStatistics::WriteJsonReport(const std::string& filename, size_t max_memory_count) const
+{
+    FILE*   file   = nullptr;
+    int32_t result = util::platform::FileOpen(&file, filename.c_str(), "w");
+
+    if ((result != 0) || (file == nullptr))
+    {
+        GFXRECON_LOG_ERROR("Failed to open file %s for the capture composition report", filename.c_str());
+        return false;
+    }
+
+    WriteJsonReport(file, max_memory_count);
+
+    bool success = (ferror(file) == 0);
+    util::platform::FileClose(file);
+
+    if (!success)
+    {
+        GFXRECON_LOG_ERROR("Failed to write the capture composition report to file %s", filename.c_str());
+    }
+
+    return success;
+}
+
+void BlockStatistics::AddCounts(const format::BlockIndexEntry& entry, BlockCounts* counts)
+{
+    assert(counts != nullptr);
+
+    ++counts->count;
+    counts->stored_size += entry.block_size;
+    counts->uncompressed_size += entry.uncompressed_size;
+}
+
+void BlockStatistics::WriteJsonReport(FILE* file, size_t max_memory_count) const
+{
+    auto write_counts = [file](const BlockCounts& counts) {
+        fprintf(file,
+                "\"count\": %" PRIu64 ", \"stored_bytes\": %" PRIu64 ", \"uncompressed_bytes\": %" PRIu64,
+                counts.count,
+                counts.stored_size,
+                counts.uncompressed_size);
+    };
+
+    fprintf(file, "{\n");
+    fprintf(file, "  \"frame_count\": %u,\n", frame_count_);
+    fprintf(file, "  \"trailing_blocks\": { ");
+    write_counts(trailing_counts_);
+    fprintf(file, " },\n");
+    fprintf(file, "  \"total\": { ");
+    write_counts(total_counts_);
+    fprintf(file, " },\n");
+
+    fprintf(file, "  \"block_types\": [\n");
+    size_t index = 0;
+    for (const auto& entry : block_type_counts_)
+    {
+        fprintf(file, "    { \"name\": \"%s\", ", format::GetBlockTypeName(entry.first));
+        write_counts(entry.second);
+        fprintf(file, " }%s\n", (++index < block_type_counts_.size()) ? "," : "");
+    }
+    fprintf(file, "  ],\n");
+
+    // API calls are listed in order of decreasing stored size.
+    std::vector<std::pair<format::ApiCallId, BlockCounts>> calls(api_call_counts_.begin(), api_call_counts_.end());
+    std::stable_sort(calls.begin(), calls.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.second.stored_size > rhs.second.stored_size;
+    });
+
+    fprintf(file, "  \"api_calls\": [\n");
+    for (size_t i = 0; i < calls.size(); ++i)
+    {
+        fprintf(file,
+                "    { \"name\": \"%s\", \"id\": %u, ",
+                format::GetApiCallName(calls[i].first),
+                static_cast<uint32_t>(calls[i].first));
+        write_counts(calls[i].second);
+        fprintf(file, " }%s\n", (i + 1 < calls.size()) ? "," : "");
+    }
+    fprintf(file, "  ],\n");
+
+    fprintf(file, "  \"meta_data\": [\n");
+    index = 0;
+    for (const auto& entry : meta_data_counts_)
+    {
+        fprintf(file,
+                "    { \"name\": \"%s\", \"id\": %u, ",
+                format::GetMetaDataTypeName(entry.first),
+                static_cast<uint32_t>(entry.first));
+        write_counts(entry.second);
+        fprintf(file, " }%s\n", (++index < meta_data_counts_.size()) ? "," : "");
+    }
+    fprintf(file, "  ],\n");
+
+    std::vector<FrameSizeBucket> histogram = GetFrameSizeHistogram();
+
+    fprintf(file, "  \"frame_size_histogram\": [\n");
+    for (size_t i = 0; i < histogram.size(); ++i)
+    {
+        fprintf(file,
+                "    { \"min_bytes\": %" PRIu64 ", \"max_bytes\": %" PRIu64 ", \"frames\": %" PRIu64 " }%s\n",
+                histogram[i].min_size,
+                histogram[i].max_size,
+                histogram[i].frame_count,
+                (i + 1 < histogram.size()) ? "," : "");
+    }
+    fprintf(file, "  ],\n");
+
+    fprintf(file, "  \"frames\": [\n");
+    for (size_t i = 0; i < frame_counts_.size(); ++i)
+    {
+        fprintf(file, "    { \"frame\": %zu, ", i);
+        write_counts(frame_counts_[i]);
+        fprintf(file, " }%s\n", (i + 1 < frame_counts_.size()) ? "," : "");
+    }
+    fprintf(file, "  ],\n");
+
+    auto fills = GetLargestMemoryFills(max_memory_count);
+
+    fprintf(file, "  \"memory_fills\": {\n");
+    fprintf(file, "    \"memory_count\": %zu,\n", memory_fill_counts_.size());
+    fprintf(file, "    \"largest\": [\n");
+    for (size_t i = 0; i < fills.size(); ++i)
+    {
+        fprintf(file,
+                "      { \"memory_id\": %" PRIu64 ", \"count\": %" PRIu64 ", \"stored_bytes\": %" PRIu64
+                ", \"fill_bytes\": %" PRIu64 " }%s\n",
+                fills[i].first,
+                fills[i].second.count,
+                fills[i].second.stored_size,
+                fills[i].second.fill_size,
+                (i + 1 < fills.size()) ? "," : "");
+    }
+    fprintf(file, "    ]\n");
+    fprintf(file, "  },\n");
+
+    fprintf(file, "  \"threads\": [\n");
+    index = 0;
+    for (const auto& entry : thread_call_counts_)
+    {
+        fprintf(file,
+                "    { \"thread_id\": %" PRIu64 ", \"calls\": %" PRIu64 " }%s\n",
+                entry.first,
+                entry.second,
+                (++index < thread_call_counts_.size()) ? "," : "");
+    }
+    fprintf(file, "  ]\n");
+    fprintf(file, "}\n");
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,143 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#ifndef GFXRECON_DECODE_BLOCK_STATISTICS_H
+#define GFXRECON_DECODE_BLOCK_STATISTICS_H
+
+#include "format/api_call_id.h"
+#include "format/format.h"
+#include "util/defines.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Capture file statistics that are aggregated from block headers, without reading or decompressing block data.  The
+// statistics are collected from the sidecar block index of a capture file when one is available, or by scanning the
+// block headers of the capture file.
+class BlockStatistics
+{
+  public:
+    struct BlockCounts
+    {
+        uint64_t count{ 0 };
+        uint64_t stored_size{ 0 };       // Size of the block bodies, as stored in the file.
+        uint64_t uncompressed_size{ 0 }; // Size of the block bodies after decompression.
+    };
+
+    struct MemoryFillCounts
+    {
+        uint64_t count{ 0 };
+        uint64_t stored_size{ 0 }; // Size of the fill memory block bodies, as stored in the file.
+        uint64_t fill_size{ 0 };   // Number of bytes written to the memory object.
+    };
+
+    // Frame size histogram bucket, for frames with stored sizes in the range [min_size, max_size].
+    struct FrameSizeBucket
+    {
+        uint64_t min_size{ 0 };
+        uint64_t max_size{ 0 };
+        uint64_t frame_count{ 0 };
+    };
+
+  public:
+    // Fill memory statistics require the fill memory command headers, which are not part of the sidecar block index, so
+    // the capture file is always scanned when they are collected.
+    BlockStatistics(bool collect_memory_fills = false) : collect_memory_fills_(collect_memory_fills) {}
+
+    // Returns false if the capture file could not be opened or an error occurred while reading block headers.
+    bool Scan(const std::string& filename);
+
+    void AddBlock(const format::BlockIndexEntry& entry);
+
+    // Adds a fill memory or fill memory reference command, which has already been added with AddBlock.
+    void AddMemoryFill(const format::BlockIndexEntry& entry, const format::FillMemoryCommandHeader& header);
+
+    // The number of complete frames, which are the frames that end with a frame delimiter.
+    uint32_t GetFrameCount() const { return frame_count_; }
+
+    // Counts for the blocks that follow the last frame delimiter, excluding the frame index blocks.  These blocks do
+    // not form a complete frame, and are not included in the frame counts or the frame size histogram.
+    const BlockCounts& GetTrailingCounts() const { return trailing_counts_; }
+
+    const BlockCounts& GetTotalCounts() const { return total_counts_; }
+
+    // Counts by block type, with compressed and uncompressed blocks of the same type counted together.
+    const std::map<format::BlockType, BlockCounts>& GetBlockTypeCounts() const { return block_type_counts_; }
+
+    const std::map<format::ApiCallId, BlockCounts>& GetApiCallCounts() const { return api_call_counts_; }
+
+    const std::map<format::MetaDataType, BlockCounts>& GetMetaDataCounts() const { return meta_data_counts_; }
+
+    // Counts for each complete frame, indexed by frame number.
+    const std::vector<BlockCounts>& GetFrameCounts() const { return frame_counts_; }
+
+    // Fill memory counts by memory ID, which are only available when memory fills are collected.
+    const std::unordered_map<format::HandleId, MemoryFillCounts>& GetMemoryFillCounts() const
+    {
+        return memory_fill_counts_;
+    }
+
+    // Function call counts by capture thread ID.
+    const std::map<format::ThreadId, uint64_t>& GetThreadCallCounts() const { return thread_call_counts_; }
+
+    uint64_t GetApiCallCount(format::ApiCallId call_id) const;
+
+    // Recorded draw and dispatch commands, which do not reflect the number of commands that are executed when a command
+    // buffer is submitted more than once.
+    uint64_t GetDrawCount() const;
+
+    uint64_t GetDispatchCount() const;
+
+    // Returns a histogram of the stored frame sizes, with power of two bucket sizes ranging from the bucket for the
+    // smallest frame to the bucket for the largest frame.
+    std::vector<FrameSizeBucket> GetFrameSizeHistogram() const;
+
+    // Returns up to max_count memory IDs, in order of decreasing fill size.
+    std::vector<std::pair<format::HandleId, MemoryFillCounts>> GetLargestMemoryFills(size_t max_count) const;
+
+    // Writes the statistics to a JSON file, listing the memory IDs with the max_memory_count largest fill sizes.
+    bool WriteJsonReport(const std::string& filename, size_t max_memory_count) const;
+
+  private:
+    static void AddCounts(const format::BlockIndexEntry& entry, BlockCounts* counts);
+
+    void WriteJsonReport(FILE* file, size_t max_memory_count) const;
+
+  private:
+    bool                                                   collect_memory_fills_;
+    uint32_t                                               frame_count_{ 0 };
+    BlockCounts                                            total_counts_;
+    std::map<format::BlockType, BlockCounts>               block_type_counts_;
+    std::map<format::ApiCallId, BlockCounts>               api_call_counts_;
+    std::map<format::MetaDataType, BlockCounts>            meta_data_counts_;
+    std::vector<BlockCounts>                               frame_counts_;
+    BlockCounts                                            trailing_counts_;
+    std::unordered_map<format::HandleId, MemoryFillCounts> memory_fill_counts_;
+    std::map<format::ThreadId, uint64_t>                   thread_call_counts_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_BLOCK_STATISTICS_H
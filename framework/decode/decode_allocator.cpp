@@ -0,0 +1,126 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#include "decode/decode_allocator.h"
+
+#include <algorithm>
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Size of the blocks that small allocations are made from.  Allocations that are larger than the block size are made
+// from a dedicated block.
+const size_t kBlockSize = 64 * 1024;
+
+// Blocks are retained for reuse by the next call, up to this limit, so that memory used by a rare call with very large
+// parameter data is not kept for the remainder of the replay.
+const size_t kMaxRetainedSize = 4 * 1024 * 1024;
+
+const size_t kAllocationAlignment = alignof(std::max_align_t);
+
+thread_local DecodeAllocator* DecodeAllocator::active_allocator_ = nullptr;
+
+DecodeAllocator::DecodeAllocator() : current_block_(0), block_offset_(0), previous_allocator_(nullptr) {}
+
+DecodeAllocator::~DecodeAllocator()
+{
+    assert(active_allocator_ != this);
+}
+
+void DecodeAllocator::Begin()
+{
+    previous_allocator_ = active_allocator_;
+    active_allocator_   = this;
+}
+
+void DecodeAllocator::End()
+{
+    assert(active_allocator_ == this);
+
+    Reset();
+
+    active_allocator_   = previous_allocator_;
+    previous_allocator_ = nullptr;
+}
+
+void* DecodeAllocator::Allocate(size_t size)
+{
+    size = (size + (kAllocationAlignment - 1)) & ~(kAllocationAlignment - 1);
+
+    while (current_block_ < blocks_.size())
+    {
+        Block& block = blocks_[current_block_];
+
+        if (size <= (block.size - block_offset_))
+        {
+            void* data = block.data.get() + block_offset_;
+            block_offset_ += size;
+            return data;
+        }
+
+        ++current_block_;
+        block_offset_ = 0;
+    }
+
+    Block block;
+    block.size = std::max(size, kBlockSize);
+    block.data.reset(new uint8_t[block.size]);
+
+    blocks_.emplace_back(std::move(block));
+
+    current_block_ = blocks_.size() - 1;
+    block_offset_  = size;
+
+    return blocks_.back().data.get();
+}
+
+bool DecodeAllocator::Contains(const void* data) const
+{
+    const uint8_t* address = reinterpret_cast<const uint8_t*>(data);
+
+    for (size_t i = 0; (i <= current_block_) && (i < blocks_.size()); ++i)
+    {
+        const Block& block = blocks_[i];
+
+        if ((address >= block.data.get()) && (address < (block.data.get() + block.size)))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void DecodeAllocator::Reset()
+{
+    size_t retained_size = 0;
+    size_t retained_end  = 0;
+
+    while ((retained_end < blocks_.size()) && ((retained_size + blocks_[retained_end].size) <= kMaxRetainedSize))
+    {
+        retained_size += blocks_[retained_end].size;
+        ++retained_end;
+    }
+
+    blocks_.resize(retained_end);
+
+    current_block_ = 0;
+    block_offset_  = 0;
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
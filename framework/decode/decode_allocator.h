@@ -0,0 +1,133 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#ifndef GFXRECON_DECODE_DECODE_ALLOCATOR_H
+#define GFXRECON_DECODE_DECODE_ALLOCATOR_H
+
+#include "util/defines.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Arena for the memory used to decode the parameters of a single API call.  Memory is allocated from large blocks by
+// advancing an offset, and is released all at once when the call has been processed.  While an allocator is active
+// for a thread, the pointer decoders allocate their decoded data from it.  When no allocator is active, the pointer
+// decoders fall back to heap allocations.
+class DecodeAllocator
+{
+  public:
+    DecodeAllocator();
+
+    ~DecodeAllocator();
+
+    // Make the allocator the source of decode memory for the calling thread.
+    void Begin();
+
+    // Release all memory allocated since the call to Begin, and deactivate the allocator for the calling thread.  All
+    // objects allocated from the allocator must have been destroyed.
+    void End();
+
+    // Allocate and default initialize an array of objects, from the active allocator when there is one.
+    template <typename T>
+    static T* AllocateArray(size_t len)
+    {
+        DecodeAllocator* allocator = active_allocator_;
+
+        if (allocator == nullptr)
+        {
+            return new T[len];
+        }
+
+        T* data = reinterpret_cast<T*>(allocator->Allocate(len * sizeof(T)));
+
+        for (size_t i = 0; i < len; ++i)
+        {
+            new (&data[i]) T;
+        }
+
+        return data;
+    }
+
+    // Destroy an array of objects that was allocated with AllocateArray.  The memory for arrays that were allocated
+    // from the active allocator is released when the allocator is reset.
+    template <typename T>
+    static void FreeArray(T* data, size_t len)
+    {
+        DecodeAllocator* allocator = active_allocator_;
+
+        if ((allocator == nullptr) || !allocator->Contains(data))
+        {
+            delete[] data;
+        }
+        else if (!std::is_trivially_destructible<T>::value)
+        {
+            for (size_t i = 0; i < len; ++i)
+            {
+                data[i].~T();
+            }
+        }
+    }
+
+    // Object allocation functions for use by class specific operator new and operator delete overloads.
+    static void* AllocateObject(size_t size)
+    {
+        DecodeAllocator* allocator = active_allocator_;
+        return (allocator != nullptr) ? allocator->Allocate(size) : ::operator new(size);
+    }
+
+    static void FreeObject(void* data)
+    {
+        DecodeAllocator* allocator = active_allocator_;
+
+        if ((allocator == nullptr) || !allocator->Contains(data))
+        {
+            ::operator delete(data);
+        }
+    }
+
+  private:
+    struct Block
+    {
+        std::unique_ptr<uint8_t[]> data;
+        size_t                     size;
+    };
+
+    void* Allocate(size_t size);
+
+    bool Contains(const void* data) const;
+
+    void Reset();
+
+  private:
+    static thread_local DecodeAllocator* active_allocator_;
+
+    std::vector<Block> blocks_;
+    size_t             current_block_;
+    size_t             block_offset_;
+    DecodeAllocator*   previous_allocator_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_DECODE_ALLOCATOR_H
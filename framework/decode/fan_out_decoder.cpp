@@ -0,0 +1,410 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#include "decode/fan_out_decoder.h"
+
+#include "util/logging.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Limit for the number of tasks that may be queued for the worker threads before the calling thread waits.  A block
+// that is queued for more than one worker is counted once for each worker.
+const size_t kMaxPendingTasks = 16384;
+
+FanOutDecoder::FanOutDecoder() : pending_tasks_(0), stop_(false) {}
+
+FanOutDecoder::~FanOutDecoder()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+
+    // Workers process their remaining tasks before exiting.
+    for (auto& worker : workers_)
+    {
+        worker->condition.notify_one();
+    }
+
+    for (auto& worker : workers_)
+    {
+        worker->thread.join();
+    }
+}
+
+void FanOutDecoder::AddDecoder(ApiDecoder* decoder)
+{
+    assert(decoder != nullptr);
+
+    std::unique_ptr<Worker> worker = std::make_unique<Worker>();
+    Worker*                 result = worker.get();
+
+    worker->decoder = decoder;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    worker->thread = std::thread(&FanOutDecoder::ProcessTasks, this, result);
+    workers_.emplace_back(std::move(worker));
+}
+
+void FanOutDecoder::Flush()
+{
+    std::exception_ptr error;
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        idle_condition_.wait(lock, [this]() { return pending_tasks_ == 0; });
+        std::swap(error, error_);
+    }
+
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+bool FanOutDecoder::SupportsApiCall(format::ApiCallId call_id)
+{
+    for (const auto& worker : workers_)
+    {
+        if (worker->decoder->SupportsApiCall(call_id))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool FanOutDecoder::SupportsMetaDataCommand(format::MetaDataType meta_type)
+{
+    for (const auto& worker : workers_)
+    {
+        if (worker->decoder->SupportsMetaDataCommand(meta_type))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void FanOutDecoder::DecodeFunctionCall(format::ApiCallId  call_id,
+                                       const ApiCallInfo& call_info,
+                                       const uint8_t*     parameter_buffer,
+                                       size_t             buffer_size)
+{
+    QueueTask(call_id,
+              [call_id, call_info, parameter_data = std::vector<uint8_t>(parameter_buffer,
+                                                                         parameter_buffer + buffer_size)](
+                  ApiDecoder* decoder) {
+                  decoder->DecodeFunctionCall(call_id, call_info, parameter_data.data(), parameter_data.size());
+              });
+}
+
+void FanOutDecoder::DispatchStateBeginMarker(uint64_t frame_number)
+{
+    QueueTask(format::ApiCallId::ApiCall_Unknown,
+              [frame_number](ApiDecoder* decoder) { decoder->DispatchStateBeginMarker(frame_number); });
+}
+
+void FanOutDecoder::DispatchStateEndMarker(uint64_t frame_number)
+{
+    QueueTask(format::ApiCallId::ApiCall_Unknown,
+              [frame_number](ApiDecoder* decoder) { decoder->DispatchStateEndMarker(frame_number); });
+}
+
+void FanOutDecoder::DispatchDisplayMessageCommand(format::ThreadId thread_id, const std::string& message)
+{
+    QueueTask(format::ApiCallId::ApiCall_Unknown, [thread_id, message](ApiDecoder* decoder) {
+        decoder->DispatchDisplayMessageCommand(thread_id, message);
+    });
+}
+
+void FanOutDecoder::DispatchFillMemoryCommand(
+    format::ThreadId thread_id, uint64_t memory_id, uint64_t offset, uint64_t size, const uint8_t* data)
+{
+    QueueTask(format::ApiCallId::ApiCall_Unknown,
+              [thread_id, memory_id, offset, size, fill_data = std::vector<uint8_t>(data, data + size)](
+                  ApiDecoder* decoder) {
+                  decoder->DispatchFillMemoryCommand(thread_id, memory_id, offset, size, fill_data.data());
+              });
+}
+
+void FanOutDecoder::DispatchResizeWindowCommand(format::ThreadId thread_id,
+                                                format::HandleId surface_id,
+                                                uint32_t         width,
+                                                uint32_t         height)
+{
+    QueueTask(format::ApiCallId::ApiCall_Unknown, [thread_id, surface_id, width, height](ApiDecoder* decoder) {
+        decoder->DispatchResizeWindowCommand(thread_id, surface_id, width, height);
+    });
+}
+
+void FanOutDecoder::DispatchCreateHardwareBufferCommand(format::ThreadId                                    thread_id,
+                                                        format::HandleId                                    memory_id,
+                                                        uint64_t                                            buffer_id,
+                                                        uint32_t                                            format,
+                                                        uint32_t                                            width,
+                                                        uint32_t                                            height,
+                                                        uint32_t                                            stride,
+                                                        uint32_t                                            usage,
+                                                        uint32_t                                            layers,
+                                                        const std::vector<format::HardwareBufferPlaneInfo>& plane_info)
+{
+    QueueTask(format::ApiCallId::ApiCall_Unknown,
+              [thread_id, memory_id, buffer_id, format, width, height, stride, usage, layers, plane_info](
+                  ApiDecoder* decoder) {
+                  decoder->DispatchCreateHardwareBufferCommand(
+                      thread_id, memory_id, buffer_id, format, width, height, stride, usage, layers, plane_info);
+              });
+}
+
+void FanOutDecoder::DispatchDestroyHardwareBufferCommand(format::ThreadId thread_id, uint64_t buffer_id)
+{
+    QueueTask(format::ApiCallId::ApiCall_Unknown, [thread_id, buffer_id](ApiDecoder* decoder) {
+        decoder->DispatchDestroyHardwareBufferCommand(thread_id, buffer_id);
+    });
+}
+
+void FanOutDecoder::DispatchSetDevicePropertiesCommand(format::ThreadId   thread_id,
+                                                       format::HandleId   physical_device_id,
+                                                       uint32_t           api_version,
+                                                       uint32_t           driver_version,
+                                                       uint32_t           vendor_id,
+                                                       uint32_t           device_id,
+                                                       uint32_t           device_type,
+                                                       const uint8_t      pipeline_cache_uuid[format::kUuidSize],
+                                                       const std::string& device_name)
+{
+    std::array<uint8_t, format::kUuidSize> uuid;
+    std::copy(pipeline_cache_uuid, pipeline_cache_uuid + format::kUuidSize, uuid.begin());
+
+    QueueTask(format::ApiCallId::ApiCall_Unknown,
+              [thread_id,
+               physical_device_id,
+               api_version,
+               driver_version,
+               vendor_id,
+               device_id,
+               device_type,
+               uuid,
+               device_name](ApiDecoder* decoder) {
+                  decoder->DispatchSetDevicePropertiesCommand(thread_id,
+                                                              physical_device_id,
+                                                              api_version,
+                                                              driver_version,
+                                                              vendor_id,
+                                                              device_id,
+                                                              device_type,
+                                                              uuid.data(),
+                                                              device_name);
+              });
+}
+
+void FanOutDecoder::DispatchSetDeviceMemoryPropertiesCommand(
+    format::ThreadId                             thread_id,
+    format::HandleId                             physical_device_id,
+    const std::vector<format::DeviceMemoryType>& memory_types,
+    const std::vector<format::DeviceMemoryHeap>& memory_heaps)
+{
+    QueueTask(format::ApiCallId::ApiCall_Unknown,
+              [thread_id, physical_device_id, memory_types, memory_heaps](ApiDecoder* decoder) {
+                  decoder->DispatchSetDeviceMemoryPropertiesCommand(
+                      thread_id, physical_device_id, memory_types, memory_heaps);
+              });
+}
+
+void FanOutDecoder::DispatchSetSwapchainImageStateCommand(
+    format::ThreadId                                    thread_id,
+    format::HandleId                                    device_id,
+    format::HandleId                                    swapchain_id,
+    uint32_t                                            last_presented_image,
+    const std::vector<format::SwapchainImageStateInfo>& image_state)
+{
+    QueueTask(format::ApiCallId::ApiCall_Unknown,
+              [thread_id, device_id, swapchain_id, last_presented_image, image_state](ApiDecoder* decoder) {
+                  decoder->DispatchSetSwapchainImageStateCommand(
+                      thread_id, device_id, swapchain_id, last_presented_image, image_state);
+              });
+}
+
+void FanOutDecoder::DispatchBeginResourceInitCommand(format::ThreadId thread_id,
+                                                     format::HandleId device_id,
+                                                     uint64_t         max_resource_size,
+                                                     uint64_t         max_copy_size)
+{
+    QueueTask(format::ApiCallId::ApiCall_Unknown,
+              [thread_id, device_id, max_resource_size, max_copy_size](ApiDecoder* decoder) {
+                  decoder->DispatchBeginResourceInitCommand(thread_id, device_id, max_resource_size, max_copy_size);
+              });
+}
+
+void FanOutDecoder::DispatchEndResourceInitCommand(format::ThreadId thread_id, format::HandleId device_id)
+{
+    QueueTask(format::ApiCallId::ApiCall_Unknown, [thread_id, device_id](ApiDecoder* decoder) {
+        decoder->DispatchEndResourceInitCommand(thread_id, device_id);
+    });
+}
+
+void FanOutDecoder::DispatchInitBufferCommand(format::ThreadId thread_id,
+                                              format::HandleId device_id,
+                                              format::HandleId buffer_id,
+                                              uint64_t         data_size,
+                                              const uint8_t*   data)
+{
+    QueueTask(format::ApiCallId::ApiCall_Unknown,
+              [thread_id, device_id, buffer_id, data_size, init_data = std::vector<uint8_t>(data, data + data_size)](
+                  ApiDecoder* decoder) {
+                  decoder->DispatchInitBufferCommand(thread_id, device_id, buffer_id, data_size, init_data.data());
+              });
+}
+
+void FanOutDecoder::DispatchInitImageCommand(format::ThreadId             thread_id,
+                                             format::HandleId             device_id,
+                                             format::HandleId             image_id,
+                                             uint64_t                     data_size,
+                                             uint32_t                     aspect,
+                                             uint32_t                     layout,
+                                             const std::vector<uint64_t>& level_sizes,
+                                             const uint8_t*               data)
+{
+    // Image data is optional, and is null when the image was not initialized by the application.
+    std::vector<uint8_t> init_data;
+    if (data != nullptr)
+    {
+        init_data.assign(data, data + data_size);
+    }
+
+    QueueTask(format::ApiCallId::ApiCall_Unknown,
+              [thread_id,
+               device_id,
+               image_id,
+               data_size,
+               aspect,
+               layout,
+               level_sizes,
+               init_data = std::move(init_data)](ApiDecoder* decoder) {
+                  decoder->DispatchInitImageCommand(thread_id,
+                                                    device_id,
+                                                    image_id,
+                                                    data_size,
+                                                    aspect,
+                                                    layout,
+                                                    level_sizes,
+                                                    init_data.empty() ? nullptr : init_data.data());
+              });
+}
+
+void FanOutDecoder::QueueTask(format::ApiCallId call_id, Task&& task)
+{
+    std::vector<Worker*> targets;
+
+    for (const auto& worker : workers_)
+    {
+        if ((call_id == format::ApiCallId::ApiCall_Unknown) || worker->decoder->SupportsApiCall(call_id))
+        {
+            targets.push_back(worker.get());
+        }
+    }
+
+    if (targets.empty())
+    {
+        return;
+    }
+
+    auto shared_task = std::make_shared<const Task>(std::move(task));
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        idle_condition_.wait(lock, [this]() { return pending_tasks_ < kMaxPendingTasks; });
+
+        for (auto worker : targets)
+        {
+            worker->tasks.push_back(shared_task);
+        }
+
+        pending_tasks_ += targets.size();
+    }
+
+    for (auto worker : targets)
+    {
+        worker->condition.notify_one();
+    }
+}
+
+void FanOutDecoder::ProcessTasks(Worker* worker)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (true)
+    {
+        worker->condition.wait(lock, [this, worker]() { return stop_ || !worker->tasks.empty(); });
+
+        if (worker->tasks.empty())
+        {
+            // Stop was requested and all queued tasks have been processed.
+            break;
+        }
+
+        std::shared_ptr<const Task> task = std::move(worker->tasks.front());
+        worker->tasks.pop_front();
+
+        // Tasks that follow a failed task are discarded, as the error will end processing when it is rethrown by Flush.
+        bool discard = static_cast<bool>(error_);
+
+        lock.unlock();
+
+        if (!discard)
+        {
+            try
+            {
+                (*task)(worker->decoder);
+            }
+            catch (...)
+            {
+                lock.lock();
+                if (!error_)
+                {
+                    error_ = std::current_exception();
+                }
+                lock.unlock();
+            }
+        }
+
+        // Release the shared task data before updating the pending count, so that Flush does not return while the data
+        // is still referenced by a worker.
+        task.reset();
+
+        lock.lock();
+
+        --pending_tasks_;
+
+        if ((pending_tasks_ == 0) || (pending_tasks_ == (kMaxPendingTasks - 1)))
+        {
+            idle_condition_.notify_one();
+        }
+    }
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
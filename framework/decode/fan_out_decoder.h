@@ -0,0 +1,170 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#ifndef GFXRECON_DECODE_FAN_OUT_DECODER_H
+#define GFXRECON_DECODE_FAN_OUT_DECODER_H
+
+#include "decode/api_decoder.h"
+#include "format/api_call_id.h"
+#include "format/format.h"
+#include "util/defines.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Decoder that forwards each block to a set of decoders, with each decoder processing blocks on its own worker thread.
+// The data for a block is copied once, to a reference counted task that is shared by the queues of every worker, so
+// a capture file that is processed by several independent decoders is only read and decompressed once.  Each worker
+// processes its blocks in capture file order, but there is no ordering between workers, so the decoders and the
+// consumers attached to them must not share state.
+class FanOutDecoder : public ApiDecoder
+{
+  public:
+    FanOutDecoder();
+
+    virtual ~FanOutDecoder() override;
+
+    // Adds a decoder and starts its worker thread.  Decoders must be added before processing starts.
+    void AddDecoder(ApiDecoder* decoder);
+
+    // Waits for the worker threads to process all queued blocks.  Exceptions thrown while processing blocks on a worker
+    // thread are rethrown by Flush.
+    void Flush();
+
+    virtual bool SupportsApiCall(format::ApiCallId call_id) override;
+
+    virtual bool SupportsMetaDataCommand(format::MetaDataType meta_type) override;
+
+    virtual void DecodeFunctionCall(format::ApiCallId  call_id,
+                                    const ApiCallInfo& call_info,
+                                    const uint8_t*     parameter_buffer,
+                                    size_t             buffer_size) override;
+
+    virtual void DispatchStateBeginMarker(uint64_t frame_number) override;
+
+    virtual void DispatchStateEndMarker(uint64_t frame_number) override;
+
+    virtual void DispatchDisplayMessageCommand(format::ThreadId thread_id, const std::string& message) override;
+
+    virtual void DispatchFillMemoryCommand(
+        format::ThreadId thread_id, uint64_t memory_id, uint64_t offset, uint64_t size, const uint8_t* data) override;
+
+    virtual void DispatchResizeWindowCommand(format::ThreadId thread_id,
+                                             format::HandleId surface_id,
+                                             uint32_t         width,
+                                             uint32_t         height) override;
+
+    virtual void
+    DispatchCreateHardwareBufferCommand(format::ThreadId                                    thread_id,
+                                        format::HandleId                                    memory_id,
+                                        uint64_t                                            buffer_id,
+                                        uint32_t                                            format,
+                                        uint32_t                                            width,
+                                        uint32_t                                            height,
+                                        uint32_t                                            stride,
+                                        uint32_t                                            usage,
+                                        uint32_t                                            layers,
+                                        const std::vector<format::HardwareBufferPlaneInfo>& plane_info) override;
+
+    virtual void DispatchDestroyHardwareBufferCommand(format::ThreadId thread_id, uint64_t buffer_id) override;
+
+    virtual void DispatchSetDevicePropertiesCommand(format::ThreadId   thread_id,
+                                                    format::HandleId   physical_device_id,
+                                                    uint32_t           api_version,
+                                                    uint32_t           driver_version,
+                                                    uint32_t           vendor_id,
+                                                    uint32_t           device_id,
+                                                    uint32_t           device_type,
+                                                    const uint8_t      pipeline_cache_uuid[format::kUuidSize],
+                                                    const std::string& device_name) override;
+
+    virtual void
+    DispatchSetDeviceMemoryPropertiesCommand(format::ThreadId                             thread_id,
+                                             format::HandleId                             physical_device_id,
+                                             const std::vector<format::DeviceMemoryType>& memory_types,
+                                             const std::vector<format::DeviceMemoryHeap>& memory_heaps) override;
+
+    virtual void
+    DispatchSetSwapchainImageStateCommand(format::ThreadId                                    thread_id,
+                                          format::HandleId                                    device_id,
+                                          format::HandleId                                    swapchain_id,
+                                          uint32_t                                            last_presented_image,
+                                          const std::vector<format::SwapchainImageStateInfo>& image_state) override;
+
+    virtual void DispatchBeginResourceInitCommand(format::ThreadId thread_id,
+                                                  format::HandleId device_id,
+                                                  uint64_t         max_resource_size,
+                                                  uint64_t         max_copy_size) override;
+
+    virtual void DispatchEndResourceInitCommand(format::ThreadId thread_id, format::HandleId device_id) override;
+
+    virtual void DispatchInitBufferCommand(format::ThreadId thread_id,
+                                           format::HandleId device_id,
+                                           format::HandleId buffer_id,
+                                           uint64_t         data_size,
+                                           const uint8_t*   data) override;
+
+    virtual void DispatchInitImageCommand(format::ThreadId             thread_id,
+                                          format::HandleId             device_id,
+                                          format::HandleId             image_id,
+                                          uint64_t                     data_size,
+                                          uint32_t                     aspect,
+                                          uint32_t                     layout,
+                                          const std::vector<uint64_t>& level_sizes,
+                                          const uint8_t*               data) override;
+
+  private:
+    typedef std::function<void(ApiDecoder*)> Task;
+
+    struct Worker
+    {
+        ApiDecoder*                             decoder{ nullptr };
+        std::thread                             thread;
+        std::deque<std::shared_ptr<const Task>> tasks;
+        std::condition_variable                 condition;
+    };
+
+  private:
+    // Queues a task for every worker.  Function call tasks are only queued for the workers with decoders that support
+    // the call; meta-data command tasks, which are queued with ApiCall_Unknown, are queued for all workers.
+    void QueueTask(format::ApiCallId call_id, Task&& task);
+
+    void ProcessTasks(Worker* worker);
+
+  private:
+    std::mutex                           mutex_;
+    std::condition_variable              idle_condition_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::exception_ptr                   error_;
+    size_t                               pending_tasks_;
+    bool                                 stop_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_FAN_OUT_DECODER_H
@@ -16,25 +16,41 @@
 */
 
 #include "decode/file_processor.h"
+#include "decode/block_index.h"
 
 #include "format/format_util.h"
 #include "util/compressor.h"
+#include "util/file_path.h"
 #include "util/logging.h"
 #include "util/platform.h"
 
 #include <cassert>
+#include <cinttypes>
 #include <numeric>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+// Maximum amount of referenced fill memory data to retain, to avoid re-reading frequently referenced data from the file.
+const size_t kMaxFillMemoryCacheSize = 64 * 1024 * 1024;
+
+// Amount of memory mapped file data to request from the OS ahead of the current read position.
+const size_t kMappedFilePrefetchSize = 16 * 1024 * 1024;
+
 FileProcessor::FileProcessor() :
     file_header_{}, file_descriptor_(nullptr), current_frame_number_(0), bytes_read_(0),
-    error_state_(kErrorInvalidFileDescriptor), compressor_(nullptr)
+    error_state_(kErrorInvalidFileDescriptor), compressor_(nullptr), file_offset_(0), next_prefetch_offset_(0),
+    end_of_file_(false), file_size_(0), pipeline_block_(nullptr), pipeline_block_offset_(0),
+    pipeline_thread_count_(0), preload_offset_(0), fill_memory_cache_size_(0)
 {}
 
 FileProcessor::~FileProcessor()
 {
+    if (block_pipeline_ != nullptr)
+    {
+        block_pipeline_->Stop();
+    }
+
     if (nullptr != compressor_)
     {
         delete compressor_;
@@ -55,15 +71,43 @@ bool FileProcessor::Initialize(const std::string& filename)
 
     if ((result == 0) && (file_descriptor_ != nullptr))
     {
+        // Read through a memory mapping of the file when possible, falling back to the file descriptor when the file
+        // cannot be mapped (e.g. it is not a regular file).
+        if (!mapped_file_.Open(filename))
+        {
+            GFXRECON_LOG_DEBUG("File %s could not be memory mapped; using buffered file reads", filename.c_str());
+        }
+
+        if (mapped_file_.IsOpen())
+        {
+            file_size_ = mapped_file_.GetFileSize();
+        }
+        else if (util::platform::FileSeek(file_descriptor_, 0, util::platform::FileSeekEnd))
+        {
+            int64_t file_size = util::platform::FileTell(file_descriptor_);
+            file_size_        = (file_size > 0) ? static_cast<uint64_t>(file_size) : 0;
+            util::platform::FileSeek(file_descriptor_, 0, util::platform::FileSeekSet);
+        }
+
         success = ProcessFileHeader();
 
         if (success)
         {
             filename_    = filename;
             error_state_ = kErrorNone;
+
+            if (!LoadFrameIndex())
+            {
+                GFXRECON_LOG_DEBUG("File %s does not contain a frame index", filename.c_str());
+            }
+
+            // A sidecar block index, which is created for existing files by the gfxrecon-index tool, also provides a
+            // frame index when the file does not contain one.
+            LoadBlockIndex();
         }
         else
         {
+            mapped_file_.Close();
             fclose(file_descriptor_);
             file_descriptor_ = nullptr;
         }
@@ -77,6 +121,35 @@ bool FileProcessor::Initialize(const std::string& filename)
     return success;
 }
 
+bool FileProcessor::StartBlockPipeline(uint32_t decompression_thread_count)
+{
+    if ((file_descriptor_ == nullptr) || (block_pipeline_ != nullptr) ||
+        (enabled_options_.compression_type == format::CompressionType::kNone) || (decompression_thread_count == 0))
+    {
+        return false;
+    }
+
+    int64_t offset = TellFile();
+
+    if (offset >= 0)
+    {
+        block_pipeline_ = std::make_unique<BlockPipeline>();
+
+        if (block_pipeline_->Start(filename_,
+                                   static_cast<uint64_t>(offset),
+                                   enabled_options_.compression_type,
+                                   decompression_thread_count))
+        {
+            pipeline_thread_count_ = decompression_thread_count;
+            return true;
+        }
+
+        block_pipeline_.reset();
+    }
+
+    return false;
+}
+
 bool FileProcessor::ProcessNextFrame()
 {
     bool success = IsFileValid();
@@ -92,7 +165,7 @@ bool FileProcessor::ProcessNextFrame()
         {
             error_state_ = kErrorInvalidFileDescriptor;
         }
-        else if (ferror(file_descriptor_))
+        else if (IsFileError())
         {
             error_state_ = kErrorReadingFile;
         }
@@ -113,6 +186,112 @@ bool FileProcessor::ProcessAllFrames()
     return (error_state_ == kErrorNone);
 }
 
+bool FileProcessor::SeekToFrame(uint32_t frame_number)
+{
+    if ((file_descriptor_ == nullptr) || (frame_number >= frame_index_.size()))
+    {
+        GFXRECON_LOG_ERROR("Failed to seek to frame %u: the file does not contain a frame index entry for the frame",
+                           frame_number);
+        return false;
+    }
+
+    int64_t offset = static_cast<int64_t>(frame_index_[frame_number].block_offset);
+
+    // Preloaded blocks that have not been processed are discarded.
+    std::vector<uint8_t>().swap(preload_data_);
+    preload_offset_ = 0;
+
+    if (block_pipeline_ != nullptr)
+    {
+        // Blocks that were read ahead of the previous position are discarded by restarting the pipeline.
+        pipeline_block_        = nullptr;
+        pipeline_block_offset_ = 0;
+
+        if (!block_pipeline_->Start(
+                filename_, static_cast<uint64_t>(offset), enabled_options_.compression_type, pipeline_thread_count_))
+        {
+            block_pipeline_.reset();
+        }
+    }
+
+    if (!SeekFile(offset))
+    {
+        GFXRECON_LOG_ERROR("Failed to seek to frame %u at file offset %" PRId64, frame_number, offset);
+        return false;
+    }
+
+    current_frame_number_ = frame_number;
+
+    return true;
+}
+
+bool FileProcessor::PreloadFrames(uint32_t frame_count, bool decompress)
+{
+    if ((file_descriptor_ == nullptr) || IsPreloadActive())
+    {
+        return false;
+    }
+
+    // Blocks are read through the normal read path, which retrieves blocks that were already decompressed by the
+    // block pipeline when it is active.  The data is accumulated in a separate buffer, as the read path reads from the
+    // preload buffer when it is not empty.
+    std::vector<uint8_t>  data;
+    BlockPipeline::Block  block;
+    std::vector<uint8_t>  compressed_data;
+    format::BlockHeader   block_header;
+    uint32_t              preloaded_frames = 0;
+    bool                  success          = true;
+
+    preload_data_.clear();
+    preload_offset_ = 0;
+
+    while (success && (preloaded_frames < frame_count) && ReadBlockHeader(&block_header))
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+
+        size_t body_size = static_cast<size_t>(block_header.size);
+
+        block.data.resize(sizeof(block_header) + body_size);
+        block.payload.clear();
+        util::platform::MemoryCopy(block.data.data(), block.data.size(), &block_header, sizeof(block_header));
+
+        success = ReadBytes(block.data.data() + sizeof(block_header), body_size);
+
+        if (success)
+        {
+            if (decompress && (compressor_ != nullptr) && format::IsBlockCompressed(block_header.type))
+            {
+                BlockPipeline::DecompressBlock(compressor_, &block, &compressed_data);
+            }
+
+            format::ApiCallId call_id = format::ApiCallId::ApiCall_Unknown;
+
+            if ((format::RemoveCompressedBlockBit(block_header.type) == format::BlockType::kFunctionCallBlock) &&
+                (block.data.size() >= (sizeof(block_header) + sizeof(call_id))))
+            {
+                util::platform::MemoryCopy(
+                    &call_id, sizeof(call_id), block.data.data() + sizeof(block_header), sizeof(call_id));
+
+                if (format::IsFrameDelimiter(call_id))
+                {
+                    ++preloaded_frames;
+                }
+            }
+
+            data.insert(data.end(), block.data.begin(), block.data.end());
+            data.insert(data.end(), block.payload.begin(), block.payload.end());
+        }
+        else
+        {
+            HandleBlockReadError(kErrorReadingBlockData, "Failed to read block data while preloading frames");
+        }
+    }
+
+    preload_data_ = std::move(data);
+
+    return success && (preloaded_frames == frame_count);
+}
+
 bool FileProcessor::ProcessFileHeader()
 {
     bool success = false;
@@ -171,6 +350,323 @@ bool FileProcessor::ProcessFileHeader()
     return success;
 }
 
+bool FileProcessor::LoadFrameIndex()
+{
+    format::FrameIndexLocatorCommand locator;
+    format::FrameIndexCommandHeader  index_header;
+    int64_t                          start_offset   = TellFile();
+    int64_t                          locator_offset = static_cast<int64_t>(file_size_ - sizeof(locator));
+    bool                             success        = false;
+
+    // The locator is the last block of the file, and references the index block that immediately precedes it.
+    if ((start_offset >= 0) && (locator_offset > start_offset) && SeekFile(locator_offset) &&
+        (ReadFileData(&locator, sizeof(locator)) == sizeof(locator)) &&
+        (locator.meta_header.block_header.type == format::BlockType::kMetaDataBlock) &&
+        (locator.meta_header.meta_data_type == format::MetaDataType::kFrameIndexLocatorCommand) &&
+        (locator.fourcc == GFXRECON_FRAME_INDEX_FOURCC) &&
+        (locator.index_offset >= static_cast<uint64_t>(start_offset)) &&
+        (locator.index_offset < static_cast<uint64_t>(locator_offset)) &&
+        SeekFile(static_cast<int64_t>(locator.index_offset)) &&
+        (ReadFileData(&index_header, sizeof(index_header)) == sizeof(index_header)) &&
+        (index_header.meta_header.block_header.type == format::BlockType::kMetaDataBlock) &&
+        (index_header.meta_header.meta_data_type == format::MetaDataType::kFrameIndexCommand))
+    {
+        uint64_t index_size = static_cast<uint64_t>(locator_offset) - locator.index_offset;
+
+        // Validate the entry counts against the size of the index before allocating storage for the entries.
+        if ((index_header.meta_header.block_header.size + sizeof(format::BlockHeader) == index_size) &&
+            (index_header.frame_count <= (index_size / sizeof(format::FrameIndexEntry))) &&
+            (index_header.state_marker_count <= (index_size / sizeof(format::StateMarkerIndexEntry))) &&
+            ((sizeof(index_header) + (index_header.frame_count * sizeof(format::FrameIndexEntry)) +
+              (index_header.state_marker_count * sizeof(format::StateMarkerIndexEntry))) == index_size))
+        {
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, index_header.frame_count);
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, index_header.state_marker_count);
+
+            size_t frame_index_size = static_cast<size_t>(index_header.frame_count) * sizeof(format::FrameIndexEntry);
+            size_t state_marker_index_size =
+                static_cast<size_t>(index_header.state_marker_count) * sizeof(format::StateMarkerIndexEntry);
+
+            frame_index_.resize(static_cast<size_t>(index_header.frame_count));
+            state_marker_index_.resize(static_cast<size_t>(index_header.state_marker_count));
+
+            success = (ReadFileData(frame_index_.data(), frame_index_size) == frame_index_size) &&
+                      (ReadFileData(state_marker_index_.data(), state_marker_index_size) == state_marker_index_size);
+        }
+        else
+        {
+            GFXRECON_LOG_WARNING("Ignoring frame index with invalid size");
+        }
+    }
+
+    if (!success)
+    {
+        frame_index_.clear();
+        state_marker_index_.clear();
+    }
+
+    // Restore the read position to the first block after the file header.
+    if (!mapped_file_.IsOpen())
+    {
+        clearerr(file_descriptor_);
+    }
+
+    SeekFile(start_offset);
+
+    return success;
+}
+
+bool FileProcessor::LoadBlockIndex()
+{
+    std::string index_filename = GetBlockIndexFilename(filename_);
+
+    if (!util::filepath::Exists(index_filename) || !ReadBlockIndexFile(index_filename, file_size_, &block_index_))
+    {
+        return false;
+    }
+
+    if (frame_index_.empty())
+    {
+        int64_t start_offset = TellFile();
+
+        for (const auto& entry : block_index_)
+        {
+            format::BlockType block_type = format::RemoveCompressedBlockBit(entry.block_type);
+
+            if ((block_type == format::BlockType::kMetaDataBlock) &&
+                ((entry.block_id == format::MetaDataType::kFrameIndexCommand) ||
+                 (entry.block_id == format::MetaDataType::kFrameIndexLocatorCommand)))
+            {
+                continue;
+            }
+
+            if (entry.frame_number >= frame_index_.size())
+            {
+                frame_index_.push_back({ entry.block_offset, 0 });
+            }
+
+            ++frame_index_.back().block_count;
+
+            if (block_type == format::BlockType::kStateMarkerBlock)
+            {
+                // The block index does not store the frame number recorded by the marker, which is read from the file.
+                format::Marker marker;
+                if (SeekFile(static_cast<int64_t>(entry.block_offset)) &&
+                    (ReadFileData(&marker, sizeof(marker)) == sizeof(marker)))
+                {
+                    state_marker_index_.push_back({ entry.block_offset, marker.frame_number, marker.marker_type });
+                }
+            }
+        }
+
+        SeekFile(start_offset);
+    }
+
+    return true;
+}
+
+bool FileProcessor::BuildBlockIndex(std::vector<format::BlockIndexEntry>* block_index)
+{
+    assert(block_index != nullptr);
+
+    return ScanBlocks([block_index](const format::BlockIndexEntry& entry) { block_index->push_back(entry); });
+}
+
+bool FileProcessor::ScanBlocks(const BlockScanCallback& callback, const FillMemoryScanCallback& fill_memory_callback)
+{
+    if ((file_descriptor_ == nullptr) || (block_pipeline_ != nullptr))
+    {
+        return false;
+    }
+
+    format::BlockHeader block_header;
+    uint32_t            frame_number = current_frame_number_;
+    bool                success      = true;
+
+    while (success)
+    {
+        int64_t block_offset = TellFile();
+
+        success = ReadBlockHeader(&block_header);
+
+        if (success)
+        {
+            format::BlockIndexEntry         entry;
+            format::FillMemoryCommandHeader fill_memory_header;
+            format::BlockType               block_type       = format::RemoveCompressedBlockBit(block_header.type);
+            size_t                          body_read        = 0;
+            bool                            compressed       = format::IsBlockCompressed(block_header.type);
+            bool                            read_fill_memory = false;
+
+            entry.block_offset      = static_cast<uint64_t>(block_offset);
+            entry.block_size        = block_header.size;
+            entry.uncompressed_size = block_header.size;
+            entry.thread_id         = 0;
+            entry.frame_number      = frame_number;
+            entry.block_type        = block_header.type;
+            entry.block_id          = 0;
+
+            // Only the fixed size fields at the start of each block are read; compressed data is skipped.
+            if (block_type == format::BlockType::kFunctionCallBlock)
+            {
+                format::CompressedFunctionCallHeader header;
+                size_t header_size = compressed ? sizeof(header) : sizeof(format::FunctionCallHeader);
+
+                success = ReadBlockFields(block_header, &header, header_size, &body_read);
+
+                if (success)
+                {
+                    entry.block_id  = header.api_call_id;
+                    entry.thread_id = header.thread_id;
+
+                    if (compressed)
+                    {
+                        entry.uncompressed_size =
+                            sizeof(header.api_call_id) + sizeof(header.thread_id) + header.uncompressed_size;
+                    }
+
+                    if (format::IsFrameDelimiter(header.api_call_id))
+                    {
+                        ++frame_number;
+                    }
+                }
+            }
+            else if (block_type == format::BlockType::kMetaDataBlock)
+            {
+                // The meta-data commands with compressed data share the same initial fields.
+                union
+                {
+                    format::FillMemoryCommandHeader fill_memory;
+                    format::InitBufferCommandHeader init_buffer;
+                    format::InitImageCommandHeader  init_image;
+                } header;
+
+                success = ReadBlockFields(block_header, &header, sizeof(format::MetaDataHeader), &body_read);
+
+                if (success)
+                {
+                    format::MetaDataType meta_type = header.fill_memory.meta_header.meta_data_type;
+                    size_t thread_id_size = sizeof(format::MetaDataHeader) + sizeof(header.fill_memory.thread_id);
+
+                    entry.block_id = meta_type;
+
+                    // All meta-data commands other than the frame index start with a thread ID.
+                    if ((meta_type != format::MetaDataType::kFrameIndexCommand) &&
+                        (meta_type != format::MetaDataType::kFrameIndexLocatorCommand) &&
+                        ReadBlockFields(block_header, &header, thread_id_size, &body_read))
+                    {
+                        entry.thread_id = header.fill_memory.thread_id;
+                    }
+
+                    bool fill_memory = (meta_type == format::MetaDataType::kFillMemoryCommand) ||
+                                       (meta_type == format::MetaDataType::kFillMemoryReferenceCommand);
+
+                    if (fill_memory && (compressed || (fill_memory_callback != nullptr)))
+                    {
+                        success = ReadBlockFields(block_header, &header, sizeof(header.fill_memory), &body_read);
+
+                        if (success)
+                        {
+                            fill_memory_header = header.fill_memory;
+                            read_fill_memory   = true;
+
+                            if (compressed && (meta_type == format::MetaDataType::kFillMemoryCommand))
+                            {
+                                entry.uncompressed_size = (sizeof(header.fill_memory) - sizeof(format::BlockHeader)) +
+                                                          header.fill_memory.memory_size;
+                            }
+                        }
+                    }
+                    else if (compressed && (meta_type == format::MetaDataType::kInitBufferCommand))
+                    {
+                        success = ReadBlockFields(block_header, &header, sizeof(header.init_buffer), &body_read);
+                        entry.uncompressed_size = (sizeof(header.init_buffer) - sizeof(format::BlockHeader)) +
+                                                  header.init_buffer.data_size;
+                    }
+                    else if (compressed && (meta_type == format::MetaDataType::kInitImageCommand))
+                    {
+                        // The header is followed by the uncompressed mip level sizes.
+                        success = ReadBlockFields(block_header, &header, sizeof(header.init_image), &body_read);
+                        entry.uncompressed_size = (sizeof(header.init_image) - sizeof(format::BlockHeader)) +
+                                                  (header.init_image.level_count * sizeof(uint64_t)) +
+                                                  header.init_image.data_size;
+                    }
+                }
+            }
+            else if (block_type == format::BlockType::kStateMarkerBlock)
+            {
+                format::Marker marker;
+
+                success = ReadBlockFields(
+                    block_header, &marker, sizeof(marker.header) + sizeof(marker.marker_type), &body_read);
+
+                if (success)
+                {
+                    entry.block_id = marker.marker_type;
+                }
+            }
+
+            if (success)
+            {
+                GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+
+                callback(entry);
+
+                if (read_fill_memory && (fill_memory_callback != nullptr))
+                {
+                    fill_memory_callback(entry, fill_memory_header);
+                }
+
+                success = SkipBytes(static_cast<size_t>(block_header.size) - body_read);
+            }
+
+            if (!success)
+            {
+                HandleBlockReadError(kErrorReadingBlockData, "Failed to read block while scanning block headers");
+            }
+        }
+        else if (!IsEndOfFile())
+        {
+            GFXRECON_LOG_ERROR("Failed to read block header");
+            error_state_ = kErrorReadingBlockHeader;
+        }
+    }
+
+    return (error_state_ == kErrorNone);
+}
+
+bool FileProcessor::ReadBlockFields(const format::BlockHeader& block_header,
+                                    void*                      header,
+                                    size_t                     header_size,
+                                    size_t*                    body_read)
+{
+    assert((header != nullptr) && (body_read != nullptr));
+
+    // Reads the fields of a block header struct that follow the fields that have already been read from the block.
+    size_t header_offset = sizeof(block_header) + (*body_read);
+
+    if (header_size <= header_offset)
+    {
+        return true;
+    }
+
+    size_t read_size = header_size - header_offset;
+
+    if (((*body_read) + read_size) > block_header.size)
+    {
+        return false;
+    }
+
+    if (!ReadBytes(reinterpret_cast<uint8_t*>(header) + header_offset, read_size))
+    {
+        return false;
+    }
+
+    (*body_read) += read_size;
+
+    return true;
+}
+
 bool FileProcessor::ProcessBlocks()
 {
     format::BlockHeader block_header;
@@ -193,7 +689,7 @@ bool FileProcessor::ProcessBlocks()
                     success = ProcessFunctionCall(block_header, api_call_id);
 
                     // Break from loop on frame delimiter.
-                    if (IsFrameDelimiter(api_call_id))
+                    if (format::IsFrameDelimiter(api_call_id))
                     {
                         // Make sure to increment the frame number on the way out.
                         ++current_frame_number_;
@@ -211,134 +707,508 @@ bool FileProcessor::ProcessBlocks()
 
                 success = ReadBytes(&meta_type, sizeof(meta_type));
 
-                if (success)
-                {
-                    success = ProcessMetaData(block_header, meta_type);
-                }
-                else
-                {
-                    HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read meta-data block header");
-                }
-            }
-            else if (block_header.type == format::BlockType::kStateMarkerBlock)
-            {
-                format::MarkerType marker_type  = format::MarkerType::kUnknownMarker;
-                uint64_t           frame_number = 0;
+                if (success)
+                {
+                    success = ProcessMetaData(block_header, meta_type);
+                }
+                else
+                {
+                    HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read meta-data block header");
+                }
+            }
+            else if (block_header.type == format::BlockType::kStateMarkerBlock)
+            {
+                format::MarkerType marker_type  = format::MarkerType::kUnknownMarker;
+                uint64_t           frame_number = 0;
+
+                success = ReadBytes(&marker_type, sizeof(marker_type));
+
+                if (success)
+                {
+                    success = ProcessStateMarker(block_header, marker_type);
+                }
+                else
+                {
+                    HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read state marker header");
+                }
+            }
+            else
+            {
+                // Unrecognized block type.
+                GFXRECON_LOG_WARNING("Skipping unrecognized file block with type %u", block_header.type);
+                GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+                success = SkipBytes(static_cast<size_t>(block_header.size));
+            }
+        }
+        else
+        {
+            if (!IsEndOfFile())
+            {
+                // No data has been read for the current block, so we don't use 'HandleBlockReadError' here, as it
+                // assumes that the block header has been successfully read and will print an incomplete block at end
+                // of file warning when the file is at EOF without an error. For this case (the normal EOF case) we
+                // print nothing at EOF, or print an error message and set the error code directly when not at EOF.
+                GFXRECON_LOG_ERROR("Failed to read block header");
+                error_state_ = kErrorReadingBlockHeader;
+            }
+        }
+    }
+
+    return success;
+}
+
+bool FileProcessor::ReadBlockHeader(format::BlockHeader* block_header)
+{
+    assert(block_header != nullptr);
+
+    bool success = false;
+
+    if (IsPreloadActive())
+    {
+        return (ReadPreloadData(block_header, sizeof(*block_header)) == sizeof(*block_header));
+    }
+    else if (!preload_data_.empty())
+    {
+        // All preloaded blocks have been processed.
+        std::vector<uint8_t>().swap(preload_data_);
+        preload_offset_ = 0;
+    }
+
+    if (block_pipeline_ != nullptr)
+    {
+        pipeline_block_        = block_pipeline_->GetNextBlock();
+        pipeline_block_offset_ = 0;
+
+        if (pipeline_block_ == nullptr)
+        {
+            return false;
+        }
+
+        // Count the size of the block as stored in the file, not the decompressed size.
+        bytes_read_ += pipeline_block_->file_size;
+    }
+
+    if (ReadBytes(block_header, sizeof(*block_header)))
+    {
+        success = true;
+    }
+
+    return success;
+}
+
+bool FileProcessor::ReadParameterBuffer(size_t buffer_size)
+{
+    if (buffer_size > parameter_buffer_.size())
+    {
+        parameter_buffer_.resize(buffer_size);
+    }
+
+    return ReadBytes(parameter_buffer_.data(), buffer_size);
+}
+
+bool FileProcessor::ReadParameterData(size_t buffer_size, const uint8_t** data)
+{
+    assert(data != nullptr);
+
+    if (IsPreloadActive())
+    {
+        if (buffer_size <= (preload_data_.size() - preload_offset_))
+        {
+            *data = preload_data_.data() + preload_offset_;
+            preload_offset_ += buffer_size;
+            return true;
+        }
+
+        return false;
+    }
+    else if (block_pipeline_ != nullptr)
+    {
+        const uint8_t* block_data = GetPipelineBlockData(buffer_size);
+
+        if (block_data != nullptr)
+        {
+            *data = block_data;
+            pipeline_block_offset_ += buffer_size;
+            return true;
+        }
+    }
+    else if (mapped_file_.IsOpen())
+    {
+        const uint8_t* mapped_data = mapped_file_.GetData(file_offset_, buffer_size);
+
+        if (mapped_data != nullptr)
+        {
+            *data = mapped_data;
+            file_offset_ += buffer_size;
+            bytes_read_ += buffer_size;
+            PrefetchMappedData();
+            return true;
+        }
+        else if (!mapped_file_.IsOpen() && !FallBackToFileReads())
+        {
+            return false;
+        }
+    }
+
+    bool success = ReadParameterBuffer(buffer_size);
+    *data        = parameter_buffer_.data();
+    return success;
+}
+
+bool FileProcessor::ReadCompressedParameterBuffer(size_t  compressed_buffer_size,
+                                                  size_t  expected_uncompressed_size,
+                                                  size_t* uncompressed_buffer_size)
+{
+    // This should only be null if initialization failed.
+    assert(compressor_ != nullptr);
+
+    if (compressed_buffer_size > compressed_parameter_buffer_.size())
+    {
+        compressed_parameter_buffer_.resize(compressed_buffer_size);
+    }
+
+    if (ReadBytes(compressed_parameter_buffer_.data(), compressed_buffer_size))
+    {
+        if (parameter_buffer_.size() < expected_uncompressed_size)
+        {
+            parameter_buffer_.resize(expected_uncompressed_size);
+        }
+
+        size_t uncompressed_size = compressor_->Decompress(
+            compressed_buffer_size, compressed_parameter_buffer_, expected_uncompressed_size, &parameter_buffer_);
+        if ((0 < uncompressed_size) && (uncompressed_size == expected_uncompressed_size))
+        {
+            *uncompressed_buffer_size = uncompressed_size;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FileProcessor::ReadResourceInitData(const format::BlockHeader& block_header,
+                                         size_t                     compressed_size,
+                                         size_t                     data_size,
+                                         uint8_t*                   destination,
+                                         const uint8_t**            data)
+{
+    assert(data != nullptr);
+
+    bool success = false;
+
+    if (format::IsBlockCompressed(block_header.type))
+    {
+        if (destination != nullptr)
+        {
+            // This should only be null if initialization failed.
+            assert(compressor_ != nullptr);
+
+            if (compressed_size > compressed_parameter_buffer_.size())
+            {
+                compressed_parameter_buffer_.resize(compressed_size);
+            }
+
+            if (ReadBytes(compressed_parameter_buffer_.data(), compressed_size))
+            {
+                size_t uncompressed_size = compressor_->Decompress(
+                    compressed_size, compressed_parameter_buffer_.data(), data_size, destination);
+
+                success = (uncompressed_size == data_size);
+                *data   = destination;
+            }
+        }
+        else
+        {
+            size_t uncompressed_size = 0;
+
+            success = ReadCompressedParameterBuffer(compressed_size, data_size, &uncompressed_size);
+            *data   = parameter_buffer_.data();
+        }
+    }
+    else if (destination != nullptr)
+    {
+        success = ReadBytes(destination, data_size);
+        *data   = destination;
+    }
+    else
+    {
+        success = ReadParameterData(data_size, data);
+    }
+
+    return success;
+}
+
+bool FileProcessor::ReadBytes(void* buffer, size_t buffer_size)
+{
+    if (IsPreloadActive())
+    {
+        return (ReadPreloadData(buffer, buffer_size) == buffer_size);
+    }
+    else if (block_pipeline_ != nullptr)
+    {
+        return (ReadPipelineBlockData(buffer, buffer_size) == buffer_size);
+    }
+
+    size_t bytes_read = ReadFileData(buffer, buffer_size);
+    bytes_read_ += bytes_read;
+    return (bytes_read == buffer_size);
+}
+
+bool FileProcessor::SkipBytes(size_t skip_size)
+{
+    bool success = false;
+
+    if (IsPreloadActive())
+    {
+        // Preloaded bytes were counted as read when they were preloaded.
+        if (skip_size > (preload_data_.size() - preload_offset_))
+        {
+            preload_offset_ = preload_data_.size();
+            return false;
+        }
+
+        preload_offset_ += skip_size;
+        return true;
+    }
+    else if (block_pipeline_ != nullptr)
+    {
+        // Skipped bytes were already counted as read when the block was retrieved from the pipeline.
+        size_t block_size = (pipeline_block_ != nullptr)
+                                ? (pipeline_block_->data.size() + pipeline_block_->payload.size())
+                                : 0;
+
+        if (skip_size > (block_size - std::min(block_size, pipeline_block_offset_)))
+        {
+            pipeline_block_offset_ = block_size;
+            return false;
+        }
+
+        pipeline_block_offset_ += skip_size;
+        return true;
+    }
+    else if (mapped_file_.IsOpen())
+    {
+        success = SeekFile(static_cast<int64_t>(file_offset_ + skip_size));
+
+        if (!success)
+        {
+            file_offset_ = mapped_file_.GetFileSize();
+            end_of_file_ = true;
+        }
+    }
+    else
+    {
+        success = util::platform::FileSeek(file_descriptor_, skip_size, util::platform::FileSeekCurrent);
+    }
+
+    if (success)
+    {
+        // These technically count as bytes read/processed.
+        bytes_read_ += skip_size;
+    }
+
+    return success;
+}
 
-                success = ReadBytes(&marker_type, sizeof(marker_type));
+size_t FileProcessor::ReadFileData(void* buffer, size_t buffer_size)
+{
+    if (mapped_file_.IsOpen())
+    {
+        uint64_t file_size  = mapped_file_.GetFileSize();
+        size_t   bytes_read = buffer_size;
 
-                if (success)
-                {
-                    success = ProcessStateMarker(block_header, marker_type);
-                }
-                else
-                {
-                    HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read state marker header");
-                }
-            }
-            else
-            {
-                // Unrecognized block type.
-                GFXRECON_LOG_WARNING("Skipping unrecognized file block with type %u", block_header.type);
-                GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
-                success = SkipBytes(static_cast<size_t>(block_header.size));
-            }
+        if ((file_offset_ >= file_size) || (buffer_size > (file_size - file_offset_)))
+        {
+            // Partial read at end of file.
+            bytes_read   = (file_offset_ < file_size) ? static_cast<size_t>(file_size - file_offset_) : 0;
+            end_of_file_ = true;
         }
-        else
+
+        if (bytes_read > 0)
         {
-            if (!feof(file_descriptor_))
+            const uint8_t* data = mapped_file_.GetData(file_offset_, bytes_read);
+
+            if (data == nullptr)
             {
-                // No data has been read for the current block, so we don't use 'HandleBlockReadError' here, as it
-                // assumes that the block header has been successfully read and will print an incomplete block at end
-                // of file warning when the file is at EOF without an error. For this case (the normal EOF case) we
-                // print nothing at EOF, or print an error message and set the error code directly when not at EOF.
-                GFXRECON_LOG_ERROR("Failed to read block header");
-                error_state_ = kErrorReadingBlockHeader;
+                end_of_file_ = false;
+
+                if (!FallBackToFileReads())
+                {
+                    return 0;
+                }
+
+                return util::platform::FileRead(buffer, 1, buffer_size, file_descriptor_);
             }
+
+            util::platform::MemoryCopy(buffer, buffer_size, data, bytes_read);
+            file_offset_ += bytes_read;
+            PrefetchMappedData();
         }
+
+        return bytes_read;
     }
 
-    return success;
+    return util::platform::FileRead(buffer, 1, buffer_size, file_descriptor_);
 }
 
-bool FileProcessor::ReadBlockHeader(format::BlockHeader* block_header)
+void FileProcessor::PrefetchMappedData()
 {
-    assert(block_header != nullptr);
-
-    bool success = false;
-
-    if (ReadBytes(block_header, sizeof(*block_header)))
+    if (file_offset_ >= next_prefetch_offset_)
     {
-        success = true;
+        mapped_file_.Prefetch(file_offset_, kMappedFilePrefetchSize);
+        next_prefetch_offset_ = file_offset_ + (kMappedFilePrefetchSize / 2);
     }
-
-    return success;
 }
 
-bool FileProcessor::ReadParameterBuffer(size_t buffer_size)
+bool FileProcessor::FallBackToFileReads()
 {
-    if (buffer_size > parameter_buffer_.size())
+    GFXRECON_LOG_WARNING("Failed to map file data at offset %" PRIu64 "; using buffered file reads", file_offset_);
+
+    mapped_file_.Close();
+
+    if (!util::platform::FileSeek(file_descriptor_, static_cast<int64_t>(file_offset_), util::platform::FileSeekSet))
     {
-        parameter_buffer_.resize(buffer_size);
+        GFXRECON_LOG_ERROR("Failed to seek to file offset %" PRIu64 " after memory mapping failed", file_offset_);
+        error_state_ = kErrorReadingFile;
+        return false;
     }
 
-    return ReadBytes(parameter_buffer_.data(), buffer_size);
+    return true;
 }
 
-bool FileProcessor::ReadCompressedParameterBuffer(size_t  compressed_buffer_size,
-                                                  size_t  expected_uncompressed_size,
-                                                  size_t* uncompressed_buffer_size)
+size_t FileProcessor::ReadPreloadData(void* buffer, size_t buffer_size)
 {
-    // This should only be null if initialization failed.
-    assert(compressor_ != nullptr);
+    // Preloaded bytes were counted as read when they were preloaded.
+    size_t bytes_read = std::min(buffer_size, preload_data_.size() - preload_offset_);
 
-    if (compressed_buffer_size > compressed_parameter_buffer_.size())
+    util::platform::MemoryCopy(buffer, buffer_size, preload_data_.data() + preload_offset_, bytes_read);
+    preload_offset_ += bytes_read;
+
+    return bytes_read;
+}
+
+size_t FileProcessor::ReadPipelineBlockData(void* buffer, size_t buffer_size)
+{
+    if (pipeline_block_ == nullptr)
     {
-        compressed_parameter_buffer_.resize(compressed_buffer_size);
+        return 0;
     }
 
-    if (ReadBytes(compressed_parameter_buffer_.data(), compressed_buffer_size))
+    // Block data is split between the block header and body data, and the decompressed payload.
+    uint8_t*       destination = reinterpret_cast<uint8_t*>(buffer);
+    size_t         bytes_read  = 0;
+    const uint8_t* segments[]  = { pipeline_block_->data.data(), pipeline_block_->payload.data() };
+    size_t         sizes[]     = { pipeline_block_->data.size(), pipeline_block_->payload.size() };
+    size_t         offset      = pipeline_block_offset_;
+
+    for (size_t i = 0; (i < 2) && (bytes_read < buffer_size); ++i)
     {
-        if (parameter_buffer_.size() < expected_uncompressed_size)
+        if (offset < sizes[i])
         {
-            parameter_buffer_.resize(expected_uncompressed_size);
+            size_t copy_size = std::min(sizes[i] - offset, buffer_size - bytes_read);
+            util::platform::MemoryCopy(destination + bytes_read, copy_size, segments[i] + offset, copy_size);
+            bytes_read += copy_size;
+            offset = 0;
+        }
+        else
+        {
+            offset -= sizes[i];
         }
+    }
 
-        size_t uncompressed_size = compressor_->Decompress(
-            compressed_buffer_size, compressed_parameter_buffer_, expected_uncompressed_size, &parameter_buffer_);
-        if ((0 < uncompressed_size) && (uncompressed_size == expected_uncompressed_size))
+    pipeline_block_offset_ += bytes_read;
+
+    return bytes_read;
+}
+
+const uint8_t* FileProcessor::GetPipelineBlockData(size_t buffer_size)
+{
+    if (pipeline_block_ != nullptr)
+    {
+        size_t data_size = pipeline_block_->data.size();
+
+        if ((pipeline_block_offset_ + buffer_size) <= data_size)
         {
-            *uncompressed_buffer_size = uncompressed_size;
-            return true;
+            return pipeline_block_->data.data() + pipeline_block_offset_;
+        }
+        else if ((pipeline_block_offset_ >= data_size) &&
+                 ((pipeline_block_offset_ - data_size + buffer_size) <= pipeline_block_->payload.size()))
+        {
+            return pipeline_block_->payload.data() + (pipeline_block_offset_ - data_size);
         }
     }
-    return false;
+
+    return nullptr;
 }
 
-bool FileProcessor::ReadBytes(void* buffer, size_t buffer_size)
+bool FileProcessor::IsEndOfFile() const
 {
-    size_t bytes_read = util::platform::FileRead(buffer, 1, buffer_size, file_descriptor_);
-    bytes_read_ += bytes_read;
-    return (bytes_read == buffer_size);
+    if (IsPreloadActive())
+    {
+        return false;
+    }
+    else if (block_pipeline_ != nullptr)
+    {
+        return block_pipeline_->IsEndOfFile() &&
+               ((pipeline_block_ == nullptr) ||
+                (pipeline_block_offset_ >= (pipeline_block_->data.size() + pipeline_block_->payload.size())));
+    }
+    else if (mapped_file_.IsOpen())
+    {
+        return end_of_file_;
+    }
+
+    return (feof(file_descriptor_) != 0);
 }
 
-bool FileProcessor::SkipBytes(size_t skip_size)
+bool FileProcessor::IsFileError() const
 {
-    bool success = util::platform::FileSeek(file_descriptor_, skip_size, util::platform::FileSeekCurrent);
+    if (IsPreloadActive())
+    {
+        return false;
+    }
+    else if (block_pipeline_ != nullptr)
+    {
+        return block_pipeline_->IsFileError();
+    }
+    else if (mapped_file_.IsOpen())
+    {
+        return false;
+    }
 
-    if (success)
+    return (ferror(file_descriptor_) != 0);
+}
+
+int64_t FileProcessor::TellFile()
+{
+    if (mapped_file_.IsOpen())
     {
-        // These technically count as bytes read/processed.
-        bytes_read_ += skip_size;
+        return static_cast<int64_t>(file_offset_);
     }
 
-    return success;
+    return util::platform::FileTell(file_descriptor_);
+}
+
+bool FileProcessor::SeekFile(int64_t offset)
+{
+    if (mapped_file_.IsOpen())
+    {
+        if ((offset < 0) || (static_cast<uint64_t>(offset) > mapped_file_.GetFileSize()))
+        {
+            return false;
+        }
+
+        file_offset_ = static_cast<uint64_t>(offset);
+        end_of_file_ = false;
+        return true;
+    }
+
+    return util::platform::FileSeek(file_descriptor_, offset, util::platform::FileSeekSet);
 }
 
 void FileProcessor::HandleBlockReadError(Error error_code, const char* error_message)
 {
     // Report incomplete block at end of file as a warning, other I/O errors as an error.
-    if (feof(file_descriptor_) && !ferror(file_descriptor_))
+    if (IsEndOfFile() && !IsFileError())
     {
         GFXRECON_LOG_WARNING("Incomplete block at end of file");
     }
@@ -351,9 +1221,33 @@ void FileProcessor::HandleBlockReadError(Error error_code, const char* error_mes
 
 bool FileProcessor::ProcessFunctionCall(const format::BlockHeader& block_header, format::ApiCallId call_id)
 {
-    size_t      parameter_buffer_size = static_cast<size_t>(block_header.size) - sizeof(call_id);
-    uint64_t    uncompressed_size     = 0;
-    ApiCallInfo call_info             = {};
+    size_t         parameter_buffer_size = static_cast<size_t>(block_header.size) - sizeof(call_id);
+    uint64_t       uncompressed_size     = 0;
+    ApiCallInfo    call_info             = {};
+    const uint8_t* parameter_data        = nullptr;
+    bool           supported             = false;
+
+    for (auto decoder : decoders_)
+    {
+        if (decoder->SupportsApiCall(call_id))
+        {
+            supported = true;
+            break;
+        }
+    }
+
+    if (!supported)
+    {
+        // No decoder processes the call, so its parameter data is skipped without being read or decompressed.
+        bool success = SkipBytes(parameter_buffer_size);
+
+        if (!success)
+        {
+            HandleBlockReadError(kErrorReadingBlockData, "Failed to skip function call block data");
+        }
+
+        return success;
+    }
 
     bool success = ReadBytes(&call_info.thread_id, sizeof(call_info.thread_id));
 
@@ -378,6 +1272,7 @@ bool FileProcessor::ProcessFunctionCall(const format::BlockHeader& block_header,
                 {
                     assert(actual_size == uncompressed_size);
                     parameter_buffer_size = static_cast<size_t>(uncompressed_size);
+                    parameter_data        = parameter_buffer_.data();
                 }
                 else
                 {
@@ -393,7 +1288,7 @@ bool FileProcessor::ProcessFunctionCall(const format::BlockHeader& block_header,
         }
         else
         {
-            success = ReadParameterBuffer(parameter_buffer_size);
+            success = ReadParameterData(parameter_buffer_size, &parameter_data);
 
             if (!success)
             {
@@ -407,7 +1302,7 @@ bool FileProcessor::ProcessFunctionCall(const format::BlockHeader& block_header,
             {
                 if (decoder->SupportsApiCall(call_id))
                 {
-                    decoder->DecodeFunctionCall(call_id, call_info, parameter_buffer_.data(), parameter_buffer_size);
+                    decoder->DecodeFunctionCall(call_id, call_info, parameter_data, parameter_buffer_size);
                 }
             }
         }
@@ -424,9 +1319,22 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
 {
     bool success = false;
 
-    if (meta_type == format::MetaDataType::kFillMemoryCommand)
+    if (!IsMetaDataCommandSupported(meta_type))
+    {
+        // No decoder processes the command, so its data is skipped without being read or decompressed.
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+
+        success = SkipBytes(static_cast<size_t>(block_header.size) - sizeof(meta_type));
+
+        if (!success)
+        {
+            HandleBlockReadError(kErrorReadingBlockData, "Failed to skip meta-data block data");
+        }
+    }
+    else if (meta_type == format::MetaDataType::kFillMemoryCommand)
     {
         format::FillMemoryCommandHeader header;
+        const uint8_t*                  data = nullptr;
 
         success = ReadBytes(&header.thread_id, sizeof(header.thread_id));
         success = success && ReadBytes(&header.memory_id, sizeof(header.memory_id));
@@ -446,10 +1354,11 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
 
                 success = ReadCompressedParameterBuffer(
                     compressed_size, static_cast<size_t>(header.memory_size), &uncompressed_size);
+                data    = parameter_buffer_.data();
             }
             else
             {
-                success = ReadParameterBuffer(static_cast<size_t>(header.memory_size));
+                success = ReadParameterData(static_cast<size_t>(header.memory_size), &data);
             }
 
             if (success)
@@ -460,7 +1369,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                                                        header.memory_id,
                                                        header.memory_offset,
                                                        header.memory_size,
-                                                       parameter_buffer_.data());
+                                                       data);
                 }
             }
             else
@@ -481,6 +1390,44 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
             HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read fill memory meta-data block header");
         }
     }
+    else if (meta_type == format::MetaDataType::kFillMemoryReferenceCommand)
+    {
+        // This command does not support compression.
+        assert(block_header.type != format::BlockType::kCompressedMetaDataBlock);
+
+        format::FillMemoryReferenceCommand command;
+
+        success = ReadBytes(&command.thread_id, sizeof(command.thread_id));
+        success = success && ReadBytes(&command.memory_id, sizeof(command.memory_id));
+        success = success && ReadBytes(&command.memory_offset, sizeof(command.memory_offset));
+        success = success && ReadBytes(&command.memory_size, sizeof(command.memory_size));
+        success = success && ReadBytes(&command.block_offset, sizeof(command.block_offset));
+
+        if (success)
+        {
+            const uint8_t* data = nullptr;
+
+            if (ReadFillMemoryReferenceData(command.block_offset, command.memory_size, &data))
+            {
+                for (auto decoder : decoders_)
+                {
+                    decoder->DispatchFillMemoryCommand(
+                        command.thread_id, command.memory_id, command.memory_offset, command.memory_size, data);
+                }
+            }
+            else
+            {
+                GFXRECON_LOG_ERROR("Failed to read fill memory data referenced at file offset %" PRIu64,
+                                   command.block_offset);
+                success      = false;
+                error_state_ = kErrorReadingBlockData;
+            }
+        }
+        else
+        {
+            HandleBlockReadError(kErrorReadingBlockData, "Failed to read fill memory reference meta-data block");
+        }
+    }
     else if (meta_type == format::MetaDataType::kResizeWindowCommand)
     {
         // This command does not support compression.
@@ -847,6 +1794,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
     else if (meta_type == format::MetaDataType::kInitBufferCommand)
     {
         format::InitBufferCommandHeader header;
+        const uint8_t*                  data = nullptr;
 
         success = ReadBytes(&header.thread_id, sizeof(header.thread_id));
         success = success && ReadBytes(&header.device_id, sizeof(header.device_id));
@@ -857,20 +1805,20 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
         {
             GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.data_size);
 
-            if (format::IsBlockCompressed(block_header.type))
-            {
-                size_t uncompressed_size = 0;
-                size_t compressed_size =
-                    static_cast<size_t>(block_header.size) - (sizeof(header) - sizeof(header.meta_header.block_header));
+            size_t   compressed_size =
+                static_cast<size_t>(block_header.size) - (sizeof(header) - sizeof(header.meta_header.block_header));
+            uint8_t* destination     = nullptr;
 
-                success = ReadCompressedParameterBuffer(
-                    compressed_size, static_cast<size_t>(header.data_size), &uncompressed_size);
-            }
-            else
+            // The data can only be read directly to memory provided by the decoder when there is a single decoder.
+            if (decoders_.size() == 1)
             {
-                success = ReadParameterBuffer(static_cast<size_t>(header.data_size));
+                destination = decoders_[0]->GetInitBufferCommandData(
+                    header.thread_id, header.device_id, header.buffer_id, header.data_size);
             }
 
+            success = ReadResourceInitData(
+                block_header, compressed_size, static_cast<size_t>(header.data_size), destination, &data);
+
             if (success)
             {
                 for (auto decoder : decoders_)
@@ -879,7 +1827,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                                                        header.device_id,
                                                        header.buffer_id,
                                                        header.data_size,
-                                                       parameter_buffer_.data());
+                                                       data);
                 }
             }
             else
@@ -904,6 +1852,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
     {
         format::InitImageCommandHeader header;
         std::vector<uint64_t>          level_sizes;
+        const uint8_t*                 data = nullptr;
 
         success = ReadBytes(&header.thread_id, sizeof(header.thread_id));
         success = success && ReadBytes(&header.device_id, sizeof(header.device_id));
@@ -924,20 +1873,20 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
             assert(header.data_size == std::accumulate(level_sizes.begin(), level_sizes.end(), 0ull));
             GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.data_size);
 
-            if (format::IsBlockCompressed(block_header.type))
-            {
-                size_t uncompressed_size = 0;
-                size_t compressed_size   = static_cast<size_t>(block_header.size) -
-                                         (sizeof(header) - sizeof(header.meta_header.block_header)) -
-                                         (level_sizes.size() * sizeof(level_sizes[0]));
+            size_t   compressed_size = static_cast<size_t>(block_header.size) -
+                                     (sizeof(header) - sizeof(header.meta_header.block_header)) -
+                                     (level_sizes.size() * sizeof(level_sizes[0]));
+            uint8_t* destination     = nullptr;
 
-                success = ReadCompressedParameterBuffer(
-                    compressed_size, static_cast<size_t>(header.data_size), &uncompressed_size);
-            }
-            else
+            // The data can only be read directly to memory provided by the decoder when there is a single decoder.
+            if (decoders_.size() == 1)
             {
-                success = ReadParameterBuffer(static_cast<size_t>(header.data_size));
+                destination = decoders_[0]->GetInitImageCommandData(
+                    header.thread_id, header.device_id, header.image_id, header.data_size, header.aspect);
             }
+
+            success = ReadResourceInitData(
+                block_header, compressed_size, static_cast<size_t>(header.data_size), destination, &data);
         }
 
         if (success)
@@ -951,7 +1900,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                                                   header.aspect,
                                                   header.layout,
                                                   level_sizes,
-                                                  parameter_buffer_.data());
+                                                  data);
             }
         }
         else
@@ -967,6 +1916,14 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
             }
         }
     }
+    else if ((meta_type == format::MetaDataType::kFrameIndexCommand) ||
+             (meta_type == format::MetaDataType::kFrameIndexLocatorCommand))
+    {
+        // The frame index is loaded when the file is opened and is not needed for sequential processing.
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+
+        success = SkipBytes(static_cast<size_t>(block_header.size) - sizeof(meta_type));
+    }
     else
     {
         // Unrecognized metadata type.
@@ -979,6 +1936,108 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
     return success;
 }
 
+bool FileProcessor::IsMetaDataCommandSupported(format::MetaDataType meta_type) const
+{
+    for (auto decoder : decoders_)
+    {
+        if (decoder->SupportsMetaDataCommand(meta_type))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool FileProcessor::ReadFillMemoryReferenceData(uint64_t block_offset, uint64_t memory_size, const uint8_t** data)
+{
+    assert(data != nullptr);
+
+    auto entry = fill_memory_cache_.find(block_offset);
+    if (entry != fill_memory_cache_.end())
+    {
+        *data = entry->second.data();
+        return (entry->second.size() == memory_size);
+    }
+
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, memory_size);
+
+    // Read the referenced fill memory block from its location in the file, and then return to the current position.
+    // These reads are not included in the count of bytes read, which only tracks sequential file processing.
+    bool    success        = false;
+    int64_t current_offset = TellFile();
+
+    if ((current_offset >= 0) && SeekFile(static_cast<int64_t>(block_offset)))
+    {
+        format::FillMemoryCommandHeader header;
+
+        if ((ReadFileData(&header, sizeof(header)) == sizeof(header)) &&
+            (format::RemoveCompressedBlockBit(header.meta_header.block_header.type) ==
+             format::BlockType::kMetaDataBlock) &&
+            (header.meta_header.meta_data_type == format::MetaDataType::kFillMemoryCommand) &&
+            (header.memory_size == memory_size))
+        {
+            size_t data_size   = static_cast<size_t>(header.meta_header.block_header.size) -
+                               (sizeof(header) - sizeof(header.meta_header.block_header));
+            size_t buffer_size = static_cast<size_t>(memory_size);
+
+            if (parameter_buffer_.size() < buffer_size)
+            {
+                parameter_buffer_.resize(buffer_size);
+            }
+
+            if (format::IsBlockCompressed(header.meta_header.block_header.type))
+            {
+                if (compressed_parameter_buffer_.size() < data_size)
+                {
+                    compressed_parameter_buffer_.resize(data_size);
+                }
+
+                if (ReadFileData(compressed_parameter_buffer_.data(), data_size) == data_size)
+                {
+                    size_t uncompressed_size = compressor_->Decompress(
+                        data_size, compressed_parameter_buffer_, buffer_size, &parameter_buffer_);
+                    success = (uncompressed_size == buffer_size);
+                }
+            }
+            else if (data_size == buffer_size)
+            {
+                success = (ReadFileData(parameter_buffer_.data(), buffer_size) == buffer_size);
+            }
+        }
+
+        if (!SeekFile(current_offset))
+        {
+            success = false;
+        }
+    }
+
+    if (success)
+    {
+        *data = parameter_buffer_.data();
+
+        if (memory_size <= kMaxFillMemoryCacheSize)
+        {
+            // Discard the oldest entries until there is space for the new entry.
+            while ((fill_memory_cache_size_ + memory_size) > kMaxFillMemoryCacheSize)
+            {
+                auto oldest = fill_memory_cache_.find(fill_memory_cache_order_.front());
+                fill_memory_cache_size_ -= oldest->second.size();
+                fill_memory_cache_.erase(oldest);
+                fill_memory_cache_order_.pop_front();
+            }
+
+            fill_memory_cache_.emplace(block_offset,
+                                       std::vector<uint8_t>(parameter_buffer_.begin(),
+                                                            std::next(parameter_buffer_.begin(), memory_size)));
+            fill_memory_cache_order_.push_back(block_offset);
+            fill_memory_cache_size_ += static_cast<size_t>(memory_size);
+        }
+    }
+
+    return success;
+}
+
 bool FileProcessor::ProcessStateMarker(const format::BlockHeader& block_header, format::MarkerType marker_type)
 {
     uint64_t frame_number = 0;
@@ -1010,12 +2069,5 @@ bool FileProcessor::ProcessStateMarker(const format::BlockHeader& block_header,
     return success;
 }
 
-bool FileProcessor::IsFrameDelimiter(format::ApiCallId call_id) const
-{
-    // TODO: IDs of API calls that were treated as frame delimiters by the GFXReconstruct layer should be in the capture
-    // file header.
-    return (call_id == format::ApiCallId::ApiCall_vkQueuePresentKHR);
-}
-
 GFXRECON_END_NAMESPACE(decode)
 GFXRECON_END_NAMESPACE(gfxrecon)
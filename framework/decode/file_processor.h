@@ -21,12 +21,18 @@
 #include "format/api_call_id.h"
 #include "format/format.h"
 #include "decode/api_decoder.h"
+#include "decode/block_pipeline.h"
 #include "util/compressor.h"
 #include "util/defines.h"
+#include "util/mapped_file.h"
 
 #include <algorithm>
 #include <cstdio>
+#include <deque>
+#include <functional>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -64,6 +70,11 @@ class FileProcessor
 
     bool Initialize(const std::string& filename);
 
+    // Start reading blocks ahead of the block being processed on a separate thread, with compressed blocks decompressed
+    // by the specified number of worker threads.  Only enabled for compressed files, as uncompressed files are read
+    // directly from a memory mapping.  Must be called after Initialize and before frame processing begins.
+    bool StartBlockPipeline(uint32_t decompression_thread_count);
+
     // Returns true if there are more frames to process, false if all frames have been processed or an error has
     // occurred.  Use GetErrorState() to determine error condition.
     bool ProcessNextFrame();
@@ -81,36 +92,128 @@ class FileProcessor
 
     Error GetErrorState() const { return error_state_; }
 
+    // Returns true when the file ends with a frame index, which provides the file offsets of the first block of each
+    // frame and of the trimmed state snapshot markers.
+    bool HasFrameIndex() const { return !frame_index_.empty(); }
+
+    const std::vector<format::FrameIndexEntry>& GetFrameIndex() const { return frame_index_; }
+
+    const std::vector<format::StateMarkerIndexEntry>& GetStateMarkerIndex() const { return state_marker_index_; }
+
+    // Moves the read position to the first block of the specified frame, using the frame index.  Only the read position
+    // is changed; decoders are not notified, so any state created by the skipped frames will be missing from replay.
+    bool SeekToFrame(uint32_t frame_number);
+
+    uint64_t GetFileSize() const { return file_size_; }
+
+    // Returns true when a sidecar block index file created for the capture file was loaded.
+    bool HasBlockIndex() const { return !block_index_.empty(); }
+
+    const std::vector<format::BlockIndexEntry>& GetBlockIndex() const { return block_index_; }
+
+    // Reads the blocks of the next frame_count frames into memory, so that the frames are processed without file reads
+    // or, when decompress is true, block decompression.  Reading resumes from the file after the preloaded blocks have
+    // been processed, and the memory used for the blocks is released.  Must not be called while previously preloaded
+    // blocks remain to be processed.
+    bool PreloadFrames(uint32_t frame_count, bool decompress);
+
+    // Returns the size of the memory used for preloaded blocks, which is zero when no preloaded blocks remain.
+    size_t GetPreloadSize() const { return preload_data_.size(); }
+
+    typedef std::function<void(const format::BlockIndexEntry&)> BlockScanCallback;
+    typedef std::function<void(const format::BlockIndexEntry&, const format::FillMemoryCommandHeader&)>
+        FillMemoryScanCallback;
+
+    // Scans the remaining blocks of the file, reading only the fixed size fields at the start of each block and
+    // skipping block data, and invokes the callback with the block index entry for each block.  When a fill memory
+    // callback is specified, it is also invoked with the header fields of each fill memory and fill memory reference
+    // command, which share the same initial fields.  Must be called before frame processing begins, and cannot be used
+    // with the block pipeline.
+    bool ScanBlocks(const BlockScanCallback& callback, const FillMemoryScanCallback& fill_memory_callback = nullptr);
+
+    // Scans the remaining blocks of the file with ScanBlocks to build a block index.
+    bool BuildBlockIndex(std::vector<format::BlockIndexEntry>* block_index);
+
   private:
     bool ProcessFileHeader();
 
     bool ProcessBlocks();
 
+    bool LoadFrameIndex();
+
+    bool LoadBlockIndex();
+
+    bool ReadBlockFields(const format::BlockHeader& block_header,
+                         void*                      header,
+                         size_t                     header_size,
+                         size_t*                    body_read);
+
     bool ReadBlockHeader(format::BlockHeader* block_header);
 
     bool ReadParameterBuffer(size_t buffer_size);
 
+    // Retrieves a pointer to the next buffer_size bytes of uncompressed block data.  When the file is memory mapped,
+    // the pointer references the mapped file data directly.  Otherwise the data is read into the parameter buffer.
+    bool ReadParameterData(size_t buffer_size, const uint8_t** data);
+
     bool ReadCompressedParameterBuffer(size_t  compressed_buffer_size,
                                        size_t  expected_uncompressed_size,
                                        size_t* uncompressed_buffer_size);
 
+    // Retrieves a pointer to resource initialization data, which is read or decompressed directly to the destination
+    // memory when a destination is provided by the decoder.
+    bool ReadResourceInitData(const format::BlockHeader& block_header,
+                              size_t                     compressed_size,
+                              size_t                     data_size,
+                              uint8_t*                   destination,
+                              const uint8_t**            data);
+
     bool ReadBytes(void* buffer, size_t buffer_size);
 
     bool SkipBytes(size_t skip_size);
 
+    size_t ReadFileData(void* buffer, size_t buffer_size);
+
+    // Hints that the mapped file data following the current read position will be accessed soon.
+    void PrefetchMappedData();
+
+    // Closes the memory mapping after it failed to map the data at the current read position, and positions the file
+    // descriptor at that offset so that reads continue from it.  Returns false if the file descriptor could not be
+    // positioned.
+    bool FallBackToFileReads();
+
+    size_t ReadPipelineBlockData(void* buffer, size_t buffer_size);
+
+    const uint8_t* GetPipelineBlockData(size_t buffer_size);
+
+    int64_t TellFile();
+
+    bool SeekFile(int64_t offset);
+
+    bool IsEndOfFile() const;
+
+    bool IsFileError() const;
+
     void HandleBlockReadError(Error error_code, const char* error_message);
 
     bool ProcessFunctionCall(const format::BlockHeader& block_header, format::ApiCallId call_id);
 
     bool ProcessMetaData(const format::BlockHeader& block_header, format::MetaDataType meta_type);
 
+    // Returns true if at least one decoder processes the meta-data command.
+    bool IsMetaDataCommandSupported(format::MetaDataType meta_type) const;
+
+    bool ReadFillMemoryReferenceData(uint64_t block_offset, uint64_t memory_size, const uint8_t** data);
+
     bool ProcessStateMarker(const format::BlockHeader& block_header, format::MarkerType marker_type);
 
-    bool IsFrameDelimiter(format::ApiCallId call_id) const;
+    bool IsPreloadActive() const { return (preload_offset_ < preload_data_.size()); }
+
+    size_t ReadPreloadData(void* buffer, size_t buffer_size);
 
     bool IsFileHeaderValid() const { return (file_header_.fourcc == GFXRECON_FOURCC); }
 
-    bool IsFileValid() const { return (file_descriptor_ && !feof(file_descriptor_) && !ferror(file_descriptor_)); }
+    bool IsFileValid() const { return (file_descriptor_ && !IsEndOfFile() && !IsFileError()); }
 
   private:
     FILE*                               file_descriptor_;
@@ -125,6 +228,36 @@ class FileProcessor
     std::vector<uint8_t>                parameter_buffer_;
     std::vector<uint8_t>                compressed_parameter_buffer_;
     util::Compressor*                   compressor_;
+
+    // Memory mapped view of the file, which is used in place of the file descriptor for reads when the file can be
+    // mapped.
+    util::MappedFile mapped_file_;
+    uint64_t         file_offset_;
+    uint64_t         next_prefetch_offset_;
+    bool             end_of_file_;
+    uint64_t         file_size_;
+
+    // When the block pipeline is active, blocks are read from the pipeline instead of the file, with the read position
+    // tracked relative to the start of the current pipeline block.
+    std::unique_ptr<BlockPipeline> block_pipeline_;
+    const BlockPipeline::Block*    pipeline_block_;
+    size_t                         pipeline_block_offset_;
+    uint32_t                       pipeline_thread_count_;
+
+    // Blocks preloaded into a contiguous buffer, in their uncompressed form when decompression was requested, which
+    // are processed before reads resume from the file.
+    std::vector<uint8_t> preload_data_;
+    size_t               preload_offset_;
+
+    std::vector<format::FrameIndexEntry>       frame_index_;
+    std::vector<format::StateMarkerIndexEntry> state_marker_index_;
+    std::vector<format::BlockIndexEntry>       block_index_;
+
+    // Cache of recently referenced fill memory data, mapping the file offset of the referenced fill memory block to the
+    // uncompressed data from the block.
+    std::unordered_map<uint64_t, std::vector<uint8_t>> fill_memory_cache_;
+    std::deque<uint64_t>                               fill_memory_cache_order_;
+    size_t                                             fill_memory_cache_size_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -0,0 +1,467 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#include "decode/frame_loop_decoder.h"
+
+#include "util/logging.h"
+
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+FrameLoopDecoder::FrameLoopDecoder(ApiDecoder* decoder) :
+    decoder_(decoder), recording_(false), unloopable_call_(format::ApiCallId::ApiCall_Unknown)
+{
+    assert(decoder != nullptr);
+}
+
+void FrameLoopDecoder::StartRecording()
+{
+    ClearRecording();
+    recording_ = true;
+}
+
+void FrameLoopDecoder::EndRecordedFrame()
+{
+    if (recording_)
+    {
+        frame_ends_.push_back(commands_.size());
+    }
+}
+
+void FrameLoopDecoder::ReplayRecording(const FrameEndCallback& frame_end_callback)
+{
+    assert(!recording_ && IsRecordingLoopable());
+
+    size_t command_index = 0;
+
+    for (auto frame_end : frame_ends_)
+    {
+        for (; command_index < frame_end; ++command_index)
+        {
+            commands_[command_index](decoder_);
+        }
+
+        if (frame_end_callback)
+        {
+            frame_end_callback();
+        }
+    }
+}
+
+void FrameLoopDecoder::ClearRecording()
+{
+    commands_.clear();
+    frame_ends_.clear();
+    unloopable_call_ = format::ApiCallId::ApiCall_Unknown;
+}
+
+bool FrameLoopDecoder::IsObjectLifetimeCall(format::ApiCallId call_id)
+{
+    // vkAcquireNextImageKHR and vkAcquireNextImage2KHR are excluded, as frame loops are replayed with offscreen
+    // swapchains, which acquire the image index that was acquired during capture without creating any objects.
+    switch (call_id)
+    {
+        case format::ApiCallId::ApiCall_vkCreateInstance:
+        case format::ApiCallId::ApiCall_vkDestroyInstance:
+        case format::ApiCallId::ApiCall_vkCreateDevice:
+        case format::ApiCallId::ApiCall_vkDestroyDevice:
+        case format::ApiCallId::ApiCall_vkAllocateMemory:
+        case format::ApiCallId::ApiCall_vkFreeMemory:
+        case format::ApiCallId::ApiCall_vkCreateFence:
+        case format::ApiCallId::ApiCall_vkDestroyFence:
+        case format::ApiCallId::ApiCall_vkCreateSemaphore:
+        case format::ApiCallId::ApiCall_vkDestroySemaphore:
+        case format::ApiCallId::ApiCall_vkCreateEvent:
+        case format::ApiCallId::ApiCall_vkDestroyEvent:
+        case format::ApiCallId::ApiCall_vkCreateQueryPool:
+        case format::ApiCallId::ApiCall_vkDestroyQueryPool:
+        case format::ApiCallId::ApiCall_vkCreateBuffer:
+        case format::ApiCallId::ApiCall_vkDestroyBuffer:
+        case format::ApiCallId::ApiCall_vkCreateBufferView:
+        case format::ApiCallId::ApiCall_vkDestroyBufferView:
+        case format::ApiCallId::ApiCall_vkCreateImage:
+        case format::ApiCallId::ApiCall_vkDestroyImage:
+        case format::ApiCallId::ApiCall_vkCreateImageView:
+        case format::ApiCallId::ApiCall_vkDestroyImageView:
+        case format::ApiCallId::ApiCall_vkCreateShaderModule:
+        case format::ApiCallId::ApiCall_vkDestroyShaderModule:
+        case format::ApiCallId::ApiCall_vkCreatePipelineCache:
+        case format::ApiCallId::ApiCall_vkDestroyPipelineCache:
+        case format::ApiCallId::ApiCall_vkCreateGraphicsPipelines:
+        case format::ApiCallId::ApiCall_vkCreateComputePipelines:
+        case format::ApiCallId::ApiCall_vkDestroyPipeline:
+        case format::ApiCallId::ApiCall_vkCreatePipelineLayout:
+        case format::ApiCallId::ApiCall_vkDestroyPipelineLayout:
+        case format::ApiCallId::ApiCall_vkCreateSampler:
+        case format::ApiCallId::ApiCall_vkDestroySampler:
+        case format::ApiCallId::ApiCall_vkCreateDescriptorSetLayout:
+        case format::ApiCallId::ApiCall_vkDestroyDescriptorSetLayout:
+        case format::ApiCallId::ApiCall_vkCreateDescriptorPool:
+        case format::ApiCallId::ApiCall_vkDestroyDescriptorPool:
+        case format::ApiCallId::ApiCall_vkAllocateDescriptorSets:
+        case format::ApiCallId::ApiCall_vkFreeDescriptorSets:
+        case format::ApiCallId::ApiCall_vkCreateFramebuffer:
+        case format::ApiCallId::ApiCall_vkDestroyFramebuffer:
+        case format::ApiCallId::ApiCall_vkCreateRenderPass:
+        case format::ApiCallId::ApiCall_vkDestroyRenderPass:
+        case format::ApiCallId::ApiCall_vkCreateCommandPool:
+        case format::ApiCallId::ApiCall_vkDestroyCommandPool:
+        case format::ApiCallId::ApiCall_vkAllocateCommandBuffers:
+        case format::ApiCallId::ApiCall_vkFreeCommandBuffers:
+        case format::ApiCallId::ApiCall_vkCreateSamplerYcbcrConversion:
+        case format::ApiCallId::ApiCall_vkDestroySamplerYcbcrConversion:
+        case format::ApiCallId::ApiCall_vkCreateDescriptorUpdateTemplate:
+        case format::ApiCallId::ApiCall_vkDestroyDescriptorUpdateTemplate:
+        case format::ApiCallId::ApiCall_vkDestroySurfaceKHR:
+        case format::ApiCallId::ApiCall_vkCreateSwapchainKHR:
+        case format::ApiCallId::ApiCall_vkDestroySwapchainKHR:
+        case format::ApiCallId::ApiCall_vkCreateDisplayModeKHR:
+        case format::ApiCallId::ApiCall_vkCreateDisplayPlaneSurfaceKHR:
+        case format::ApiCallId::ApiCall_vkCreateSharedSwapchainsKHR:
+        case format::ApiCallId::ApiCall_vkCreateXlibSurfaceKHR:
+        case format::ApiCallId::ApiCall_vkCreateXcbSurfaceKHR:
+        case format::ApiCallId::ApiCall_vkCreateWaylandSurfaceKHR:
+        case format::ApiCallId::ApiCall_vkCreateMirSurfaceKHR:
+        case format::ApiCallId::ApiCall_vkCreateAndroidSurfaceKHR:
+        case format::ApiCallId::ApiCall_vkCreateWin32SurfaceKHR:
+        case format::ApiCallId::ApiCall_vkCreateDescriptorUpdateTemplateKHR:
+        case format::ApiCallId::ApiCall_vkDestroyDescriptorUpdateTemplateKHR:
+        case format::ApiCallId::ApiCall_vkCreateRenderPass2KHR:
+        case format::ApiCallId::ApiCall_vkCreateSamplerYcbcrConversionKHR:
+        case format::ApiCallId::ApiCall_vkDestroySamplerYcbcrConversionKHR:
+        case format::ApiCallId::ApiCall_vkCreateDebugReportCallbackEXT:
+        case format::ApiCallId::ApiCall_vkDestroyDebugReportCallbackEXT:
+        case format::ApiCallId::ApiCall_vkCreateViSurfaceNN:
+        case format::ApiCallId::ApiCall_vkCreateIndirectCommandsLayoutNVX:
+        case format::ApiCallId::ApiCall_vkDestroyIndirectCommandsLayoutNVX:
+        case format::ApiCallId::ApiCall_vkCreateObjectTableNVX:
+        case format::ApiCallId::ApiCall_vkDestroyObjectTableNVX:
+        case format::ApiCallId::ApiCall_vkCreateIOSSurfaceMVK:
+        case format::ApiCallId::ApiCall_vkCreateMacOSSurfaceMVK:
+        case format::ApiCallId::ApiCall_vkCreateDebugUtilsMessengerEXT:
+        case format::ApiCallId::ApiCall_vkDestroyDebugUtilsMessengerEXT:
+        case format::ApiCallId::ApiCall_vkCreateValidationCacheEXT:
+        case format::ApiCallId::ApiCall_vkDestroyValidationCacheEXT:
+        case format::ApiCallId::ApiCall_vkCreateAccelerationStructureNV:
+        case format::ApiCallId::ApiCall_vkDestroyAccelerationStructureNV:
+        case format::ApiCallId::ApiCall_vkCreateRayTracingPipelinesNV:
+        case format::ApiCallId::ApiCall_vkCreateImagePipeSurfaceFUCHSIA:
+        case format::ApiCallId::ApiCall_vkCreateMetalSurfaceEXT:
+        case format::ApiCallId::ApiCall_vkCreateStreamDescriptorSurfaceGGP:
+        case format::ApiCallId::ApiCall_vkCreateHeadlessSurfaceEXT:
+        case format::ApiCallId::ApiCall_vkCreateRenderPass2:
+        case format::ApiCallId::ApiCall_vkCreateDeferredOperationKHR:
+        case format::ApiCallId::ApiCall_vkDestroyDeferredOperationKHR:
+        case format::ApiCallId::ApiCall_vkCreateAccelerationStructureKHR:
+        case format::ApiCallId::ApiCall_vkDestroyAccelerationStructureKHR:
+        case format::ApiCallId::ApiCall_vkCreateRayTracingPipelinesKHR:
+        case format::ApiCallId::ApiCall_vkCreateIndirectCommandsLayoutNV:
+        case format::ApiCallId::ApiCall_vkDestroyIndirectCommandsLayoutNV:
+        case format::ApiCallId::ApiCall_vkCreatePrivateDataSlotEXT:
+        case format::ApiCallId::ApiCall_vkDestroyPrivateDataSlotEXT:
+        case format::ApiCallId::ApiCall_vkCreateDirectFBSurfaceEXT:
+            return true;
+        default:
+            break;
+    }
+
+    return false;
+}
+
+void FrameLoopDecoder::DecodeFunctionCall(format::ApiCallId  call_id,
+                                          const ApiCallInfo& call_info,
+                                          const uint8_t*     parameter_buffer,
+                                          size_t             buffer_size)
+{
+    if (recording_)
+    {
+        if ((unloopable_call_ == format::ApiCallId::ApiCall_Unknown) && IsObjectLifetimeCall(call_id))
+        {
+            unloopable_call_ = call_id;
+        }
+
+        std::vector<uint8_t> parameter_data(parameter_buffer, parameter_buffer + buffer_size);
+
+        commands_.emplace_back([call_id, call_info, parameter_data](ApiDecoder* decoder) {
+            decoder->DecodeFunctionCall(call_id, call_info, parameter_data.data(), parameter_data.size());
+        });
+    }
+
+    decoder_->DecodeFunctionCall(call_id, call_info, parameter_buffer, buffer_size);
+}
+
+void FrameLoopDecoder::DispatchStateBeginMarker(uint64_t frame_number)
+{
+    if (recording_)
+    {
+        commands_.emplace_back(
+            [frame_number](ApiDecoder* decoder) { decoder->DispatchStateBeginMarker(frame_number); });
+    }
+
+    decoder_->DispatchStateBeginMarker(frame_number);
+}
+
+void FrameLoopDecoder::DispatchStateEndMarker(uint64_t frame_number)
+{
+    if (recording_)
+    {
+        commands_.emplace_back([frame_number](ApiDecoder* decoder) { decoder->DispatchStateEndMarker(frame_number); });
+    }
+
+    decoder_->DispatchStateEndMarker(frame_number);
+}
+
+void FrameLoopDecoder::DispatchDisplayMessageCommand(format::ThreadId thread_id, const std::string& message)
+{
+    if (recording_)
+    {
+        commands_.emplace_back([thread_id, message](ApiDecoder* decoder) {
+            decoder->DispatchDisplayMessageCommand(thread_id, message);
+        });
+    }
+
+    decoder_->DispatchDisplayMessageCommand(thread_id, message);
+}
+
+void FrameLoopDecoder::DispatchFillMemoryCommand(
+    format::ThreadId thread_id, uint64_t memory_id, uint64_t offset, uint64_t size, const uint8_t* data)
+{
+    if (recording_)
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, size);
+
+        std::vector<uint8_t> fill_data(data, data + static_cast<size_t>(size));
+
+        commands_.emplace_back([thread_id, memory_id, offset, size, fill_data](ApiDecoder* decoder) {
+            decoder->DispatchFillMemoryCommand(thread_id, memory_id, offset, size, fill_data.data());
+        });
+    }
+
+    decoder_->DispatchFillMemoryCommand(thread_id, memory_id, offset, size, data);
+}
+
+void FrameLoopDecoder::DispatchResizeWindowCommand(format::ThreadId thread_id,
+                                                   format::HandleId surface_id,
+                                                   uint32_t         width,
+                                                   uint32_t         height)
+{
+    if (recording_)
+    {
+        commands_.emplace_back([thread_id, surface_id, width, height](ApiDecoder* decoder) {
+            decoder->DispatchResizeWindowCommand(thread_id, surface_id, width, height);
+        });
+    }
+
+    decoder_->DispatchResizeWindowCommand(thread_id, surface_id, width, height);
+}
+
+void FrameLoopDecoder::DispatchCreateHardwareBufferCommand(
+    format::ThreadId                                    thread_id,
+    format::HandleId                                    memory_id,
+    uint64_t                                            buffer_id,
+    uint32_t                                            format,
+    uint32_t                                            width,
+    uint32_t                                            height,
+    uint32_t                                            stride,
+    uint32_t                                            usage,
+    uint32_t                                            layers,
+    const std::vector<format::HardwareBufferPlaneInfo>& plane_info)
+{
+    if (recording_)
+    {
+        commands_.emplace_back(
+            [thread_id, memory_id, buffer_id, format, width, height, stride, usage, layers, plane_info](
+                ApiDecoder* decoder) {
+                decoder->DispatchCreateHardwareBufferCommand(
+                    thread_id, memory_id, buffer_id, format, width, height, stride, usage, layers, plane_info);
+            });
+    }
+
+    decoder_->DispatchCreateHardwareBufferCommand(
+        thread_id, memory_id, buffer_id, format, width, height, stride, usage, layers, plane_info);
+}
+
+void FrameLoopDecoder::DispatchDestroyHardwareBufferCommand(format::ThreadId thread_id, uint64_t buffer_id)
+{
+    if (recording_)
+    {
+        commands_.emplace_back([thread_id, buffer_id](ApiDecoder* decoder) {
+            decoder->DispatchDestroyHardwareBufferCommand(thread_id, buffer_id);
+        });
+    }
+
+    decoder_->DispatchDestroyHardwareBufferCommand(thread_id, buffer_id);
+}
+
+void FrameLoopDecoder::DispatchSetDevicePropertiesCommand(format::ThreadId   thread_id,
+                                                          format::HandleId   physical_device_id,
+                                                          uint32_t           api_version,
+                                                          uint32_t           driver_version,
+                                                          uint32_t           vendor_id,
+                                                          uint32_t           device_id,
+                                                          uint32_t           device_type,
+                                                          const uint8_t      pipeline_cache_uuid[format::kUuidSize],
+                                                          const std::string& device_name)
+{
+    if (recording_)
+    {
+        std::vector<uint8_t> uuid(pipeline_cache_uuid, pipeline_cache_uuid + format::kUuidSize);
+
+        commands_.emplace_back([thread_id,
+                                physical_device_id,
+                                api_version,
+                                driver_version,
+                                vendor_id,
+                                device_id,
+                                device_type,
+                                uuid,
+                                device_name](ApiDecoder* decoder) {
+            decoder->DispatchSetDevicePropertiesCommand(thread_id,
+                                                        physical_device_id,
+                                                        api_version,
+                                                        driver_version,
+                                                        vendor_id,
+                                                        device_id,
+                                                        device_type,
+                                                        uuid.data(),
+                                                        device_name);
+        });
+    }
+
+    decoder_->DispatchSetDevicePropertiesCommand(thread_id,
+                                                 physical_device_id,
+                                                 api_version,
+                                                 driver_version,
+                                                 vendor_id,
+                                                 device_id,
+                                                 device_type,
+                                                 pipeline_cache_uuid,
+                                                 device_name);
+}
+
+void FrameLoopDecoder::DispatchSetDeviceMemoryPropertiesCommand(
+    format::ThreadId                             thread_id,
+    format::HandleId                             physical_device_id,
+    const std::vector<format::DeviceMemoryType>& memory_types,
+    const std::vector<format::DeviceMemoryHeap>& memory_heaps)
+{
+    if (recording_)
+    {
+        commands_.emplace_back([thread_id, physical_device_id, memory_types, memory_heaps](ApiDecoder* decoder) {
+            decoder->DispatchSetDeviceMemoryPropertiesCommand(
+                thread_id, physical_device_id, memory_types, memory_heaps);
+        });
+    }
+
+    decoder_->DispatchSetDeviceMemoryPropertiesCommand(thread_id, physical_device_id, memory_types, memory_heaps);
+}
+
+void FrameLoopDecoder::DispatchSetSwapchainImageStateCommand(
+    format::ThreadId                                    thread_id,
+    format::HandleId                                    device_id,
+    format::HandleId                                    swapchain_id,
+    uint32_t                                            last_presented_image,
+    const std::vector<format::SwapchainImageStateInfo>& image_state)
+{
+    if (recording_)
+    {
+        commands_.emplace_back(
+            [thread_id, device_id, swapchain_id, last_presented_image, image_state](ApiDecoder* decoder) {
+                decoder->DispatchSetSwapchainImageStateCommand(
+                    thread_id, device_id, swapchain_id, last_presented_image, image_state);
+            });
+    }
+
+    decoder_->DispatchSetSwapchainImageStateCommand(
+        thread_id, device_id, swapchain_id, last_presented_image, image_state);
+}
+
+void FrameLoopDecoder::DispatchBeginResourceInitCommand(format::ThreadId thread_id,
+                                                        format::HandleId device_id,
+                                                        uint64_t         max_resource_size,
+                                                        uint64_t         max_copy_size)
+{
+    if (recording_)
+    {
+        commands_.emplace_back([thread_id, device_id, max_resource_size, max_copy_size](ApiDecoder* decoder) {
+            decoder->DispatchBeginResourceInitCommand(thread_id, device_id, max_resource_size, max_copy_size);
+        });
+    }
+
+    decoder_->DispatchBeginResourceInitCommand(thread_id, device_id, max_resource_size, max_copy_size);
+}
+
+void FrameLoopDecoder::DispatchEndResourceInitCommand(format::ThreadId thread_id, format::HandleId device_id)
+{
+    if (recording_)
+    {
+        commands_.emplace_back([thread_id, device_id](ApiDecoder* decoder) {
+            decoder->DispatchEndResourceInitCommand(thread_id, device_id);
+        });
+    }
+
+    decoder_->DispatchEndResourceInitCommand(thread_id, device_id);
+}
+
+void FrameLoopDecoder::DispatchInitBufferCommand(format::ThreadId thread_id,
+                                                 format::HandleId device_id,
+                                                 format::HandleId buffer_id,
+                                                 uint64_t         data_size,
+                                                 const uint8_t*   data)
+{
+    if (recording_)
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, data_size);
+
+        std::vector<uint8_t> init_data(data, data + static_cast<size_t>(data_size));
+
+        commands_.emplace_back([thread_id, device_id, buffer_id, data_size, init_data](ApiDecoder* decoder) {
+            decoder->DispatchInitBufferCommand(thread_id, device_id, buffer_id, data_size, init_data.data());
+        });
+    }
+
+    decoder_->DispatchInitBufferCommand(thread_id, device_id, buffer_id, data_size, data);
+}
+
+void FrameLoopDecoder::DispatchInitImageCommand(format::ThreadId             thread_id,
+                                                format::HandleId             device_id,
+                                                format::HandleId             image_id,
+                                                uint64_t                     data_size,
+                                                uint32_t                     aspect,
+                                                uint32_t                     layout,
+                                                const std::vector<uint64_t>& level_sizes,
+                                                const uint8_t*               data)
+{
+    if (recording_)
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, data_size);
+
+        std::vector<uint8_t> init_data(data, data + static_cast<size_t>(data_size));
+
+        commands_.emplace_back(
+            [thread_id, device_id, image_id, data_size, aspect, layout, level_sizes, init_data](ApiDecoder* decoder) {
+                decoder->DispatchInitImageCommand(
+                    thread_id, device_id, image_id, data_size, aspect, layout, level_sizes, init_data.data());
+            });
+    }
+
+    decoder_->DispatchInitImageCommand(thread_id, device_id, image_id, data_size, aspect, layout, level_sizes, data);
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,177 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#ifndef GFXRECON_DECODE_FRAME_LOOP_DECODER_H
+#define GFXRECON_DECODE_FRAME_LOOP_DECODER_H
+
+#include "decode/api_decoder.h"
+#include "format/api_call_id.h"
+#include "format/format.h"
+#include "util/defines.h"
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Decoder that forwards calls to another decoder, and that can store copies of the forwarded calls and meta-data
+// commands for a range of frames.  The stored frames can then be forwarded to the decoder again any number of times,
+// without reading or decompressing the capture file, to replay the frame range in a loop.
+class FrameLoopDecoder : public ApiDecoder
+{
+  public:
+    typedef std::function<void()> FrameEndCallback;
+
+  public:
+    FrameLoopDecoder(ApiDecoder* decoder);
+
+    virtual ~FrameLoopDecoder() override {}
+
+    // Starts storing the calls and commands that are forwarded to the decoder, discarding any previously stored frames.
+    void StartRecording();
+
+    void StopRecording() { recording_ = false; }
+
+    bool IsRecording() const { return recording_; }
+
+    // Marks the end of a stored frame, which is used to invoke the frame end callback during replay.
+    void EndRecordedFrame();
+
+    uint32_t GetRecordedFrameCount() const { return static_cast<uint32_t>(frame_ends_.size()); }
+
+    // Object state is not restored between loops, so stored frames can only be replayed again when they do not create,
+    // destroy, allocate, or free objects.  Replaying those calls again would reuse capture IDs that are already mapped
+    // to replay handles, leaking the new handles and destroying stale handles.  Swapchain image acquires are replayed
+    // again, which requires the stored frames to be replayed with offscreen swapchains.
+    bool IsRecordingLoopable() const { return (unloopable_call_ == format::ApiCallId::ApiCall_Unknown); }
+
+    // Returns the first stored call that prevents the stored frames from being replayed again.
+    format::ApiCallId GetUnloopableCall() const { return unloopable_call_; }
+
+    // Forwards the stored calls and commands to the decoder, invoking frame_end_callback after each frame.  The stored
+    // frames must be loopable.
+    void ReplayRecording(const FrameEndCallback& frame_end_callback);
+
+    void ClearRecording();
+
+    virtual bool SupportsApiCall(format::ApiCallId call_id) override { return decoder_->SupportsApiCall(call_id); }
+
+    virtual bool SupportsMetaDataCommand(format::MetaDataType meta_type) override
+    {
+        return decoder_->SupportsMetaDataCommand(meta_type);
+    }
+
+    virtual void DecodeFunctionCall(format::ApiCallId  call_id,
+                                    const ApiCallInfo& call_info,
+                                    const uint8_t*     parameter_buffer,
+                                    size_t             buffer_size) override;
+
+    virtual void DispatchStateBeginMarker(uint64_t frame_number) override;
+
+    virtual void DispatchStateEndMarker(uint64_t frame_number) override;
+
+    virtual void DispatchDisplayMessageCommand(format::ThreadId thread_id, const std::string& message) override;
+
+    virtual void DispatchFillMemoryCommand(
+        format::ThreadId thread_id, uint64_t memory_id, uint64_t offset, uint64_t size, const uint8_t* data) override;
+
+    virtual void DispatchResizeWindowCommand(format::ThreadId thread_id,
+                                             format::HandleId surface_id,
+                                             uint32_t         width,
+                                             uint32_t         height) override;
+
+    virtual void
+    DispatchCreateHardwareBufferCommand(format::ThreadId                                    thread_id,
+                                        format::HandleId                                    memory_id,
+                                        uint64_t                                            buffer_id,
+                                        uint32_t                                            format,
+                                        uint32_t                                            width,
+                                        uint32_t                                            height,
+                                        uint32_t                                            stride,
+                                        uint32_t                                            usage,
+                                        uint32_t                                            layers,
+                                        const std::vector<format::HardwareBufferPlaneInfo>& plane_info) override;
+
+    virtual void DispatchDestroyHardwareBufferCommand(format::ThreadId thread_id, uint64_t buffer_id) override;
+
+    virtual void DispatchSetDevicePropertiesCommand(format::ThreadId   thread_id,
+                                                    format::HandleId   physical_device_id,
+                                                    uint32_t           api_version,
+                                                    uint32_t           driver_version,
+                                                    uint32_t           vendor_id,
+                                                    uint32_t           device_id,
+                                                    uint32_t           device_type,
+                                                    const uint8_t      pipeline_cache_uuid[format::kUuidSize],
+                                                    const std::string& device_name) override;
+
+    virtual void
+    DispatchSetDeviceMemoryPropertiesCommand(format::ThreadId                             thread_id,
+                                             format::HandleId                             physical_device_id,
+                                             const std::vector<format::DeviceMemoryType>& memory_types,
+                                             const std::vector<format::DeviceMemoryHeap>& memory_heaps) override;
+
+    virtual void
+    DispatchSetSwapchainImageStateCommand(format::ThreadId                                    thread_id,
+                                          format::HandleId                                    device_id,
+                                          format::HandleId                                    swapchain_id,
+                                          uint32_t                                            last_presented_image,
+                                          const std::vector<format::SwapchainImageStateInfo>& image_state) override;
+
+    virtual void DispatchBeginResourceInitCommand(format::ThreadId thread_id,
+                                                  format::HandleId device_id,
+                                                  uint64_t         max_resource_size,
+                                                  uint64_t         max_copy_size) override;
+
+    virtual void DispatchEndResourceInitCommand(format::ThreadId thread_id, format::HandleId device_id) override;
+
+    virtual void DispatchInitBufferCommand(format::ThreadId thread_id,
+                                           format::HandleId device_id,
+                                           format::HandleId buffer_id,
+                                           uint64_t         data_size,
+                                           const uint8_t*   data) override;
+
+    virtual void DispatchInitImageCommand(format::ThreadId             thread_id,
+                                          format::HandleId             device_id,
+                                          format::HandleId             image_id,
+                                          uint64_t                     data_size,
+                                          uint32_t                     aspect,
+                                          uint32_t                     layout,
+                                          const std::vector<uint64_t>& level_sizes,
+                                          const uint8_t*               data) override;
+
+  private:
+    typedef std::function<void(ApiDecoder*)> Command;
+
+  private:
+    static bool IsObjectLifetimeCall(format::ApiCallId call_id);
+
+  private:
+    ApiDecoder*          decoder_;
+    bool                 recording_;
+    std::vector<Command> commands_;
+    format::ApiCallId    unloopable_call_;
+
+    // Number of stored commands at the end of each stored frame.
+    std::vector<size_t> frame_ends_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_FRAME_LOOP_DECODER_H
@@ -0,0 +1,309 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#ifndef GFXRECON_DECODE_OBJECT_INFO_PAGE_TABLE_H
+#define GFXRECON_DECODE_OBJECT_INFO_PAGE_TABLE_H
+
+#include "format/format.h"
+#include "util/defines.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Page directory that is shared by the object info tables of all object types, mapping capture IDs to the table and
+// pool slot that store the info for the ID.  Capture IDs are small integers that are assigned in increasing order from
+// a single counter for all object types, so the directory is indexed by capture ID, with fixed size pages that are
+// selected by the upper bits of the ID and allocated on first use.  A single directory is used for all object types so
+// that the memory used for the directory grows with the largest capture ID, and not with the largest capture ID times
+// the number of object types.
+class ObjectInfoDirectory
+{
+  public:
+    struct Entry
+    {
+        uint32_t table{ 0 }; // Zero for unused entries.
+        uint32_t slot{ 0 };
+    };
+
+  public:
+    // Returns a table index, starting from one, that identifies the entries for a table.
+    uint32_t RegisterTable() { return ++table_count_; }
+
+    // Returns the entry for the specified ID, or nullptr if the ID is too large for the directory.  When the entry's
+    // page has not been allocated, the page is allocated if create is true, and nullptr is returned otherwise.
+    Entry* GetEntry(format::HandleId id, bool create)
+    {
+        uint64_t page_index = id >> kPageBits;
+
+        if (page_index >= kMaxPageCount)
+        {
+            return nullptr;
+        }
+
+        if (page_index >= pages_.size())
+        {
+            if (!create)
+            {
+                return nullptr;
+            }
+
+            pages_.resize(static_cast<size_t>(page_index) + 1);
+        }
+
+        std::unique_ptr<Page>& page = pages_[static_cast<size_t>(page_index)];
+        if (page == nullptr)
+        {
+            if (!create)
+            {
+                return nullptr;
+            }
+
+            page = std::make_unique<Page>();
+        }
+
+        return &page->entries[static_cast<size_t>(id & kSlotMask)];
+    }
+
+  private:
+    static const uint64_t kPageBits     = 12;
+    static const uint64_t kPageSize     = 1 << kPageBits;
+    static const uint64_t kSlotMask     = kPageSize - 1;
+    static const uint64_t kMaxPageCount = 1 << 20;
+
+    struct Page
+    {
+        Entry entries[kPageSize];
+    };
+
+  private:
+    uint32_t                           table_count_{ 0 };
+    std::vector<std::unique_ptr<Page>> pages_;
+};
+
+// Storage for the object info structures of one object type.  Infos are stored in a dense pool of fixed size chunks
+// that are allocated on first use and never moved, so the address of an info remains stable while it is in the table.
+// The directory maps capture IDs to pool slots, so a lookup is a directory page load, an entry load, and a chunk load.
+// Slots of removed infos are reused for new infos.  IDs that are too large for the directory, or that are already in
+// the directory for a different object type, are stored in a hash map.
+template <typename T>
+class ObjectInfoPageTable
+{
+  public:
+    ObjectInfoPageTable(ObjectInfoDirectory* directory) : directory_(directory), table_(0)
+    {
+        assert(directory != nullptr);
+        table_ = directory->RegisterTable();
+    }
+
+    ~ObjectInfoPageTable() { Clear(); }
+
+    ObjectInfoPageTable(const ObjectInfoPageTable&) = delete;
+
+    ObjectInfoPageTable& operator=(const ObjectInfoPageTable&) = delete;
+
+    // Adds an info for the specified ID, returning a pointer to the stored info and true if the info was added, or a
+    // pointer to the existing info and false if the ID was already in use, in which case info is not moved from.
+    std::pair<T*, bool> Emplace(format::HandleId id, T&& info)
+    {
+        assert(id != 0);
+
+        ObjectInfoDirectory::Entry* entry = directory_->GetEntry(id, true);
+
+        if ((entry != nullptr) && (entry->table == table_))
+        {
+            return std::make_pair(GetInfo(entry->slot), false);
+        }
+
+        if ((entry == nullptr) || (entry->table != 0))
+        {
+            auto overflow_entry = overflow_map_.find(id);
+            if (overflow_entry != overflow_map_.end())
+            {
+                return std::make_pair(&overflow_entry->second, false);
+            }
+
+            auto result = overflow_map_.emplace(id, std::move(info));
+            return std::make_pair(&result.first->second, true);
+        }
+
+        uint32_t slot = AllocateSlot();
+        T*       ptr  = GetInfo(slot);
+
+        new (ptr) T(std::move(info));
+        chunks_[slot >> kChunkBits]->ids[slot & kChunkMask] = id;
+
+        entry->table = table_;
+        entry->slot  = slot;
+
+        return std::make_pair(ptr, true);
+    }
+
+    // Destroys the info for the specified ID, releasing its slot for reuse.
+    bool Remove(format::HandleId id)
+    {
+        ObjectInfoDirectory::Entry* entry = directory_->GetEntry(id, false);
+
+        if ((entry != nullptr) && (entry->table == table_))
+        {
+            uint32_t slot = entry->slot;
+
+            GetInfo(slot)->~T();
+            chunks_[slot >> kChunkBits]->ids[slot & kChunkMask] = 0;
+            free_slots_.push_back(slot);
+
+            entry->table = 0;
+            entry->slot  = 0;
+
+            return true;
+        }
+
+        return (!overflow_map_.empty() && (overflow_map_.erase(id) != 0));
+    }
+
+    T* Find(format::HandleId id)
+    {
+        ObjectInfoDirectory::Entry* entry = directory_->GetEntry(id, false);
+
+        if ((entry != nullptr) && (entry->table == table_))
+        {
+            return GetInfo(entry->slot);
+        }
+
+        if (!overflow_map_.empty())
+        {
+            auto overflow_entry = overflow_map_.find(id);
+            if (overflow_entry != overflow_map_.end())
+            {
+                return &overflow_entry->second;
+            }
+        }
+
+        return nullptr;
+    }
+
+    const T* Find(format::HandleId id) const { return const_cast<ObjectInfoPageTable*>(this)->Find(id); }
+
+    // Invokes func for each info in the table, stopping when func returns false.
+    template <typename Func>
+    void VisitInfos(Func func)
+    {
+        for (auto& chunk : chunks_)
+        {
+            for (size_t i = 0; i < kChunkSize; ++i)
+            {
+                if ((chunk->ids[i] != 0) && !func(chunk->GetInfo(i)))
+                {
+                    return;
+                }
+            }
+        }
+
+        for (auto& entry : overflow_map_)
+        {
+            if (!func(&entry.second))
+            {
+                return;
+            }
+        }
+    }
+
+    void Clear()
+    {
+        for (auto& chunk : chunks_)
+        {
+            for (size_t i = 0; i < kChunkSize; ++i)
+            {
+                format::HandleId id = chunk->ids[i];
+
+                if (id != 0)
+                {
+                    chunk->GetInfo(i)->~T();
+
+                    ObjectInfoDirectory::Entry* entry = directory_->GetEntry(id, false);
+                    if (entry != nullptr)
+                    {
+                        entry->table = 0;
+                        entry->slot  = 0;
+                    }
+                }
+            }
+        }
+
+        chunks_.clear();
+        free_slots_.clear();
+        overflow_map_.clear();
+        slot_count_ = 0;
+    }
+
+  private:
+    static const uint32_t kChunkBits = 6;
+    static const uint32_t kChunkSize = 1 << kChunkBits;
+    static const uint32_t kChunkMask = kChunkSize - 1;
+
+    struct Chunk
+    {
+        Chunk() { std::fill(std::begin(ids), std::end(ids), static_cast<format::HandleId>(0)); }
+
+        T* GetInfo(size_t index) { return reinterpret_cast<T*>(&storage[index]); }
+
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage[kChunkSize];
+        format::HandleId                                            ids[kChunkSize]; // Zero for unused slots.
+    };
+
+  private:
+    T* GetInfo(uint32_t slot) { return chunks_[slot >> kChunkBits]->GetInfo(slot & kChunkMask); }
+
+    uint32_t AllocateSlot()
+    {
+        if (!free_slots_.empty())
+        {
+            uint32_t slot = free_slots_.back();
+            free_slots_.pop_back();
+            return slot;
+        }
+
+        if ((slot_count_ >> kChunkBits) >= chunks_.size())
+        {
+            chunks_.push_back(std::make_unique<Chunk>());
+        }
+
+        return slot_count_++;
+    }
+
+  private:
+    ObjectInfoDirectory*                    directory_;
+    uint32_t                                table_;
+    uint32_t                                slot_count_{ 0 };
+    std::vector<std::unique_ptr<Chunk>>     chunks_;
+    std::vector<uint32_t>                   free_slots_;
+    std::unordered_map<format::HandleId, T> overflow_map_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_OBJECT_INFO_PAGE_TABLE_H
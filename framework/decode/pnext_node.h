@@ -18,6 +18,7 @@
 #ifndef GFXRECON_DECODE_PNEXT_NODE_H
 #define GFXRECON_DECODE_PNEXT_NODE_H
 
+#include "decode/decode_allocator.h"
 #include "util/defines.h"
 
 #include <cassert>
@@ -33,6 +34,11 @@ class PNextNode
 
     virtual ~PNextNode() {}
 
+    // Nodes are allocated from the active decode allocator.
+    static void* operator new(size_t size) { return DecodeAllocator::AllocateObject(size); }
+
+    static void operator delete(void* data) { DecodeAllocator::FreeObject(data); }
+
     virtual uint32_t GetAttributeMask() const = 0;
 
     virtual uint64_t GetAddress() const = 0;
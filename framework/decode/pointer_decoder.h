@@ -18,6 +18,7 @@
 #ifndef GFXRECON_DECODE_POINTER_DECODER_H
 #define GFXRECON_DECODE_POINTER_DECODER_H
 
+#include "decode/decode_allocator.h"
 #include "decode/pointer_decoder_base.h"
 #include "decode/value_decoder.h"
 #include "format/format.h"
@@ -40,7 +41,7 @@ class PointerDecoder : public PointerDecoderBase
     {
         if ((data_ != nullptr) && !is_memory_external_)
         {
-            delete[] data_;
+            DecodeAllocator::FreeArray(data_, GetLength());
         }
     }
 
@@ -169,7 +170,7 @@ class PointerDecoder : public PointerDecoderBase
         size_t bytes_read = 0;
         size_t len        = GetLength();
 
-        data_ = new T[len];
+        data_ = DecodeAllocator::AllocateArray<T>(len);
 
         if (HasData())
         {
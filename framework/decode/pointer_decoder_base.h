@@ -18,6 +18,7 @@
 #ifndef GFXRECON_DECODE_POINTER_DECODER_BASE_H
 #define GFXRECON_DECODE_POINTER_DECODER_BASE_H
 
+#include "decode/decode_allocator.h"
 #include "decode/value_decoder.h"
 #include "format/format.h"
 #include "util/defines.h"
@@ -32,6 +33,12 @@ class PointerDecoderBase
 
     virtual ~PointerDecoderBase() {}
 
+    // Pointer decoders that are dynamically allocated by struct decoders are allocated from the active decode
+    // allocator.
+    static void* operator new(size_t size) { return DecodeAllocator::AllocateObject(size); }
+
+    static void operator delete(void* data) { DecodeAllocator::FreeObject(data); }
+
     bool IsNull() const
     {
         return ((attrib_ & format::PointerAttributes::kIsNull) == format::PointerAttributes::kIsNull) ? true : false;
@@ -0,0 +1,344 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#include "decode/replay_statistics.h"
+
+#include "format/format_util.h"
+#include "util/date_time.h"
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cinttypes>
+#include <utility>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Timestamps for the API call that is being processed by the current thread.
+static thread_local int64_t call_start_time      = 0;
+static thread_local int64_t call_decode_end_time = 0;
+
+static double ToMilliseconds(int64_t time)
+{
+    return static_cast<double>(time) / 1000000.0;
+}
+
+static int64_t GetFileTime(int64_t wall_time, int64_t decode_time, int64_t replay_time)
+{
+    // Calls processed by worker threads may overlap the replay thread, so the call times can exceed the wall time.
+    return std::max(static_cast<int64_t>(0), wall_time - decode_time - replay_time);
+}
+
+ReplayStatistics::ReplayStatistics() : frame_start_time_(0) {}
+
+void ReplayStatistics::BeginCall()
+{
+    call_start_time      = util::datetime::GetTimestamp();
+    call_decode_end_time = 0;
+}
+
+void ReplayStatistics::EndCallDecode()
+{
+    call_decode_end_time = util::datetime::GetTimestamp();
+}
+
+void ReplayStatistics::EndCall(format::ApiCallId call_id)
+{
+    int64_t end_time = util::datetime::GetTimestamp();
+
+    // Calls that were not dispatched to a consumer only have decode time.
+    int64_t decode_end_time = (call_decode_end_time != 0) ? call_decode_end_time : end_time;
+    int64_t decode_time     = util::datetime::DiffTimestamps(call_start_time, decode_end_time);
+    int64_t replay_time     = util::datetime::DiffTimestamps(decode_end_time, end_time);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    CallStatistics& call_statistics = call_statistics_[call_id];
+    ++call_statistics.count;
+    call_statistics.decode_time += decode_time;
+    call_statistics.replay_time += replay_time;
+
+    current_frame_.decode_time += decode_time;
+    current_frame_.replay_time += replay_time;
+}
+
+void ReplayStatistics::BeginFrame()
+{
+    frame_start_time_ = util::datetime::GetTimestamp();
+}
+
+void ReplayStatistics::EndFrame(uint32_t frame_number)
+{
+    int64_t end_time = util::datetime::GetTimestamp();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    current_frame_.frame_number = frame_number;
+    current_frame_.wall_time    = util::datetime::DiffTimestamps(frame_start_time_, end_time);
+
+    frames_.push_back(current_frame_);
+    current_frame_ = FrameStatistics();
+}
+
+size_t ReplayStatistics::GetCurrentFrameIndex() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return frames_.size();
+}
+
+void ReplayStatistics::AddSubmissionGpuTime(size_t frame_index, int64_t gpu_time)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    FrameStatistics& frame = (frame_index < frames_.size()) ? frames_[frame_index] : current_frame_;
+    frame.gpu_time += gpu_time;
+    ++frame.gpu_submission_count;
+
+    submission_gpu_times_.push_back(gpu_time);
+}
+
+bool ReplayStatistics::WriteReport(const std::string& filename) const
+{
+    FILE*   file   = nullptr;
+    int32_t result = util::platform::FileOpen(&file, filename.c_str(), "w");
+
+    if ((result != 0) || (file == nullptr))
+    {
+        GFXRECON_LOG_ERROR("Failed to open file %s for the replay performance report", filename.c_str());
+        return false;
+    }
+
+    std::string extension = (filename.length() >= 4) ? filename.substr(filename.length() - 4) : "";
+    std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (extension == ".csv")
+        {
+            WriteCsvReport(file);
+        }
+        else
+        {
+            WriteJsonReport(file);
+        }
+    }
+
+    bool success = (ferror(file) == 0);
+    util::platform::FileClose(file);
+
+    if (!success)
+    {
+        GFXRECON_LOG_ERROR("Failed to write the replay performance report to file %s", filename.c_str());
+    }
+
+    return success;
+}
+
+ReplayStatistics::Summary ReplayStatistics::Summarize(std::vector<int64_t> times)
+{
+    Summary summary;
+
+    if (!times.empty())
+    {
+        std::sort(times.begin(), times.end());
+
+        // Nearest-rank percentiles.
+        auto percentile = [&times](size_t p) {
+            size_t rank = ((p * times.size()) + 99) / 100;
+            return ToMilliseconds(times[std::max(rank, static_cast<size_t>(1)) - 1]);
+        };
+
+        int64_t total = 0;
+        for (auto time : times)
+        {
+            total += time;
+        }
+
+        summary.min  = ToMilliseconds(times.front());
+        summary.mean = ToMilliseconds(total) / times.size();
+        summary.p50  = percentile(50);
+        summary.p90  = percentile(90);
+        summary.p95  = percentile(95);
+        summary.p99  = percentile(99);
+        summary.max  = ToMilliseconds(times.back());
+    }
+
+    return summary;
+}
+
+std::vector<std::pair<const char*, ReplayStatistics::Summary>> ReplayStatistics::GetFrameSummaries() const
+{
+    std::vector<int64_t> wall_times;
+    std::vector<int64_t> decode_times;
+    std::vector<int64_t> replay_times;
+    std::vector<int64_t> file_times;
+    std::vector<int64_t> gpu_times;
+
+    for (const auto& frame : frames_)
+    {
+        wall_times.push_back(frame.wall_time);
+        decode_times.push_back(frame.decode_time);
+        replay_times.push_back(frame.replay_time);
+        file_times.push_back(GetFileTime(frame.wall_time, frame.decode_time, frame.replay_time));
+
+        // Frames without timed submissions are excluded from the GPU time summary.
+        if (frame.gpu_submission_count > 0)
+        {
+            gpu_times.push_back(frame.gpu_time);
+        }
+    }
+
+    return { { "wall", Summarize(wall_times) },
+             { "decode", Summarize(decode_times) },
+             { "replay", Summarize(replay_times) },
+             { "file", Summarize(file_times) },
+             { "gpu", Summarize(gpu_times) } };
+}
+
+void ReplayStatistics::WriteJsonReport(FILE* file) const
+{
+    std::vector<std::pair<const char*, Summary>> frame_summaries = GetFrameSummaries();
+    Summary                                      submission_summary = Summarize(submission_gpu_times_);
+
+    auto write_summary = [file](const char* name, const Summary& summary, bool last) {
+        fprintf(file,
+                "      \"%s\": { \"min\": %.4f, \"mean\": %.4f, \"p50\": %.4f, \"p90\": %.4f, \"p95\": %.4f, "
+                "\"p99\": %.4f, \"max\": %.4f }%s\n",
+                name,
+                summary.min,
+                summary.mean,
+                summary.p50,
+                summary.p90,
+                summary.p95,
+                summary.p99,
+                summary.max,
+                last ? "" : ",");
+    };
+
+    fprintf(file, "{\n");
+    fprintf(file, "  \"frames\": {\n");
+    fprintf(file, "    \"count\": %zu,\n", frames_.size());
+    fprintf(file, "    \"times_ms\": {\n");
+    for (size_t i = 0; i < frame_summaries.size(); ++i)
+    {
+        write_summary(frame_summaries[i].first, frame_summaries[i].second, (i + 1 == frame_summaries.size()));
+    }
+    fprintf(file, "    }\n");
+    fprintf(file, "  },\n");
+
+    fprintf(file, "  \"submissions\": {\n");
+    fprintf(file, "    \"count\": %zu,\n", submission_gpu_times_.size());
+    fprintf(file, "    \"times_ms\": {\n");
+    write_summary("gpu", submission_summary, true);
+    fprintf(file, "    }\n");
+    fprintf(file, "  },\n");
+
+    // API calls are listed in order of decreasing replay time.
+    std::vector<std::pair<format::ApiCallId, CallStatistics>> calls(call_statistics_.begin(), call_statistics_.end());
+    std::stable_sort(calls.begin(), calls.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.second.replay_time > rhs.second.replay_time;
+    });
+
+    fprintf(file, "  \"api_calls\": [\n");
+    for (size_t i = 0; i < calls.size(); ++i)
+    {
+        fprintf(file,
+                "    { \"name\": \"%s\", \"id\": %u, \"count\": %" PRIu64
+                ", \"decode_time_ms\": %.4f, \"replay_time_ms\": %.4f }%s\n",
+                format::GetApiCallName(calls[i].first),
+                static_cast<uint32_t>(calls[i].first),
+                calls[i].second.count,
+                ToMilliseconds(calls[i].second.decode_time),
+                ToMilliseconds(calls[i].second.replay_time),
+                (i + 1 < calls.size()) ? "," : "");
+    }
+    fprintf(file, "  ],\n");
+
+    fprintf(file, "  \"frame_times\": [\n");
+    for (size_t i = 0; i < frames_.size(); ++i)
+    {
+        const FrameStatistics& frame = frames_[i];
+        fprintf(file,
+                "    { \"frame\": %u, \"wall_ms\": %.4f, \"decode_ms\": %.4f, \"replay_ms\": %.4f, \"file_ms\": %.4f, "
+                "\"gpu_ms\": %.4f, \"gpu_submissions\": %u }%s\n",
+                frame.frame_number,
+                ToMilliseconds(frame.wall_time),
+                ToMilliseconds(frame.decode_time),
+                ToMilliseconds(frame.replay_time),
+                ToMilliseconds(GetFileTime(frame.wall_time, frame.decode_time, frame.replay_time)),
+                ToMilliseconds(frame.gpu_time),
+                frame.gpu_submission_count,
+                (i + 1 < frames_.size()) ? "," : "");
+    }
+    fprintf(file, "  ]\n");
+    fprintf(file, "}\n");
+}
+
+void ReplayStatistics::WriteCsvReport(FILE* file) const
+{
+    // The CSV report contains a summary of the frame and submission times, the per-frame times, and the per-call times,
+    // with each table preceded by its column headers and separated by an empty line.
+    std::vector<std::pair<const char*, Summary>> summaries = GetFrameSummaries();
+    summaries.emplace_back("submission_gpu", Summarize(submission_gpu_times_));
+
+    fprintf(file, "time_ms,min,mean,p50,p90,p95,p99,max\n");
+    for (const auto& entry : summaries)
+    {
+        const Summary& summary = entry.second;
+        fprintf(file,
+                "%s,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f\n",
+                entry.first,
+                summary.min,
+                summary.mean,
+                summary.p50,
+                summary.p90,
+                summary.p95,
+                summary.p99,
+                summary.max);
+    }
+
+    fprintf(file, "\nframe,wall_ms,decode_ms,replay_ms,file_ms,gpu_ms,gpu_submissions\n");
+    for (const auto& frame : frames_)
+    {
+        fprintf(file,
+                "%u,%.4f,%.4f,%.4f,%.4f,%.4f,%u\n",
+                frame.frame_number,
+                ToMilliseconds(frame.wall_time),
+                ToMilliseconds(frame.decode_time),
+                ToMilliseconds(frame.replay_time),
+                ToMilliseconds(GetFileTime(frame.wall_time, frame.decode_time, frame.replay_time)),
+                ToMilliseconds(frame.gpu_time),
+                frame.gpu_submission_count);
+    }
+
+    fprintf(file, "\napi_call,id,count,decode_time_ms,replay_time_ms\n");
+    for (const auto& entry : call_statistics_)
+    {
+        fprintf(file,
+                "%s,%u,%" PRIu64 ",%.4f,%.4f\n",
+                format::GetApiCallName(entry.first),
+                static_cast<uint32_t>(entry.first),
+                entry.second.count,
+                ToMilliseconds(entry.second.decode_time),
+                ToMilliseconds(entry.second.replay_time));
+    }
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
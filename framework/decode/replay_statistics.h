@@ -0,0 +1,118 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#ifndef GFXRECON_DECODE_REPLAY_STATISTICS_H
+#define GFXRECON_DECODE_REPLAY_STATISTICS_H
+
+#include "format/api_call_id.h"
+#include "util/defines.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Collects replay performance measurements and writes them to a report.  Frame times are split into the time spent
+// decoding API call parameters, the time spent replaying API calls, which is dominated by driver time, and the
+// remaining time, which is spent reading and decompressing file data and processing meta-data commands.  API call
+// measurements are also accumulated for each API call ID, and GPU times are recorded for each queue submission that
+// was timed with timestamp queries.
+class ReplayStatistics
+{
+  public:
+    ReplayStatistics();
+
+    // The API call functions may be called concurrently from multiple threads, with each thread measuring its current
+    // call.
+    void BeginCall();
+
+    void EndCallDecode();
+
+    void EndCall(format::ApiCallId call_id);
+
+    // The frame functions are called by the replay thread.
+    void BeginFrame();
+
+    void EndFrame(uint32_t frame_number);
+
+    // Returns the index of the frame that is currently being replayed, for the attribution of GPU times that are
+    // retrieved after the frame has ended.
+    size_t GetCurrentFrameIndex() const;
+
+    void AddSubmissionGpuTime(size_t frame_index, int64_t gpu_time);
+
+    // Writes the report in CSV format when the file name has a .csv extension, and in JSON format otherwise.
+    bool WriteReport(const std::string& filename) const;
+
+  private:
+    struct CallStatistics
+    {
+        uint64_t count{ 0 };
+        int64_t  decode_time{ 0 };
+        int64_t  replay_time{ 0 };
+    };
+
+    struct FrameStatistics
+    {
+        uint32_t frame_number{ 0 };
+        int64_t  wall_time{ 0 };
+        int64_t  decode_time{ 0 };
+        int64_t  replay_time{ 0 };
+        int64_t  gpu_time{ 0 };
+        uint32_t gpu_submission_count{ 0 };
+    };
+
+    struct Summary
+    {
+        double min{ 0.0 };
+        double mean{ 0.0 };
+        double p50{ 0.0 };
+        double p90{ 0.0 };
+        double p95{ 0.0 };
+        double p99{ 0.0 };
+        double max{ 0.0 };
+    };
+
+  private:
+    // Summarizes times in nanoseconds, with the summary values in milliseconds.
+    static Summary Summarize(std::vector<int64_t> times);
+
+    // Summarizes the wall, decode, replay, file, and GPU times of the replayed frames.
+    std::vector<std::pair<const char*, Summary>> GetFrameSummaries() const;
+
+    void WriteJsonReport(FILE* file) const;
+
+    void WriteCsvReport(FILE* file) const;
+
+  private:
+    mutable std::mutex                          mutex_;
+    std::map<format::ApiCallId, CallStatistics> call_statistics_;
+    std::vector<FrameStatistics>                frames_;
+    FrameStatistics                             current_frame_;
+    int64_t                                     frame_start_time_;
+    std::vector<int64_t>                        submission_gpu_times_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_REPLAY_STATISTICS_H
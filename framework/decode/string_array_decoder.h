@@ -18,6 +18,7 @@
 #ifndef GFXRECON_DECODE_STRING_ARRAY_DECODER_H
 #define GFXRECON_DECODE_STRING_ARRAY_DECODER_H
 
+#include "decode/decode_allocator.h"
 #include "decode/pointer_decoder_base.h"
 #include "decode/value_decoder.h"
 #include "format/format.h"
@@ -82,7 +83,7 @@ class BasicStringArrayDecoder : public PointerDecoderBase
                     bytes_read +=
                         ValueDecoder::DecodeSizeTValue((buffer + bytes_read), (buffer_size - bytes_read), &slen);
 
-                    CharT* value = new CharT[slen + 1];
+                    CharT* value = DecodeAllocator::AllocateArray<CharT>(slen + 1);
 
                     if (((attrib & format::PointerAttributes::kHasData) == format::PointerAttributes::kHasData))
                     {
@@ -120,8 +121,11 @@ class BasicStringArrayDecoder : public PointerDecoderBase
             // Must explicitly destroy the individual strings in the array.
             for (size_t i = 0; i < GetLength(); ++i)
             {
-                delete[] strings_[i];
-                strings_[i] = nullptr;
+                if (strings_[i] != nullptr)
+                {
+                    DecodeAllocator::FreeArray(strings_[i], string_lengths_[i] + 1);
+                    strings_[i] = nullptr;
+                }
             }
         }
     }
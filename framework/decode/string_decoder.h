@@ -18,6 +18,7 @@
 #ifndef GFXRECON_DECODE_STRING_DECODER_H
 #define GFXRECON_DECODE_STRING_DECODER_H
 
+#include "decode/decode_allocator.h"
 #include "decode/pointer_decoder_base.h"
 #include "decode/value_decoder.h"
 #include "format/format.h"
@@ -39,7 +40,7 @@ class BasicStringDecoder : public PointerDecoderBase
     {
         if ((data_ != nullptr) && !is_memory_external_)
         {
-            delete[] data_;
+            DecodeAllocator::FreeArray(data_, capacity_);
         }
     }
 
@@ -76,7 +77,7 @@ class BasicStringDecoder : public PointerDecoderBase
             {
                 assert(data_ == nullptr);
 
-                data_     = new CharT[alloc_len];
+                data_     = DecodeAllocator::AllocateArray<CharT>(alloc_len);
                 capacity_ = alloc_len;
                 bytes_read += ValueDecoder::DecodeArrayFrom<EncodeT>(
                     (buffer + bytes_read), (buffer_size - bytes_read), data_, string_len);
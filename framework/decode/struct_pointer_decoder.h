@@ -19,6 +19,7 @@
 #define GFXRECON_DECODE_STRUCT_POINTER_DECODER_H
 
 #include "decode/custom_vulkan_struct_decoders_forward.h"
+#include "decode/decode_allocator.h"
 #include "decode/pointer_decoder_base.h"
 #include "decode/value_decoder.h"
 #include "format/format.h"
@@ -43,12 +44,12 @@ class StructPointerDecoder : public PointerDecoderBase
     {
         if ((struct_memory_ != nullptr) && !is_memory_external_)
         {
-            delete[] struct_memory_;
+            DecodeAllocator::FreeArray(struct_memory_, capacity_);
         }
 
         if (decoded_structs_ != nullptr)
         {
-            delete[] decoded_structs_;
+            DecodeAllocator::FreeArray(decoded_structs_, GetLength());
         }
     }
 
@@ -115,7 +116,7 @@ class StructPointerDecoder : public PointerDecoderBase
             {
                 assert(struct_memory_ == nullptr);
 
-                struct_memory_ = new typename T::struct_type[len];
+                struct_memory_ = DecodeAllocator::AllocateArray<typename T::struct_type>(len);
                 capacity_      = len;
             }
             else
@@ -132,12 +133,12 @@ class StructPointerDecoder : public PointerDecoderBase
                                          len);
 
                     is_memory_external_ = false;
-                    struct_memory_      = new typename T::struct_type[len];
+                    struct_memory_      = DecodeAllocator::AllocateArray<typename T::struct_type>(len);
                     capacity_           = len;
                 }
             }
 
-            decoded_structs_ = new T[len];
+            decoded_structs_ = DecodeAllocator::AllocateArray<T>(len);
 
             if (HasData())
             {
@@ -0,0 +1,277 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#include "decode/block_index.h"
+#include "decode/file_processor.h"
+#include "format/format.h"
+#include "util/platform.h"
+
+#include <catch2/catch.hpp>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace format = gfxrecon::format;
+
+namespace
+{
+
+using gfxrecon::decode::FileProcessor;
+using gfxrecon::format::ApiCallId;
+
+// Builds a small capture file with three frames, the last of which does not end with a frame delimiter.
+class CaptureWriter
+{
+  public:
+    CaptureWriter()
+    {
+        format::FileHeader header;
+        header.fourcc        = GFXRECON_FOURCC;
+        header.major_version = 0;
+        header.minor_version = 0;
+        header.num_options   = 0;
+        Write(header);
+
+        BeginFrame();
+        WriteFunctionCall(ApiCallId::ApiCall_vkCmdDraw, 1, 12);
+        WriteFunctionCall(ApiCallId::ApiCall_vkQueueSubmit, 1, 24);
+        WriteFunctionCall(ApiCallId::ApiCall_vkQueuePresentKHR, 1, 16);
+
+        BeginFrame();
+        WriteFunctionCall(ApiCallId::ApiCall_vkCmdDraw, 2, 12);
+        WriteFunctionCall(ApiCallId::ApiCall_vkCmdDraw, 2, 12);
+        WriteFunctionCall(ApiCallId::ApiCall_vkQueuePresentKHR, 1, 16);
+
+        BeginFrame();
+        WriteFunctionCall(ApiCallId::ApiCall_vkDeviceWaitIdle, 1, 8);
+    }
+
+    const std::vector<format::FrameIndexEntry>& GetFrameIndex() const { return frame_index_; }
+
+    uint64_t GetBlockCount() const { return block_count_; }
+
+    // Appends the frame index and frame index locator blocks, which are written at the end of the capture file.
+    void WriteFrameIndex()
+    {
+        uint64_t index_offset = data_.size();
+
+        format::FrameIndexCommandHeader index_header;
+        index_header.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+        index_header.meta_header.block_header.size = (sizeof(index_header) - sizeof(format::BlockHeader)) +
+                                                     (frame_index_.size() * sizeof(format::FrameIndexEntry));
+        index_header.meta_header.meta_data_type = format::MetaDataType::kFrameIndexCommand;
+        index_header.frame_count                = frame_index_.size();
+        index_header.state_marker_count         = 0;
+        Write(index_header);
+
+        for (const auto& entry : frame_index_)
+        {
+            Write(entry);
+        }
+
+        format::FrameIndexLocatorCommand locator;
+        locator.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+        locator.meta_header.block_header.size = sizeof(locator) - sizeof(format::BlockHeader);
+        locator.meta_header.meta_data_type    = format::MetaDataType::kFrameIndexLocatorCommand;
+        locator.index_offset                  = index_offset;
+        locator.fourcc                        = GFXRECON_FRAME_INDEX_FOURCC;
+        Write(locator);
+
+        block_count_ += 2;
+    }
+
+    bool WriteFile(const std::string& filename) const
+    {
+        FILE*   file   = nullptr;
+        int32_t result = gfxrecon::util::platform::FileOpen(&file, filename.c_str(), "wb");
+
+        if ((result != 0) || (file == nullptr))
+        {
+            return false;
+        }
+
+        bool success = (gfxrecon::util::platform::FileWrite(data_.data(), data_.size(), 1, file) == 1);
+        gfxrecon::util::platform::FileClose(file);
+
+        return success;
+    }
+
+  private:
+    template <typename T>
+    void Write(const T& value)
+    {
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+        data_.insert(data_.end(), bytes, bytes + sizeof(T));
+    }
+
+    void BeginFrame() { frame_index_.push_back({ data_.size(), 0 }); }
+
+    void WriteFunctionCall(ApiCallId call_id, format::ThreadId thread_id, size_t parameter_size)
+    {
+        format::FunctionCallHeader header;
+        header.block_header.type = format::BlockType::kFunctionCallBlock;
+        header.block_header.size = (sizeof(header) - sizeof(format::BlockHeader)) + parameter_size;
+        header.api_call_id       = call_id;
+        header.thread_id         = thread_id;
+        Write(header);
+
+        data_.insert(data_.end(), parameter_size, 0);
+
+        ++frame_index_.back().block_count;
+        ++block_count_;
+    }
+
+  private:
+    std::vector<uint8_t>                 data_;
+    std::vector<format::FrameIndexEntry> frame_index_;
+    uint64_t                             block_count_{ 0 };
+};
+
+// Removes a test file and its sidecar block index when the test completes.
+class ScopedTestFile
+{
+  public:
+    ScopedTestFile(const std::string& filename) : filename_(filename) {}
+
+    ~ScopedTestFile()
+    {
+        std::remove(filename_.c_str());
+        std::remove(gfxrecon::decode::GetBlockIndexFilename(filename_).c_str());
+    }
+
+    const std::string& GetFilename() const { return filename_; }
+
+  private:
+    std::string filename_;
+};
+
+void CheckFrameIndex(const std::vector<format::FrameIndexEntry>& actual,
+                     const std::vector<format::FrameIndexEntry>& expected)
+{
+    REQUIRE(actual.size() == expected.size());
+
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        CHECK(actual[i].block_offset == expected[i].block_offset);
+        CHECK(actual[i].block_count == expected[i].block_count);
+    }
+}
+
+void CheckBlockIndex(const std::vector<format::BlockIndexEntry>& actual,
+                     const std::vector<format::BlockIndexEntry>& expected)
+{
+    REQUIRE(actual.size() == expected.size());
+
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        CHECK(actual[i].block_offset == expected[i].block_offset);
+        CHECK(actual[i].block_size == expected[i].block_size);
+        CHECK(actual[i].uncompressed_size == expected[i].uncompressed_size);
+        CHECK(actual[i].thread_id == expected[i].thread_id);
+        CHECK(actual[i].frame_number == expected[i].frame_number);
+        CHECK(actual[i].block_type == expected[i].block_type);
+        CHECK(actual[i].block_id == expected[i].block_id);
+    }
+}
+
+} // namespace
+
+TEST_CASE("The frame index is read from the end of the capture file", "[block_index]")
+{
+    CaptureWriter writer;
+    writer.WriteFrameIndex();
+
+    ScopedTestFile test_file("gfxrecon_frame_index_test.gfxr");
+    REQUIRE(writer.WriteFile(test_file.GetFilename()));
+
+    FileProcessor file_processor;
+    REQUIRE(file_processor.Initialize(test_file.GetFilename()));
+    REQUIRE(file_processor.HasFrameIndex());
+    REQUIRE(!file_processor.HasBlockIndex());
+    REQUIRE(file_processor.GetStateMarkerIndex().empty());
+    CheckFrameIndex(file_processor.GetFrameIndex(), writer.GetFrameIndex());
+
+    // The frame index blocks follow the last frame, and are not counted as a frame.
+    std::vector<format::BlockIndexEntry> block_index;
+    REQUIRE(file_processor.BuildBlockIndex(&block_index));
+    REQUIRE(block_index.size() == writer.GetBlockCount());
+    REQUIRE(gfxrecon::decode::GetBlockIndexFrameCount(block_index) == writer.GetFrameIndex().size());
+}
+
+TEST_CASE("Seeking to a frame resumes block processing at the frame", "[block_index]")
+{
+    CaptureWriter writer;
+    writer.WriteFrameIndex();
+
+    ScopedTestFile test_file("gfxrecon_seek_to_frame_test.gfxr");
+    REQUIRE(writer.WriteFile(test_file.GetFilename()));
+
+    FileProcessor file_processor;
+    REQUIRE(file_processor.Initialize(test_file.GetFilename()));
+    REQUIRE(file_processor.SeekToFrame(1));
+    REQUIRE(!file_processor.SeekToFrame(static_cast<uint32_t>(writer.GetFrameIndex().size())));
+
+    std::vector<format::BlockIndexEntry> block_index;
+    REQUIRE(file_processor.BuildBlockIndex(&block_index));
+    REQUIRE(!block_index.empty());
+    REQUIRE(block_index.front().block_offset == writer.GetFrameIndex()[1].block_offset);
+    REQUIRE(block_index.front().frame_number == 1);
+}
+
+TEST_CASE("A block index round trips through the sidecar file and provides the frame index", "[block_index]")
+{
+    // The frame index is derived from the sidecar block index for files without a frame index.
+    CaptureWriter  writer;
+    ScopedTestFile test_file("gfxrecon_block_index_test.gfxr");
+    REQUIRE(writer.WriteFile(test_file.GetFilename()));
+
+    std::vector<format::BlockIndexEntry> block_index;
+    uint64_t                             file_size = 0;
+
+    {
+        FileProcessor file_processor;
+        REQUIRE(file_processor.Initialize(test_file.GetFilename()));
+        REQUIRE(!file_processor.HasFrameIndex());
+        REQUIRE(file_processor.BuildBlockIndex(&block_index));
+        file_size = file_processor.GetFileSize();
+    }
+
+    REQUIRE(block_index.size() == writer.GetBlockCount());
+    REQUIRE(block_index[2].block_id == ApiCallId::ApiCall_vkQueuePresentKHR);
+    REQUIRE(block_index[2].frame_number == 0);
+    REQUIRE(block_index[3].frame_number == 1);
+    REQUIRE(block_index[3].thread_id == 2);
+
+    std::string index_filename = gfxrecon::decode::GetBlockIndexFilename(test_file.GetFilename());
+    REQUIRE(gfxrecon::decode::WriteBlockIndexFile(index_filename, file_size, block_index));
+
+    std::vector<format::BlockIndexEntry> read_index;
+    REQUIRE(gfxrecon::decode::ReadBlockIndexFile(index_filename, file_size, &read_index));
+    CheckBlockIndex(read_index, block_index);
+
+    // The index is rejected when the capture file size does not match.
+    std::vector<format::BlockIndexEntry> mismatched_index;
+    REQUIRE(!gfxrecon::decode::ReadBlockIndexFile(index_filename, file_size + 1, &mismatched_index));
+    REQUIRE(mismatched_index.empty());
+
+    FileProcessor file_processor;
+    REQUIRE(file_processor.Initialize(test_file.GetFilename()));
+    REQUIRE(file_processor.HasBlockIndex());
+    REQUIRE(file_processor.HasFrameIndex());
+    CheckBlockIndex(file_processor.GetBlockIndex(), block_index);
+    CheckFrameIndex(file_processor.GetFrameIndex(), writer.GetFrameIndex());
+}
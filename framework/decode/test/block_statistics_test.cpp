@@ -0,0 +1,188 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#include "decode/block_statistics.h"
+#include "format/format.h"
+#include "format/format_util.h"
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+
+namespace format = gfxrecon::format;
+
+namespace
+{
+
+using gfxrecon::decode::BlockStatistics;
+using gfxrecon::format::ApiCallId;
+
+format::BlockIndexEntry MakeFunctionCall(ApiCallId call_id, format::ThreadId thread_id, uint32_t frame, uint64_t size)
+{
+    format::BlockIndexEntry entry{};
+    entry.block_size        = size;
+    entry.uncompressed_size = size;
+    entry.thread_id         = thread_id;
+    entry.frame_number      = frame;
+    entry.block_type        = format::BlockType::kFunctionCallBlock;
+    entry.block_id          = call_id;
+    return entry;
+}
+
+format::BlockIndexEntry MakeMetaData(format::MetaDataType meta_type, uint32_t frame, uint64_t size)
+{
+    format::BlockIndexEntry entry{};
+    entry.block_size        = size;
+    entry.uncompressed_size = size;
+    entry.frame_number      = frame;
+    entry.block_type        = format::BlockType::kMetaDataBlock;
+    entry.block_id          = meta_type;
+    return entry;
+}
+
+} // namespace
+
+TEST_CASE("Block statistics are aggregated by type, call, thread, and frame", "[block_statistics]")
+{
+    BlockStatistics statistics;
+
+    // Frame 0: 100 bytes.
+    statistics.AddBlock(MakeFunctionCall(ApiCallId::ApiCall_vkCmdDraw, 1, 0, 20));
+    statistics.AddBlock(MakeMetaData(format::MetaDataType::kFillMemoryCommand, 0, 60));
+    statistics.AddBlock(MakeFunctionCall(ApiCallId::ApiCall_vkQueuePresentKHR, 1, 0, 20));
+
+    // Frame 1: 3000 bytes, with a compressed block.
+    format::BlockIndexEntry compressed = MakeFunctionCall(ApiCallId::ApiCall_vkCmdDrawIndexed, 2, 1, 980);
+    compressed.block_type              = format::AddCompressedBlockBit(format::BlockType::kFunctionCallBlock);
+    compressed.uncompressed_size       = 4000;
+    statistics.AddBlock(compressed);
+    statistics.AddBlock(MakeFunctionCall(ApiCallId::ApiCall_vkCmdDispatch, 2, 1, 1000));
+    statistics.AddBlock(MakeFunctionCall(ApiCallId::ApiCall_vkQueuePresentKHR, 1, 1, 1020));
+
+    // The frame index follows the last frame.
+    statistics.AddBlock(MakeMetaData(format::MetaDataType::kFrameIndexCommand, 2, 40));
+    statistics.AddBlock(MakeMetaData(format::MetaDataType::kFrameIndexLocatorCommand, 2, 24));
+
+    REQUIRE(statistics.GetTotalCounts().count == 8);
+    REQUIRE(statistics.GetTotalCounts().stored_size == 3164);
+    REQUIRE(statistics.GetTotalCounts().uncompressed_size == 6184);
+
+    const auto& type_counts = statistics.GetBlockTypeCounts();
+    REQUIRE(type_counts.size() == 2);
+    REQUIRE(type_counts.at(format::BlockType::kFunctionCallBlock).count == 5);
+    REQUIRE(type_counts.at(format::BlockType::kMetaDataBlock).count == 3);
+
+    REQUIRE(statistics.GetApiCallCount(ApiCallId::ApiCall_vkQueuePresentKHR) == 2);
+    REQUIRE(statistics.GetApiCallCount(ApiCallId::ApiCall_vkQueueSubmit) == 0);
+    REQUIRE(statistics.GetApiCallCounts().at(ApiCallId::ApiCall_vkCmdDrawIndexed).uncompressed_size == 4000);
+    REQUIRE(statistics.GetDrawCount() == 2);
+    REQUIRE(statistics.GetDispatchCount() == 1);
+
+    REQUIRE(statistics.GetMetaDataCounts().at(format::MetaDataType::kFillMemoryCommand).stored_size == 60);
+    REQUIRE(statistics.GetMetaDataCounts().at(format::MetaDataType::kFrameIndexCommand).count == 1);
+
+    REQUIRE(statistics.GetThreadCallCounts().at(1) == 3);
+    REQUIRE(statistics.GetThreadCallCounts().at(2) == 2);
+
+    // The frame index blocks are not counted as part of a frame.
+    REQUIRE(statistics.GetFrameCount() == 2);
+    REQUIRE(statistics.GetFrameCounts().size() == 2);
+    REQUIRE(statistics.GetFrameCounts()[0].count == 3);
+    REQUIRE(statistics.GetFrameCounts()[0].stored_size == 100);
+    REQUIRE(statistics.GetFrameCounts()[1].stored_size == 3000);
+
+    // The 100 byte frame is in the [64, 127] bucket and the 3000 byte frame is in the [2048, 4095] bucket.
+    auto histogram = statistics.GetFrameSizeHistogram();
+    REQUIRE(histogram.size() == 6);
+    REQUIRE(histogram.front().min_size == 64);
+    REQUIRE(histogram.front().max_size == 127);
+    REQUIRE(histogram.front().frame_count == 1);
+    REQUIRE(histogram.back().min_size == 2048);
+    REQUIRE(histogram.back().max_size == 4095);
+    REQUIRE(histogram.back().frame_count == 1);
+    REQUIRE(histogram[1].frame_count == 0);
+}
+
+TEST_CASE("Blocks after the last frame delimiter are not counted as a frame", "[block_statistics]")
+{
+    BlockStatistics statistics;
+
+    statistics.AddBlock(MakeFunctionCall(ApiCallId::ApiCall_vkCmdDraw, 1, 0, 20));
+    statistics.AddBlock(MakeFunctionCall(ApiCallId::ApiCall_vkQueuePresentKHR, 1, 0, 80));
+
+    // Blocks recorded after the last present, such as the device teardown, do not form a complete frame.
+    statistics.AddBlock(MakeFunctionCall(ApiCallId::ApiCall_vkDeviceWaitIdle, 1, 1, 16));
+    statistics.AddBlock(MakeFunctionCall(ApiCallId::ApiCall_vkDestroyDevice, 1, 1, 8000));
+    statistics.AddBlock(MakeMetaData(format::MetaDataType::kFrameIndexCommand, 1, 40));
+    statistics.AddBlock(MakeMetaData(format::MetaDataType::kFrameIndexLocatorCommand, 1, 24));
+
+    REQUIRE(statistics.GetFrameCount() == 1);
+    REQUIRE(statistics.GetFrameCounts().size() == 1);
+    REQUIRE(statistics.GetFrameCounts()[0].count == 2);
+    REQUIRE(statistics.GetFrameCounts()[0].stored_size == 100);
+
+    REQUIRE(statistics.GetTrailingCounts().count == 2);
+    REQUIRE(statistics.GetTrailingCounts().stored_size == 8016);
+
+    // The trailing blocks are not part of the histogram.
+    auto histogram = statistics.GetFrameSizeHistogram();
+    REQUIRE(histogram.size() == 1);
+    REQUIRE(histogram.front().min_size == 64);
+    REQUIRE(histogram.front().frame_count == 1);
+
+    // A capture without a present has no complete frames.
+    BlockStatistics no_present;
+    no_present.AddBlock(MakeFunctionCall(ApiCallId::ApiCall_vkCreateInstance, 1, 0, 64));
+
+    REQUIRE(no_present.GetFrameCount() == 0);
+    REQUIRE(no_present.GetFrameCounts().empty());
+    REQUIRE(no_present.GetFrameSizeHistogram().empty());
+    REQUIRE(no_present.GetTrailingCounts().count == 1);
+}
+
+TEST_CASE("Memory fills are ordered by decreasing fill size", "[block_statistics]")
+{
+    BlockStatistics statistics(true);
+
+    format::FillMemoryCommandHeader header{};
+    format::BlockIndexEntry         entry = MakeMetaData(format::MetaDataType::kFillMemoryCommand, 0, 100);
+
+    header.memory_id   = 3;
+    header.memory_size = 64;
+    statistics.AddMemoryFill(entry, header);
+    statistics.AddMemoryFill(entry, header);
+
+    header.memory_id   = 1;
+    header.memory_size = 256;
+    statistics.AddMemoryFill(entry, header);
+
+    header.memory_id   = 2;
+    header.memory_size = 128;
+    statistics.AddMemoryFill(entry, header);
+
+    // Memory 2 and memory 3 have the same fill size, and are ordered by ID.
+    auto fills = statistics.GetLargestMemoryFills(2);
+    REQUIRE(fills.size() == 2);
+    REQUIRE(fills[0].first == 1);
+    REQUIRE(fills[1].first == 2);
+
+    fills = statistics.GetLargestMemoryFills(10);
+    REQUIRE(fills.size() == 3);
+    REQUIRE(fills[2].first == 3);
+    REQUIRE(fills[2].second.count == 2);
+    REQUIRE(fills[2].second.stored_size == 200);
+    REQUIRE(fills[2].second.fill_size == 128);
+}
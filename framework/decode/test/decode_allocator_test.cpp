@@ -0,0 +1,159 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#include "decode/decode_allocator.h"
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+
+using gfxrecon::decode::DecodeAllocator;
+
+// Tracks the number of live instances, to check that the allocator runs constructors and destructors.
+struct Counted
+{
+    Counted() { ++live_count; }
+    ~Counted() { --live_count; }
+
+    static int live_count;
+
+    uint64_t value{ 7 };
+};
+
+int Counted::live_count = 0;
+
+bool IsAligned(const void* data)
+{
+    return (reinterpret_cast<uintptr_t>(data) % alignof(std::max_align_t)) == 0;
+}
+
+} // namespace
+
+TEST_CASE("Arrays are allocated from the active allocator and reused after End", "[decode_allocator]")
+{
+    DecodeAllocator allocator;
+
+    allocator.Begin();
+    uint32_t* first  = DecodeAllocator::AllocateArray<uint32_t>(3);
+    uint8_t*  second = DecodeAllocator::AllocateArray<uint8_t>(5);
+    uint64_t* third  = DecodeAllocator::AllocateArray<uint64_t>(2);
+
+    REQUIRE(first != nullptr);
+    REQUIRE(IsAligned(first));
+    REQUIRE(IsAligned(second));
+    REQUIRE(IsAligned(third));
+    REQUIRE(reinterpret_cast<uint8_t*>(second) >= reinterpret_cast<uint8_t*>(first + 3));
+    REQUIRE(reinterpret_cast<uint8_t*>(third) >= (second + 5));
+
+    DecodeAllocator::FreeArray(third, 2);
+    DecodeAllocator::FreeArray(second, 5);
+    DecodeAllocator::FreeArray(first, 3);
+    allocator.End();
+
+    // Memory is retained for the next call.
+    allocator.Begin();
+    uint32_t* reused = DecodeAllocator::AllocateArray<uint32_t>(3);
+    REQUIRE(reused == first);
+    DecodeAllocator::FreeArray(reused, 3);
+    allocator.End();
+}
+
+TEST_CASE("Allocations fall back to the heap without an active allocator", "[decode_allocator]")
+{
+    int* data = DecodeAllocator::AllocateArray<int>(4);
+    REQUIRE(data != nullptr);
+    DecodeAllocator::FreeArray(data, 4);
+
+    void* object = DecodeAllocator::AllocateObject(32);
+    REQUIRE(object != nullptr);
+    DecodeAllocator::FreeObject(object);
+
+    // Heap allocations that are freed while an allocator is active are released to the heap.
+    DecodeAllocator allocator;
+    int*            heap_data = DecodeAllocator::AllocateArray<int>(4);
+
+    allocator.Begin();
+    DecodeAllocator::FreeArray(heap_data, 4);
+    allocator.End();
+}
+
+TEST_CASE("Array elements are constructed and destroyed", "[decode_allocator]")
+{
+    DecodeAllocator allocator;
+
+    allocator.Begin();
+    Counted* data = DecodeAllocator::AllocateArray<Counted>(10);
+    REQUIRE(Counted::live_count == 10);
+    REQUIRE(data[9].value == 7);
+    DecodeAllocator::FreeArray(data, 10);
+    REQUIRE(Counted::live_count == 0);
+    allocator.End();
+}
+
+TEST_CASE("Allocations larger than a block use a dedicated block", "[decode_allocator]")
+{
+    DecodeAllocator allocator;
+    const size_t    large_size = 1024 * 1024;
+
+    allocator.Begin();
+    uint8_t* small = DecodeAllocator::AllocateArray<uint8_t>(16);
+    uint8_t* large = DecodeAllocator::AllocateArray<uint8_t>(large_size);
+
+    REQUIRE(large != nullptr);
+    REQUIRE(IsAligned(large));
+
+    // The entire allocation must be writable.
+    large[0]              = 1;
+    large[large_size - 1] = 2;
+    small[15]             = 3;
+
+    uint8_t* next = DecodeAllocator::AllocateArray<uint8_t>(16);
+    REQUIRE((((next + 16) <= large) || (next >= (large + large_size))));
+
+    DecodeAllocator::FreeArray(next, 16);
+    DecodeAllocator::FreeArray(large, large_size);
+    DecodeAllocator::FreeArray(small, 16);
+    allocator.End();
+}
+
+TEST_CASE("Nested allocators restore the previous allocator", "[decode_allocator]")
+{
+    DecodeAllocator outer;
+    DecodeAllocator inner;
+
+    outer.Begin();
+    uint32_t* outer_data = DecodeAllocator::AllocateArray<uint32_t>(4);
+
+    inner.Begin();
+    uint32_t* inner_data = DecodeAllocator::AllocateArray<uint32_t>(4);
+    DecodeAllocator::FreeArray(inner_data, 4);
+    inner.End();
+
+    // Allocations continue from the outer allocator, immediately following its earlier allocation.
+    const size_t alignment  = alignof(std::max_align_t);
+    const size_t array_size = ((sizeof(uint32_t) * 4) + (alignment - 1)) & ~(alignment - 1);
+    uint32_t*    more_data  = DecodeAllocator::AllocateArray<uint32_t>(4);
+
+    REQUIRE(reinterpret_cast<uint8_t*>(more_data) == (reinterpret_cast<uint8_t*>(outer_data) + array_size));
+
+    DecodeAllocator::FreeArray(more_data, 4);
+    DecodeAllocator::FreeArray(outer_data, 4);
+    outer.End();
+}
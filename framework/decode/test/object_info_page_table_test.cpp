@@ -0,0 +1,194 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#include "decode/object_info_page_table.h"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using gfxrecon::decode::ObjectInfoDirectory;
+using gfxrecon::decode::ObjectInfoPageTable;
+using gfxrecon::format::HandleId;
+
+struct TestInfo
+{
+    HandleId                 capture_id{ 0 };
+    std::string              name;
+    std::unique_ptr<uint8_t> data; // Move-only member.
+};
+
+TestInfo MakeInfo(HandleId id, const std::string& name)
+{
+    TestInfo info;
+    info.capture_id = id;
+    info.name       = name;
+    return info;
+}
+
+size_t CountInfos(ObjectInfoPageTable<TestInfo>* table)
+{
+    size_t count = 0;
+    table->VisitInfos([&count](const TestInfo*) {
+        ++count;
+        return true;
+    });
+    return count;
+}
+
+} // namespace
+
+TEST_CASE("Infos can be added, found, and removed", "[object_info_page_table]")
+{
+    ObjectInfoDirectory           directory;
+    ObjectInfoPageTable<TestInfo> table(&directory);
+
+    auto result = table.Emplace(1, MakeInfo(1, "first"));
+    REQUIRE(result.second);
+    REQUIRE(result.first->name == "first");
+
+    table.Emplace(2, MakeInfo(2, "second"));
+    table.Emplace(5000, MakeInfo(5000, "other page"));
+
+    REQUIRE(table.Find(1) == result.first);
+    REQUIRE(table.Find(2)->name == "second");
+    REQUIRE(table.Find(5000)->name == "other page");
+    REQUIRE(table.Find(3) == nullptr);
+    REQUIRE(table.Find(100000) == nullptr);
+
+    // Adding an existing ID returns the existing info.
+    auto duplicate = table.Emplace(2, MakeInfo(2, "duplicate"));
+    REQUIRE(!duplicate.second);
+    REQUIRE(duplicate.first->name == "second");
+
+    REQUIRE(table.Remove(2));
+    REQUIRE(!table.Remove(2));
+    REQUIRE(table.Find(2) == nullptr);
+    REQUIRE(CountInfos(&table) == 2);
+}
+
+TEST_CASE("Info addresses are stable while the table grows", "[object_info_page_table]")
+{
+    ObjectInfoDirectory           directory;
+    ObjectInfoPageTable<TestInfo> table(&directory);
+
+    TestInfo* first = table.Emplace(1, MakeInfo(1, "first")).first;
+
+    for (HandleId id = 2; id <= 1000; ++id)
+    {
+        table.Emplace(id, MakeInfo(id, std::to_string(id)));
+    }
+
+    REQUIRE(table.Find(1) == first);
+    REQUIRE(first->name == "first");
+    REQUIRE(table.Find(1000)->capture_id == 1000);
+    REQUIRE(CountInfos(&table) == 1000);
+}
+
+TEST_CASE("IDs can be reused after they are removed", "[object_info_page_table]")
+{
+    ObjectInfoDirectory           directory;
+    ObjectInfoPageTable<TestInfo> buffers(&directory);
+    ObjectInfoPageTable<TestInfo> images(&directory);
+
+    TestInfo* buffer = buffers.Emplace(10, MakeInfo(10, "buffer")).first;
+    buffers.Emplace(11, MakeInfo(11, "next buffer"));
+    REQUIRE(buffers.Remove(10));
+
+    // The slot of the removed info is reused by the same table.
+    auto result = buffers.Emplace(12, MakeInfo(12, "reused slot"));
+    REQUIRE(result.second);
+    REQUIRE(result.first == buffer);
+    REQUIRE(buffers.Find(10) == nullptr);
+    REQUIRE(buffers.Find(12)->name == "reused slot");
+
+    // The removed ID can be added to the same table or to a different table.
+    REQUIRE(buffers.Emplace(10, MakeInfo(10, "buffer again")).second);
+    REQUIRE(buffers.Find(10)->name == "buffer again");
+    REQUIRE(buffers.Remove(10));
+
+    REQUIRE(images.Emplace(10, MakeInfo(10, "image")).second);
+    REQUIRE(images.Find(10)->name == "image");
+    REQUIRE(buffers.Find(10) == nullptr);
+    REQUIRE(buffers.Find(11)->name == "next buffer");
+}
+
+TEST_CASE("IDs that are in use by another table or too large for the directory are stored",
+          "[object_info_page_table]")
+{
+    ObjectInfoDirectory           directory;
+    ObjectInfoPageTable<TestInfo> buffers(&directory);
+    ObjectInfoPageTable<TestInfo> images(&directory);
+
+    const HandleId large_id = static_cast<HandleId>(1) << 40;
+
+    buffers.Emplace(7, MakeInfo(7, "buffer"));
+    REQUIRE(images.Emplace(7, MakeInfo(7, "image")).second);
+    REQUIRE(images.Emplace(large_id, MakeInfo(large_id, "large")).second);
+
+    REQUIRE(buffers.Find(7)->name == "buffer");
+    REQUIRE(images.Find(7)->name == "image");
+    REQUIRE(images.Find(large_id)->name == "large");
+    REQUIRE(buffers.Find(large_id) == nullptr);
+
+    std::set<HandleId> visited;
+    images.VisitInfos([&visited](const TestInfo* info) {
+        visited.insert(info->capture_id);
+        return true;
+    });
+    REQUIRE(visited == std::set<HandleId>{ 7, large_id });
+
+    REQUIRE(images.Remove(7));
+    REQUIRE(images.Find(7) == nullptr);
+    REQUIRE(buffers.Find(7)->name == "buffer");
+}
+
+TEST_CASE("Clearing a table releases its directory entries", "[object_info_page_table]")
+{
+    ObjectInfoDirectory directory;
+    auto                buffers = std::make_unique<ObjectInfoPageTable<TestInfo>>(&directory);
+
+    for (HandleId id = 1; id <= 100; ++id)
+    {
+        buffers->Emplace(id, MakeInfo(id, "buffer"));
+    }
+
+    buffers.reset();
+
+    ObjectInfoPageTable<TestInfo> images(&directory);
+
+    for (HandleId id = 1; id <= 100; ++id)
+    {
+        REQUIRE(images.Emplace(id, MakeInfo(id, "image")).second);
+    }
+
+    // Infos in the dense pool are visited in the order that they were added.
+    std::vector<HandleId> visited;
+    images.VisitInfos([&visited](const TestInfo* info) {
+        visited.push_back(info->capture_id);
+        return true;
+    });
+    REQUIRE(visited.size() == 100);
+    REQUIRE(std::is_sorted(visited.begin(), visited.end()));
+}
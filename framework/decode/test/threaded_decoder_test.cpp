@@ -0,0 +1,314 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+
+#include "decode/threaded_decoder.h"
+#include "format/format.h"
+
+#include <catch2/catch.hpp>
+
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace format = gfxrecon::format;
+
+namespace
+{
+
+using gfxrecon::decode::ApiCallInfo;
+using gfxrecon::decode::ApiDecoder;
+using gfxrecon::decode::ThreadedDecoder;
+using gfxrecon::format::ApiCallId;
+using gfxrecon::format::HandleId;
+
+// Builds call parameter data with the capture file encoding.
+class ParameterWriter
+{
+  public:
+    template <typename T>
+    ParameterWriter& Write(T value)
+    {
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+        data_.insert(data_.end(), bytes, bytes + sizeof(T));
+        return *this;
+    }
+
+    const std::vector<uint8_t>& GetData() const { return data_; }
+
+  private:
+    std::vector<uint8_t> data_;
+};
+
+struct ProcessedCall
+{
+    ApiCallId       call_id;
+    HandleId        command_buffer_id;
+    uint64_t        sequence;
+    std::thread::id thread;
+};
+
+// Decoder that records the calls it receives, in the order that they are received, along with the thread that processed
+// each call.
+class RecordingDecoder : public ApiDecoder
+{
+  public:
+    virtual bool SupportsApiCall(ApiCallId) override { return true; }
+
+    virtual void DecodeFunctionCall(ApiCallId          call_id,
+                                    const ApiCallInfo& call_info,
+                                    const uint8_t*     buffer,
+                                    size_t             buffer_size) override
+    {
+        ProcessedCall call = { call_id, 0, 0, std::this_thread::get_id() };
+
+        // Catch assertions are not thread safe, so the parameter size is checked without them.
+        if (ThreadedDecoder::IsCommandBufferRecordingCall(call_id) &&
+            (buffer_size == (sizeof(HandleId) + sizeof(uint64_t))))
+        {
+            std::memcpy(&call.command_buffer_id, buffer, sizeof(HandleId));
+            std::memcpy(&call.sequence, buffer + sizeof(HandleId), sizeof(uint64_t));
+
+            // Give other workers a chance to run, to expose ordering errors.
+            std::this_thread::yield();
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        calls.push_back(call);
+    }
+
+    virtual void DispatchStateBeginMarker(uint64_t) override {}
+    virtual void DispatchStateEndMarker(uint64_t) override {}
+    virtual void DispatchDisplayMessageCommand(format::ThreadId, const std::string&) override {}
+    virtual void DispatchFillMemoryCommand(format::ThreadId, uint64_t, uint64_t, uint64_t, const uint8_t*) override {}
+    virtual void DispatchResizeWindowCommand(format::ThreadId, HandleId, uint32_t, uint32_t) override {}
+    virtual void DispatchCreateHardwareBufferCommand(format::ThreadId,
+                                                     HandleId,
+                                                     uint64_t,
+                                                     uint32_t,
+                                                     uint32_t,
+                                                     uint32_t,
+                                                     uint32_t,
+                                                     uint32_t,
+                                                     uint32_t,
+                                                     const std::vector<format::HardwareBufferPlaneInfo>&) override
+    {}
+    virtual void DispatchDestroyHardwareBufferCommand(format::ThreadId, uint64_t) override {}
+    virtual void DispatchSetDevicePropertiesCommand(format::ThreadId,
+                                                    HandleId,
+                                                    uint32_t,
+                                                    uint32_t,
+                                                    uint32_t,
+                                                    uint32_t,
+                                                    uint32_t,
+                                                    const uint8_t[format::kUuidSize],
+                                                    const std::string&) override
+    {}
+    virtual void DispatchSetDeviceMemoryPropertiesCommand(format::ThreadId,
+                                                          HandleId,
+                                                          const std::vector<format::DeviceMemoryType>&,
+                                                          const std::vector<format::DeviceMemoryHeap>&) override
+    {}
+    virtual void DispatchSetSwapchainImageStateCommand(format::ThreadId,
+                                                       HandleId,
+                                                       HandleId,
+                                                       uint32_t,
+                                                       const std::vector<format::SwapchainImageStateInfo>&) override
+    {}
+    virtual void DispatchBeginResourceInitCommand(format::ThreadId, HandleId, uint64_t, uint64_t) override {}
+    virtual void DispatchEndResourceInitCommand(format::ThreadId, HandleId) override {}
+    virtual void DispatchInitBufferCommand(format::ThreadId, HandleId, HandleId, uint64_t, const uint8_t*) override {}
+    virtual void DispatchInitImageCommand(format::ThreadId,
+                                          HandleId,
+                                          HandleId,
+                                          uint64_t,
+                                          uint32_t,
+                                          uint32_t,
+                                          const std::vector<uint64_t>&,
+                                          const uint8_t*) override
+    {}
+
+    std::vector<ProcessedCall> calls;
+
+  private:
+    std::mutex mutex_;
+};
+
+void DecodeRecordingCall(ApiDecoder*                decoder,
+                         ApiCallId                  call_id,
+                         format::ThreadId thread_id,
+                         HandleId                   command_buffer_id,
+                         uint64_t                   sequence)
+{
+    ApiCallInfo     call_info;
+    ParameterWriter parameters;
+
+    call_info.thread_id = thread_id;
+    parameters.Write(command_buffer_id).Write(sequence);
+    decoder->DecodeFunctionCall(call_id, call_info, parameters.GetData().data(), parameters.GetData().size());
+}
+
+void DecodeAllocateCommandBuffers(ApiDecoder* decoder, HandleId command_pool_id, const std::vector<HandleId>& ids)
+{
+    using format::PointerAttributes;
+
+    ApiCallInfo     call_info;
+    ParameterWriter parameters;
+
+    // device, pAllocateInfo, pCommandBuffers, and the return value.
+    parameters.Write<HandleId>(1);
+    parameters.Write<uint32_t>(PointerAttributes::kIsSingle | PointerAttributes::kIsStruct |
+                               PointerAttributes::kHasAddress | PointerAttributes::kHasData);
+    parameters.Write<uint64_t>(0x1000);
+    parameters.Write<uint32_t>(40); // VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO
+    parameters.Write<uint32_t>(PointerAttributes::kIsNull);
+    parameters.Write<HandleId>(command_pool_id);
+    parameters.Write<uint32_t>(0); // VK_COMMAND_BUFFER_LEVEL_PRIMARY
+    parameters.Write<uint32_t>(static_cast<uint32_t>(ids.size()));
+    parameters.Write<uint32_t>(PointerAttributes::kIsArray | PointerAttributes::kHasAddress |
+                               PointerAttributes::kHasData);
+    parameters.Write<uint64_t>(0x2000);
+    parameters.Write<uint64_t>(ids.size());
+
+    for (auto id : ids)
+    {
+        parameters.Write<HandleId>(id);
+    }
+
+    parameters.Write<uint32_t>(0); // VK_SUCCESS
+
+    decoder->DecodeFunctionCall(ApiCallId::ApiCall_vkAllocateCommandBuffers,
+                                call_info,
+                                parameters.GetData().data(),
+                                parameters.GetData().size());
+}
+
+// Returns the sequence numbers of the calls for each command buffer, in the order that they were processed.
+std::map<HandleId, std::vector<uint64_t>> GetCommandBufferSequences(const std::vector<ProcessedCall>& calls)
+{
+    std::map<HandleId, std::vector<uint64_t>> sequences;
+
+    for (const auto& call : calls)
+    {
+        if (call.command_buffer_id != 0)
+        {
+            sequences[call.command_buffer_id].push_back(call.sequence);
+        }
+    }
+
+    return sequences;
+}
+
+} // namespace
+
+TEST_CASE("Recording calls are processed in capture order for each command buffer", "[threaded_decoder]")
+{
+    const HandleId kCommandBufferCount = 8;
+    const uint64_t kCallCount          = 4000;
+
+    RecordingDecoder single_threaded;
+    RecordingDecoder multi_threaded;
+
+    {
+        ThreadedDecoder threaded_decoder(&multi_threaded);
+
+        for (uint64_t i = 0; i < kCallCount; ++i)
+        {
+            // The capture thread changes between calls for the same command buffer, as it does for applications that
+            // hand command buffers between threads.
+            HandleId command_buffer_id = 100 + (i % kCommandBufferCount);
+            auto     thread_id         = static_cast<format::ThreadId>(i % 3);
+
+            DecodeRecordingCall(&single_threaded, ApiCallId::ApiCall_vkCmdDraw, thread_id, command_buffer_id, i);
+            DecodeRecordingCall(&threaded_decoder, ApiCallId::ApiCall_vkCmdDraw, thread_id, command_buffer_id, i);
+        }
+
+        threaded_decoder.Flush();
+    }
+
+    REQUIRE(multi_threaded.calls.size() == single_threaded.calls.size());
+    REQUIRE(GetCommandBufferSequences(multi_threaded.calls) == GetCommandBufferSequences(single_threaded.calls));
+}
+
+TEST_CASE("Recording calls for command buffers from the same pool are serialized", "[threaded_decoder]")
+{
+    RecordingDecoder recording_decoder;
+
+    {
+        ThreadedDecoder threaded_decoder(&recording_decoder);
+
+        DecodeAllocateCommandBuffers(&threaded_decoder, 10, { 100, 101 });
+        DecodeAllocateCommandBuffers(&threaded_decoder, 11, { 200 });
+
+        for (uint64_t i = 0; i < 1000; ++i)
+        {
+            DecodeRecordingCall(&threaded_decoder, ApiCallId::ApiCall_vkCmdDraw, 1, 100, i);
+            DecodeRecordingCall(&threaded_decoder, ApiCallId::ApiCall_vkCmdDraw, 2, 101, i);
+            DecodeRecordingCall(&threaded_decoder, ApiCallId::ApiCall_vkCmdDraw, 3, 200, i);
+        }
+
+        threaded_decoder.Flush();
+    }
+
+    std::map<HandleId, std::thread::id> threads;
+    std::vector<HandleId>               pool_order;
+
+    for (const auto& call : recording_decoder.calls)
+    {
+        if (call.command_buffer_id != 0)
+        {
+            auto entry = threads.emplace(call.command_buffer_id, call.thread);
+            REQUIRE(entry.first->second == call.thread);
+
+            if ((call.command_buffer_id == 100) || (call.command_buffer_id == 101))
+            {
+                pool_order.push_back(call.command_buffer_id);
+            }
+        }
+    }
+
+    // Both command buffers from the first pool were recorded by one worker, in capture file order.
+    REQUIRE(threads[100] == threads[101]);
+    REQUIRE(pool_order.size() == 2000);
+
+    for (size_t i = 0; i < pool_order.size(); ++i)
+    {
+        REQUIRE(pool_order[i] == (((i % 2) == 0) ? 100 : 101));
+    }
+}
+
+TEST_CASE("Non-recording calls wait for queued recording calls", "[threaded_decoder]")
+{
+    RecordingDecoder recording_decoder;
+
+    {
+        ThreadedDecoder threaded_decoder(&recording_decoder);
+        ApiCallInfo     call_info;
+
+        for (uint64_t i = 0; i < 100; ++i)
+        {
+            DecodeRecordingCall(&threaded_decoder, ApiCallId::ApiCall_vkCmdDraw, i % 4, 100 + (i % 4), i);
+        }
+
+        threaded_decoder.DecodeFunctionCall(ApiCallId::ApiCall_vkQueueSubmit, call_info, nullptr, 0);
+        threaded_decoder.Flush();
+    }
+
+    REQUIRE(recording_decoder.calls.size() == 101);
+    REQUIRE(recording_decoder.calls.back().call_id == ApiCallId::ApiCall_vkQueueSubmit);
+}
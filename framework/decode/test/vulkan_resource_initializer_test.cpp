@@ -0,0 +1,63 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#include "decode/vulkan_resource_initializer.h"
+
+#include <catch2/catch.hpp>
+
+#include <vector>
+
+using gfxrecon::decode::VulkanResourceInitializer;
+
+TEST_CASE("Staging offsets are aligned from the start of the staging ring", "[vulkan_resource_initializer]")
+{
+    const VkDeviceSize alignment    = VulkanResourceInitializer::kStagingOffsetAlignment;
+    const VkDeviceSize segment_size = VulkanResourceInitializer::kStagingSegmentSize;
+
+    REQUIRE((segment_size % alignment) == 0);
+
+    // Amounts of data already written to a segment, including data that fills the segment up to its last aligned
+    // offset.
+    const std::vector<VkDeviceSize> data_sizes = { 0, 1, 4, 95, 96, 97, 1000, segment_size - alignment };
+
+    for (uint32_t batch_index = 0; batch_index < VulkanResourceInitializer::kBatchCount; ++batch_index)
+    {
+        VkDeviceSize segment_offset = VulkanResourceInitializer::GetStagingSegmentOffset(batch_index);
+
+        REQUIRE((segment_offset % alignment) == 0);
+
+        for (auto data_size : data_sizes)
+        {
+            VkDeviceSize offset = VulkanResourceInitializer::AlignStagingOffset(data_size);
+
+            REQUIRE(offset >= data_size);
+            REQUIRE((offset - data_size) < alignment);
+            REQUIRE(((segment_offset + offset) % alignment) == 0);
+        }
+    }
+}
+
+TEST_CASE("Staging ring segments do not overlap", "[vulkan_resource_initializer]")
+{
+    const VkDeviceSize segment_size = VulkanResourceInitializer::kStagingSegmentSize;
+
+    for (uint32_t batch_index = 1; batch_index < VulkanResourceInitializer::kBatchCount; ++batch_index)
+    {
+        VkDeviceSize previous_end = VulkanResourceInitializer::GetStagingSegmentOffset(batch_index - 1) + segment_size;
+
+        REQUIRE(VulkanResourceInitializer::GetStagingSegmentOffset(batch_index) == previous_end);
+    }
+}
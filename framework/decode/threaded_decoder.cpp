@@ -0,0 +1,567 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#include "decode/threaded_decoder.h"
+
+#include "decode/handle_pointer_decoder.h"
+#include "decode/struct_pointer_decoder.h"
+#include "decode/value_decoder.h"
+#include "generated/generated_vulkan_struct_decoders.h"
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Limit for the number of calls that may be queued for the worker threads before the calling thread waits.
+const size_t kMaxPendingCalls = 16384;
+
+ThreadedDecoder::ThreadedDecoder(ApiDecoder* decoder) :
+    decoder_(decoder), max_workers_(std::max(std::thread::hardware_concurrency(), 1u)), pending_calls_(0), stop_(false)
+{
+    assert(decoder != nullptr);
+}
+
+ThreadedDecoder::~ThreadedDecoder()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+
+    // Workers process their remaining calls before exiting.
+    for (auto& worker : workers_)
+    {
+        worker->condition.notify_one();
+    }
+
+    for (auto& worker : workers_)
+    {
+        worker->thread.join();
+    }
+}
+
+void ThreadedDecoder::Flush()
+{
+    std::exception_ptr error;
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        idle_condition_.wait(lock, [this]() { return pending_calls_ == 0; });
+        std::swap(error, error_);
+    }
+
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+void ThreadedDecoder::DecodeFunctionCall(format::ApiCallId  call_id,
+                                         const ApiCallInfo& call_info,
+                                         const uint8_t*     parameter_buffer,
+                                         size_t             buffer_size)
+{
+    if (IsCommandBufferRecordingCall(call_id))
+    {
+        format::HandleId command_pool_id = GetCommandPool(parameter_buffer, buffer_size);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        idle_condition_.wait(lock, [this]() { return pending_calls_ < kMaxPendingCalls; });
+
+        Worker*    worker = GetWorker(command_pool_id);
+        QueuedCall call   = { call_id, call_info, std::vector<uint8_t>() };
+
+        if (!free_buffers_.empty())
+        {
+            call.parameter_data = std::move(free_buffers_.back());
+            free_buffers_.pop_back();
+        }
+
+        call.parameter_data.assign(parameter_buffer, parameter_buffer + buffer_size);
+
+        worker->calls.emplace_back(std::move(call));
+        ++pending_calls_;
+
+        lock.unlock();
+        worker->condition.notify_one();
+    }
+    else
+    {
+        Flush();
+        UpdateCommandPools(call_id, parameter_buffer, buffer_size);
+        decoder_->DecodeFunctionCall(call_id, call_info, parameter_buffer, buffer_size);
+    }
+}
+
+void ThreadedDecoder::DispatchStateBeginMarker(uint64_t frame_number)
+{
+    Flush();
+    decoder_->DispatchStateBeginMarker(frame_number);
+}
+
+void ThreadedDecoder::DispatchStateEndMarker(uint64_t frame_number)
+{
+    Flush();
+    decoder_->DispatchStateEndMarker(frame_number);
+}
+
+void ThreadedDecoder::DispatchDisplayMessageCommand(format::ThreadId thread_id, const std::string& message)
+{
+    Flush();
+    decoder_->DispatchDisplayMessageCommand(thread_id, message);
+}
+
+void ThreadedDecoder::DispatchFillMemoryCommand(
+    format::ThreadId thread_id, uint64_t memory_id, uint64_t offset, uint64_t size, const uint8_t* data)
+{
+    Flush();
+    decoder_->DispatchFillMemoryCommand(thread_id, memory_id, offset, size, data);
+}
+
+void ThreadedDecoder::DispatchResizeWindowCommand(format::ThreadId thread_id,
+                                                  format::HandleId surface_id,
+                                                  uint32_t         width,
+                                                  uint32_t         height)
+{
+    Flush();
+    decoder_->DispatchResizeWindowCommand(thread_id, surface_id, width, height);
+}
+
+void ThreadedDecoder::DispatchCreateHardwareBufferCommand(
+    format::ThreadId                                    thread_id,
+    format::HandleId                                    memory_id,
+    uint64_t                                            buffer_id,
+    uint32_t                                            format,
+    uint32_t                                            width,
+    uint32_t                                            height,
+    uint32_t                                            stride,
+    uint32_t                                            usage,
+    uint32_t                                            layers,
+    const std::vector<format::HardwareBufferPlaneInfo>& plane_info)
+{
+    Flush();
+    decoder_->DispatchCreateHardwareBufferCommand(
+        thread_id, memory_id, buffer_id, format, width, height, stride, usage, layers, plane_info);
+}
+
+void ThreadedDecoder::DispatchDestroyHardwareBufferCommand(format::ThreadId thread_id, uint64_t buffer_id)
+{
+    Flush();
+    decoder_->DispatchDestroyHardwareBufferCommand(thread_id, buffer_id);
+}
+
+void ThreadedDecoder::DispatchSetDevicePropertiesCommand(format::ThreadId   thread_id,
+                                                         format::HandleId   physical_device_id,
+                                                         uint32_t           api_version,
+                                                         uint32_t           driver_version,
+                                                         uint32_t           vendor_id,
+                                                         uint32_t           device_id,
+                                                         uint32_t           device_type,
+                                                         const uint8_t      pipeline_cache_uuid[format::kUuidSize],
+                                                         const std::string& device_name)
+{
+    Flush();
+    decoder_->DispatchSetDevicePropertiesCommand(thread_id,
+                                                 physical_device_id,
+                                                 api_version,
+                                                 driver_version,
+                                                 vendor_id,
+                                                 device_id,
+                                                 device_type,
+                                                 pipeline_cache_uuid,
+                                                 device_name);
+}
+
+void ThreadedDecoder::DispatchSetDeviceMemoryPropertiesCommand(
+    format::ThreadId                             thread_id,
+    format::HandleId                             physical_device_id,
+    const std::vector<format::DeviceMemoryType>& memory_types,
+    const std::vector<format::DeviceMemoryHeap>& memory_heaps)
+{
+    Flush();
+    decoder_->DispatchSetDeviceMemoryPropertiesCommand(thread_id, physical_device_id, memory_types, memory_heaps);
+}
+
+void ThreadedDecoder::DispatchSetSwapchainImageStateCommand(
+    format::ThreadId                                    thread_id,
+    format::HandleId                                    device_id,
+    format::HandleId                                    swapchain_id,
+    uint32_t                                            last_presented_image,
+    const std::vector<format::SwapchainImageStateInfo>& image_state)
+{
+    Flush();
+    decoder_->DispatchSetSwapchainImageStateCommand(
+        thread_id, device_id, swapchain_id, last_presented_image, image_state);
+}
+
+void ThreadedDecoder::DispatchBeginResourceInitCommand(format::ThreadId thread_id,
+                                                       format::HandleId device_id,
+                                                       uint64_t         max_resource_size,
+                                                       uint64_t         max_copy_size)
+{
+    Flush();
+    decoder_->DispatchBeginResourceInitCommand(thread_id, device_id, max_resource_size, max_copy_size);
+}
+
+void ThreadedDecoder::DispatchEndResourceInitCommand(format::ThreadId thread_id, format::HandleId device_id)
+{
+    Flush();
+    decoder_->DispatchEndResourceInitCommand(thread_id, device_id);
+}
+
+void ThreadedDecoder::DispatchInitBufferCommand(format::ThreadId thread_id,
+                                                format::HandleId device_id,
+                                                format::HandleId buffer_id,
+                                                uint64_t         data_size,
+                                                const uint8_t*   data)
+{
+    Flush();
+    decoder_->DispatchInitBufferCommand(thread_id, device_id, buffer_id, data_size, data);
+}
+
+void ThreadedDecoder::DispatchInitImageCommand(format::ThreadId             thread_id,
+                                               format::HandleId             device_id,
+                                               format::HandleId             image_id,
+                                               uint64_t                     data_size,
+                                               uint32_t                     aspect,
+                                               uint32_t                     layout,
+                                               const std::vector<uint64_t>& level_sizes,
+                                               const uint8_t*               data)
+{
+    Flush();
+    decoder_->DispatchInitImageCommand(thread_id, device_id, image_id, data_size, aspect, layout, level_sizes, data);
+}
+
+bool ThreadedDecoder::IsCommandBufferRecordingCall(format::ApiCallId call_id)
+{
+    // vkCmdExecuteCommands is excluded, as the secondary command buffers that it references may be recorded by other
+    // capture threads, and must be complete before it is processed.
+    switch (call_id)
+    {
+        case format::ApiCallId::ApiCall_vkBeginCommandBuffer:
+        case format::ApiCallId::ApiCall_vkEndCommandBuffer:
+        case format::ApiCallId::ApiCall_vkResetCommandBuffer:
+        case format::ApiCallId::ApiCall_vkCmdBindPipeline:
+        case format::ApiCallId::ApiCall_vkCmdSetViewport:
+        case format::ApiCallId::ApiCall_vkCmdSetScissor:
+        case format::ApiCallId::ApiCall_vkCmdSetLineWidth:
+        case format::ApiCallId::ApiCall_vkCmdSetDepthBias:
+        case format::ApiCallId::ApiCall_vkCmdSetBlendConstants:
+        case format::ApiCallId::ApiCall_vkCmdSetDepthBounds:
+        case format::ApiCallId::ApiCall_vkCmdSetStencilCompareMask:
+        case format::ApiCallId::ApiCall_vkCmdSetStencilWriteMask:
+        case format::ApiCallId::ApiCall_vkCmdSetStencilReference:
+        case format::ApiCallId::ApiCall_vkCmdBindDescriptorSets:
+        case format::ApiCallId::ApiCall_vkCmdBindIndexBuffer:
+        case format::ApiCallId::ApiCall_vkCmdBindVertexBuffers:
+        case format::ApiCallId::ApiCall_vkCmdDraw:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndexed:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndirect:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirect:
+        case format::ApiCallId::ApiCall_vkCmdDispatch:
+        case format::ApiCallId::ApiCall_vkCmdDispatchIndirect:
+        case format::ApiCallId::ApiCall_vkCmdCopyBuffer:
+        case format::ApiCallId::ApiCall_vkCmdCopyImage:
+        case format::ApiCallId::ApiCall_vkCmdBlitImage:
+        case format::ApiCallId::ApiCall_vkCmdCopyBufferToImage:
+        case format::ApiCallId::ApiCall_vkCmdCopyImageToBuffer:
+        case format::ApiCallId::ApiCall_vkCmdUpdateBuffer:
+        case format::ApiCallId::ApiCall_vkCmdFillBuffer:
+        case format::ApiCallId::ApiCall_vkCmdClearColorImage:
+        case format::ApiCallId::ApiCall_vkCmdClearDepthStencilImage:
+        case format::ApiCallId::ApiCall_vkCmdClearAttachments:
+        case format::ApiCallId::ApiCall_vkCmdResolveImage:
+        case format::ApiCallId::ApiCall_vkCmdSetEvent:
+        case format::ApiCallId::ApiCall_vkCmdResetEvent:
+        case format::ApiCallId::ApiCall_vkCmdWaitEvents:
+        case format::ApiCallId::ApiCall_vkCmdPipelineBarrier:
+        case format::ApiCallId::ApiCall_vkCmdBeginQuery:
+        case format::ApiCallId::ApiCall_vkCmdEndQuery:
+        case format::ApiCallId::ApiCall_vkCmdResetQueryPool:
+        case format::ApiCallId::ApiCall_vkCmdWriteTimestamp:
+        case format::ApiCallId::ApiCall_vkCmdCopyQueryPoolResults:
+        case format::ApiCallId::ApiCall_vkCmdPushConstants:
+        case format::ApiCallId::ApiCall_vkCmdBeginRenderPass:
+        case format::ApiCallId::ApiCall_vkCmdNextSubpass:
+        case format::ApiCallId::ApiCall_vkCmdEndRenderPass:
+        case format::ApiCallId::ApiCall_vkCmdSetDeviceMask:
+        case format::ApiCallId::ApiCall_vkCmdDispatchBase:
+        case format::ApiCallId::ApiCall_vkCmdSetDeviceMaskKHR:
+        case format::ApiCallId::ApiCall_vkCmdDispatchBaseKHR:
+        case format::ApiCallId::ApiCall_vkCmdPushDescriptorSetKHR:
+        case format::ApiCallId::ApiCall_vkCmdPushDescriptorSetWithTemplateKHR:
+        case format::ApiCallId::ApiCall_vkCmdBeginRenderPass2KHR:
+        case format::ApiCallId::ApiCall_vkCmdNextSubpass2KHR:
+        case format::ApiCallId::ApiCall_vkCmdEndRenderPass2KHR:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndirectCountKHR:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountKHR:
+        case format::ApiCallId::ApiCall_vkCmdDebugMarkerBeginEXT:
+        case format::ApiCallId::ApiCall_vkCmdDebugMarkerEndEXT:
+        case format::ApiCallId::ApiCall_vkCmdDebugMarkerInsertEXT:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndirectCountAMD:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountAMD:
+        case format::ApiCallId::ApiCall_vkCmdBeginConditionalRenderingEXT:
+        case format::ApiCallId::ApiCall_vkCmdEndConditionalRenderingEXT:
+        case format::ApiCallId::ApiCall_vkCmdProcessCommandsNVX:
+        case format::ApiCallId::ApiCall_vkCmdReserveSpaceForCommandsNVX:
+        case format::ApiCallId::ApiCall_vkCmdSetViewportWScalingNV:
+        case format::ApiCallId::ApiCall_vkCmdSetDiscardRectangleEXT:
+        case format::ApiCallId::ApiCall_vkCmdBeginDebugUtilsLabelEXT:
+        case format::ApiCallId::ApiCall_vkCmdEndDebugUtilsLabelEXT:
+        case format::ApiCallId::ApiCall_vkCmdInsertDebugUtilsLabelEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetSampleLocationsEXT:
+        case format::ApiCallId::ApiCall_vkCmdWriteBufferMarkerAMD:
+        case format::ApiCallId::ApiCall_vkCmdBindShadingRateImageNV:
+        case format::ApiCallId::ApiCall_vkCmdSetViewportShadingRatePaletteNV:
+        case format::ApiCallId::ApiCall_vkCmdSetCoarseSampleOrderNV:
+        case format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructureNV:
+        case format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureNV:
+        case format::ApiCallId::ApiCall_vkCmdTraceRaysNV:
+        case format::ApiCallId::ApiCall_vkCmdWriteAccelerationStructuresPropertiesNV:
+        case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksNV:
+        case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectNV:
+        case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectCountNV:
+        case format::ApiCallId::ApiCall_vkCmdSetExclusiveScissorNV:
+        case format::ApiCallId::ApiCall_vkCmdSetCheckpointNV:
+        case format::ApiCallId::ApiCall_vkCmdBindTransformFeedbackBuffersEXT:
+        case format::ApiCallId::ApiCall_vkCmdBeginTransformFeedbackEXT:
+        case format::ApiCallId::ApiCall_vkCmdEndTransformFeedbackEXT:
+        case format::ApiCallId::ApiCall_vkCmdBeginQueryIndexedEXT:
+        case format::ApiCallId::ApiCall_vkCmdEndQueryIndexedEXT:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndirectByteCountEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetPerformanceMarkerINTEL:
+        case format::ApiCallId::ApiCall_vkCmdSetPerformanceStreamMarkerINTEL:
+        case format::ApiCallId::ApiCall_vkCmdSetPerformanceOverrideINTEL:
+        case format::ApiCallId::ApiCall_vkCmdSetLineStippleEXT:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndirectCount:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCount:
+        case format::ApiCallId::ApiCall_vkCmdBeginRenderPass2:
+        case format::ApiCallId::ApiCall_vkCmdNextSubpass2:
+        case format::ApiCallId::ApiCall_vkCmdEndRenderPass2:
+        case format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructureKHR:
+        case format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructureIndirectKHR:
+        case format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureKHR:
+        case format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureToMemoryKHR:
+        case format::ApiCallId::ApiCall_vkCmdCopyMemoryToAccelerationStructureKHR:
+        case format::ApiCallId::ApiCall_vkCmdTraceRaysKHR:
+        case format::ApiCallId::ApiCall_vkCmdWriteAccelerationStructuresPropertiesKHR:
+        case format::ApiCallId::ApiCall_vkCmdTraceRaysIndirectKHR:
+        case format::ApiCallId::ApiCall_vkCmdPreprocessGeneratedCommandsNV:
+        case format::ApiCallId::ApiCall_vkCmdExecuteGeneratedCommandsNV:
+        case format::ApiCallId::ApiCall_vkCmdBindPipelineShaderGroupNV:
+        case format::ApiCallId::ApiCall_vkCmdSetCullModeEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetFrontFaceEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetPrimitiveTopologyEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetViewportWithCountEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetScissorWithCountEXT:
+        case format::ApiCallId::ApiCall_vkCmdBindVertexBuffers2EXT:
+        case format::ApiCallId::ApiCall_vkCmdSetDepthTestEnableEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetDepthWriteEnableEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetDepthCompareOpEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetDepthBoundsTestEnableEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetStencilTestEnableEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetStencilOpEXT:
+            return true;
+        default:
+            return false;
+    }
+}
+
+ThreadedDecoder::Worker* ThreadedDecoder::GetWorker(format::HandleId command_pool_id)
+{
+    // Called with mutex_ locked.
+    auto entry = pool_workers_.find(command_pool_id);
+    if (entry != pool_workers_.end())
+    {
+        return entry->second;
+    }
+
+    Worker* result = nullptr;
+
+    if (workers_.size() < max_workers_)
+    {
+        std::unique_ptr<Worker> worker = std::make_unique<Worker>();
+        result                         = worker.get();
+
+        GFXRECON_LOG_INFO("Creating replay worker thread %" PRIuPTR, workers_.size());
+
+        worker->thread = std::thread(&ThreadedDecoder::ProcessCalls, this, result);
+        workers_.emplace_back(std::move(worker));
+    }
+    else
+    {
+        // Pools beyond the worker limit share the existing workers.  A pool is never moved to another worker, so its
+        // calls remain in capture file order.
+        result = workers_[pool_workers_.size() % workers_.size()].get();
+    }
+
+    pool_workers_.emplace(command_pool_id, result);
+
+    return result;
+}
+
+format::HandleId ThreadedDecoder::GetCommandPool(const uint8_t* parameter_buffer, size_t buffer_size) const
+{
+    // Every recording call has the command buffer as its first parameter.
+    format::HandleId command_buffer_id = 0;
+    ValueDecoder::DecodeHandleIdValue(parameter_buffer, buffer_size, &command_buffer_id);
+
+    auto entry = command_buffer_pools_.find(command_buffer_id);
+    if (entry != command_buffer_pools_.end())
+    {
+        return entry->second;
+    }
+
+    // The command buffer ID can't collide with a pool ID, as handle IDs are unique across object types.
+    return command_buffer_id;
+}
+
+void ThreadedDecoder::UpdateCommandPools(format::ApiCallId call_id, const uint8_t* parameter_buffer, size_t buffer_size)
+{
+    // Called after Flush, when no recording calls are being processed.
+    if (call_id == format::ApiCallId::ApiCall_vkAllocateCommandBuffers)
+    {
+        size_t                                                    bytes_read = 0;
+        format::HandleId                                          device     = 0;
+        StructPointerDecoder<Decoded_VkCommandBufferAllocateInfo> allocate_info;
+        HandlePointerDecoder<VkCommandBuffer>                     command_buffers;
+
+        bytes_read += ValueDecoder::DecodeHandleIdValue(parameter_buffer, buffer_size, &device);
+        bytes_read += allocate_info.Decode(parameter_buffer + bytes_read, buffer_size - bytes_read);
+        command_buffers.Decode(parameter_buffer + bytes_read, buffer_size - bytes_read);
+
+        const Decoded_VkCommandBufferAllocateInfo* allocate_info_meta = allocate_info.GetMetaStructPointer();
+        const format::HandleId*                    command_buffer_ids = command_buffers.GetPointer();
+
+        if ((allocate_info_meta != nullptr) && (command_buffer_ids != nullptr))
+        {
+            for (size_t i = 0; i < command_buffers.GetLength(); ++i)
+            {
+                command_buffer_pools_[command_buffer_ids[i]] = allocate_info_meta->commandPool;
+            }
+        }
+    }
+    else if (call_id == format::ApiCallId::ApiCall_vkFreeCommandBuffers)
+    {
+        size_t                                bytes_read           = 0;
+        format::HandleId                      device               = 0;
+        format::HandleId                      command_pool         = 0;
+        uint32_t                              command_buffer_count = 0;
+        HandlePointerDecoder<VkCommandBuffer> command_buffers;
+
+        bytes_read += ValueDecoder::DecodeHandleIdValue(parameter_buffer, buffer_size, &device);
+        bytes_read +=
+            ValueDecoder::DecodeHandleIdValue(parameter_buffer + bytes_read, buffer_size - bytes_read, &command_pool);
+        bytes_read += ValueDecoder::DecodeUInt32Value(
+            parameter_buffer + bytes_read, buffer_size - bytes_read, &command_buffer_count);
+        command_buffers.Decode(parameter_buffer + bytes_read, buffer_size - bytes_read);
+
+        const format::HandleId* command_buffer_ids = command_buffers.GetPointer();
+
+        if (command_buffer_ids != nullptr)
+        {
+            for (size_t i = 0; i < command_buffers.GetLength(); ++i)
+            {
+                command_buffer_pools_.erase(command_buffer_ids[i]);
+            }
+        }
+    }
+    else if (call_id == format::ApiCallId::ApiCall_vkDestroyCommandPool)
+    {
+        size_t           bytes_read   = 0;
+        format::HandleId device       = 0;
+        format::HandleId command_pool = 0;
+
+        bytes_read += ValueDecoder::DecodeHandleIdValue(parameter_buffer, buffer_size, &device);
+        ValueDecoder::DecodeHandleIdValue(parameter_buffer + bytes_read, buffer_size - bytes_read, &command_pool);
+
+        // Destroying the pool frees its command buffers.
+        for (auto entry = command_buffer_pools_.begin(); entry != command_buffer_pools_.end();)
+        {
+            if (entry->second == command_pool)
+            {
+                entry = command_buffer_pools_.erase(entry);
+            }
+            else
+            {
+                ++entry;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        pool_workers_.erase(command_pool);
+    }
+}
+
+void ThreadedDecoder::ProcessCalls(Worker* worker)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (true)
+    {
+        worker->condition.wait(lock, [this, worker]() { return stop_ || !worker->calls.empty(); });
+
+        if (worker->calls.empty())
+        {
+            // Stop was requested and all queued calls have been processed.
+            break;
+        }
+
+        QueuedCall call = std::move(worker->calls.front());
+        worker->calls.pop_front();
+
+        // Calls that follow a failed call are discarded, as the error will end replay when it is rethrown by Flush.
+        bool discard = static_cast<bool>(error_);
+
+        lock.unlock();
+
+        if (!discard)
+        {
+            try
+            {
+                decoder_->DecodeFunctionCall(
+                    call.call_id, call.call_info, call.parameter_data.data(), call.parameter_data.size());
+            }
+            catch (...)
+            {
+                lock.lock();
+                if (!error_)
+                {
+                    error_ = std::current_exception();
+                }
+                lock.unlock();
+            }
+        }
+
+        lock.lock();
+
+        free_buffers_.emplace_back(std::move(call.parameter_data));
+        --pending_calls_;
+
+        if ((pending_calls_ == 0) || (pending_calls_ == (kMaxPendingCalls - 1)))
+        {
+            idle_condition_.notify_one();
+        }
+    }
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
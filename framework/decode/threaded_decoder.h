@@ -0,0 +1,191 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#ifndef GFXRECON_DECODE_THREADED_DECODER_H
+#define GFXRECON_DECODE_THREADED_DECODER_H
+
+#include "decode/api_decoder.h"
+#include "format/api_call_id.h"
+#include "format/format.h"
+#include "util/defines.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Decoder that forwards calls to another decoder, processing command buffer recording calls on worker threads.  Each
+// recording call is assigned to a worker by the command pool of the command buffer that it records to, so all calls
+// for command buffers from the same pool, which the application must externally synchronize, are processed by one
+// worker in capture file order, while command buffers from different pools are recorded concurrently.  The command
+// pool for each command buffer is tracked from the vkAllocateCommandBuffers calls; command buffers with an unknown
+// pool are assigned to a worker by their own handle ID.  All other calls and meta-data commands, which include queue
+// submission, object creation and destruction, and synchronization, first wait for the worker threads to process
+// their queued calls and are then processed on the calling thread, so they are ordered with respect to every call
+// that precedes them in the file.
+class ThreadedDecoder : public ApiDecoder
+{
+  public:
+    ThreadedDecoder(ApiDecoder* decoder);
+
+    virtual ~ThreadedDecoder() override;
+
+    // Waits for the worker threads to process all queued calls.  Exceptions thrown while processing calls on a worker
+    // thread are rethrown by Flush.
+    void Flush();
+
+    virtual bool SupportsApiCall(format::ApiCallId call_id) override { return decoder_->SupportsApiCall(call_id); }
+
+    virtual bool SupportsMetaDataCommand(format::MetaDataType meta_type) override
+    {
+        return decoder_->SupportsMetaDataCommand(meta_type);
+    }
+
+    virtual void DecodeFunctionCall(format::ApiCallId  call_id,
+                                    const ApiCallInfo& call_info,
+                                    const uint8_t*     parameter_buffer,
+                                    size_t             buffer_size) override;
+
+    virtual void DispatchStateBeginMarker(uint64_t frame_number) override;
+
+    virtual void DispatchStateEndMarker(uint64_t frame_number) override;
+
+    virtual void DispatchDisplayMessageCommand(format::ThreadId thread_id, const std::string& message) override;
+
+    virtual void DispatchFillMemoryCommand(
+        format::ThreadId thread_id, uint64_t memory_id, uint64_t offset, uint64_t size, const uint8_t* data) override;
+
+    virtual void DispatchResizeWindowCommand(format::ThreadId thread_id,
+                                             format::HandleId surface_id,
+                                             uint32_t         width,
+                                             uint32_t         height) override;
+
+    virtual void
+    DispatchCreateHardwareBufferCommand(format::ThreadId                                    thread_id,
+                                        format::HandleId                                    memory_id,
+                                        uint64_t                                            buffer_id,
+                                        uint32_t                                            format,
+                                        uint32_t                                            width,
+                                        uint32_t                                            height,
+                                        uint32_t                                            stride,
+                                        uint32_t                                            usage,
+                                        uint32_t                                            layers,
+                                        const std::vector<format::HardwareBufferPlaneInfo>& plane_info) override;
+
+    virtual void DispatchDestroyHardwareBufferCommand(format::ThreadId thread_id, uint64_t buffer_id) override;
+
+    virtual void DispatchSetDevicePropertiesCommand(format::ThreadId   thread_id,
+                                                    format::HandleId   physical_device_id,
+                                                    uint32_t           api_version,
+                                                    uint32_t           driver_version,
+                                                    uint32_t           vendor_id,
+                                                    uint32_t           device_id,
+                                                    uint32_t           device_type,
+                                                    const uint8_t      pipeline_cache_uuid[format::kUuidSize],
+                                                    const std::string& device_name) override;
+
+    virtual void
+    DispatchSetDeviceMemoryPropertiesCommand(format::ThreadId                             thread_id,
+                                             format::HandleId                             physical_device_id,
+                                             const std::vector<format::DeviceMemoryType>& memory_types,
+                                             const std::vector<format::DeviceMemoryHeap>& memory_heaps) override;
+
+    virtual void
+    DispatchSetSwapchainImageStateCommand(format::ThreadId                                    thread_id,
+                                          format::HandleId                                    device_id,
+                                          format::HandleId                                    swapchain_id,
+                                          uint32_t                                            last_presented_image,
+                                          const std::vector<format::SwapchainImageStateInfo>& image_state) override;
+
+    virtual void DispatchBeginResourceInitCommand(format::ThreadId thread_id,
+                                                  format::HandleId device_id,
+                                                  uint64_t         max_resource_size,
+                                                  uint64_t         max_copy_size) override;
+
+    virtual void DispatchEndResourceInitCommand(format::ThreadId thread_id, format::HandleId device_id) override;
+
+    virtual void DispatchInitBufferCommand(format::ThreadId thread_id,
+                                           format::HandleId device_id,
+                                           format::HandleId buffer_id,
+                                           uint64_t         data_size,
+                                           const uint8_t*   data) override;
+
+    virtual void DispatchInitImageCommand(format::ThreadId             thread_id,
+                                          format::HandleId             device_id,
+                                          format::HandleId             image_id,
+                                          uint64_t                     data_size,
+                                          uint32_t                     aspect,
+                                          uint32_t                     layout,
+                                          const std::vector<uint64_t>& level_sizes,
+                                          const uint8_t*               data) override;
+
+    // Calls that only record commands to a command buffer, which the application must externally synchronize, and
+    // which may be processed concurrently with calls from other capture threads.
+    static bool IsCommandBufferRecordingCall(format::ApiCallId call_id);
+
+  private:
+    struct QueuedCall
+    {
+        format::ApiCallId    call_id;
+        ApiCallInfo          call_info;
+        std::vector<uint8_t> parameter_data;
+    };
+
+    struct Worker
+    {
+        std::thread             thread;
+        std::deque<QueuedCall>  calls;
+        std::condition_variable condition;
+    };
+
+  private:
+    Worker* GetWorker(format::HandleId command_pool_id);
+
+    // Returns the ID of the command pool of the command buffer that is the first parameter of a recording call.
+    format::HandleId GetCommandPool(const uint8_t* parameter_buffer, size_t buffer_size) const;
+
+    // Tracks command buffer allocation and release, to assign recording calls to workers by command pool.
+    void UpdateCommandPools(format::ApiCallId call_id, const uint8_t* parameter_buffer, size_t buffer_size);
+
+    void ProcessCalls(Worker* worker);
+
+  private:
+    ApiDecoder*                                            decoder_;
+    std::mutex                                             mutex_;
+    std::condition_variable                                idle_condition_;
+    std::vector<std::unique_ptr<Worker>>                   workers_;
+    size_t                                                 max_workers_;
+    std::unordered_map<format::HandleId, Worker*>          pool_workers_;
+    std::unordered_map<format::HandleId, format::HandleId> command_buffer_pools_;
+    std::vector<std::vector<uint8_t>>                      free_buffers_;
+    std::exception_ptr                                     error_;
+    size_t                                                 pending_calls_;
+    bool                                                   stop_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_THREADED_DECODER_H
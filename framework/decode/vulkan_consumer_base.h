@@ -18,6 +18,7 @@
 #ifndef GFXRECON_DECODE_VULKAN_CONSUMER_BASE_H
 #define GFXRECON_DECODE_VULKAN_CONSUMER_BASE_H
 
+#include "format/api_call_id.h"
 #include "format/platform_types.h"
 #include "decode/custom_vulkan_struct_decoders.h"
 #include "decode/descriptor_update_template_decoder.h"
@@ -41,6 +42,24 @@ class VulkanConsumerBase
 
     virtual ~VulkanConsumerBase() {}
 
+    // Reports the API calls that are processed by the consumer.  The decoder skips calls that are not processed by any
+    // of its consumers without decoding their parameters, so consumers that only override a few Process_* methods
+    // should override this to return true for the calls that they process.
+    virtual bool SupportsApiCall(format::ApiCallId call_id) const
+    {
+        GFXRECON_UNREFERENCED_PARAMETER(call_id);
+        return true;
+    }
+
+    // Reports the meta-data commands that are processed by the consumer.  Consumers that do not process meta-data
+    // commands such as kFillMemoryCommand, which may contain large amounts of data, should override this to return
+    // false, so that the file processor can skip the data when no other consumer processes the command.
+    virtual bool SupportsMetaDataCommand(format::MetaDataType meta_type) const
+    {
+        GFXRECON_UNREFERENCED_PARAMETER(meta_type);
+        return true;
+    }
+
     virtual void ProcessStateBeginMarker(uint64_t frame_number) {}
 
     virtual void ProcessStateEndMarker(uint64_t frame_number) {}
@@ -91,6 +110,23 @@ class VulkanConsumerBase
 
     virtual void ProcessEndResourceInitCommand(format::HandleId device_id) {}
 
+    // Retrieve memory that the data for the next ProcessInitBufferCommand or ProcessInitImageCommand call can be read
+    // to directly, such as mapped staging memory.  The memory is then provided as the data parameter of the process
+    // call.  A return value of nullptr indicates that the data should be read to memory managed by the decoder.
+    virtual uint8_t*
+    GetInitBufferCommandData(format::HandleId device_id, format::HandleId buffer_id, uint64_t data_size)
+    {
+        return nullptr;
+    }
+
+    virtual uint8_t* GetInitImageCommandData(format::HandleId device_id,
+                                             format::HandleId image_id,
+                                             uint64_t         data_size,
+                                             uint32_t         aspect)
+    {
+        return nullptr;
+    }
+
     virtual void ProcessInitBufferCommand(format::HandleId device_id,
                                           format::HandleId buffer_id,
                                           uint64_t         data_size,
@@ -24,6 +24,33 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+DecodeAllocator& VulkanDecoderBase::GetDecodeAllocator()
+{
+    static thread_local DecodeAllocator decode_allocator;
+    return decode_allocator;
+}
+
+void VulkanDecoderBase::UpdateConsumedApiCalls()
+{
+    for (size_t i = 0; i < consumed_api_calls_.size(); ++i)
+    {
+        format::ApiCallId call_id =
+            static_cast<format::ApiCallId>(format::ApiCallId::ApiCall_vkCreateInstance + static_cast<uint32_t>(i));
+        uint8_t consumed = 0;
+
+        for (auto consumer : consumers_)
+        {
+            if (consumer->SupportsApiCall(call_id))
+            {
+                consumed = 1;
+                break;
+            }
+        }
+
+        consumed_api_calls_[i] = consumed;
+    }
+}
+
 void VulkanDecoderBase::DispatchStateBeginMarker(uint64_t frame_number)
 {
     for (auto consumer : consumers_)
@@ -182,6 +209,39 @@ void VulkanDecoderBase::DispatchEndResourceInitCommand(format::ThreadId thread_i
     }
 }
 
+uint8_t* VulkanDecoderBase::GetInitBufferCommandData(format::ThreadId thread_id,
+                                                     format::HandleId device_id,
+                                                     format::HandleId buffer_id,
+                                                     uint64_t         data_size)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(thread_id);
+
+    // Data that is read to memory provided by a consumer is not available to other consumers.
+    if (consumers_.size() == 1)
+    {
+        return consumers_[0]->GetInitBufferCommandData(device_id, buffer_id, data_size);
+    }
+
+    return nullptr;
+}
+
+uint8_t* VulkanDecoderBase::GetInitImageCommandData(format::ThreadId thread_id,
+                                                    format::HandleId device_id,
+                                                    format::HandleId image_id,
+                                                    uint64_t         data_size,
+                                                    uint32_t         aspect)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(thread_id);
+
+    // Data that is read to memory provided by a consumer is not available to other consumers.
+    if (consumers_.size() == 1)
+    {
+        return consumers_[0]->GetInitImageCommandData(device_id, image_id, data_size, aspect);
+    }
+
+    return nullptr;
+}
+
 void VulkanDecoderBase::DispatchInitBufferCommand(format::ThreadId thread_id,
                                                   format::HandleId device_id,
                                                   format::HandleId buffer_id,
@@ -230,6 +290,8 @@ size_t VulkanDecoderBase::Decode_vkUpdateDescriptorSetWithTemplate(const uint8_t
         (parameter_buffer + bytes_read), (buffer_size - bytes_read), &descriptorUpdateTemplate);
     bytes_read += pData.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : consumers_)
     {
         consumer->Process_vkUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, &pData);
@@ -258,6 +320,8 @@ size_t VulkanDecoderBase::Decode_vkCmdPushDescriptorSetWithTemplateKHR(const uin
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &set);
     bytes_read += pData.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : consumers_)
     {
         consumer->Process_vkCmdPushDescriptorSetWithTemplateKHR(
@@ -285,6 +349,8 @@ size_t VulkanDecoderBase::Decode_vkUpdateDescriptorSetWithTemplateKHR(const uint
         (parameter_buffer + bytes_read), (buffer_size - bytes_read), &descriptorUpdateTemplate);
     bytes_read += pData.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : consumers_)
     {
         consumer->Process_vkUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, &pData);
@@ -19,6 +19,8 @@
 #define GFXRECON_DECODE_VULKAN_DECODER_BASE_H
 
 #include "decode/api_decoder.h"
+#include "decode/decode_allocator.h"
+#include "decode/replay_statistics.h"
 #include "format/api_call_id.h"
 #include "format/format.h"
 #include "format/platform_types.h"
@@ -36,21 +38,44 @@ GFXRECON_BEGIN_NAMESPACE(decode)
 class VulkanDecoderBase : public ApiDecoder
 {
   public:
-    VulkanDecoderBase() {}
+    VulkanDecoderBase() : consumed_api_calls_(GetApiCallIndexCount(), 0), statistics_(nullptr) {}
 
     virtual ~VulkanDecoderBase() override {}
 
-    void AddConsumer(VulkanConsumer* consumer) { consumers_.push_back(consumer); }
+    void AddConsumer(VulkanConsumer* consumer)
+    {
+        consumers_.push_back(consumer);
+        UpdateConsumedApiCalls();
+    }
+
+    // Enables the measurement of the decode and replay times of each API call.
+    void SetReplayStatistics(ReplayStatistics* statistics) { statistics_ = statistics; }
 
     void RemoveConsumer(VulkanConsumer* consumer)
     {
         consumers_.erase(std::remove(consumers_.begin(), consumers_.end(), consumer));
+        UpdateConsumedApiCalls();
     }
 
+    // Only reports the API calls that are processed by at least one consumer, so that the file processor can skip the
+    // remaining calls without reading their parameter data.
     virtual bool SupportsApiCall(format::ApiCallId call_id) override
     {
-        return ((call_id >= format::ApiCallId::ApiCall_vkCreateInstance) &&
-                (call_id < format::ApiCallId::ApiCall_VulkanLast));
+        size_t index = GetApiCallIndex(call_id);
+        return ((index < consumed_api_calls_.size()) && (consumed_api_calls_[index] != 0));
+    }
+
+    virtual bool SupportsMetaDataCommand(format::MetaDataType meta_type) override
+    {
+        for (auto consumer : consumers_)
+        {
+            if (consumer->SupportsMetaDataCommand(meta_type))
+            {
+                return true;
+            }
+        }
+
+        return false;
     }
 
     virtual void DecodeFunctionCall(format::ApiCallId  call_id,
@@ -116,6 +141,17 @@ class VulkanDecoderBase : public ApiDecoder
 
     virtual void DispatchEndResourceInitCommand(format::ThreadId thread_id, format::HandleId device_id) override;
 
+    virtual uint8_t* GetInitBufferCommandData(format::ThreadId thread_id,
+                                              format::HandleId device_id,
+                                              format::HandleId buffer_id,
+                                              uint64_t         data_size) override;
+
+    virtual uint8_t* GetInitImageCommandData(format::ThreadId thread_id,
+                                             format::HandleId device_id,
+                                             format::HandleId image_id,
+                                             uint64_t         data_size,
+                                             uint32_t         aspect) override;
+
     virtual void DispatchInitBufferCommand(format::ThreadId thread_id,
                                            format::HandleId device_id,
                                            format::HandleId buffer_id,
@@ -134,7 +170,51 @@ class VulkanDecoderBase : public ApiDecoder
   protected:
     const std::vector<VulkanConsumer*>& GetConsumers() const { return consumers_; }
 
+    // Index of a Vulkan API call ID in the dense tables that are indexed by API call.  Returns a value greater than or
+    // equal to GetApiCallIndexCount() for IDs that do not belong to the Vulkan API family.
+    static size_t GetApiCallIndex(format::ApiCallId call_id)
+    {
+        return static_cast<size_t>(call_id - format::ApiCallId::ApiCall_vkCreateInstance);
+    }
+
+    static size_t GetApiCallIndexCount()
+    {
+        return static_cast<size_t>(format::ApiCallId::ApiCall_VulkanLast - format::ApiCallId::ApiCall_vkCreateInstance);
+    }
+
+    // Allocator for the memory used to decode the parameters of the current call, which is released after the call
+    // has been dispatched to the consumers.  Each thread has its own allocator, so calls may be decoded concurrently.
+    static DecodeAllocator& GetDecodeAllocator();
+
+    // Call measurement hooks, which are called when decoding begins, when the decoded call is dispatched to the
+    // consumers, and after the consumers have processed the call.
+    void BeginCallStatistics()
+    {
+        if (statistics_ != nullptr)
+        {
+            statistics_->BeginCall();
+        }
+    }
+
+    void EndCallDecodeStatistics()
+    {
+        if (statistics_ != nullptr)
+        {
+            statistics_->EndCallDecode();
+        }
+    }
+
+    void EndCallStatistics(format::ApiCallId call_id)
+    {
+        if (statistics_ != nullptr)
+        {
+            statistics_->EndCall(call_id);
+        }
+    }
+
   private:
+    void UpdateConsumedApiCalls();
+
     size_t Decode_vkUpdateDescriptorSetWithTemplate(const uint8_t* parameter_buffer, size_t buffer_size);
 
     size_t Decode_vkCmdPushDescriptorSetWithTemplateKHR(const uint8_t* parameter_buffer, size_t buffer_size);
@@ -143,6 +223,8 @@ class VulkanDecoderBase : public ApiDecoder
 
   private:
     std::vector<VulkanConsumer*> consumers_;
+    std::vector<uint8_t>         consumed_api_calls_; // Non-zero for calls processed by a consumer, by API call index.
+    ReplayStatistics*            statistics_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
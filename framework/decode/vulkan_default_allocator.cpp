@@ -378,6 +378,14 @@ VkResult VulkanDefaultAllocator::WriteMappedMemoryRange(MemoryData     allocator
     return result;
 }
 
+VkResult VulkanDefaultAllocator::SubmitPendingWrites(VkQueue queue, uint32_t queue_family_index)
+{
+    // Mapped memory writes are written directly to the replay memory, so there are no pending writes.
+    GFXRECON_UNREFERENCED_PARAMETER(queue);
+    GFXRECON_UNREFERENCED_PARAMETER(queue_family_index);
+    return VK_SUCCESS;
+}
+
 void VulkanDefaultAllocator::ReportAllocateMemoryIncompatibility(const VkMemoryAllocateInfo* allocate_info)
 {
     if ((allocate_info != nullptr) && (allocate_info->memoryTypeIndex >= memory_properties_.memoryTypeCount))
@@ -129,6 +129,8 @@ class VulkanDefaultAllocator : public VulkanResourceAllocator
     virtual VkResult
     WriteMappedMemoryRange(MemoryData allocator_data, uint64_t offset, uint64_t size, const uint8_t* data) override;
 
+    virtual VkResult SubmitPendingWrites(VkQueue queue, uint32_t queue_family_index) override;
+
     virtual void ReportAllocateMemoryIncompatibility(const VkMemoryAllocateInfo* allocate_info) override;
 
     virtual void ReportBindBufferIncompatibility(VkBuffer     buffer,
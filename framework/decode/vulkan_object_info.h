@@ -17,8 +17,10 @@
 #ifndef GFXRECON_DECODE_VULKAN_OBJECT_INFO_H
 #define GFXRECON_DECODE_VULKAN_OBJECT_INFO_H
 
+#include "decode/vulkan_offscreen_swapchain.h"
 #include "decode/vulkan_resource_allocator.h"
 #include "decode/vulkan_resource_initializer.h"
+#include "decode/vulkan_submit_timer.h"
 #include "decode/window.h"
 #include "format/format.h"
 #include "generated/generated_vulkan_dispatch_table.h"
@@ -232,11 +234,24 @@ struct DeviceInfo : public VulkanObjectInfo<VkDevice>
     // Ensure swapchains and surfaces are cleaned up on exit to avoid issues encountered when calling xcb_disconnect
     // with active xcb surfaces.
     std::unordered_set<VkSwapchainKHR> active_swapchains;
+
+    // Swapchains that were replaced with offscreen images, which are not tracked as active swapchains.
+    std::unordered_map<VkSwapchainKHR, std::unique_ptr<VulkanOffscreenSwapchain>> offscreen_swapchains;
+
+    // Pipeline cache owned by replay, which is used for all pipeline creation when a persistent pipeline cache file is
+    // enabled, and is saved to the file when the device is destroyed.
+    VkPipelineCache replay_pipeline_cache{ VK_NULL_HANDLE };
+    std::string     replay_pipeline_cache_file;
+
+    // Timestamp queries for measuring the GPU time of queue submissions, when the replay performance report is enabled.
+    std::unique_ptr<VulkanSubmitTimer> submit_timer;
 };
 
 struct QueueInfo : public VulkanObjectInfo<VkQueue>
 {
     std::unordered_map<uint32_t, size_t> array_counts;
+    format::HandleId                     parent_id{ 0 };
+    uint32_t                             queue_family_index{ 0 };
 };
 
 struct DeviceMemoryInfo : public VulkanObjectInfo<VkDeviceMemory>
@@ -18,6 +18,7 @@
 #ifndef GFXRECON_DECODE_VULKAN_OBJECT_MAPPER_H
 #define GFXRECON_DECODE_VULKAN_OBJECT_MAPPER_H
 
+#include "decode/object_info_page_table.h"
 #include "decode/vulkan_object_info.h"
 #include "format/format.h"
 #include "util/defines.h"
@@ -26,7 +27,6 @@
 #include "vulkan/vulkan.h"
 
 #include <cassert>
-#include <unordered_map>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
@@ -164,37 +164,37 @@ class VulkanObjectInfoTable
 
     void ReplaceSemaphore(VkSemaphore target, VkSemaphore replacement)
     {
-        for (auto& entry : semaphore_map_)
-        {
-            if (entry.second.handle == target)
+        semaphore_map_.VisitInfos([target, replacement](SemaphoreInfo* info) {
+            if (info->handle == target)
             {
-                entry.second.handle = replacement;
-                break;
+                info->handle = replacement;
+                return false;
             }
-        }
+            return true;
+        });
     }
 
     void ReplaceFence(VkFence target, VkFence replacement)
     {
-        for (auto& entry : fence_map_)
-        {
-            if (entry.second.handle == target)
+        fence_map_.VisitInfos([target, replacement](FenceInfo* info) {
+            if (info->handle == target)
             {
-                entry.second.handle = replacement;
-                break;
+                info->handle = replacement;
+                return false;
             }
-        }
+            return true;
+        });
     }
 
   private:
     template <typename T>
-    void AddObjectInfo(T&& info, std::unordered_map<format::HandleId, T>* map)
+    void AddObjectInfo(T&& info, ObjectInfoPageTable<T>* map)
     {
         assert(map != nullptr);
 
         if ((info.capture_id != 0) && (info.handle != VK_NULL_HANDLE))
         {
-            auto result = map->emplace(info.capture_id, std::forward<T>(info));
+            auto result = map->Emplace(info.capture_id, std::forward<T>(info));
 
             if (!result.second)
             {
@@ -206,17 +206,17 @@ class VulkanObjectInfoTable
                 // temporary objects created during the trimmed file state setup. IDs may be reused when creating these
                 // temporary objects, creating a case where we have a new handle that is not a duplicate of the existing
                 // map entry. In this case, the map entry needs to be updated with the new object's info.
-                auto iter = result.first;
-                if (iter->second.handle != info.handle)
+                T* existing_info = result.first;
+                if (existing_info->handle != info.handle)
                 {
-                    iter->second = std::forward<T>(info);
+                    *existing_info = std::forward<T>(info);
                 }
             }
         }
     }
 
     template <typename T>
-    const T* GetObjectInfo(format::HandleId id, const std::unordered_map<format::HandleId, T>* map) const
+    const T* GetObjectInfo(format::HandleId id, const ObjectInfoPageTable<T>* map) const
     {
         assert(map != nullptr);
 
@@ -224,13 +224,9 @@ class VulkanObjectInfoTable
 
         if (id != 0)
         {
-            const auto entry = map->find(id);
+            object_info = map->Find(id);
 
-            if (entry != map->end())
-            {
-                object_info = &entry->second;
-            }
-            else
+            if (object_info == nullptr)
             {
                 GFXRECON_LOG_WARNING("Failed to map handle for object id %" PRIu64, id);
             }
@@ -240,7 +236,7 @@ class VulkanObjectInfoTable
     }
 
     template <typename T>
-    T* GetObjectInfo(format::HandleId id, std::unordered_map<format::HandleId, T>* map)
+    T* GetObjectInfo(format::HandleId id, ObjectInfoPageTable<T>* map)
     {
         assert(map != nullptr);
 
@@ -248,13 +244,9 @@ class VulkanObjectInfoTable
 
         if (id != 0)
         {
-            auto entry = map->find(id);
+            object_info = map->Find(id);
 
-            if (entry != map->end())
-            {
-                object_info = &entry->second;
-            }
-            else
+            if (object_info == nullptr)
             {
                 GFXRECON_LOG_WARNING("Failed to map handle for object id %" PRIu64, id);
             }
@@ -264,47 +256,49 @@ class VulkanObjectInfoTable
     }
 
   private:
-    std::unordered_map<format::HandleId, InstanceInfo>                      instance_map_;
-    std::unordered_map<format::HandleId, PhysicalDeviceInfo>                physical_device_map_;
-    std::unordered_map<format::HandleId, DeviceInfo>                        device_map_;
-    std::unordered_map<format::HandleId, QueueInfo>                         queue_map_;
-    std::unordered_map<format::HandleId, SemaphoreInfo>                     semaphore_map_;
-    std::unordered_map<format::HandleId, CommandBufferInfo>                 command_buffer_map_;
-    std::unordered_map<format::HandleId, FenceInfo>                         fence_map_;
-    std::unordered_map<format::HandleId, DeviceMemoryInfo>                  device_memory_map_;
-    std::unordered_map<format::HandleId, BufferInfo>                        buffer_map_;
-    std::unordered_map<format::HandleId, ImageInfo>                         image_map_;
-    std::unordered_map<format::HandleId, EventInfo>                         event_map_;
-    std::unordered_map<format::HandleId, QueryPoolInfo>                     query_pool_map_;
-    std::unordered_map<format::HandleId, BufferViewInfo>                    buffer_view_map_;
-    std::unordered_map<format::HandleId, ImageViewInfo>                     image_view_map_;
-    std::unordered_map<format::HandleId, ShaderModuleInfo>                  shader_module_map_;
-    std::unordered_map<format::HandleId, PipelineCacheInfo>                 pipeline_cache_map_;
-    std::unordered_map<format::HandleId, PipelineLayoutInfo>                pipeline_layout_map_;
-    std::unordered_map<format::HandleId, RenderPassInfo>                    render_pass_map_;
-    std::unordered_map<format::HandleId, PipelineInfo>                      pipeline_map_;
-    std::unordered_map<format::HandleId, DescriptorSetLayoutInfo>           descriptor_set_layout_map_;
-    std::unordered_map<format::HandleId, SamplerInfo>                       sampler_map_;
-    std::unordered_map<format::HandleId, DescriptorPoolInfo>                descriptor_pool_map_;
-    std::unordered_map<format::HandleId, DescriptorSetInfo>                 descriptor_set_map_;
-    std::unordered_map<format::HandleId, FramebufferInfo>                   framebuffer_map_;
-    std::unordered_map<format::HandleId, CommandPoolInfo>                   command_pool_map_;
-    std::unordered_map<format::HandleId, SamplerYcbcrConversionInfo>        sampler_ycbcr_conversion_map_;
-    std::unordered_map<format::HandleId, DescriptorUpdateTemplateInfo>      descriptor_update_template_map_;
-    std::unordered_map<format::HandleId, SurfaceKHRInfo>                    surface_khr_map_;
-    std::unordered_map<format::HandleId, SwapchainKHRInfo>                  swapchain_khr_map_;
-    std::unordered_map<format::HandleId, DisplayKHRInfo>                    display_khr_map_;
-    std::unordered_map<format::HandleId, DisplayModeKHRInfo>                display_mode_khr_map_;
-    std::unordered_map<format::HandleId, SamplerYcbcrConversionKHRInfo>     sampler_ycbcr_conversion_khr_map_;
-    std::unordered_map<format::HandleId, DebugReportCallbackEXTInfo>        debug_report_callback_ext_map_;
-    std::unordered_map<format::HandleId, IndirectCommandsLayoutNVInfo>      indirect_commands_layout_nv_map_;
-    std::unordered_map<format::HandleId, DebugUtilsMessengerEXTInfo>        debug_utils_messenger_ext_map_;
-    std::unordered_map<format::HandleId, ValidationCacheEXTInfo>            validation_cache_ext_map_;
-    std::unordered_map<format::HandleId, AccelerationStructureKHRInfo>      acceleration_structure_khr_map_;
-    std::unordered_map<format::HandleId, AccelerationStructureNVInfo>       acceleration_structure_nv_map_;
-    std::unordered_map<format::HandleId, PerformanceConfigurationINTELInfo> performance_configuration_intel_map_;
-    std::unordered_map<format::HandleId, DeferredOperationKHRInfo>          deferred_operation_khr_map_;
-    std::unordered_map<format::HandleId, PrivateDataSlotEXTInfo>            private_data_slot_ext_map_;
+    // The directory must be declared before the tables, which register with the directory when they are constructed.
+    ObjectInfoDirectory                                    directory_;
+    ObjectInfoPageTable<InstanceInfo>                      instance_map_{ &directory_ };
+    ObjectInfoPageTable<PhysicalDeviceInfo>                physical_device_map_{ &directory_ };
+    ObjectInfoPageTable<DeviceInfo>                        device_map_{ &directory_ };
+    ObjectInfoPageTable<QueueInfo>                         queue_map_{ &directory_ };
+    ObjectInfoPageTable<SemaphoreInfo>                     semaphore_map_{ &directory_ };
+    ObjectInfoPageTable<CommandBufferInfo>                 command_buffer_map_{ &directory_ };
+    ObjectInfoPageTable<FenceInfo>                         fence_map_{ &directory_ };
+    ObjectInfoPageTable<DeviceMemoryInfo>                  device_memory_map_{ &directory_ };
+    ObjectInfoPageTable<BufferInfo>                        buffer_map_{ &directory_ };
+    ObjectInfoPageTable<ImageInfo>                         image_map_{ &directory_ };
+    ObjectInfoPageTable<EventInfo>                         event_map_{ &directory_ };
+    ObjectInfoPageTable<QueryPoolInfo>                     query_pool_map_{ &directory_ };
+    ObjectInfoPageTable<BufferViewInfo>                    buffer_view_map_{ &directory_ };
+    ObjectInfoPageTable<ImageViewInfo>                     image_view_map_{ &directory_ };
+    ObjectInfoPageTable<ShaderModuleInfo>                  shader_module_map_{ &directory_ };
+    ObjectInfoPageTable<PipelineCacheInfo>                 pipeline_cache_map_{ &directory_ };
+    ObjectInfoPageTable<PipelineLayoutInfo>                pipeline_layout_map_{ &directory_ };
+    ObjectInfoPageTable<RenderPassInfo>                    render_pass_map_{ &directory_ };
+    ObjectInfoPageTable<PipelineInfo>                      pipeline_map_{ &directory_ };
+    ObjectInfoPageTable<DescriptorSetLayoutInfo>           descriptor_set_layout_map_{ &directory_ };
+    ObjectInfoPageTable<SamplerInfo>                       sampler_map_{ &directory_ };
+    ObjectInfoPageTable<DescriptorPoolInfo>                descriptor_pool_map_{ &directory_ };
+    ObjectInfoPageTable<DescriptorSetInfo>                 descriptor_set_map_{ &directory_ };
+    ObjectInfoPageTable<FramebufferInfo>                   framebuffer_map_{ &directory_ };
+    ObjectInfoPageTable<CommandPoolInfo>                   command_pool_map_{ &directory_ };
+    ObjectInfoPageTable<SamplerYcbcrConversionInfo>        sampler_ycbcr_conversion_map_{ &directory_ };
+    ObjectInfoPageTable<DescriptorUpdateTemplateInfo>      descriptor_update_template_map_{ &directory_ };
+    ObjectInfoPageTable<SurfaceKHRInfo>                    surface_khr_map_{ &directory_ };
+    ObjectInfoPageTable<SwapchainKHRInfo>                  swapchain_khr_map_{ &directory_ };
+    ObjectInfoPageTable<DisplayKHRInfo>                    display_khr_map_{ &directory_ };
+    ObjectInfoPageTable<DisplayModeKHRInfo>                display_mode_khr_map_{ &directory_ };
+    ObjectInfoPageTable<SamplerYcbcrConversionKHRInfo>     sampler_ycbcr_conversion_khr_map_{ &directory_ };
+    ObjectInfoPageTable<DebugReportCallbackEXTInfo>        debug_report_callback_ext_map_{ &directory_ };
+    ObjectInfoPageTable<IndirectCommandsLayoutNVInfo>      indirect_commands_layout_nv_map_{ &directory_ };
+    ObjectInfoPageTable<DebugUtilsMessengerEXTInfo>        debug_utils_messenger_ext_map_{ &directory_ };
+    ObjectInfoPageTable<ValidationCacheEXTInfo>            validation_cache_ext_map_{ &directory_ };
+    ObjectInfoPageTable<AccelerationStructureKHRInfo>      acceleration_structure_khr_map_{ &directory_ };
+    ObjectInfoPageTable<AccelerationStructureNVInfo>       acceleration_structure_nv_map_{ &directory_ };
+    ObjectInfoPageTable<PerformanceConfigurationINTELInfo> performance_configuration_intel_map_{ &directory_ };
+    ObjectInfoPageTable<DeferredOperationKHRInfo>          deferred_operation_khr_map_{ &directory_ };
+    ObjectInfoPageTable<PrivateDataSlotEXTInfo>            private_data_slot_ext_map_{ &directory_ };
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -0,0 +1,342 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#include "decode/vulkan_offscreen_swapchain.h"
+
+#include "format/format_util.h"
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+VulkanOffscreenSwapchain::VulkanOffscreenSwapchain(VkDevice                                device,
+                                                   const encode::DeviceTable*              device_table,
+                                                   const VkPhysicalDeviceMemoryProperties& memory_properties,
+                                                   const VkSwapchainCreateInfoKHR*         create_info,
+                                                   VkQueue                                 queue) :
+    device_(device), device_table_(device_table), memory_properties_(memory_properties), image_create_info_{},
+    queue_(queue)
+{
+    assert((device_table != nullptr) && (create_info != nullptr));
+
+    image_create_info_.sType                 = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    image_create_info_.pNext                 = nullptr;
+    image_create_info_.flags                 = 0;
+    image_create_info_.imageType             = VK_IMAGE_TYPE_2D;
+    image_create_info_.format                = create_info->imageFormat;
+    image_create_info_.extent                = { create_info->imageExtent.width, create_info->imageExtent.height, 1 };
+    image_create_info_.mipLevels             = 1;
+    image_create_info_.arrayLayers           = create_info->imageArrayLayers;
+    image_create_info_.samples               = VK_SAMPLE_COUNT_1_BIT;
+    image_create_info_.tiling                = VK_IMAGE_TILING_OPTIMAL;
+    image_create_info_.usage                 = create_info->imageUsage;
+    image_create_info_.sharingMode           = create_info->imageSharingMode;
+    image_create_info_.queueFamilyIndexCount = 0;
+    image_create_info_.pQueueFamilyIndices   = nullptr;
+    image_create_info_.initialLayout         = VK_IMAGE_LAYOUT_UNDEFINED;
+
+    if ((create_info->flags & VK_SWAPCHAIN_CREATE_MUTABLE_FORMAT_BIT_KHR) == VK_SWAPCHAIN_CREATE_MUTABLE_FORMAT_BIT_KHR)
+    {
+        image_create_info_.flags |= VK_IMAGE_CREATE_MUTABLE_FORMAT_BIT;
+    }
+
+    if ((create_info->imageSharingMode == VK_SHARING_MODE_CONCURRENT) && (create_info->pQueueFamilyIndices != nullptr))
+    {
+        queue_family_indices_.assign(create_info->pQueueFamilyIndices,
+                                     create_info->pQueueFamilyIndices + create_info->queueFamilyIndexCount);
+    }
+}
+
+VulkanOffscreenSwapchain::~VulkanOffscreenSwapchain()
+{
+    DestroyImages();
+}
+
+VkSwapchainKHR VulkanOffscreenSwapchain::GetHandle() const
+{
+    // The address of the object is unique among the active swapchains.
+    return format::FromHandleId<VkSwapchainKHR>(static_cast<format::HandleId>(reinterpret_cast<uintptr_t>(this)));
+}
+
+VkResult VulkanOffscreenSwapchain::GetImages(uint32_t capture_image_count, uint32_t* image_count, VkImage* images)
+{
+    assert(image_count != nullptr);
+
+    VkResult result = VK_SUCCESS;
+
+    if (images_.empty())
+    {
+        result = CreateImages(capture_image_count);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        uint32_t available_count = static_cast<uint32_t>(images_.size());
+
+        if (images == nullptr)
+        {
+            (*image_count) = available_count;
+        }
+        else
+        {
+            uint32_t copy_count = std::min(*image_count, available_count);
+
+            std::copy(images_.begin(), images_.begin() + copy_count, images);
+            (*image_count) = copy_count;
+
+            if (copy_count < available_count)
+            {
+                result = VK_INCOMPLETE;
+            }
+        }
+    }
+
+    return result;
+}
+
+VkResult VulkanOffscreenSwapchain::AcquireImage(uint32_t image_index, VkSemaphore semaphore, VkFence fence)
+{
+    if (image_index >= images_.size())
+    {
+        GFXRECON_LOG_ERROR("Offscreen swapchain image index %u is out of range for a swapchain with %u images",
+                           image_index,
+                           static_cast<uint32_t>(images_.size()));
+        return VK_ERROR_OUT_OF_DATE_KHR;
+    }
+
+    VkResult result = VK_SUCCESS;
+
+    // The image is immediately available, but the synchronization objects must still be signaled for the waits that
+    // the application performs on them.
+    if ((semaphore != VK_NULL_HANDLE) || (fence != VK_NULL_HANDLE))
+    {
+        VkSubmitInfo submit_info         = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+        submit_info.pNext                = nullptr;
+        submit_info.waitSemaphoreCount   = 0;
+        submit_info.pWaitSemaphores      = nullptr;
+        submit_info.pWaitDstStageMask    = nullptr;
+        submit_info.commandBufferCount   = 0;
+        submit_info.pCommandBuffers      = nullptr;
+        submit_info.signalSemaphoreCount = (semaphore != VK_NULL_HANDLE) ? 1 : 0;
+        submit_info.pSignalSemaphores    = &semaphore;
+
+        result = device_table_->QueueSubmit(queue_, 1, &submit_info, fence);
+    }
+
+    return result;
+}
+
+VkResult VulkanOffscreenSwapchain::SetImageLayouts(uint32_t queue_family_index, const std::vector<VkImageLayout>& layouts)
+{
+    std::vector<VkImageMemoryBarrier> image_barriers;
+
+    for (size_t i = 0; (i < layouts.size()) && (i < images_.size()); ++i)
+    {
+        if (layouts[i] != VK_IMAGE_LAYOUT_UNDEFINED)
+        {
+            VkImageMemoryBarrier image_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
+            image_barrier.pNext                           = nullptr;
+            image_barrier.srcAccessMask                   = 0;
+            image_barrier.dstAccessMask                   = 0;
+            image_barrier.oldLayout                       = VK_IMAGE_LAYOUT_UNDEFINED;
+            image_barrier.newLayout                       = layouts[i];
+            image_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+            image_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+            image_barrier.image                           = images_[i];
+            image_barrier.subresourceRange.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+            image_barrier.subresourceRange.baseMipLevel   = 0;
+            image_barrier.subresourceRange.levelCount     = 1;
+            image_barrier.subresourceRange.baseArrayLayer = 0;
+            image_barrier.subresourceRange.layerCount     = image_create_info_.arrayLayers;
+
+            image_barriers.push_back(image_barrier);
+        }
+    }
+
+    if (image_barriers.empty())
+    {
+        return VK_SUCCESS;
+    }
+
+    VkCommandPool   pool    = VK_NULL_HANDLE;
+    VkCommandBuffer command = VK_NULL_HANDLE;
+
+    VkCommandPoolCreateInfo pool_create_info = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
+    pool_create_info.pNext                   = nullptr;
+    pool_create_info.flags                   = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+    pool_create_info.queueFamilyIndex        = queue_family_index;
+
+    VkResult result = device_table_->CreateCommandPool(device_, &pool_create_info, nullptr, &pool);
+
+    if (result == VK_SUCCESS)
+    {
+        VkCommandBufferAllocateInfo command_allocate_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+        command_allocate_info.pNext                       = nullptr;
+        command_allocate_info.commandBufferCount          = 1;
+        command_allocate_info.commandPool                 = pool;
+        command_allocate_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+
+        result = device_table_->AllocateCommandBuffers(device_, &command_allocate_info, &command);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+        begin_info.pNext                    = nullptr;
+        begin_info.flags                    = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        begin_info.pInheritanceInfo         = nullptr;
+
+        result = device_table_->BeginCommandBuffer(command, &begin_info);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        device_table_->CmdPipelineBarrier(command,
+                                          VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                                          VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                                          0,
+                                          0,
+                                          nullptr,
+                                          0,
+                                          nullptr,
+                                          static_cast<uint32_t>(image_barriers.size()),
+                                          image_barriers.data());
+
+        result = device_table_->EndCommandBuffer(command);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        VkSubmitInfo submit_info       = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+        submit_info.pNext              = nullptr;
+        submit_info.commandBufferCount = 1;
+        submit_info.pCommandBuffers    = &command;
+
+        result = device_table_->QueueSubmit(queue_, 1, &submit_info, VK_NULL_HANDLE);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        result = device_table_->QueueWaitIdle(queue_);
+    }
+
+    if (pool != VK_NULL_HANDLE)
+    {
+        device_table_->DestroyCommandPool(device_, pool, nullptr);
+    }
+
+    return result;
+}
+
+VkResult VulkanOffscreenSwapchain::CreateImages(uint32_t image_count)
+{
+    VkResult result = VK_SUCCESS;
+
+    image_create_info_.queueFamilyIndexCount = static_cast<uint32_t>(queue_family_indices_.size());
+    image_create_info_.pQueueFamilyIndices   = queue_family_indices_.empty() ? nullptr : queue_family_indices_.data();
+
+    for (uint32_t i = 0; (i < image_count) && (result == VK_SUCCESS); ++i)
+    {
+        VkImage        image  = VK_NULL_HANDLE;
+        VkDeviceMemory memory = VK_NULL_HANDLE;
+
+        result = device_table_->CreateImage(device_, &image_create_info_, nullptr, &image);
+
+        if (result == VK_SUCCESS)
+        {
+            images_.push_back(image);
+
+            VkMemoryRequirements memory_requirements;
+            device_table_->GetImageMemoryRequirements(device_, image, &memory_requirements);
+
+            VkMemoryAllocateInfo allocate_info = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
+            allocate_info.pNext                = nullptr;
+            allocate_info.allocationSize       = memory_requirements.size;
+            allocate_info.memoryTypeIndex      = FindMemoryType(memory_requirements.memoryTypeBits);
+
+            if (allocate_info.memoryTypeIndex == std::numeric_limits<uint32_t>::max())
+            {
+                result = VK_ERROR_OUT_OF_DEVICE_MEMORY;
+            }
+            else
+            {
+                result = device_table_->AllocateMemory(device_, &allocate_info, nullptr, &memory);
+            }
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            memories_.push_back(memory);
+
+            result = device_table_->BindImageMemory(device_, image, memory, 0);
+        }
+    }
+
+    if (result != VK_SUCCESS)
+    {
+        GFXRECON_LOG_ERROR("Failed to create offscreen swapchain images (error = %x)", result);
+        DestroyImages();
+    }
+
+    return result;
+}
+
+void VulkanOffscreenSwapchain::DestroyImages()
+{
+    for (auto image : images_)
+    {
+        device_table_->DestroyImage(device_, image, nullptr);
+    }
+
+    for (auto memory : memories_)
+    {
+        device_table_->FreeMemory(device_, memory, nullptr);
+    }
+
+    images_.clear();
+    memories_.clear();
+}
+
+uint32_t VulkanOffscreenSwapchain::FindMemoryType(uint32_t type_bits) const
+{
+    uint32_t memory_type = std::numeric_limits<uint32_t>::max();
+
+    // Prefer device local memory, falling back to any supported memory type.
+    for (uint32_t i = 0; i < memory_properties_.memoryTypeCount; ++i)
+    {
+        if ((type_bits & (1u << i)) != 0)
+        {
+            if ((memory_properties_.memoryTypes[i].propertyFlags & VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT) ==
+                VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)
+            {
+                return i;
+            }
+            else if (memory_type == std::numeric_limits<uint32_t>::max())
+            {
+                memory_type = i;
+            }
+        }
+    }
+
+    return memory_type;
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
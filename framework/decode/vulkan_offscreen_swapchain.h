@@ -0,0 +1,82 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#ifndef GFXRECON_DECODE_VULKAN_OFFSCREEN_SWAPCHAIN_H
+#define GFXRECON_DECODE_VULKAN_OFFSCREEN_SWAPCHAIN_H
+
+#include "generated/generated_vulkan_dispatch_table.h"
+#include "util/defines.h"
+
+#include "vulkan/vulkan.h"
+
+#include <cstdint>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Replaces a swapchain with images that are created by replay, for replay without a window system.  The swapchain has
+// the number of images that were retrieved from the swapchain during capture.  An image acquire returns the image that
+// was acquired during capture and signals the acquire semaphore and fence with an empty queue submission, so images
+// are always acquired in capture order and replay is never throttled by a presentation engine.
+class VulkanOffscreenSwapchain
+{
+  public:
+    // The queue is used for the queue submissions that signal the synchronization objects of image acquires.
+    VulkanOffscreenSwapchain(VkDevice                                device,
+                             const encode::DeviceTable*              device_table,
+                             const VkPhysicalDeviceMemoryProperties& memory_properties,
+                             const VkSwapchainCreateInfoKHR*         create_info,
+                             VkQueue                                 queue);
+
+    ~VulkanOffscreenSwapchain();
+
+    // Returns a unique handle value for the swapchain, which must not be passed to the driver.
+    VkSwapchainKHR GetHandle() const;
+
+    // Creates the swapchain images on the first call, with the number of images specified by capture_image_count,
+    // which is the image count that was returned to the application during capture.  The remaining parameters
+    // behave as the parameters of vkGetSwapchainImagesKHR.
+    VkResult GetImages(uint32_t capture_image_count, uint32_t* image_count, VkImage* images);
+
+    VkResult AcquireImage(uint32_t image_index, VkSemaphore semaphore, VkFence fence);
+
+    // Transitions the images to the specified layouts, for initialization of the swapchain state of trimmed captures.
+    // Images with the undefined layout are not transitioned.
+    VkResult SetImageLayouts(uint32_t queue_family_index, const std::vector<VkImageLayout>& layouts);
+
+  private:
+    VkResult CreateImages(uint32_t image_count);
+
+    void DestroyImages();
+
+    uint32_t FindMemoryType(uint32_t type_bits) const;
+
+  private:
+    VkDevice                         device_;
+    const encode::DeviceTable*       device_table_;
+    VkPhysicalDeviceMemoryProperties memory_properties_;
+    VkImageCreateInfo                image_create_info_;
+    std::vector<uint32_t>            queue_family_indices_;
+    VkQueue                          queue_;
+    std::vector<VkImage>             images_;
+    std::vector<VkDeviceMemory>      memories_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_VULKAN_OFFSCREEN_SWAPCHAIN_H
@@ -0,0 +1,442 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#include "decode/vulkan_pipeline_precompiler.h"
+
+#include "decode/file_processor.h"
+#include "decode/handle_pointer_decoder.h"
+#include "decode/value_decoder.h"
+#include "decode/vulkan_decoder_base.h"
+#include "generated/generated_vulkan_struct_handle_mappers.h"
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Decoder for the scan of the capture file, which only reads the parameter data of pipeline creation calls.
+class PipelineCallScanDecoder : public VulkanDecoderBase
+{
+  public:
+    PipelineCallScanDecoder(VulkanPipelinePrecompiler* precompiler) : precompiler_(precompiler), skipped_count_(0) {}
+
+    virtual bool SupportsApiCall(format::ApiCallId call_id) override
+    {
+        return ((call_id == format::ApiCallId::ApiCall_vkCreateGraphicsPipelines) ||
+                (call_id == format::ApiCallId::ApiCall_vkCreateComputePipelines));
+    }
+
+    virtual void DecodeFunctionCall(format::ApiCallId  call_id,
+                                    const ApiCallInfo& call_info,
+                                    const uint8_t*     parameter_buffer,
+                                    size_t             buffer_size) override
+    {
+        GFXRECON_UNREFERENCED_PARAMETER(call_info);
+
+        if (!precompiler_->AddCall(call_id, parameter_buffer, buffer_size))
+        {
+            ++skipped_count_;
+        }
+    }
+
+    uint64_t GetSkippedCount() const { return skipped_count_; }
+
+  private:
+    VulkanPipelinePrecompiler* precompiler_;
+    uint64_t                   skipped_count_;
+};
+
+VulkanPipelinePrecompiler::VulkanPipelinePrecompiler(const VulkanObjectInfoTable* object_info_table,
+                                                     GetDeviceTableFunc           get_device_table,
+                                                     uint32_t                     thread_count) :
+    object_info_table_(object_info_table),
+    get_device_table_(get_device_table), thread_count_(std::max(thread_count, 1u)), stop_(false)
+{
+    assert(object_info_table_ != nullptr);
+}
+
+VulkanPipelinePrecompiler::~VulkanPipelinePrecompiler()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+
+    worker_condition_.notify_all();
+
+    // Worker threads complete the call that they are processing before exiting.  Pipelines that were created for calls
+    // that were never reached by replay are not destroyed, matching the handling of other objects that remain when
+    // replay ends.
+    for (auto& worker_thread : worker_threads_)
+    {
+        worker_thread.join();
+    }
+}
+
+bool VulkanPipelinePrecompiler::ScanFile(const std::string& filename)
+{
+    FileProcessor           file_processor;
+    PipelineCallScanDecoder decoder(this);
+
+    if (!file_processor.Initialize(filename))
+    {
+        return false;
+    }
+
+    file_processor.AddDecoder(&decoder);
+
+    if (!file_processor.ProcessAllFrames())
+    {
+        GFXRECON_LOG_ERROR("Failed to scan file %s for pipeline creation calls", filename.c_str());
+        return false;
+    }
+
+    GFXRECON_LOG_INFO("Found %" PRIu64 " pipeline creation calls to precompile, and %" PRIu64
+                      " pipeline creation calls that will be replayed normally",
+                      static_cast<uint64_t>(calls_.size()),
+                      decoder.GetSkippedCount());
+
+    return true;
+}
+
+bool VulkanPipelinePrecompiler::AddCall(format::ApiCallId call_id, const uint8_t* parameter_buffer, size_t buffer_size)
+{
+    size_t                                              bytes_read = 0;
+    std::unique_ptr<Call>                               call       = std::make_unique<Call>();
+    HandlePointerDecoder<VkPipeline>                    pPipelines;
+    StructPointerDecoder<Decoded_VkAllocationCallbacks> pAllocator;
+    VkResult                                            return_value;
+
+    call->call_id           = call_id;
+    call->create_info_count = 0;
+    call->next_dependency   = 0;
+    call->state             = kCallWaiting;
+    call->device            = VK_NULL_HANDLE;
+    call->pipeline_cache    = VK_NULL_HANDLE;
+    call->result            = VK_SUCCESS;
+
+    bytes_read += ValueDecoder::DecodeHandleIdValue(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), &call->device_id);
+    bytes_read += ValueDecoder::DecodeHandleIdValue(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), &call->pipeline_cache_id);
+    bytes_read += ValueDecoder::DecodeUInt32Value(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), &call->create_info_count);
+
+    AddDependency(kDependencyDevice, call->device_id, call.get());
+    AddDependency(kDependencyPipelineCache, call->pipeline_cache_id, call.get());
+
+    if (call_id == format::ApiCallId::ApiCall_vkCreateGraphicsPipelines)
+    {
+        call->graphics_create_infos = std::make_unique<StructPointerDecoder<Decoded_VkGraphicsPipelineCreateInfo>>();
+        bytes_read += call->graphics_create_infos->Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+
+        const Decoded_VkGraphicsPipelineCreateInfo* create_infos = call->graphics_create_infos->GetMetaStructPointer();
+        size_t                                      length       = call->graphics_create_infos->GetLength();
+
+        for (size_t i = 0; i < length; ++i)
+        {
+            if (create_infos[i].pNext != nullptr)
+            {
+                return false;
+            }
+
+            const auto* stages = create_infos[i].pStages->GetMetaStructPointer();
+            for (size_t j = 0; j < create_infos[i].pStages->GetLength(); ++j)
+            {
+                AddDependency(kDependencyShaderModule, stages[j].module, call.get());
+            }
+
+            AddDependency(kDependencyPipelineLayout, create_infos[i].layout, call.get());
+            AddDependency(kDependencyRenderPass, create_infos[i].renderPass, call.get());
+            AddDependency(kDependencyPipeline, create_infos[i].basePipelineHandle, call.get());
+        }
+    }
+    else if (call_id == format::ApiCallId::ApiCall_vkCreateComputePipelines)
+    {
+        call->compute_create_infos = std::make_unique<StructPointerDecoder<Decoded_VkComputePipelineCreateInfo>>();
+        bytes_read += call->compute_create_infos->Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+
+        const Decoded_VkComputePipelineCreateInfo* create_infos = call->compute_create_infos->GetMetaStructPointer();
+        size_t                                     length       = call->compute_create_infos->GetLength();
+
+        for (size_t i = 0; i < length; ++i)
+        {
+            if (create_infos[i].pNext != nullptr)
+            {
+                return false;
+            }
+
+            AddDependency(kDependencyShaderModule, create_infos[i].stage->module, call.get());
+            AddDependency(kDependencyPipelineLayout, create_infos[i].layout, call.get());
+            AddDependency(kDependencyPipeline, create_infos[i].basePipelineHandle, call.get());
+        }
+    }
+    else
+    {
+        return false;
+    }
+
+    bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += pPipelines.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read +=
+        ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+
+    if ((return_value < 0) || (call->device_id == 0) || pPipelines.IsNull() || (pPipelines.GetLength() == 0) ||
+        (pPipelines.GetLength() != call->create_info_count))
+    {
+        return false;
+    }
+
+    call->pipeline_ids.assign(pPipelines.GetPointer(), pPipelines.GetPointer() + pPipelines.GetLength());
+    call->pipelines.resize(call->pipeline_ids.size(), VK_NULL_HANDLE);
+
+    format::HandleId first_pipeline_id = call->pipeline_ids[0];
+    if (calls_.find(first_pipeline_id) != calls_.end())
+    {
+        return false;
+    }
+
+    // No objects have been created when the file is scanned, so the call waits for its device.
+    Call* call_ptr = call.get();
+    calls_.emplace(first_pipeline_id, std::move(call));
+    waiting_calls_[call_ptr->device_id].push_back(call_ptr);
+
+    return true;
+}
+
+bool VulkanPipelinePrecompiler::GetPipelines(format::HandleId first_pipeline_id,
+                                             uint32_t         count,
+                                             VkPipeline*      pipelines,
+                                             VkResult*        result)
+{
+    assert((pipelines != nullptr) && (result != nullptr));
+
+    auto entry = calls_.find(first_pipeline_id);
+    if (entry == calls_.end())
+    {
+        return false;
+    }
+
+    Call* call        = entry->second.get();
+    bool  precompiled = false;
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        if (call->state == kCallWaiting)
+        {
+            auto& waiting = waiting_calls_[call->dependencies[call->next_dependency].id];
+            waiting.erase(std::remove(waiting.begin(), waiting.end(), call), waiting.end());
+        }
+        else if (call->state == kCallQueued)
+        {
+            // Creation has not started, so the call is replayed by the caller instead of waiting for the calls that
+            // are ahead of it in the queue.
+            queued_calls_.erase(std::remove(queued_calls_.begin(), queued_calls_.end(), call), queued_calls_.end());
+        }
+        else
+        {
+            complete_condition_.wait(lock, [call]() { return call->state == kCallComplete; });
+            precompiled = true;
+        }
+    }
+
+    if (precompiled)
+    {
+        assert(count == call->pipelines.size());
+
+        size_t length = std::min(static_cast<size_t>(count), call->pipelines.size());
+        std::copy(call->pipelines.begin(), std::next(call->pipelines.begin(), length), pipelines);
+        *result = call->result;
+    }
+
+    calls_.erase(entry);
+
+    return precompiled;
+}
+
+void VulkanPipelinePrecompiler::AddDependency(DependencyType type, format::HandleId id, Call* call)
+{
+    assert(call != nullptr);
+
+    if (id != 0)
+    {
+        call->dependencies.push_back({ type, id });
+    }
+}
+
+bool VulkanPipelinePrecompiler::IsDependencyCreated(const Dependency& dependency) const
+{
+    switch (dependency.type)
+    {
+        case kDependencyDevice:
+            return (object_info_table_->GetDeviceInfo(dependency.id) != nullptr);
+        case kDependencyPipelineCache:
+            return (object_info_table_->GetPipelineCacheInfo(dependency.id) != nullptr);
+        case kDependencyShaderModule:
+            return (object_info_table_->GetShaderModuleInfo(dependency.id) != nullptr);
+        case kDependencyPipelineLayout:
+            return (object_info_table_->GetPipelineLayoutInfo(dependency.id) != nullptr);
+        case kDependencyRenderPass:
+            return (object_info_table_->GetRenderPassInfo(dependency.id) != nullptr);
+        case kDependencyPipeline:
+            return (object_info_table_->GetPipelineInfo(dependency.id) != nullptr);
+        default:
+            assert(false);
+            return false;
+    }
+}
+
+void VulkanPipelinePrecompiler::ProcessWaitingCalls(WaitingCallMap::iterator entry)
+{
+    std::vector<Call*> calls = std::move(entry->second);
+    waiting_calls_.erase(entry);
+
+    for (auto call : calls)
+    {
+        UpdateCall(call);
+    }
+}
+
+void VulkanPipelinePrecompiler::UpdateCall(Call* call)
+{
+    assert(call != nullptr);
+
+    while (call->next_dependency < call->dependencies.size())
+    {
+        const Dependency& dependency = call->dependencies[call->next_dependency];
+
+        if (!IsDependencyCreated(dependency))
+        {
+            waiting_calls_[dependency.id].push_back(call);
+            return;
+        }
+
+        ++call->next_dependency;
+    }
+
+    QueueCall(call);
+}
+
+void VulkanPipelinePrecompiler::QueueCall(Call* call)
+{
+    assert(call != nullptr);
+
+    // Handles are mapped by the replay thread, as the object info table is not accessed by the worker threads.
+    const DeviceInfo* device_info = object_info_table_->GetDeviceInfo(call->device_id);
+    assert(device_info != nullptr);
+
+    call->device = device_info->handle;
+
+    // The replay pipeline cache, when present, replaces the application's pipeline cache.
+    const PipelineCacheInfo* pipeline_cache_info = object_info_table_->GetPipelineCacheInfo(call->pipeline_cache_id);
+    if (device_info->replay_pipeline_cache != VK_NULL_HANDLE)
+    {
+        call->pipeline_cache = device_info->replay_pipeline_cache;
+    }
+    else if (pipeline_cache_info != nullptr)
+    {
+        call->pipeline_cache = pipeline_cache_info->handle;
+    }
+
+    const encode::DeviceTable* device_table = get_device_table_(call->device);
+    assert(device_table != nullptr);
+
+    call->create_graphics_pipelines = device_table->CreateGraphicsPipelines;
+    call->create_compute_pipelines  = device_table->CreateComputePipelines;
+
+    if (call->graphics_create_infos != nullptr)
+    {
+        MapStructArrayHandles(call->graphics_create_infos->GetMetaStructPointer(),
+                              call->graphics_create_infos->GetLength(),
+                              *object_info_table_);
+    }
+    else
+    {
+        MapStructArrayHandles(call->compute_create_infos->GetMetaStructPointer(),
+                              call->compute_create_infos->GetLength(),
+                              *object_info_table_);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        call->state = kCallQueued;
+        queued_calls_.push_back(call);
+
+        // Worker threads are started when the first call is ready to be processed.
+        if (worker_threads_.empty())
+        {
+            for (uint32_t i = 0; i < thread_count_; ++i)
+            {
+                worker_threads_.emplace_back(&VulkanPipelinePrecompiler::ProcessCalls, this);
+            }
+        }
+    }
+
+    worker_condition_.notify_one();
+}
+
+void VulkanPipelinePrecompiler::ProcessCalls()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (true)
+    {
+        worker_condition_.wait(lock, [this]() { return stop_ || !queued_calls_.empty(); });
+
+        if (stop_)
+        {
+            break;
+        }
+
+        Call* call = queued_calls_.front();
+        queued_calls_.pop_front();
+        call->state = kCallActive;
+
+        lock.unlock();
+
+        if (call->graphics_create_infos != nullptr)
+        {
+            call->result = call->create_graphics_pipelines(call->device,
+                                                           call->pipeline_cache,
+                                                           call->create_info_count,
+                                                           call->graphics_create_infos->GetPointer(),
+                                                           nullptr,
+                                                           call->pipelines.data());
+        }
+        else
+        {
+            call->result = call->create_compute_pipelines(call->device,
+                                                          call->pipeline_cache,
+                                                          call->create_info_count,
+                                                          call->compute_create_infos->GetPointer(),
+                                                          nullptr,
+                                                          call->pipelines.data());
+        }
+
+        lock.lock();
+
+        call->state = kCallComplete;
+        complete_condition_.notify_all();
+    }
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,170 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#ifndef GFXRECON_DECODE_VULKAN_PIPELINE_PRECOMPILER_H
+#define GFXRECON_DECODE_VULKAN_PIPELINE_PRECOMPILER_H
+
+#include "decode/struct_pointer_decoder.h"
+#include "decode/vulkan_object_info_table.h"
+#include "format/api_call_id.h"
+#include "format/format.h"
+#include "generated/generated_vulkan_dispatch_table.h"
+#include "generated/generated_vulkan_struct_decoders.h"
+#include "util/defines.h"
+
+#include "vulkan/vulkan.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Creates pipelines ahead of the point in the capture file where they are created by the captured application.  The
+// pipeline creation calls are found by scanning the capture file before replay begins, and are decoded and held until
+// the device, pipeline cache, shader modules, pipeline layout, render pass, and base pipeline that they reference have
+// been created by replay.  The calls are then processed by a pool of worker threads, and the replay of each call
+// retrieves the pipelines that were created for it, waiting for the worker thread when creation is still in progress.
+class VulkanPipelinePrecompiler
+{
+  public:
+    typedef std::function<const encode::DeviceTable*(VkDevice)> GetDeviceTableFunc;
+
+  public:
+    VulkanPipelinePrecompiler(const VulkanObjectInfoTable* object_info_table,
+                              GetDeviceTableFunc           get_device_table,
+                              uint32_t                     thread_count);
+
+    ~VulkanPipelinePrecompiler();
+
+    // Scans the capture file for the pipeline creation calls to precompile.  Must be called before replay begins.
+    bool ScanFile(const std::string& filename);
+
+    // Decodes a pipeline creation call.  Returns false for calls that will not be precompiled, which are calls that
+    // failed during capture and calls with create info extension structures that may reference other objects.
+    bool AddCall(format::ApiCallId call_id, const uint8_t* parameter_buffer, size_t buffer_size);
+
+    // Notifies the precompiler that an object has been added to the object info table, starting the creation of any
+    // pipelines that were waiting for the object.
+    void ProcessObjectAdded(format::HandleId id)
+    {
+        if (!waiting_calls_.empty())
+        {
+            auto entry = waiting_calls_.find(id);
+            if (entry != waiting_calls_.end())
+            {
+                ProcessWaitingCalls(entry);
+            }
+        }
+    }
+
+    // Retrieves the result of the precompiled call that creates the pipeline with the specified capture ID, waiting
+    // for pipeline creation to complete.  Returns false if pipeline creation has not started, in which case the call
+    // is no longer precompiled and must be replayed normally.
+    bool GetPipelines(format::HandleId first_pipeline_id, uint32_t count, VkPipeline* pipelines, VkResult* result);
+
+  private:
+    enum DependencyType : uint32_t
+    {
+        kDependencyDevice         = 0,
+        kDependencyPipelineCache  = 1,
+        kDependencyShaderModule   = 2,
+        kDependencyPipelineLayout = 3,
+        kDependencyRenderPass     = 4,
+        kDependencyPipeline       = 5
+    };
+
+    enum CallState : uint32_t
+    {
+        kCallWaiting  = 0,
+        kCallQueued   = 1,
+        kCallActive   = 2,
+        kCallComplete = 3
+    };
+
+    struct Dependency
+    {
+        DependencyType   type;
+        format::HandleId id;
+    };
+
+    struct Call
+    {
+        format::ApiCallId                                                           call_id;
+        format::HandleId                                                            device_id;
+        format::HandleId                                                            pipeline_cache_id;
+        uint32_t                                                                    create_info_count;
+        std::unique_ptr<StructPointerDecoder<Decoded_VkGraphicsPipelineCreateInfo>> graphics_create_infos;
+        std::unique_ptr<StructPointerDecoder<Decoded_VkComputePipelineCreateInfo>>  compute_create_infos;
+        std::vector<format::HandleId>                                               pipeline_ids;
+        std::vector<Dependency>                                                     dependencies;
+        size_t                                                                      next_dependency;
+        CallState                                                                   state;
+        VkDevice                                                                    device;
+        VkPipelineCache                                                             pipeline_cache;
+        PFN_vkCreateGraphicsPipelines                                               create_graphics_pipelines;
+        PFN_vkCreateComputePipelines                                                create_compute_pipelines;
+        std::vector<VkPipeline>                                                     pipelines;
+        VkResult                                                                    result;
+    };
+
+    typedef std::unordered_map<format::HandleId, std::vector<Call*>> WaitingCallMap;
+
+  private:
+    void AddDependency(DependencyType type, format::HandleId id, Call* call);
+
+    bool IsDependencyCreated(const Dependency& dependency) const;
+
+    void ProcessWaitingCalls(WaitingCallMap::iterator entry);
+
+    // Places the call in the wait list for the first dependency that has not been created, or in the queue of calls
+    // to process when all dependencies have been created.
+    void UpdateCall(Call* call);
+
+    void QueueCall(Call* call);
+
+    void ProcessCalls();
+
+  private:
+    const VulkanObjectInfoTable* object_info_table_;
+    GetDeviceTableFunc           get_device_table_;
+    uint32_t                     thread_count_;
+
+    // Calls are owned by the call map, which is keyed by the capture ID of the first pipeline created by the call.
+    // The wait lists are only accessed by the replay thread.
+    std::unordered_map<format::HandleId, std::unique_ptr<Call>> calls_;
+    WaitingCallMap                                              waiting_calls_;
+
+    std::mutex               mutex_;
+    std::condition_variable  worker_condition_;
+    std::condition_variable  complete_condition_;
+    std::vector<std::thread> worker_threads_;
+    std::deque<Call*>        queued_calls_;
+    bool                     stop_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_VULKAN_PIPELINE_PRECOMPILER_H
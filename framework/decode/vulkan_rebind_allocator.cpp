@@ -33,6 +33,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <iterator>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
@@ -42,7 +43,8 @@ const uintptr_t        kPlaceholderAddress  = static_cast<uintptr_t>(~0);
 
 VulkanRebindAllocator::VulkanRebindAllocator() :
     device_(VK_NULL_HANDLE), allocator_(VK_NULL_HANDLE), vma_functions_{},
-    capture_device_type_(VK_PHYSICAL_DEVICE_TYPE_OTHER), capture_memory_properties_{}, replay_memory_properties_{}
+    capture_device_type_(VK_PHYSICAL_DEVICE_TYPE_OTHER), capture_memory_properties_{}, replay_memory_properties_{},
+    current_staging_batch_(0)
 {}
 
 VulkanRebindAllocator::~VulkanRebindAllocator() {}
@@ -72,6 +74,22 @@ VkResult VulkanRebindAllocator::Initialize(uint32_t
         capture_memory_properties_ = capture_memory_properties;
         replay_memory_properties_  = replay_memory_properties;
 
+        // Staging copies can only be submitted to queues from families that support transfer commands.
+        if (functions_.get_physical_device_queue_family_properties != nullptr)
+        {
+            uint32_t family_count = 0;
+            functions_.get_physical_device_queue_family_properties(physical_device, &family_count, nullptr);
+
+            std::vector<VkQueueFamilyProperties> family_properties(family_count);
+            functions_.get_physical_device_queue_family_properties(
+                physical_device, &family_count, family_properties.data());
+
+            for (const auto& properties : family_properties)
+            {
+                queue_family_flags_.push_back(properties.queueFlags);
+            }
+        }
+
         vma_functions_.vkGetPhysicalDeviceProperties           = functions_.get_physical_device_properties;
         vma_functions_.vkGetPhysicalDeviceMemoryProperties     = functions_.get_physical_device_memory_properties;
         vma_functions_.vkAllocateMemory                        = functions_.allocate_memory;
@@ -146,6 +164,14 @@ VkResult VulkanRebindAllocator::Initialize(uint32_t
 
 void VulkanRebindAllocator::Destroy()
 {
+    for (auto& batch : staging_batches_)
+    {
+        DestroyStagingBatch(&batch);
+    }
+
+    staging_batches_.clear();
+    current_staging_batch_ = 0;
+
     if (allocator_ != VK_NULL_HANDLE)
     {
         vmaDestroyAllocator(allocator_);
@@ -166,11 +192,16 @@ VkResult VulkanRebindAllocator::CreateBuffer(const VkBufferCreateInfo*    create
 
     if ((create_info != nullptr) && (buffer != nullptr) && (allocator_data != nullptr))
     {
-        result = functions_.create_buffer(device_, create_info, nullptr, buffer);
+        // Buffers that are rebound to memory that is not host visible are written with staging copies.
+        VkBufferCreateInfo modified_create_info = (*create_info);
+        modified_create_info.usage |= VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+
+        result = functions_.create_buffer(device_, &modified_create_info, nullptr, buffer);
 
         if (result >= 0)
         {
             auto resource_alloc_info      = new ResourceAllocInfo;
+            resource_alloc_info->buffer   = (*buffer);
             resource_alloc_info->usage    = create_info->usage;
             resource_alloc_info->is_image = false;
             (*allocator_data)             = reinterpret_cast<uintptr_t>(resource_alloc_info);
@@ -203,6 +234,8 @@ void VulkanRebindAllocator::DestroyBuffer(VkBuffer                     buffer,
             memory_alloc_info->original_buffers.erase(buffer);
         }
 
+        DiscardStagedWrites(buffer);
+
         if (resource_alloc_info->mapped_pointer != nullptr)
         {
             vmaUnmapMemory(allocator_, resource_alloc_info->allocation);
@@ -809,6 +842,66 @@ VkResult VulkanRebindAllocator::WriteMappedMemoryRange(MemoryData     allocator_
     return result;
 }
 
+VkResult VulkanRebindAllocator::SubmitPendingWrites(VkQueue queue, uint32_t queue_family_index)
+{
+    VkResult result = VK_SUCCESS;
+
+    // Writes remain pending when the queue cannot execute copy commands, such as a queue from a family that only
+    // supports sparse binding, and are submitted with the next submission to a queue that can.
+    if (!staging_batches_.empty() && SupportsStagingCopies(queue_family_index))
+    {
+        StagingBatch* batch = &staging_batches_[current_staging_batch_];
+
+        if (!batch->segments.empty())
+        {
+            result = RecordStagingBatch(batch, queue_family_index);
+
+            if (result == VK_SUCCESS)
+            {
+                VkSubmitInfo submit_info         = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+                submit_info.pNext                = nullptr;
+                submit_info.waitSemaphoreCount   = 0;
+                submit_info.pWaitSemaphores      = nullptr;
+                submit_info.pWaitDstStageMask    = nullptr;
+                submit_info.commandBufferCount   = 1;
+                submit_info.pCommandBuffers      = &batch->command_buffer;
+                submit_info.signalSemaphoreCount = 0;
+                submit_info.pSignalSemaphores    = nullptr;
+
+                result = functions_.queue_submit(queue, 1, &submit_info, batch->fence);
+            }
+
+            if (result == VK_SUCCESS)
+            {
+                batch->in_flight       = true;
+                current_staging_batch_ = (current_staging_batch_ + 1) % kStagingBatchCount;
+            }
+            else
+            {
+                GFXRECON_LOG_ERROR("Failed to submit staging copies for mapped memory writes to buffers that were not "
+                                   "bound to host visible memory (%s)",
+                                   enumutil::GetResultValueString(result));
+            }
+
+            batch->size = 0;
+            batch->segments.clear();
+        }
+    }
+
+    return result;
+}
+
+bool VulkanRebindAllocator::SupportsStagingCopies(uint32_t queue_family_index) const
+{
+    // Graphics and compute queues support transfer commands, even when the transfer bit is not reported.
+    const VkQueueFlags kCopyQueueFlags = VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT;
+
+    // Queue family properties are not available when the function was not provided, so all queues are assumed to
+    // support copies.
+    return (queue_family_index >= queue_family_flags_.size()) ||
+           ((queue_family_flags_[queue_family_index] & kCopyQueueFlags) != 0);
+}
+
 void VulkanRebindAllocator::ReportAllocateMemoryIncompatibility(const VkMemoryAllocateInfo* allocate_info)
 {
     // The rebind allocator defers allocation until bind and always returns success from vkAllocateMemory, so has no
@@ -940,11 +1033,351 @@ void VulkanRebindAllocator::WriteBoundResource(ResourceAllocInfo* resource_alloc
                                enumutil::GetResultValueString(result));
         }
     }
+    else if (!resource_alloc_info->is_image)
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, src_offset);
+        WriteStagedBuffer(resource_alloc_info->buffer, dst_offset, data_size, data + static_cast<size_t>(src_offset));
+    }
+    else
+    {
+        GFXRECON_LOG_WARNING("Skipping mapped memory write to an image that was not bound to host visible memory");
+    }
+}
+
+void VulkanRebindAllocator::WriteStagedBuffer(VkBuffer       buffer,
+                                              VkDeviceSize   dst_offset,
+                                              VkDeviceSize   data_size,
+                                              const uint8_t* data)
+{
+    assert(buffer != VK_NULL_HANDLE);
+
+    if (data_size == 0)
+    {
+        return;
+    }
+
+    if (staging_batches_.empty())
+    {
+        staging_batches_.resize(kStagingBatchCount);
+    }
+
+    StagingBatch* batch  = &staging_batches_[current_staging_batch_];
+    VkResult      result = ReserveStagingBatch(batch, data_size);
+
+    if (result != VK_SUCCESS)
+    {
+        GFXRECON_LOG_ERROR("Skipping mapped memory write to a buffer that was not bound to host visible memory: failed "
+                           "to reserve staging buffer space (%s)",
+                           enumutil::GetResultValueString(result));
+        return;
+    }
+
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, batch->size);
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, data_size);
+
+    size_t copy_size = static_cast<size_t>(data_size);
+    util::platform::MemoryCopy(batch->mapped_pointer + static_cast<size_t>(batch->size), copy_size, data, copy_size);
+
+    VkBufferCopy region;
+    region.srcOffset = batch->size;
+    region.dstOffset = dst_offset;
+    region.size      = data_size;
+
+    batch->size += data_size;
+
+    if (batch->segments.empty())
+    {
+        batch->segments.emplace_back();
+    }
+
+    // Only the last region that starts at or before the write and the first region that starts after the write can
+    // overlap or be contiguous with the write.
+    CopyRegions* regions = &batch->segments.back()[buffer];
+    auto         next    = regions->upper_bound(dst_offset);
+    auto         prev    = (next != regions->begin()) ? std::prev(next) : regions->end();
+
+    bool overlaps_prev = (prev != regions->end()) && ((prev->second.dstOffset + prev->second.size) > dst_offset);
+    bool overlaps_next = (next != regions->end()) && (next->first < (dst_offset + data_size));
+
+    if (overlaps_prev || overlaps_next)
+    {
+        // Copies to overlapping regions must be executed in write order, so are placed in a new segment.
+        batch->segments.emplace_back();
+        batch->segments.back()[buffer].emplace(dst_offset, region);
+    }
+    else if ((prev != regions->end()) && ((prev->second.dstOffset + prev->second.size) == dst_offset) &&
+             ((prev->second.srcOffset + prev->second.size) == region.srcOffset))
+    {
+        prev->second.size += data_size;
+    }
+    else
+    {
+        regions->emplace_hint(next, dst_offset, region);
+    }
+}
+
+VkResult VulkanRebindAllocator::ReserveStagingBatch(StagingBatch* batch, VkDeviceSize size)
+{
+    assert(batch != nullptr);
+
+    VkResult result = VK_SUCCESS;
+
+    if (batch->in_flight)
+    {
+        // The batch is being reused, so its previous submission must complete before its staging buffer is written.
+        result = functions_.wait_for_fences(device_, 1, &batch->fence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+
+        if (result == VK_SUCCESS)
+        {
+            result = functions_.reset_fences(device_, 1, &batch->fence);
+        }
+
+        if (result != VK_SUCCESS)
+        {
+            return result;
+        }
+
+        batch->in_flight = false;
+    }
+
+    if ((batch->size + size) > batch->capacity)
+    {
+        VkDeviceSize min_capacity = kMinStagingBufferSize;
+        VkDeviceSize capacity     = std::max(std::max(batch->capacity * 2, batch->size + size), min_capacity);
+
+        VkBufferCreateInfo create_info    = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
+        create_info.pNext                 = nullptr;
+        create_info.flags                 = 0;
+        create_info.size                  = capacity;
+        create_info.usage                 = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+        create_info.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
+        create_info.queueFamilyIndexCount = 0;
+        create_info.pQueueFamilyIndices   = nullptr;
+
+        VmaAllocationCreateInfo allocation_create_info = {};
+        allocation_create_info.flags                   = VMA_ALLOCATION_CREATE_MAPPED_BIT;
+        allocation_create_info.usage                   = VMA_MEMORY_USAGE_CPU_ONLY;
+
+        VkBuffer          buffer     = VK_NULL_HANDLE;
+        VmaAllocation     allocation = VK_NULL_HANDLE;
+        VmaAllocationInfo allocation_info;
+
+        result =
+            vmaCreateBuffer(allocator_, &create_info, &allocation_create_info, &buffer, &allocation, &allocation_info);
+
+        if (result == VK_SUCCESS)
+        {
+            auto mapped_pointer = static_cast<uint8_t*>(allocation_info.pMappedData);
+
+            if (batch->size > 0)
+            {
+                // Preserve the writes that have already been added to the batch.
+                GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, batch->size);
+                size_t copy_size = static_cast<size_t>(batch->size);
+                util::platform::MemoryCopy(mapped_pointer, copy_size, batch->mapped_pointer, copy_size);
+            }
+
+            if (batch->buffer != VK_NULL_HANDLE)
+            {
+                vmaDestroyBuffer(allocator_, batch->buffer, batch->allocation);
+            }
+
+            batch->buffer         = buffer;
+            batch->allocation     = allocation;
+            batch->mapped_pointer = mapped_pointer;
+            batch->capacity       = capacity;
+        }
+    }
+
+    return result;
+}
+
+VkResult VulkanRebindAllocator::RecordStagingBatch(StagingBatch* batch, uint32_t queue_family_index)
+{
+    assert(batch != nullptr);
+
+    VkResult result = VK_SUCCESS;
+
+    if ((batch->command_pool != VK_NULL_HANDLE) && (batch->queue_family_index != queue_family_index))
+    {
+        functions_.destroy_command_pool(device_, batch->command_pool, nullptr);
+        batch->command_pool   = VK_NULL_HANDLE;
+        batch->command_buffer = VK_NULL_HANDLE;
+    }
+
+    if (batch->command_pool == VK_NULL_HANDLE)
+    {
+        VkCommandPoolCreateInfo pool_info = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
+        pool_info.pNext                   = nullptr;
+        pool_info.flags                   = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+        pool_info.queueFamilyIndex        = queue_family_index;
+
+        result = functions_.create_command_pool(device_, &pool_info, nullptr, &batch->command_pool);
+
+        if (result == VK_SUCCESS)
+        {
+            batch->queue_family_index = queue_family_index;
+
+            VkCommandBufferAllocateInfo alloc_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+            alloc_info.pNext                       = nullptr;
+            alloc_info.commandPool                 = batch->command_pool;
+            alloc_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            alloc_info.commandBufferCount          = 1;
+
+            result = functions_.allocate_command_buffers(device_, &alloc_info, &batch->command_buffer);
+        }
+    }
     else
     {
-        // TODO: Staging copy.
-        GFXRECON_LOG_WARNING("Skipping mapped memory write the needs to be converted to a staging copy");
+        result = functions_.reset_command_pool(device_, batch->command_pool, 0);
+    }
+
+    if ((result == VK_SUCCESS) && (batch->fence == VK_NULL_HANDLE))
+    {
+        VkFenceCreateInfo fence_info = { VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+        fence_info.pNext             = nullptr;
+        fence_info.flags             = 0;
+
+        result = functions_.create_fence(device_, &fence_info, nullptr, &batch->fence);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+        begin_info.pNext                    = nullptr;
+        begin_info.flags                    = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        begin_info.pInheritanceInfo         = nullptr;
+
+        result = functions_.begin_command_buffer(batch->command_buffer, &begin_info);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        // The copies overwrite buffers that may still be accessed by commands from earlier submissions to the queue,
+        // which must complete, with their writes made available, before the copies start.
+        VkMemoryBarrier barrier = { VK_STRUCTURE_TYPE_MEMORY_BARRIER };
+        barrier.pNext           = nullptr;
+        barrier.srcAccessMask   = VK_ACCESS_MEMORY_WRITE_BIT;
+        barrier.dstAccessMask   = VK_ACCESS_TRANSFER_WRITE_BIT;
+
+        functions_.cmd_pipeline_barrier(batch->command_buffer,
+                                        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                        VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                        0,
+                                        1,
+                                        &barrier,
+                                        0,
+                                        nullptr,
+                                        0,
+                                        nullptr);
+
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+
+        std::vector<VkBufferCopy> copy_regions;
+
+        for (size_t i = 0; i < batch->segments.size(); ++i)
+        {
+            if (i > 0)
+            {
+                functions_.cmd_pipeline_barrier(batch->command_buffer,
+                                                VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                                VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                                0,
+                                                1,
+                                                &barrier,
+                                                0,
+                                                nullptr,
+                                                0,
+                                                nullptr);
+            }
+
+            for (const auto& entry : batch->segments[i])
+            {
+                copy_regions.clear();
+
+                for (const auto& region : entry.second)
+                {
+                    copy_regions.push_back(region.second);
+                }
+
+                if (!copy_regions.empty())
+                {
+                    functions_.cmd_copy_buffer(batch->command_buffer,
+                                               batch->buffer,
+                                               entry.first,
+                                               static_cast<uint32_t>(copy_regions.size()),
+                                               copy_regions.data());
+                }
+            }
+        }
+
+        // Make the copies visible to the commands of the queue submissions that follow the staging submission.
+        barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+
+        functions_.cmd_pipeline_barrier(batch->command_buffer,
+                                        VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                        0,
+                                        1,
+                                        &barrier,
+                                        0,
+                                        nullptr,
+                                        0,
+                                        nullptr);
+
+        result = functions_.end_command_buffer(batch->command_buffer);
+    }
+
+    return result;
+}
+
+void VulkanRebindAllocator::DiscardStagedWrites(VkBuffer buffer)
+{
+    // Only the current batch has writes that have not been submitted.
+    if (!staging_batches_.empty())
+    {
+        for (auto& segment : staging_batches_[current_staging_batch_].segments)
+        {
+            segment.erase(buffer);
+        }
+    }
+}
+
+void VulkanRebindAllocator::DestroyStagingBatch(StagingBatch* batch)
+{
+    assert(batch != nullptr);
+
+    if (batch->in_flight)
+    {
+        functions_.wait_for_fences(device_, 1, &batch->fence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+        batch->in_flight = false;
+    }
+
+    if (batch->fence != VK_NULL_HANDLE)
+    {
+        functions_.destroy_fence(device_, batch->fence, nullptr);
+        batch->fence = VK_NULL_HANDLE;
     }
+
+    // The command buffer is freed with the command pool.
+    if (batch->command_pool != VK_NULL_HANDLE)
+    {
+        functions_.destroy_command_pool(device_, batch->command_pool, nullptr);
+        batch->command_pool   = VK_NULL_HANDLE;
+        batch->command_buffer = VK_NULL_HANDLE;
+    }
+
+    if (batch->buffer != VK_NULL_HANDLE)
+    {
+        vmaDestroyBuffer(allocator_, batch->buffer, batch->allocation);
+        batch->buffer         = VK_NULL_HANDLE;
+        batch->allocation     = VK_NULL_HANDLE;
+        batch->mapped_pointer = nullptr;
+        batch->capacity       = 0;
+    }
+
+    batch->size = 0;
+    batch->segments.clear();
 }
 
 bool VulkanRebindAllocator::TranslateMemoryRange(const ResourceAllocInfo* resource_alloc_info,
@@ -1025,7 +1458,9 @@ VkResult VulkanRebindAllocator::UpdateMappedMemoryRange(
     VkDeviceSize dst_offset = 0;
     VkDeviceSize data_size  = 0;
 
-    if (TranslateMemoryRange(resource_alloc_info, oiriginal_start, original_end, &src_offset, &dst_offset, &data_size))
+    // Resources that were not bound to host visible memory are written with staging copies, and are not mapped.
+    if (resource_alloc_info->is_host_visible &&
+        TranslateMemoryRange(resource_alloc_info, oiriginal_start, original_end, &src_offset, &dst_offset, &data_size))
     {
         if (resource_alloc_info->mapped_pointer == nullptr)
         {
@@ -23,6 +23,7 @@
 #include "vk_mem_alloc.h"
 
 #include <limits>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -133,6 +134,8 @@ class VulkanRebindAllocator : public VulkanResourceAllocator
     virtual VkResult
     WriteMappedMemoryRange(MemoryData allocator_data, uint64_t offset, uint64_t size, const uint8_t* data) override;
 
+    virtual VkResult SubmitPendingWrites(VkQueue queue, uint32_t queue_family_index) override;
+
     virtual void ReportAllocateMemoryIncompatibility(const VkMemoryAllocateInfo* allocate_info) override;
 
     virtual void ReportBindBufferIncompatibility(VkBuffer     buffer,
@@ -166,6 +169,7 @@ class VulkanRebindAllocator : public VulkanResourceAllocator
     struct ResourceAllocInfo
     {
         MemoryAllocInfo* memory_info{ nullptr };
+        VkBuffer         buffer{ VK_NULL_HANDLE }; // Buffer handle for staging copies, which is null for images.
         VmaAllocation    allocation{ VK_NULL_HANDLE };
         bool             is_host_visible{ false };
         void*            mapped_pointer{ nullptr };
@@ -193,6 +197,34 @@ class VulkanRebindAllocator : public VulkanResourceAllocator
         std::unordered_map<VkImage, ResourceAllocInfo*>  original_images;
     };
 
+    // Mapped memory writes to buffers that were not bound to host visible memory at replay are written to the staging
+    // buffer of a staging batch, and the copies from the staging buffer are recorded and submitted to the queue of the
+    // next queue submission.  Batches are reused in ring order, waiting for a batch's previous submission to complete
+    // only when it is reused.
+    static const uint32_t     kStagingBatchCount    = 4;
+    static const VkDeviceSize kMinStagingBufferSize = 4 * 1024 * 1024;
+
+    // Contiguous writes to the same buffer are merged into a single copy region.  Copy regions are sorted by
+    // destination offset to detect overlapping writes, which start a new segment that is separated from the previous
+    // segment by a barrier.
+    typedef std::map<VkDeviceSize, VkBufferCopy>      CopyRegions;
+    typedef std::unordered_map<VkBuffer, CopyRegions> StagingSegment;
+
+    struct StagingBatch
+    {
+        VkBuffer                    buffer{ VK_NULL_HANDLE };
+        VmaAllocation               allocation{ VK_NULL_HANDLE };
+        uint8_t*                    mapped_pointer{ nullptr };
+        VkDeviceSize                capacity{ 0 };
+        VkDeviceSize                size{ 0 };
+        std::vector<StagingSegment> segments;
+        uint32_t                    queue_family_index{ 0 };
+        VkCommandPool               command_pool{ VK_NULL_HANDLE };
+        VkCommandBuffer             command_buffer{ VK_NULL_HANDLE };
+        VkFence                     fence{ VK_NULL_HANDLE };
+        bool                        in_flight{ false };
+    };
+
   private:
     void WriteBoundResource(ResourceAllocInfo* resource_alloc_info,
                             VkDeviceSize       src_offset,
@@ -211,6 +243,21 @@ class VulkanRebindAllocator : public VulkanResourceAllocator
                               VkDeviceSize*            dst_offset,
                               VkDeviceSize*            data_size);
 
+    // Writes data to the staging buffer of the current staging batch, and adds a copy from the staging buffer to the
+    // destination buffer.
+    void WriteStagedBuffer(VkBuffer buffer, VkDeviceSize dst_offset, VkDeviceSize data_size, const uint8_t* data);
+
+    VkResult ReserveStagingBatch(StagingBatch* batch, VkDeviceSize size);
+
+    VkResult RecordStagingBatch(StagingBatch* batch, uint32_t queue_family_index);
+
+    // Returns true if queues from the specified family can execute the staging copy commands.
+    bool SupportsStagingCopies(uint32_t queue_family_index) const;
+
+    void DiscardStagedWrites(VkBuffer buffer);
+
+    void DestroyStagingBatch(StagingBatch* batch);
+
     void UpdateBoundResource(ResourceAllocInfo* resource_alloc_info,
                              VkDeviceSize       write_start,
                              VkDeviceSize       write_end,
@@ -247,6 +294,9 @@ class VulkanRebindAllocator : public VulkanResourceAllocator
     VkPhysicalDeviceType             capture_device_type_;
     VkPhysicalDeviceMemoryProperties capture_memory_properties_;
     VkPhysicalDeviceMemoryProperties replay_memory_properties_;
+    std::vector<StagingBatch>        staging_batches_;
+    std::vector<VkQueueFlags>        queue_family_flags_;
+    uint32_t                         current_staging_batch_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -26,6 +26,7 @@
 #include "util/hash.h"
 #include "util/platform.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <limits>
 #include <unordered_set>
@@ -134,7 +135,8 @@ static uint32_t GetHardwareBufferFormatBpp(uint32_t format)
 
 VulkanReplayConsumerBase::VulkanReplayConsumerBase(WindowFactory* window_factory, const ReplayOptions& options) :
     loader_handle_(nullptr), get_instance_proc_addr_(nullptr), create_instance_proc_(nullptr),
-    window_factory_(window_factory), options_(options), loading_trim_state_(false)
+    window_factory_(window_factory), options_(options), loading_trim_state_(false), statistics_(nullptr),
+    frame_number_(1)
 {
     assert(window_factory != nullptr);
     assert(options.create_resource_allocator != nullptr);
@@ -142,6 +144,9 @@ VulkanReplayConsumerBase::VulkanReplayConsumerBase(WindowFactory* window_factory
 
 VulkanReplayConsumerBase::~VulkanReplayConsumerBase()
 {
+    // Wait for pipeline creation in progress on the precompiler's worker threads before destroying any objects.
+    pipeline_precompiler_.reset();
+
     for (auto device_id : active_device_ids_)
     {
         auto device_info = object_info_table_.GetDeviceInfo(device_id);
@@ -153,6 +158,11 @@ VulkanReplayConsumerBase::~VulkanReplayConsumerBase()
             // Idle device before destroying other resources.
             GetDeviceTable(device)->DeviceWaitIdle(device);
 
+            DestroyReplayPipelineCache(device_info);
+
+            device_info->submit_timer.reset();
+            device_info->offscreen_swapchains.clear();
+
             for (auto swapchain : device_info->active_swapchains)
             {
                 GetDeviceTable(device)->DestroySwapchainKHR(device, swapchain, nullptr);
@@ -187,6 +197,34 @@ VulkanReplayConsumerBase::~VulkanReplayConsumerBase()
     }
 }
 
+bool VulkanReplayConsumerBase::EnablePipelinePrecompilation(const std::string& filename, uint32_t thread_count)
+{
+    pipeline_precompiler_ = std::make_unique<VulkanPipelinePrecompiler>(
+        &object_info_table_, [this](VkDevice device) { return GetDeviceTable(device); }, thread_count);
+
+    if (!pipeline_precompiler_->ScanFile(filename))
+    {
+        pipeline_precompiler_.reset();
+        return false;
+    }
+
+    return true;
+}
+
+void VulkanReplayConsumerBase::CollectSubmissionGpuTimes()
+{
+    for (auto device_id : active_device_ids_)
+    {
+        auto device_info = object_info_table_.GetDeviceInfo(device_id);
+
+        if ((device_info != nullptr) && (device_info->submit_timer != nullptr))
+        {
+            GetDeviceTable(device_info->handle)->DeviceWaitIdle(device_info->handle);
+            device_info->submit_timer->CollectResults();
+        }
+    }
+}
+
 void VulkanReplayConsumerBase::ProcessStateBeginMarker(uint64_t frame_number)
 {
     GFXRECON_LOG_INFO("Loading state for captured frame %" PRId64, frame_number);
@@ -579,6 +617,30 @@ void VulkanReplayConsumerBase::ProcessSetSwapchainImageStateCommand(
         VkDevice       device    = device_info->handle;
         VkSwapchainKHR swapchain = swapchain_info->handle;
 
+        VulkanOffscreenSwapchain* offscreen_swapchain = GetOffscreenSwapchain(device_info, swapchain);
+
+        if (offscreen_swapchain != nullptr)
+        {
+            // Offscreen swapchain images are acquired by the captured acquire calls without being pre-acquired, so
+            // they only need to be transitioned to their captured layouts.
+            std::vector<VkImageLayout> image_layouts;
+
+            for (const auto& entry : image_info)
+            {
+                image_layouts.push_back(static_cast<VkImageLayout>(entry.image_layout));
+            }
+
+            VkResult result = offscreen_swapchain->SetImageLayouts(swapchain_info->queue_family_index, image_layouts);
+
+            if (result != VK_SUCCESS)
+            {
+                GFXRECON_LOG_WARNING("Failed image initialization for offscreen swapchain (ID = %" PRIu64 ")",
+                                     swapchain_id);
+            }
+
+            return;
+        }
+
         VkPhysicalDevice physical_device = device_info->parent;
         VkSurfaceKHR     surface         = swapchain_info->surface;
         assert((physical_device != VK_NULL_HANDLE) && (surface != VK_NULL_HANDLE));
@@ -1192,10 +1254,65 @@ void VulkanReplayConsumerBase::ProcessEndResourceInitCommand(format::HandleId de
 
     if ((device_info != nullptr) && (device_info->resource_initializer != nullptr))
     {
+        VkResult result = device_info->resource_initializer->Flush();
+
+        if (result != VK_SUCCESS)
+        {
+            GFXRECON_LOG_WARNING("State snapshot resource initialization failed to complete (%s)",
+                                 enumutil::GetResultValueString(result));
+        }
+
         device_info->resource_initializer.reset();
     }
 }
 
+uint8_t* VulkanReplayConsumerBase::GetInitBufferCommandData(format::HandleId device_id,
+                                                            format::HandleId buffer_id,
+                                                            uint64_t         data_size)
+{
+    DeviceInfo*       device_info = object_info_table_.GetDeviceInfo(device_id);
+    const BufferInfo* buffer_info = object_info_table_.GetBufferInfo(buffer_id);
+    uint8_t*          data        = nullptr;
+
+    // Only buffers that are initialized with a staging copy can receive their data directly in staging memory.
+    if ((device_info != nullptr) && (device_info->resource_initializer != nullptr) && (buffer_info != nullptr) &&
+        ((buffer_info->memory_property_flags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) !=
+         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT))
+    {
+        data = device_info->resource_initializer->GetBufferStagingData(
+            data_size, buffer_info->queue_family_index, buffer_info->handle);
+    }
+
+    return data;
+}
+
+uint8_t* VulkanReplayConsumerBase::GetInitImageCommandData(format::HandleId device_id,
+                                                           format::HandleId image_id,
+                                                           uint64_t         data_size,
+                                                           uint32_t         aspect)
+{
+    DeviceInfo*      device_info = object_info_table_.GetDeviceInfo(device_id);
+    const ImageInfo* image_info  = object_info_table_.GetImageInfo(image_id);
+    uint8_t*         data        = nullptr;
+
+    // Only images that are initialized with a staging copy can receive their data directly in staging memory.
+    if ((device_info != nullptr) && (device_info->resource_initializer != nullptr) && (image_info != nullptr) &&
+        ((image_info->tiling != VK_IMAGE_TILING_LINEAR) ||
+         ((image_info->memory_property_flags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) !=
+          VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)))
+    {
+        data = device_info->resource_initializer->GetImageStagingData(data_size,
+                                                                      image_info->queue_family_index,
+                                                                      image_info->handle,
+                                                                      image_info->type,
+                                                                      static_cast<VkImageAspectFlagBits>(aspect),
+                                                                      image_info->sample_count,
+                                                                      image_info->usage);
+    }
+
+    return data;
+}
+
 void VulkanReplayConsumerBase::ProcessInitBufferCommand(format::HandleId device_id,
                                                         format::HandleId buffer_id,
                                                         uint64_t         data_size,
@@ -1849,8 +1966,9 @@ void VulkanReplayConsumerBase::InitializeResourceAllocator(const PhysicalDeviceI
     assert((instance_table != nullptr) && (device_table != nullptr));
 
     VulkanResourceAllocator::Functions functions;
-    functions.get_physical_device_properties        = instance_table->GetPhysicalDeviceProperties;
-    functions.get_physical_device_memory_properties = instance_table->GetPhysicalDeviceMemoryProperties;
+    functions.get_physical_device_properties              = instance_table->GetPhysicalDeviceProperties;
+    functions.get_physical_device_memory_properties       = instance_table->GetPhysicalDeviceMemoryProperties;
+    functions.get_physical_device_queue_family_properties = instance_table->GetPhysicalDeviceQueueFamilyProperties;
 
     if (instance_table->GetPhysicalDeviceMemoryProperties2 != nullptr)
     {
@@ -1878,6 +1996,18 @@ void VulkanReplayConsumerBase::InitializeResourceAllocator(const PhysicalDeviceI
     functions.get_image_memory_requirements  = device_table->GetImageMemoryRequirements;
     functions.get_image_subresource_layout   = device_table->GetImageSubresourceLayout;
     functions.bind_image_memory              = device_table->BindImageMemory;
+    functions.create_command_pool            = device_table->CreateCommandPool;
+    functions.destroy_command_pool           = device_table->DestroyCommandPool;
+    functions.reset_command_pool             = device_table->ResetCommandPool;
+    functions.allocate_command_buffers       = device_table->AllocateCommandBuffers;
+    functions.begin_command_buffer           = device_table->BeginCommandBuffer;
+    functions.end_command_buffer             = device_table->EndCommandBuffer;
+    functions.cmd_pipeline_barrier           = device_table->CmdPipelineBarrier;
+    functions.queue_submit                   = device_table->QueueSubmit;
+    functions.create_fence                   = device_table->CreateFence;
+    functions.destroy_fence                  = device_table->DestroyFence;
+    functions.wait_for_fences                = device_table->WaitForFences;
+    functions.reset_fences                   = device_table->ResetFences;
 
     if (device_table->GetBufferMemoryRequirements2 != nullptr)
     {
@@ -1936,6 +2066,171 @@ void VulkanReplayConsumerBase::InitializeResourceAllocator(const PhysicalDeviceI
     }
 }
 
+void VulkanReplayConsumerBase::CreateReplayPipelineCache(VkPhysicalDevice physical_device, DeviceInfo* device_info)
+{
+    assert(device_info != nullptr);
+
+    auto instance_table = GetInstanceTable(physical_device);
+    auto device_table   = GetDeviceTable(device_info->handle);
+    assert((instance_table != nullptr) && (device_table != nullptr));
+
+    // The cache file is specific to the capture file and to the device and driver that produced the cache data, which
+    // is identified by the pipeline cache UUID and driver version.  The captured device ID is also included, so that
+    // each of the devices that a capture creates on the same physical device has its own cache file.
+    VkPhysicalDeviceProperties properties;
+    instance_table->GetPhysicalDeviceProperties(physical_device, &properties);
+
+    const char  hex_digits[] = "0123456789abcdef";
+    std::string uuid;
+    for (uint32_t i = 0; i < VK_UUID_SIZE; ++i)
+    {
+        uuid += hex_digits[properties.pipelineCacheUUID[i] >> 4];
+        uuid += hex_digits[properties.pipelineCacheUUID[i] & 0xf];
+    }
+
+    std::string file_name = options_.capture_file_key + "_" + std::to_string(device_info->capture_id) + "_" +
+                            std::to_string(properties.vendorID) + "_" + std::to_string(properties.deviceID) + "_" +
+                            std::to_string(properties.driverVersion) + "_" + uuid + ".cache";
+    std::string file_path = util::filepath::Join(options_.pipeline_cache_dir, file_name);
+
+    std::vector<uint8_t> cache_data;
+
+    FILE*   fp     = nullptr;
+    int32_t result = util::platform::FileOpen(&fp, file_path.c_str(), "rb");
+    if (result == 0)
+    {
+        int64_t file_size = -1;
+
+        if (util::platform::FileSeek(fp, 0L, util::platform::FileSeekEnd))
+        {
+            file_size = util::platform::FileTell(fp);
+        }
+
+        // The cache is created without initial data when the file size cannot be determined.
+        if ((file_size < 0) || !util::platform::FileSeek(fp, 0L, util::platform::FileSeekSet))
+        {
+            GFXRECON_LOG_WARNING("Failed to determine the size of pipeline cache file %s", file_path.c_str());
+        }
+        else
+        {
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, file_size);
+
+            cache_data.resize(static_cast<size_t>(file_size));
+
+            if (util::platform::FileRead(cache_data.data(), sizeof(uint8_t), cache_data.size(), fp) !=
+                cache_data.size())
+            {
+                GFXRECON_LOG_WARNING("Failed to read pipeline cache file %s", file_path.c_str());
+                cache_data.clear();
+            }
+        }
+
+        util::platform::FileClose(fp);
+    }
+
+    // Data that is not compatible with the replay device is ignored by the driver.
+    VkPipelineCacheCreateInfo create_info = { VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO };
+    create_info.initialDataSize           = cache_data.size();
+    create_info.pInitialData              = cache_data.empty() ? nullptr : cache_data.data();
+
+    if (device_table->CreatePipelineCache(
+            device_info->handle, &create_info, nullptr, &device_info->replay_pipeline_cache) == VK_SUCCESS)
+    {
+        device_info->replay_pipeline_cache_file = file_path;
+
+        if (!cache_data.empty())
+        {
+            GFXRECON_LOG_INFO("Loaded pipeline cache file %s", file_path.c_str());
+        }
+    }
+    else
+    {
+        GFXRECON_LOG_WARNING("Failed to create pipeline cache for pipeline cache file %s", file_path.c_str());
+        device_info->replay_pipeline_cache = VK_NULL_HANDLE;
+    }
+}
+
+void VulkanReplayConsumerBase::DestroyReplayPipelineCache(const DeviceInfo* device_info)
+{
+    assert(device_info != nullptr);
+
+    if (device_info->replay_pipeline_cache == VK_NULL_HANDLE)
+    {
+        return;
+    }
+
+    VkDevice        device         = device_info->handle;
+    VkPipelineCache pipeline_cache = device_info->replay_pipeline_cache;
+    auto            device_table   = GetDeviceTable(device);
+    assert(device_table != nullptr);
+
+    size_t   data_size = 0;
+    VkResult result    = device_table->GetPipelineCacheData(device, pipeline_cache, &data_size, nullptr);
+
+    if ((result == VK_SUCCESS) && (data_size > 0))
+    {
+        std::vector<uint8_t> cache_data(data_size);
+        result = device_table->GetPipelineCacheData(device, pipeline_cache, &data_size, cache_data.data());
+
+        if (result == VK_SUCCESS)
+        {
+            // The data is written to a temporary file that replaces the cache file once it is complete, so that an
+            // interrupted write or a concurrent replay never leaves a partially written cache file to be loaded.
+            const std::string& file_path = device_info->replay_pipeline_cache_file;
+            std::string        temp_path =
+                file_path + "." + std::to_string(util::platform::GetCurrentProcessId()) + ".tmp";
+
+            FILE* fp      = nullptr;
+            bool  success = (util::platform::FileOpen(&fp, temp_path.c_str(), "wb") == 0) &&
+                            (util::platform::FileWrite(cache_data.data(), sizeof(uint8_t), data_size, fp) == data_size);
+
+            if (fp != nullptr)
+            {
+                success = (util::platform::FileClose(fp) == 0) && success;
+            }
+
+            if (success && (util::platform::FileRename(temp_path.c_str(), file_path.c_str()) == 0))
+            {
+                GFXRECON_LOG_INFO("Saved pipeline cache file %s", file_path.c_str());
+            }
+            else
+            {
+                GFXRECON_LOG_WARNING("Failed to write pipeline cache file %s", file_path.c_str());
+                util::platform::FileRemove(temp_path.c_str());
+            }
+        }
+    }
+
+    device_table->DestroyPipelineCache(device, pipeline_cache, nullptr);
+}
+
+void VulkanReplayConsumerBase::CreateSubmitTimer(VkPhysicalDevice physical_device, DeviceInfo* device_info)
+{
+    assert((device_info != nullptr) && (statistics_ != nullptr));
+
+    auto instance_table = GetInstanceTable(physical_device);
+    auto device_table   = GetDeviceTable(device_info->handle);
+    assert((instance_table != nullptr) && (device_table != nullptr));
+
+    VkPhysicalDeviceProperties properties;
+    instance_table->GetPhysicalDeviceProperties(physical_device, &properties);
+
+    uint32_t family_count = 0;
+    instance_table->GetPhysicalDeviceQueueFamilyProperties(physical_device, &family_count, nullptr);
+
+    std::vector<VkQueueFamilyProperties> family_properties(family_count);
+    instance_table->GetPhysicalDeviceQueueFamilyProperties(physical_device, &family_count, family_properties.data());
+
+    std::vector<uint32_t> timestamp_valid_bits;
+    for (const auto& family : family_properties)
+    {
+        timestamp_valid_bits.push_back(family.timestampValidBits);
+    }
+
+    device_info->submit_timer = std::make_unique<VulkanSubmitTimer>(
+        device_info->handle, device_table, properties.limits.timestampPeriod, timestamp_valid_bits, statistics_);
+}
+
 VkResult VulkanReplayConsumerBase::CreateSurface(InstanceInfo*                       instance_info,
                                                  VkFlags                             flags,
                                                  HandlePointerDecoder<VkSurfaceKHR>* surface)
@@ -1981,6 +2276,129 @@ VkResult VulkanReplayConsumerBase::CreateSurface(InstanceInfo*
     return result;
 }
 
+VkResult VulkanReplayConsumerBase::CreateOffscreenSwapchain(DeviceInfo*                     device_info,
+                                                            const VkSwapchainCreateInfoKHR* create_info,
+                                                            uint32_t                        queue_family_index,
+                                                            VkSwapchainKHR*                 swapchain)
+{
+    assert((device_info != nullptr) && (create_info != nullptr) && (swapchain != nullptr));
+
+    VkDevice         device          = device_info->handle;
+    VkPhysicalDevice physical_device = device_info->parent;
+    auto             instance_table  = GetInstanceTable(physical_device);
+    auto             device_table    = GetDeviceTable(device);
+    assert((instance_table != nullptr) && (device_table != nullptr));
+
+    VkPhysicalDeviceMemoryProperties memory_properties;
+    instance_table->GetPhysicalDeviceMemoryProperties(physical_device, &memory_properties);
+
+    // The queue signals the synchronization objects of image acquires.  As with the swapchain state initialization for
+    // trimmed captures, the first queue of the swapchain's queue family is used.
+    VkQueue queue = VK_NULL_HANDLE;
+    device_table->GetDeviceQueue(device, queue_family_index, 0, &queue);
+
+    auto offscreen_swapchain =
+        std::make_unique<VulkanOffscreenSwapchain>(device, device_table, memory_properties, create_info, queue);
+
+    (*swapchain) = offscreen_swapchain->GetHandle();
+    device_info->offscreen_swapchains.emplace(*swapchain, std::move(offscreen_swapchain));
+
+    return VK_SUCCESS;
+}
+
+VulkanOffscreenSwapchain* VulkanReplayConsumerBase::GetOffscreenSwapchain(const DeviceInfo* device_info,
+                                                                          VkSwapchainKHR    swapchain) const
+{
+    assert(device_info != nullptr);
+
+    auto entry = device_info->offscreen_swapchains.find(swapchain);
+
+    if (entry != device_info->offscreen_swapchains.end())
+    {
+        return entry->second.get();
+    }
+
+    return nullptr;
+}
+
+bool VulkanReplayConsumerBase::CanSkipFenceWait(uint32_t fence_count, const VkFence* fences) const
+{
+    if ((fence_count == 0) || (fences == nullptr))
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < fence_count; ++i)
+    {
+        if (fast_forward_completed_fences_.count(fences[i]) == 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void VulkanReplayConsumerBase::TrackFastForwardSubmit(format::HandleId device_id, VkFence fence)
+{
+    fast_forward_device_ids_.insert(device_id);
+
+    if (fence != VK_NULL_HANDLE)
+    {
+        fast_forward_completed_fences_.erase(fence);
+        fast_forward_submitted_fences_.insert(fence);
+    }
+}
+
+void VulkanReplayConsumerBase::TrackFastForwardAcquire(VkFence fence)
+{
+    // Fences signaled by image acquisition are not covered by the device wait, so waits for them are never skipped.
+    if (fence != VK_NULL_HANDLE)
+    {
+        fast_forward_completed_fences_.erase(fence);
+        fast_forward_submitted_fences_.erase(fence);
+    }
+}
+
+void VulkanReplayConsumerBase::EndFrame(const QueueInfo* queue_info)
+{
+    assert(queue_info != nullptr);
+
+    if (IsFastForwardFrame())
+    {
+        fast_forward_device_ids_.insert(queue_info->parent_id);
+
+        for (auto device_id : fast_forward_device_ids_)
+        {
+            auto device_info = object_info_table_.GetDeviceInfo(device_id);
+
+            if (device_info != nullptr)
+            {
+                VkDevice device = device_info->handle;
+                GetDeviceTable(device)->DeviceWaitIdle(device);
+            }
+        }
+
+        // The fences that were submitted before the device wait have been signaled, so later waits for them can be
+        // skipped until they are submitted again.
+        fast_forward_completed_fences_.insert(fast_forward_submitted_fences_.begin(),
+                                              fast_forward_submitted_fences_.end());
+        fast_forward_submitted_fences_.clear();
+        fast_forward_device_ids_.clear();
+
+        if (frame_number_ == options_.fast_forward_last_frame)
+        {
+            GFXRECON_LOG_INFO("Finished fast-forwarding frames %u-%u",
+                              options_.fast_forward_first_frame,
+                              options_.fast_forward_last_frame);
+
+            fast_forward_completed_fences_.clear();
+        }
+    }
+
+    ++frame_number_;
+}
+
 void VulkanReplayConsumerBase::ProcessSwapchainFullScreenExclusiveInfo(
     const Decoded_VkSwapchainCreateInfoKHR* swapchain_info)
 {
@@ -2279,6 +2697,16 @@ VulkanReplayConsumerBase::OverrideCreateDevice(VkResult            original_resu
 
             device_info->allocator = std::unique_ptr<VulkanResourceAllocator>(allocator);
 
+            if (!options_.pipeline_cache_dir.empty())
+            {
+                CreateReplayPipelineCache(physical_device, device_info);
+            }
+
+            if (statistics_ != nullptr)
+            {
+                CreateSubmitTimer(physical_device, device_info);
+            }
+
             active_device_ids_.insert(*pDevice->GetPointer());
         }
     }
@@ -2288,7 +2716,7 @@ VulkanReplayConsumerBase::OverrideCreateDevice(VkResult            original_resu
 
 void VulkanReplayConsumerBase::OverrideDestroyDevice(
     PFN_vkDestroyDevice                                        func,
-    const DeviceInfo*                                          device_info,
+    DeviceInfo*                                                device_info,
     const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
     VkDevice device = VK_NULL_HANDLE;
@@ -2297,11 +2725,180 @@ void VulkanReplayConsumerBase::OverrideDestroyDevice(
     {
         device = device_info->handle;
         active_device_ids_.erase(device_info->capture_id);
+
+        DestroyReplayPipelineCache(device_info);
+
+        device_info->submit_timer.reset();
+        device_info->offscreen_swapchains.clear();
     }
 
     func(device, GetAllocationCallbacks(pAllocator));
 }
 
+void VulkanReplayConsumerBase::OverrideGetDeviceQueue(PFN_vkGetDeviceQueue           func,
+                                                      const DeviceInfo*              device_info,
+                                                      uint32_t                       queueFamilyIndex,
+                                                      uint32_t                       queueIndex,
+                                                      HandlePointerDecoder<VkQueue>* pQueue)
+{
+    assert((device_info != nullptr) && (pQueue != nullptr));
+
+    func(device_info->handle, queueFamilyIndex, queueIndex, pQueue->GetHandlePointer());
+
+    if (!pQueue->IsNull())
+    {
+        auto queue_info = reinterpret_cast<QueueInfo*>(pQueue->GetConsumerData(0));
+        assert(queue_info != nullptr);
+
+        queue_info->parent_id          = device_info->capture_id;
+        queue_info->queue_family_index = queueFamilyIndex;
+    }
+}
+
+void VulkanReplayConsumerBase::OverrideGetDeviceQueue2(
+    PFN_vkGetDeviceQueue2                                   func,
+    const DeviceInfo*                                       device_info,
+    const StructPointerDecoder<Decoded_VkDeviceQueueInfo2>* pQueueInfo,
+    HandlePointerDecoder<VkQueue>*                          pQueue)
+{
+    assert((device_info != nullptr) && (pQueueInfo != nullptr) && (pQueue != nullptr));
+
+    const VkDeviceQueueInfo2* queue_info_2 = pQueueInfo->GetPointer();
+
+    func(device_info->handle, queue_info_2, pQueue->GetHandlePointer());
+
+    if (!pQueue->IsNull() && (queue_info_2 != nullptr))
+    {
+        auto queue_info = reinterpret_cast<QueueInfo*>(pQueue->GetConsumerData(0));
+        assert(queue_info != nullptr);
+
+        queue_info->parent_id          = device_info->capture_id;
+        queue_info->queue_family_index = queue_info_2->queueFamilyIndex;
+    }
+}
+
+VkResult
+VulkanReplayConsumerBase::OverrideQueueSubmit(PFN_vkQueueSubmit                                 func,
+                                              VkResult                                          original_result,
+                                              const QueueInfo*                                  queue_info,
+                                              uint32_t                                          submitCount,
+                                              const StructPointerDecoder<Decoded_VkSubmitInfo>* pSubmits,
+                                              const FenceInfo*                                  fence_info)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(original_result);
+
+    assert((queue_info != nullptr) && (pSubmits != nullptr));
+
+    const VkSubmitInfo* submit_infos = pSubmits->GetPointer();
+    VkFence             fence        = (fence_info != nullptr) ? fence_info->handle : VK_NULL_HANDLE;
+    VulkanSubmitTimer*  submit_timer = nullptr;
+    auto                device_info  = object_info_table_.GetDeviceInfo(queue_info->parent_id);
+
+    if (IsFastForwardPending())
+    {
+        TrackFastForwardSubmit(queue_info->parent_id, fence);
+    }
+
+    if (device_info != nullptr)
+    {
+        // Mapped memory writes that the resource allocator deferred to the next submission are submitted first, to the
+        // same queue, so that they are complete before the submitted commands execute.
+        auto allocator = device_info->allocator.get();
+        assert(allocator != nullptr);
+
+        allocator->SubmitPendingWrites(queue_info->handle, queue_info->queue_family_index);
+
+        if ((statistics_ != nullptr) && (submitCount > 0) && (submit_infos != nullptr))
+        {
+            submit_timer = device_info->submit_timer.get();
+        }
+    }
+
+    VkCommandBuffer begin_command_buffer = VK_NULL_HANDLE;
+    VkCommandBuffer end_command_buffer   = VK_NULL_HANDLE;
+
+    if ((submit_timer == nullptr) ||
+        !submit_timer->BeginSubmission(
+            queue_info->handle, queue_info->queue_family_index, &begin_command_buffer, &end_command_buffer))
+    {
+        return func(queue_info->handle, submitCount, submit_infos, fence);
+    }
+
+    // Add the timestamp command buffers to the start of the first batch and the end of the last batch.
+    std::vector<VkSubmitInfo>    modified_submit_infos(submit_infos, submit_infos + submitCount);
+    std::vector<VkCommandBuffer> first_command_buffers;
+    std::vector<VkCommandBuffer> last_command_buffers;
+
+    VkSubmitInfo& first_submit_info = modified_submit_infos.front();
+    VkSubmitInfo& last_submit_info  = modified_submit_infos.back();
+
+    first_command_buffers.push_back(begin_command_buffer);
+    first_command_buffers.insert(first_command_buffers.end(),
+                                 first_submit_info.pCommandBuffers,
+                                 first_submit_info.pCommandBuffers + first_submit_info.commandBufferCount);
+
+    if (submitCount == 1)
+    {
+        first_command_buffers.push_back(end_command_buffer);
+    }
+    else
+    {
+        last_command_buffers.insert(last_command_buffers.end(),
+                                    last_submit_info.pCommandBuffers,
+                                    last_submit_info.pCommandBuffers + last_submit_info.commandBufferCount);
+        last_command_buffers.push_back(end_command_buffer);
+
+        last_submit_info.commandBufferCount = static_cast<uint32_t>(last_command_buffers.size());
+        last_submit_info.pCommandBuffers    = last_command_buffers.data();
+    }
+
+    first_submit_info.commandBufferCount = static_cast<uint32_t>(first_command_buffers.size());
+    first_submit_info.pCommandBuffers    = first_command_buffers.data();
+
+    VkResult result = func(queue_info->handle, submitCount, modified_submit_infos.data(), fence);
+
+    if (result != VK_SUCCESS)
+    {
+        submit_timer->CancelSubmission(queue_info->handle);
+    }
+
+    return result;
+}
+
+VkResult
+VulkanReplayConsumerBase::OverrideQueueBindSparse(PFN_vkQueueBindSparse                                 func,
+                                                  VkResult                                              original_result,
+                                                  const QueueInfo*                                      queue_info,
+                                                  uint32_t                                              bindInfoCount,
+                                                  const StructPointerDecoder<Decoded_VkBindSparseInfo>* pBindInfo,
+                                                  const FenceInfo*                                      fence_info)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(original_result);
+
+    assert((queue_info != nullptr) && (pBindInfo != nullptr));
+
+    const VkBindSparseInfo* bind_infos  = pBindInfo->GetPointer();
+    VkFence                 fence       = (fence_info != nullptr) ? fence_info->handle : VK_NULL_HANDLE;
+    auto                    device_info = object_info_table_.GetDeviceInfo(queue_info->parent_id);
+
+    if (IsFastForwardPending())
+    {
+        TrackFastForwardSubmit(queue_info->parent_id, fence);
+    }
+
+    if (device_info != nullptr)
+    {
+        // As with vkQueueSubmit, deferred mapped memory writes are submitted first, so that the copies to the buffers
+        // that are rebound by the sparse binding operations are complete before the binding changes.
+        auto allocator = device_info->allocator.get();
+        assert(allocator != nullptr);
+
+        allocator->SubmitPendingWrites(queue_info->handle, queue_info->queue_family_index);
+    }
+
+    return func(queue_info->handle, bindInfoCount, bind_infos, fence);
+}
+
 VkResult
 VulkanReplayConsumerBase::OverrideEnumeratePhysicalDevices(PFN_vkEnumeratePhysicalDevices          func,
                                                            VkResult                                original_result,
@@ -2476,23 +3073,29 @@ VkResult VulkanReplayConsumerBase::OverrideWaitForFences(PFN_vkWaitForFences
 {
     assert((device_info != nullptr) && (pFences != nullptr));
 
-    VkResult result;
-    VkDevice device = device_info->handle;
+    VkResult       result;
+    VkDevice       device = device_info->handle;
+    const VkFence* fences = pFences->GetHandlePointer();
+
+    if (IsFastForwardFrame() && CanSkipFenceWait(fenceCount, fences))
+    {
+        return original_result;
+    }
 
     if (original_result == VK_SUCCESS)
     {
         // Ensure that wait for fences waits until the fences have been signaled (or error occurs) by changing the
         // timeout to UINT64_MAX.
-        result = func(device, fenceCount, pFences->GetHandlePointer(), waitAll, std::numeric_limits<uint64_t>::max());
+        result = func(device, fenceCount, fences, waitAll, std::numeric_limits<uint64_t>::max());
     }
     else if (original_result == VK_TIMEOUT)
     {
         // Try to get a timeout result with a 0 timeout.
-        result = func(device, fenceCount, pFences->GetHandlePointer(), waitAll, 0);
+        result = func(device, fenceCount, fences, waitAll, 0);
     }
     else
     {
-        result = func(device, fenceCount, pFences->GetHandlePointer(), waitAll, timeout);
+        result = func(device, fenceCount, fences, waitAll, timeout);
     }
 
     return result;
@@ -2509,6 +3112,11 @@ VkResult VulkanReplayConsumerBase::OverrideGetFenceStatus(PFN_vkGetFenceStatus f
     VkDevice device = device_info->handle;
     VkFence  fence  = fence_info->handle;
 
+    if (IsFastForwardFrame() && CanSkipFenceWait(1, &fence))
+    {
+        return original_result;
+    }
+
     do
     {
         result = func(device, fence);
@@ -2528,6 +3136,12 @@ VkResult VulkanReplayConsumerBase::OverrideGetEventStatus(PFN_vkGetEventStatus f
     VkDevice device = device_info->handle;
     VkEvent  event  = event_info->handle;
 
+    // Fast-forward does not wait for events to reach their captured state.
+    if (IsFastForwardFrame())
+    {
+        return original_result;
+    }
+
     do
     {
         result = func(device, event);
@@ -2554,6 +3168,12 @@ VkResult VulkanReplayConsumerBase::OverrideGetQueryPoolResults(PFN_vkGetQueryPoo
     VkDevice    device     = device_info->handle;
     VkQueryPool query_pool = query_pool_info->handle;
 
+    // Fast-forward does not retrieve query results, which are not used by replay.
+    if (IsFastForwardFrame())
+    {
+        return original_result;
+    }
+
     do
     {
         result = func(device, query_pool, firstQuery, queryCount, dataSize, pData->GetOutputPointer(), stride, flags);
@@ -3417,7 +4037,10 @@ VkResult VulkanReplayConsumerBase::OverrideCreatePipelineCache(
 
     auto replay_create_info = pCreateInfo->GetPointer();
 
-    if (options_.omit_pipeline_cache_data && (replay_create_info != nullptr))
+    // Captured cache data is also omitted when pipelines are created with the persistent pipeline cache, as the
+    // application's pipeline caches are not used for pipeline creation.
+    if ((options_.omit_pipeline_cache_data || (device_info->replay_pipeline_cache != VK_NULL_HANDLE)) &&
+        (replay_create_info != nullptr))
     {
         // Make a shallow copy of the create info structure and clear the cache data.
         VkPipelineCacheCreateInfo override_create_info = (*replay_create_info);
@@ -3438,6 +4061,68 @@ VkResult VulkanReplayConsumerBase::OverrideCreatePipelineCache(
     }
 }
 
+VkResult VulkanReplayConsumerBase::OverrideCreateGraphicsPipelines(
+    PFN_vkCreateGraphicsPipelines                                      func,
+    VkResult                                                           original_result,
+    const DeviceInfo*                                                  device_info,
+    const PipelineCacheInfo*                                           pipeline_cache_info,
+    uint32_t                                                           createInfoCount,
+    const StructPointerDecoder<Decoded_VkGraphicsPipelineCreateInfo>* pCreateInfos,
+    const StructPointerDecoder<Decoded_VkAllocationCallbacks>*         pAllocator,
+    HandlePointerDecoder<VkPipeline>*                                  pPipelines)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(original_result);
+
+    assert((device_info != nullptr) && (pCreateInfos != nullptr) && (pPipelines != nullptr) && !pPipelines->IsNull());
+
+    VkResult result = VK_SUCCESS;
+
+    if ((pipeline_precompiler_ == nullptr) ||
+        !pipeline_precompiler_->GetPipelines(
+            *pPipelines->GetPointer(), createInfoCount, pPipelines->GetHandlePointer(), &result))
+    {
+        result = func(device_info->handle,
+                      GetReplayPipelineCache(device_info, pipeline_cache_info),
+                      createInfoCount,
+                      pCreateInfos->GetPointer(),
+                      GetAllocationCallbacks(pAllocator),
+                      pPipelines->GetHandlePointer());
+    }
+
+    return result;
+}
+
+VkResult VulkanReplayConsumerBase::OverrideCreateComputePipelines(
+    PFN_vkCreateComputePipelines                                      func,
+    VkResult                                                          original_result,
+    const DeviceInfo*                                                 device_info,
+    const PipelineCacheInfo*                                          pipeline_cache_info,
+    uint32_t                                                          createInfoCount,
+    const StructPointerDecoder<Decoded_VkComputePipelineCreateInfo>* pCreateInfos,
+    const StructPointerDecoder<Decoded_VkAllocationCallbacks>*        pAllocator,
+    HandlePointerDecoder<VkPipeline>*                                 pPipelines)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(original_result);
+
+    assert((device_info != nullptr) && (pCreateInfos != nullptr) && (pPipelines != nullptr) && !pPipelines->IsNull());
+
+    VkResult result = VK_SUCCESS;
+
+    if ((pipeline_precompiler_ == nullptr) ||
+        !pipeline_precompiler_->GetPipelines(
+            *pPipelines->GetPointer(), createInfoCount, pPipelines->GetHandlePointer(), &result))
+    {
+        result = func(device_info->handle,
+                      GetReplayPipelineCache(device_info, pipeline_cache_info),
+                      createInfoCount,
+                      pCreateInfos->GetPointer(),
+                      GetAllocationCallbacks(pAllocator),
+                      pPipelines->GetHandlePointer());
+    }
+
+    return result;
+}
+
 VkResult VulkanReplayConsumerBase::OverrideCreateDebugReportCallbackEXT(
     PFN_vkCreateDebugReportCallbackEXT                                      func,
     VkResult                                                                original_result,
@@ -3517,27 +4202,37 @@ VkResult VulkanReplayConsumerBase::OverrideCreateSwapchainKHR(
 
     ProcessSwapchainFullScreenExclusiveInfo(pCreateInfo->GetMetaStructPointer());
 
-    VkResult result =
-        func(device_info->handle, replay_create_info, GetAllocationCallbacks(pAllocator), replay_swapchain);
+    uint32_t queue_family_index = 0;
 
-    if ((result == VK_SUCCESS) && (replay_create_info != nullptr) && ((*replay_swapchain) != VK_NULL_HANDLE))
+    if ((replay_create_info != nullptr) && (replay_create_info->imageSharingMode == VK_SHARING_MODE_CONCURRENT) &&
+        (replay_create_info->queueFamilyIndexCount > 0) && (replay_create_info->pQueueFamilyIndices != nullptr))
     {
-        auto swapchain_info = reinterpret_cast<SwapchainKHRInfo*>(pSwapchain->GetConsumerData(0));
-        assert(swapchain_info != nullptr);
+        queue_family_index = replay_create_info->pQueueFamilyIndices[0];
+    }
 
-        if ((replay_create_info->imageSharingMode == VK_SHARING_MODE_CONCURRENT) &&
-            (replay_create_info->queueFamilyIndexCount > 0) && (replay_create_info->pQueueFamilyIndices != nullptr))
-        {
-            swapchain_info->queue_family_index = replay_create_info->pQueueFamilyIndices[0];
-        }
-        else
+    VkResult result = VK_SUCCESS;
+
+    if (options_.offscreen_swapchain && (replay_create_info != nullptr))
+    {
+        result = CreateOffscreenSwapchain(device_info, replay_create_info, queue_family_index, replay_swapchain);
+    }
+    else
+    {
+        result = func(device_info->handle, replay_create_info, GetAllocationCallbacks(pAllocator), replay_swapchain);
+
+        if ((result == VK_SUCCESS) && ((*replay_swapchain) != VK_NULL_HANDLE))
         {
-            swapchain_info->queue_family_index = 0;
+            device_info->active_swapchains.insert(*replay_swapchain);
         }
+    }
 
-        swapchain_info->surface = replay_create_info->surface;
+    if ((result == VK_SUCCESS) && (replay_create_info != nullptr) && ((*replay_swapchain) != VK_NULL_HANDLE))
+    {
+        auto swapchain_info = reinterpret_cast<SwapchainKHRInfo*>(pSwapchain->GetConsumerData(0));
+        assert(swapchain_info != nullptr);
 
-        device_info->active_swapchains.insert(*replay_swapchain);
+        swapchain_info->queue_family_index = queue_family_index;
+        swapchain_info->surface            = replay_create_info->surface;
     }
 
     return result;
@@ -3557,12 +4252,45 @@ void VulkanReplayConsumerBase::OverrideDestroySwapchainKHR(
     if (swapchain_info != nullptr)
     {
         swapchain = swapchain_info->handle;
+
+        // Offscreen swapchain images are destroyed with the offscreen swapchain, which was not created by the driver.
+        if (device_info->offscreen_swapchains.erase(swapchain) > 0)
+        {
+            return;
+        }
+
         device_info->active_swapchains.erase(swapchain);
     }
 
     func(device, swapchain, GetAllocationCallbacks(pAllocator));
 }
 
+VkResult VulkanReplayConsumerBase::OverrideGetSwapchainImagesKHR(PFN_vkGetSwapchainImagesKHR    func,
+                                                                 VkResult                       original_result,
+                                                                 const DeviceInfo*              device_info,
+                                                                 const SwapchainKHRInfo*        swapchain_info,
+                                                                 PointerDecoder<uint32_t>*      pSwapchainImageCount,
+                                                                 HandlePointerDecoder<VkImage>* pSwapchainImages)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(original_result);
+
+    assert((device_info != nullptr) && (swapchain_info != nullptr) && (pSwapchainImageCount != nullptr) &&
+           (pSwapchainImageCount->GetPointer() != nullptr) && (pSwapchainImages != nullptr));
+
+    VkSwapchainKHR            swapchain           = swapchain_info->handle;
+    uint32_t*                 replay_count        = pSwapchainImageCount->GetOutputPointer();
+    VkImage*                  replay_images       = pSwapchainImages->GetHandlePointer();
+    VulkanOffscreenSwapchain* offscreen_swapchain = GetOffscreenSwapchain(device_info, swapchain);
+
+    if (offscreen_swapchain != nullptr)
+    {
+        // The offscreen swapchain is created with the image count that was returned during capture.
+        return offscreen_swapchain->GetImages((*pSwapchainImageCount->GetPointer()), replay_count, replay_images);
+    }
+
+    return func(device_info->handle, swapchain, replay_count, replay_images);
+}
+
 VkResult VulkanReplayConsumerBase::OverrideAcquireNextImageKHR(PFN_vkAcquireNextImageKHR func,
                                                                VkResult                  original_result,
                                                                const DeviceInfo*         device_info,
@@ -3586,8 +4314,25 @@ VkResult VulkanReplayConsumerBase::OverrideAcquireNextImageKHR(PFN_vkAcquireNext
     VkFence        preacquire_fence     = VK_NULL_HANDLE;
     uint32_t       captured_index       = (*pImageIndex->GetPointer());
 
-    if (swapchain_image_tracker_.RetrievePreAcquiredImage(
-            swapchain, captured_index, &preacquire_semaphore, &preacquire_fence))
+    if (IsFastForwardPending())
+    {
+        TrackFastForwardAcquire(fence);
+    }
+
+    VulkanOffscreenSwapchain* offscreen_swapchain = GetOffscreenSwapchain(device_info, swapchain);
+
+    if (offscreen_swapchain != nullptr)
+    {
+        // Offscreen swapchains acquire the image that was acquired during capture, so their images are never
+        // pre-acquired and tracked by the swapchain image tracker.
+        assert(pImageIndex->GetOutputPointer() != nullptr);
+
+        (*pImageIndex->GetOutputPointer()) = captured_index;
+
+        result = offscreen_swapchain->AcquireImage(captured_index, semaphore, fence);
+    }
+    else if (swapchain_image_tracker_.RetrievePreAcquiredImage(
+                 swapchain, captured_index, &preacquire_semaphore, &preacquire_fence))
     {
         auto table = GetDeviceTable(device);
         assert(table != nullptr);
@@ -3643,8 +4388,26 @@ VkResult VulkanReplayConsumerBase::OverrideAcquireNextImage2KHR(
     auto        replay_acquire_info  = pAcquireInfo->GetPointer();
     uint32_t    captured_index       = (*pImageIndex->GetPointer());
 
-    if (swapchain_image_tracker_.RetrievePreAcquiredImage(
-            replay_acquire_info->swapchain, captured_index, &preacquire_semaphore, &preacquire_fence))
+    if (IsFastForwardPending())
+    {
+        TrackFastForwardAcquire(replay_acquire_info->fence);
+    }
+
+    VulkanOffscreenSwapchain* offscreen_swapchain = GetOffscreenSwapchain(device_info, replay_acquire_info->swapchain);
+
+    if (offscreen_swapchain != nullptr)
+    {
+        // Offscreen swapchains acquire the image that was acquired during capture, so their images are never
+        // pre-acquired and tracked by the swapchain image tracker.
+        assert(pImageIndex->GetOutputPointer() != nullptr);
+
+        (*pImageIndex->GetOutputPointer()) = captured_index;
+
+        result = offscreen_swapchain->AcquireImage(
+            captured_index, replay_acquire_info->semaphore, replay_acquire_info->fence);
+    }
+    else if (swapchain_image_tracker_.RetrievePreAcquiredImage(
+                 replay_acquire_info->swapchain, captured_index, &preacquire_semaphore, &preacquire_fence))
     {
         auto table = GetDeviceTable(device);
         assert(table != nullptr);
@@ -3681,6 +4444,226 @@ VkResult VulkanReplayConsumerBase::OverrideAcquireNextImage2KHR(
     return result;
 }
 
+VkResult
+VulkanReplayConsumerBase::OverrideQueuePresentKHR(PFN_vkQueuePresentKHR                                 func,
+                                                  VkResult                                              original_result,
+                                                  const QueueInfo*                                      queue_info,
+                                                  const StructPointerDecoder<Decoded_VkPresentInfoKHR>* pPresentInfo)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(original_result);
+
+    assert((queue_info != nullptr) && (pPresentInfo != nullptr) && !pPresentInfo->IsNull());
+
+    VkQueue                 queue               = queue_info->handle;
+    const VkPresentInfoKHR* replay_present_info = pPresentInfo->GetPointer();
+
+    EndFrame(queue_info);
+
+    if (!options_.offscreen_swapchain)
+    {
+        return func(queue, replay_present_info);
+    }
+
+    // Presenting offscreen swapchain images only needs to consume the wait semaphores, which are waited on by an empty
+    // queue submission.
+    VkResult result = VK_SUCCESS;
+
+    if (replay_present_info->waitSemaphoreCount > 0)
+    {
+        std::vector<VkPipelineStageFlags> wait_stages(replay_present_info->waitSemaphoreCount,
+                                                      VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+
+        VkSubmitInfo submit_info         = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+        submit_info.pNext                = nullptr;
+        submit_info.waitSemaphoreCount   = replay_present_info->waitSemaphoreCount;
+        submit_info.pWaitSemaphores      = replay_present_info->pWaitSemaphores;
+        submit_info.pWaitDstStageMask    = wait_stages.data();
+        submit_info.commandBufferCount   = 0;
+        submit_info.pCommandBuffers      = nullptr;
+        submit_info.signalSemaphoreCount = 0;
+        submit_info.pSignalSemaphores    = nullptr;
+
+        result = GetDeviceTable(queue)->QueueSubmit(queue, 1, &submit_info, VK_NULL_HANDLE);
+    }
+
+    if (replay_present_info->pResults != nullptr)
+    {
+        for (uint32_t i = 0; i < replay_present_info->swapchainCount; ++i)
+        {
+            replay_present_info->pResults[i] = result;
+        }
+    }
+
+    return result;
+}
+
+VkResult VulkanReplayConsumerBase::OverrideGetSwapchainStatusKHR(PFN_vkGetSwapchainStatusKHR func,
+                                                                VkResult                    original_result,
+                                                                const DeviceInfo*           device_info,
+                                                                const SwapchainKHRInfo*     swapchain_info)
+{
+    assert((device_info != nullptr) && (swapchain_info != nullptr));
+
+    if (GetOffscreenSwapchain(device_info, swapchain_info->handle) != nullptr)
+    {
+        return original_result;
+    }
+
+    return func(device_info->handle, swapchain_info->handle);
+}
+
+void VulkanReplayConsumerBase::OverrideSetHdrMetadataEXT(
+    PFN_vkSetHdrMetadataEXT                               func,
+    const DeviceInfo*                                     device_info,
+    uint32_t                                              swapchainCount,
+    const HandlePointerDecoder<VkSwapchainKHR>*           pSwapchains,
+    const StructPointerDecoder<Decoded_VkHdrMetadataEXT>* pMetadata)
+{
+    assert((device_info != nullptr) && (pSwapchains != nullptr) && (pMetadata != nullptr));
+
+    const VkSwapchainKHR*   replay_swapchains = pSwapchains->GetHandlePointer();
+    const VkHdrMetadataEXT* replay_metadata   = pMetadata->GetPointer();
+
+    if ((swapchainCount == 0) || (replay_swapchains == nullptr) || (replay_metadata == nullptr))
+    {
+        return;
+    }
+
+    // Metadata is only set for the swapchains that were created by the driver.
+    std::vector<VkSwapchainKHR>   swapchains;
+    std::vector<VkHdrMetadataEXT> metadata;
+
+    for (uint32_t i = 0; i < swapchainCount; ++i)
+    {
+        if (GetOffscreenSwapchain(device_info, replay_swapchains[i]) == nullptr)
+        {
+            swapchains.push_back(replay_swapchains[i]);
+            metadata.push_back(replay_metadata[i]);
+        }
+    }
+
+    if (!swapchains.empty())
+    {
+        func(device_info->handle, static_cast<uint32_t>(swapchains.size()), swapchains.data(), metadata.data());
+    }
+}
+
+VkResult VulkanReplayConsumerBase::OverrideGetSwapchainCounterEXT(PFN_vkGetSwapchainCounterEXT func,
+                                                                 VkResult                     original_result,
+                                                                 const DeviceInfo*            device_info,
+                                                                 const SwapchainKHRInfo*      swapchain_info,
+                                                                 VkSurfaceCounterFlagBitsEXT  counter,
+                                                                 PointerDecoder<uint64_t>*    pCounterValue)
+{
+    assert((device_info != nullptr) && (swapchain_info != nullptr) && (pCounterValue != nullptr));
+
+    uint64_t* replay_counter_value = pCounterValue->GetOutputPointer();
+
+    if (GetOffscreenSwapchain(device_info, swapchain_info->handle) != nullptr)
+    {
+        if ((replay_counter_value != nullptr) && (pCounterValue->GetPointer() != nullptr))
+        {
+            (*replay_counter_value) = (*pCounterValue->GetPointer());
+        }
+
+        return original_result;
+    }
+
+    return func(device_info->handle, swapchain_info->handle, counter, replay_counter_value);
+}
+
+VkResult VulkanReplayConsumerBase::OverrideGetRefreshCycleDurationGOOGLE(
+    PFN_vkGetRefreshCycleDurationGOOGLE                         func,
+    VkResult                                                    original_result,
+    const DeviceInfo*                                           device_info,
+    const SwapchainKHRInfo*                                     swapchain_info,
+    StructPointerDecoder<Decoded_VkRefreshCycleDurationGOOGLE>* pDisplayTimingProperties)
+{
+    assert((device_info != nullptr) && (swapchain_info != nullptr) && (pDisplayTimingProperties != nullptr));
+
+    VkRefreshCycleDurationGOOGLE* replay_properties = pDisplayTimingProperties->GetOutputPointer();
+
+    if (GetOffscreenSwapchain(device_info, swapchain_info->handle) != nullptr)
+    {
+        if ((replay_properties != nullptr) && (pDisplayTimingProperties->GetPointer() != nullptr))
+        {
+            (*replay_properties) = (*pDisplayTimingProperties->GetPointer());
+        }
+
+        return original_result;
+    }
+
+    return func(device_info->handle, swapchain_info->handle, replay_properties);
+}
+
+VkResult VulkanReplayConsumerBase::OverrideGetPastPresentationTimingGOOGLE(
+    PFN_vkGetPastPresentationTimingGOOGLE                         func,
+    VkResult                                                      original_result,
+    const DeviceInfo*                                             device_info,
+    const SwapchainKHRInfo*                                       swapchain_info,
+    PointerDecoder<uint32_t>*                                     pPresentationTimingCount,
+    StructPointerDecoder<Decoded_VkPastPresentationTimingGOOGLE>* pPresentationTimings)
+{
+    assert((device_info != nullptr) && (swapchain_info != nullptr) && (pPresentationTimingCount != nullptr) &&
+           (pPresentationTimings != nullptr));
+
+    uint32_t*                       replay_count   = pPresentationTimingCount->GetOutputPointer();
+    VkPastPresentationTimingGOOGLE* replay_timings = pPresentationTimings->GetOutputPointer();
+
+    if (GetOffscreenSwapchain(device_info, swapchain_info->handle) != nullptr)
+    {
+        const uint32_t*                       captured_count   = pPresentationTimingCount->GetPointer();
+        const VkPastPresentationTimingGOOGLE* captured_timings = pPresentationTimings->GetPointer();
+
+        if ((replay_count != nullptr) && (captured_count != nullptr))
+        {
+            if ((replay_timings != nullptr) && (captured_timings != nullptr))
+            {
+                uint32_t copy_count = std::min(*replay_count, *captured_count);
+                std::copy(captured_timings, captured_timings + copy_count, replay_timings);
+            }
+
+            (*replay_count) = (*captured_count);
+        }
+
+        return original_result;
+    }
+
+    return func(device_info->handle, swapchain_info->handle, replay_count, replay_timings);
+}
+
+VkResult VulkanReplayConsumerBase::OverrideAcquireFullScreenExclusiveModeEXT(
+    PFN_vkAcquireFullScreenExclusiveModeEXT func,
+    VkResult                                original_result,
+    const DeviceInfo*                       device_info,
+    const SwapchainKHRInfo*                 swapchain_info)
+{
+    assert((device_info != nullptr) && (swapchain_info != nullptr));
+
+    if (GetOffscreenSwapchain(device_info, swapchain_info->handle) != nullptr)
+    {
+        return original_result;
+    }
+
+    return func(device_info->handle, swapchain_info->handle);
+}
+
+VkResult VulkanReplayConsumerBase::OverrideReleaseFullScreenExclusiveModeEXT(
+    PFN_vkReleaseFullScreenExclusiveModeEXT func,
+    VkResult                                original_result,
+    const DeviceInfo*                       device_info,
+    const SwapchainKHRInfo*                 swapchain_info)
+{
+    assert((device_info != nullptr) && (swapchain_info != nullptr));
+
+    if (GetOffscreenSwapchain(device_info, swapchain_info->handle) != nullptr)
+    {
+        return original_result;
+    }
+
+    return func(device_info->handle, swapchain_info->handle);
+}
+
 VkResult VulkanReplayConsumerBase::OverrideCreateAndroidSurfaceKHR(
     PFN_vkCreateAndroidSurfaceKHR                                      func,
     VkResult                                                           original_result,
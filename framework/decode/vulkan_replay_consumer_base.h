@@ -20,10 +20,12 @@
 
 #include "decode/handle_pointer_decoder.h"
 #include "decode/pointer_decoder.h"
+#include "decode/replay_statistics.h"
 #include "decode/swapchain_image_tracker.h"
 #include "decode/vulkan_handle_mapping_util.h"
 #include "decode/vulkan_object_info.h"
 #include "decode/vulkan_object_info_table.h"
+#include "decode/vulkan_pipeline_precompiler.h"
 #include "decode/vulkan_replay_options.h"
 #include "decode/vulkan_resource_allocator.h"
 #include "decode/vulkan_resource_initializer.h"
@@ -63,6 +65,18 @@ class VulkanReplayConsumerBase : public VulkanConsumer
 
     void SetFatalErrorHandler(std::function<void(const char*)> handler) { fatal_error_handler_ = handler; }
 
+    // Scans the capture file for pipeline creation calls, which are processed by the specified number of worker threads
+    // as soon as the objects that they reference have been created, ahead of their position in the capture file.  Must
+    // be called before replay begins.
+    bool EnablePipelinePrecompilation(const std::string& filename, uint32_t thread_count);
+
+    // Enables the measurement of the GPU time of queue submissions with timestamp queries, for devices created after
+    // the call.  Must be called before replay begins.
+    void SetReplayStatistics(ReplayStatistics* statistics) { statistics_ = statistics; }
+
+    // Waits for all devices to become idle and records the GPU times of the queue submissions that have completed.
+    void CollectSubmissionGpuTimes();
+
     virtual void ProcessStateBeginMarker(uint64_t frame_number) override;
 
     virtual void ProcessStateEndMarker(uint64_t frame_number) override;
@@ -113,6 +127,14 @@ class VulkanReplayConsumerBase : public VulkanConsumer
 
     virtual void ProcessEndResourceInitCommand(format::HandleId device_id) override;
 
+    virtual uint8_t*
+    GetInitBufferCommandData(format::HandleId device_id, format::HandleId buffer_id, uint64_t data_size) override;
+
+    virtual uint8_t* GetInitImageCommandData(format::HandleId device_id,
+                                             format::HandleId image_id,
+                                             uint64_t         data_size,
+                                             uint32_t         aspect) override;
+
     virtual void ProcessInitBufferCommand(format::HandleId device_id,
                                           format::HandleId buffer_id,
                                           uint64_t         data_size,
@@ -198,6 +220,7 @@ class VulkanReplayConsumerBase : public VulkanConsumer
         if ((id != nullptr) && (handle != nullptr))
         {
             handle_mapping::AddHandle(*id, *handle, std::forward<T>(initial_info), &object_info_table_, AddFunc);
+            ProcessHandlesAdded(id, 1);
         }
     }
 
@@ -209,6 +232,7 @@ class VulkanReplayConsumerBase : public VulkanConsumer
         if ((id != nullptr) && (handle != nullptr))
         {
             handle_mapping::AddHandle(*id, *handle, &object_info_table_, AddFunc);
+            ProcessHandlesAdded(id, 1);
         }
     }
 
@@ -222,6 +246,7 @@ class VulkanReplayConsumerBase : public VulkanConsumer
     {
         handle_mapping::AddHandleArray(
             ids, ids_len, handles, handles_len, std::move(initial_infos), &object_info_table_, AddFunc);
+        ProcessHandlesAdded(ids, (handles != nullptr) ? std::min(ids_len, handles_len) : 0);
     }
 
     template <typename T>
@@ -232,6 +257,19 @@ class VulkanReplayConsumerBase : public VulkanConsumer
                     void (VulkanObjectInfoTable::*AddFunc)(T&&))
     {
         handle_mapping::AddHandleArray(ids, ids_len, handles, handles_len, &object_info_table_, AddFunc);
+        ProcessHandlesAdded(ids, (handles != nullptr) ? std::min(ids_len, handles_len) : 0);
+    }
+
+    // Notifies the pipeline precompiler of new objects, which may be referenced by the pipelines that it creates.
+    void ProcessHandlesAdded(const format::HandleId* ids, size_t ids_len)
+    {
+        if ((pipeline_precompiler_ != nullptr) && (ids != nullptr))
+        {
+            for (size_t i = 0; i < ids_len; ++i)
+            {
+                pipeline_precompiler_->ProcessObjectAdded(ids[i]);
+            }
+        }
     }
 
     template <typename HandleInfoT>
@@ -310,9 +348,34 @@ class VulkanReplayConsumerBase : public VulkanConsumer
                                   HandlePointerDecoder<VkDevice>*                            pDevice);
 
     void OverrideDestroyDevice(PFN_vkDestroyDevice                                        func,
-                               const DeviceInfo*                                          device_info,
+                               DeviceInfo*                                                device_info,
                                const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator);
 
+    void OverrideGetDeviceQueue(PFN_vkGetDeviceQueue           func,
+                                const DeviceInfo*              device_info,
+                                uint32_t                       queueFamilyIndex,
+                                uint32_t                       queueIndex,
+                                HandlePointerDecoder<VkQueue>* pQueue);
+
+    void OverrideGetDeviceQueue2(PFN_vkGetDeviceQueue2                                   func,
+                                 const DeviceInfo*                                       device_info,
+                                 const StructPointerDecoder<Decoded_VkDeviceQueueInfo2>* pQueueInfo,
+                                 HandlePointerDecoder<VkQueue>*                          pQueue);
+
+    VkResult OverrideQueueSubmit(PFN_vkQueueSubmit                                 func,
+                                 VkResult                                          original_result,
+                                 const QueueInfo*                                  queue_info,
+                                 uint32_t                                          submitCount,
+                                 const StructPointerDecoder<Decoded_VkSubmitInfo>* pSubmits,
+                                 const FenceInfo*                                  fence_info);
+
+    VkResult OverrideQueueBindSparse(PFN_vkQueueBindSparse                                 func,
+                                     VkResult                                              original_result,
+                                     const QueueInfo*                                      queue_info,
+                                     uint32_t                                              bindInfoCount,
+                                     const StructPointerDecoder<Decoded_VkBindSparseInfo>* pBindInfo,
+                                     const FenceInfo*                                      fence_info);
+
     VkResult OverrideEnumeratePhysicalDevices(PFN_vkEnumeratePhysicalDevices          func,
                                               VkResult                                original_result,
                                               InstanceInfo*                           instance_info,
@@ -499,6 +562,26 @@ class VulkanReplayConsumerBase : public VulkanConsumer
                                          const StructPointerDecoder<Decoded_VkAllocationCallbacks>*     pAllocator,
                                          HandlePointerDecoder<VkPipelineCache>*                         pPipelineCache);
 
+    VkResult OverrideCreateGraphicsPipelines(
+        PFN_vkCreateGraphicsPipelines                                      func,
+        VkResult                                                           original_result,
+        const DeviceInfo*                                                  device_info,
+        const PipelineCacheInfo*                                           pipeline_cache_info,
+        uint32_t                                                           createInfoCount,
+        const StructPointerDecoder<Decoded_VkGraphicsPipelineCreateInfo>* pCreateInfos,
+        const StructPointerDecoder<Decoded_VkAllocationCallbacks>*         pAllocator,
+        HandlePointerDecoder<VkPipeline>*                                  pPipelines);
+
+    VkResult OverrideCreateComputePipelines(
+        PFN_vkCreateComputePipelines                                      func,
+        VkResult                                                          original_result,
+        const DeviceInfo*                                                 device_info,
+        const PipelineCacheInfo*                                          pipeline_cache_info,
+        uint32_t                                                          createInfoCount,
+        const StructPointerDecoder<Decoded_VkComputePipelineCreateInfo>* pCreateInfos,
+        const StructPointerDecoder<Decoded_VkAllocationCallbacks>*        pAllocator,
+        HandlePointerDecoder<VkPipeline>*                                 pPipelines);
+
     VkResult OverrideCreateDebugReportCallbackEXT(
         PFN_vkCreateDebugReportCallbackEXT                                      func,
         VkResult                                                                original_result,
@@ -527,6 +610,13 @@ class VulkanReplayConsumerBase : public VulkanConsumer
                                      const SwapchainKHRInfo*                                    swapchain_info,
                                      const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator);
 
+    VkResult OverrideGetSwapchainImagesKHR(PFN_vkGetSwapchainImagesKHR    func,
+                                           VkResult                       original_result,
+                                           const DeviceInfo*              device_info,
+                                           const SwapchainKHRInfo*        swapchain_info,
+                                           PointerDecoder<uint32_t>*      pSwapchainImageCount,
+                                           HandlePointerDecoder<VkImage>* pSwapchainImages);
+
     VkResult OverrideAcquireNextImageKHR(PFN_vkAcquireNextImageKHR func,
                                          VkResult                  original_result,
                                          const DeviceInfo*         device_info,
@@ -542,6 +632,56 @@ class VulkanReplayConsumerBase : public VulkanConsumer
                                           const StructPointerDecoder<Decoded_VkAcquireNextImageInfoKHR>* pAcquireInfo,
                                           PointerDecoder<uint32_t>*                                      pImageIndex);
 
+    VkResult OverrideQueuePresentKHR(PFN_vkQueuePresentKHR                                 func,
+                                     VkResult                                              original_result,
+                                     const QueueInfo*                                      queue_info,
+                                     const StructPointerDecoder<Decoded_VkPresentInfoKHR>* pPresentInfo);
+
+    // Swapchain queries and operations, which return the captured results for offscreen swapchains, whose handles
+    // must not be passed to the driver.
+    VkResult OverrideGetSwapchainStatusKHR(PFN_vkGetSwapchainStatusKHR func,
+                                           VkResult                    original_result,
+                                           const DeviceInfo*           device_info,
+                                           const SwapchainKHRInfo*     swapchain_info);
+
+    void OverrideSetHdrMetadataEXT(PFN_vkSetHdrMetadataEXT                               func,
+                                   const DeviceInfo*                                     device_info,
+                                   uint32_t                                              swapchainCount,
+                                   const HandlePointerDecoder<VkSwapchainKHR>*           pSwapchains,
+                                   const StructPointerDecoder<Decoded_VkHdrMetadataEXT>* pMetadata);
+
+    VkResult OverrideGetSwapchainCounterEXT(PFN_vkGetSwapchainCounterEXT func,
+                                            VkResult                     original_result,
+                                            const DeviceInfo*            device_info,
+                                            const SwapchainKHRInfo*      swapchain_info,
+                                            VkSurfaceCounterFlagBitsEXT  counter,
+                                            PointerDecoder<uint64_t>*    pCounterValue);
+
+    VkResult OverrideGetRefreshCycleDurationGOOGLE(
+        PFN_vkGetRefreshCycleDurationGOOGLE                         func,
+        VkResult                                                    original_result,
+        const DeviceInfo*                                           device_info,
+        const SwapchainKHRInfo*                                     swapchain_info,
+        StructPointerDecoder<Decoded_VkRefreshCycleDurationGOOGLE>* pDisplayTimingProperties);
+
+    VkResult OverrideGetPastPresentationTimingGOOGLE(
+        PFN_vkGetPastPresentationTimingGOOGLE                         func,
+        VkResult                                                      original_result,
+        const DeviceInfo*                                             device_info,
+        const SwapchainKHRInfo*                                       swapchain_info,
+        PointerDecoder<uint32_t>*                                     pPresentationTimingCount,
+        StructPointerDecoder<Decoded_VkPastPresentationTimingGOOGLE>* pPresentationTimings);
+
+    VkResult OverrideAcquireFullScreenExclusiveModeEXT(PFN_vkAcquireFullScreenExclusiveModeEXT func,
+                                                       VkResult                                original_result,
+                                                       const DeviceInfo*                       device_info,
+                                                       const SwapchainKHRInfo*                 swapchain_info);
+
+    VkResult OverrideReleaseFullScreenExclusiveModeEXT(PFN_vkReleaseFullScreenExclusiveModeEXT func,
+                                                       VkResult                                original_result,
+                                                       const DeviceInfo*                       device_info,
+                                                       const SwapchainKHRInfo*                 swapchain_info);
+
     // Window/Surface related overrides, which can transform the window/surface type from the platform
     // specific type found in the trace file to the platform specific type used for replay.
     VkResult
@@ -647,8 +787,60 @@ class VulkanReplayConsumerBase : public VulkanConsumer
                                      const std::vector<std::string>& enabled_device_extensions,
                                      VulkanResourceAllocator*        allocator);
 
+    // Creates the persistent pipeline cache for a device, with the data from the device's pipeline cache file when it
+    // exists.
+    void CreateReplayPipelineCache(VkPhysicalDevice physical_device, DeviceInfo* device_info);
+
+    // Writes the persistent pipeline cache data to the device's pipeline cache file and destroys the pipeline cache.
+    void DestroyReplayPipelineCache(const DeviceInfo* device_info);
+
+    // Creates the timestamp queries for measuring the GPU time of the device's queue submissions.
+    void CreateSubmitTimer(VkPhysicalDevice physical_device, DeviceInfo* device_info);
+
+    VkPipelineCache GetReplayPipelineCache(const DeviceInfo* device_info, const PipelineCacheInfo* pipeline_cache_info)
+    {
+        if (device_info->replay_pipeline_cache != VK_NULL_HANDLE)
+        {
+            return device_info->replay_pipeline_cache;
+        }
+
+        return (pipeline_cache_info != nullptr) ? pipeline_cache_info->handle : VK_NULL_HANDLE;
+    }
+
     VkResult CreateSurface(InstanceInfo* instance_info, VkFlags flags, HandlePointerDecoder<VkSurfaceKHR>* surface);
 
+    VkResult CreateOffscreenSwapchain(DeviceInfo*                     device_info,
+                                      const VkSwapchainCreateInfoKHR* create_info,
+                                      uint32_t                        queue_family_index,
+                                      VkSwapchainKHR*                 swapchain);
+
+    VulkanOffscreenSwapchain* GetOffscreenSwapchain(const DeviceInfo* device_info, VkSwapchainKHR swapchain) const;
+
+    // Fast-forward frames are replayed without host waits for fences, events, and query results.  Fences are tracked
+    // while fast-forward frames remain to be replayed.
+    bool IsFastForwardFrame() const
+    {
+        return (options_.fast_forward_first_frame > 0) && (frame_number_ >= options_.fast_forward_first_frame) &&
+               (frame_number_ <= options_.fast_forward_last_frame);
+    }
+
+    bool IsFastForwardPending() const
+    {
+        return (options_.fast_forward_first_frame > 0) && (frame_number_ <= options_.fast_forward_last_frame);
+    }
+
+    // Determines if a wait for the fences can be skipped, because the fences were all signaled by queue submissions
+    // that completed before the last fast-forward device wait.
+    bool CanSkipFenceWait(uint32_t fence_count, const VkFence* fences) const;
+
+    void TrackFastForwardSubmit(format::HandleId device_id, VkFence fence);
+
+    void TrackFastForwardAcquire(VkFence fence);
+
+    // Advances the frame number at the end of a frame, replacing the host waits that were skipped during a
+    // fast-forward frame with a wait for all of the devices that the frame submitted work to.
+    void EndFrame(const QueueInfo* queue_info);
+
     void MapDescriptorUpdateTemplateHandles(const DescriptorUpdateTemplateInfo* update_template_info,
                                             DescriptorUpdateTemplateDecoder*    decoder);
 
@@ -718,6 +910,12 @@ class VulkanReplayConsumerBase : public VulkanConsumer
     HardwareBufferMemoryMap                                          hardware_buffer_memory_info_;
     std::unordered_set<format::HandleId>                             active_instance_ids_;
     std::unordered_set<format::HandleId>                             active_device_ids_;
+    std::unique_ptr<VulkanPipelinePrecompiler>                       pipeline_precompiler_;
+    ReplayStatistics*                                                statistics_;
+    uint32_t                                                         frame_number_;
+    std::unordered_set<format::HandleId>                             fast_forward_device_ids_;
+    std::unordered_set<VkFence>                                      fast_forward_submitted_fences_;
+    std::unordered_set<VkFence>                                      fast_forward_completed_fences_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
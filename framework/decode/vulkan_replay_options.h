@@ -35,6 +35,20 @@ struct ReplayOptions
     int32_t                 override_gpu_index{ -1 };
     CreateResourceAllocator create_resource_allocator{ nullptr };
     std::string             replace_dir{};
+
+    // Range of frames to replay without the host waits for fences, events, and query results that were performed
+    // during capture, which are replaced by a device wait at the end of each frame.  Frame numbers start at 1, and a
+    // first frame of 0 disables fast-forward.
+    uint32_t fast_forward_first_frame{ 0 };
+    uint32_t fast_forward_last_frame{ 0 };
+
+    // Replace swapchains with offscreen images that are created by replay, for replay without a window system.
+    bool offscreen_swapchain{ false };
+
+    // Directory for pipeline cache files that are kept across replays of the same capture file.  Cache files are named
+    // with the capture file key and the properties of the replay device that determine pipeline cache compatibility.
+    std::string pipeline_cache_dir{};
+    std::string capture_file_key{};
 };
 
 GFXRECON_END_NAMESPACE(decode)
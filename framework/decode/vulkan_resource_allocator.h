@@ -42,30 +42,43 @@ class VulkanResourceAllocator
   public:
     struct Functions
     {
-        PFN_vkGetPhysicalDeviceProperties        get_physical_device_properties{ nullptr };
-        PFN_vkGetPhysicalDeviceMemoryProperties  get_physical_device_memory_properties{ nullptr };
-        PFN_vkGetPhysicalDeviceMemoryProperties2 get_physical_device_memory_properties2{ nullptr };
-        PFN_vkAllocateMemory                     allocate_memory{ nullptr };
-        PFN_vkFreeMemory                         free_memory{ nullptr };
-        PFN_vkGetDeviceMemoryCommitment          get_device_memory_commitment{ nullptr };
-        PFN_vkMapMemory                          map_memory{ nullptr };
-        PFN_vkUnmapMemory                        unmap_memory{ nullptr };
-        PFN_vkFlushMappedMemoryRanges            flush_memory_ranges{ nullptr };
-        PFN_vkInvalidateMappedMemoryRanges       invalidate_memory_ranges{ nullptr };
-        PFN_vkCreateBuffer                       create_buffer{ nullptr };
-        PFN_vkDestroyBuffer                      destroy_buffer{ nullptr };
-        PFN_vkGetBufferMemoryRequirements        get_buffer_memory_requirements{ nullptr };
-        PFN_vkGetBufferMemoryRequirements2       get_buffer_memory_requirements2{ nullptr };
-        PFN_vkBindBufferMemory                   bind_buffer_memory{ nullptr };
-        PFN_vkBindBufferMemory2                  bind_buffer_memory2{ nullptr };
-        PFN_vkCmdCopyBuffer                      cmd_copy_buffer{ nullptr };
-        PFN_vkCreateImage                        create_image{ nullptr };
-        PFN_vkDestroyImage                       destroy_image{ nullptr };
-        PFN_vkGetImageMemoryRequirements         get_image_memory_requirements{ nullptr };
-        PFN_vkGetImageMemoryRequirements2        get_image_memory_requirements2{ nullptr };
-        PFN_vkGetImageSubresourceLayout          get_image_subresource_layout{ nullptr };
-        PFN_vkBindImageMemory                    bind_image_memory{ nullptr };
-        PFN_vkBindImageMemory2                   bind_image_memory2{ nullptr };
+        PFN_vkGetPhysicalDeviceProperties            get_physical_device_properties{ nullptr };
+        PFN_vkGetPhysicalDeviceMemoryProperties      get_physical_device_memory_properties{ nullptr };
+        PFN_vkGetPhysicalDeviceMemoryProperties2     get_physical_device_memory_properties2{ nullptr };
+        PFN_vkGetPhysicalDeviceQueueFamilyProperties get_physical_device_queue_family_properties{ nullptr };
+        PFN_vkAllocateMemory                         allocate_memory{ nullptr };
+        PFN_vkFreeMemory                             free_memory{ nullptr };
+        PFN_vkGetDeviceMemoryCommitment              get_device_memory_commitment{ nullptr };
+        PFN_vkMapMemory                              map_memory{ nullptr };
+        PFN_vkUnmapMemory                            unmap_memory{ nullptr };
+        PFN_vkFlushMappedMemoryRanges                flush_memory_ranges{ nullptr };
+        PFN_vkInvalidateMappedMemoryRanges           invalidate_memory_ranges{ nullptr };
+        PFN_vkCreateBuffer                           create_buffer{ nullptr };
+        PFN_vkDestroyBuffer                          destroy_buffer{ nullptr };
+        PFN_vkGetBufferMemoryRequirements            get_buffer_memory_requirements{ nullptr };
+        PFN_vkGetBufferMemoryRequirements2           get_buffer_memory_requirements2{ nullptr };
+        PFN_vkBindBufferMemory                       bind_buffer_memory{ nullptr };
+        PFN_vkBindBufferMemory2                      bind_buffer_memory2{ nullptr };
+        PFN_vkCmdCopyBuffer                          cmd_copy_buffer{ nullptr };
+        PFN_vkCreateImage                            create_image{ nullptr };
+        PFN_vkDestroyImage                           destroy_image{ nullptr };
+        PFN_vkGetImageMemoryRequirements             get_image_memory_requirements{ nullptr };
+        PFN_vkGetImageMemoryRequirements2            get_image_memory_requirements2{ nullptr };
+        PFN_vkGetImageSubresourceLayout              get_image_subresource_layout{ nullptr };
+        PFN_vkBindImageMemory                        bind_image_memory{ nullptr };
+        PFN_vkBindImageMemory2                       bind_image_memory2{ nullptr };
+        PFN_vkCreateCommandPool                      create_command_pool{ nullptr };
+        PFN_vkDestroyCommandPool                     destroy_command_pool{ nullptr };
+        PFN_vkResetCommandPool                       reset_command_pool{ nullptr };
+        PFN_vkAllocateCommandBuffers                 allocate_command_buffers{ nullptr };
+        PFN_vkBeginCommandBuffer                     begin_command_buffer{ nullptr };
+        PFN_vkEndCommandBuffer                       end_command_buffer{ nullptr };
+        PFN_vkCmdPipelineBarrier                     cmd_pipeline_barrier{ nullptr };
+        PFN_vkQueueSubmit                            queue_submit{ nullptr };
+        PFN_vkCreateFence                            create_fence{ nullptr };
+        PFN_vkDestroyFence                           destroy_fence{ nullptr };
+        PFN_vkWaitForFences                          wait_for_fences{ nullptr };
+        PFN_vkResetFences                            reset_fences{ nullptr };
     };
 
   public:
@@ -164,6 +177,10 @@ class VulkanResourceAllocator
     virtual VkResult
     WriteMappedMemoryRange(MemoryData allocator_data, uint64_t offset, uint64_t size, const uint8_t* data) = 0;
 
+    // Called before each queue submission to submit the mapped memory writes that the allocator deferred to the next
+    // queue submission, which are submitted to the same queue so that they complete before the submission executes.
+    virtual VkResult SubmitPendingWrites(VkQueue queue, uint32_t queue_family_index) = 0;
+
     virtual void ReportAllocateMemoryIncompatibility(const VkMemoryAllocateInfo* allocate_info) = 0;
 
     virtual void ReportBindBufferIncompatibility(VkBuffer     buffer,
@@ -34,6 +34,8 @@ VulkanResourceInitializer::VulkanResourceInitializer(VkDevice
                                                      const encode::DeviceTable*              device_table) :
     device_(device),
     staging_memory_(VK_NULL_HANDLE), staging_memory_data_(0), staging_buffer_(VK_NULL_HANDLE), staging_buffer_data_(0),
+    staging_ring_memory_(VK_NULL_HANDLE), staging_ring_buffer_(VK_NULL_HANDLE), staging_ring_data_(nullptr),
+    staging_ring_coherent_(false), batches_(kBatchCount), current_batch_(0),
     draw_sampler_(VK_NULL_HANDLE), draw_pool_(VK_NULL_HANDLE), draw_set_layout_(VK_NULL_HANDLE),
     draw_set_(VK_NULL_HANDLE), max_copy_size_(max_copy_size), have_shader_stencil_write_(have_shader_stencil_write),
     resource_allocator_(resource_allocator), device_table_(device_table)
@@ -49,10 +51,24 @@ VulkanResourceInitializer::VulkanResourceInitializer(VkDevice
 
     util::platform::MemoryCopy(&memory_properties_.memoryTypes, type_size, &memory_properties.memoryTypes, type_size);
     util::platform::MemoryCopy(&memory_properties_.memoryHeaps, heap_size, &memory_properties.memoryHeaps, heap_size);
+
+    for (uint32_t i = 0; i < kBatchCount; ++i)
+    {
+        batches_[i].staging_offset = GetStagingSegmentOffset(i);
+    }
 }
 
 VulkanResourceInitializer::~VulkanResourceInitializer()
 {
+    // Batches that were not submitted with Flush() are discarded, but submitted batches must complete before their
+    // resources are destroyed.
+    for (auto& batch : batches_)
+    {
+        DestroyBatch(&batch);
+    }
+
+    DestroyStagingRing();
+
     for (const auto& entry : command_exec_objects_)
     {
         device_table_->DestroyCommandPool(device_, entry.second.command_pool, nullptr);
@@ -104,33 +120,67 @@ VkResult VulkanResourceInitializer::InitializeBuffer(VkDeviceSize        data_si
     // TODO: handle usage cases without TRANSFER_DST.
     GFXRECON_UNREFERENCED_PARAMETER(usage);
 
-    VkQueue                               queue               = VK_NULL_HANDLE;
-    VkCommandBuffer                       command_buffer      = VK_NULL_HANDLE;
-    VkDeviceMemory                        staging_memory      = VK_NULL_HANDLE;
-    VkBuffer                              staging_buffer      = VK_NULL_HANDLE;
-    VulkanResourceAllocator::MemoryData   staging_memory_data = 0;
-    VulkanResourceAllocator::ResourceData staging_buffer_data = 0;
+    VkResult result = VK_SUCCESS;
 
-    VkResult result = GetCommandExecObjects(queue_family_index, &queue, &command_buffer);
+    if (data_size <= kStagingSegmentSize)
+    {
+        CommandBatch* batch          = nullptr;
+        VkDeviceSize  staging_offset = 0;
+        bool          submit_current = (batches_[current_batch_].buffers.count(buffer) > 0);
 
-    if (result == VK_SUCCESS)
+        result = AcquireBatch(queue_family_index, submit_current, data_size, data, &batch, &staging_offset);
+
+        if (result == VK_SUCCESS)
+        {
+            BufferCopy copy;
+            copy.buffer = buffer;
+            copy.regions.assign(regions, regions + region_count);
+
+            for (auto& region : copy.regions)
+            {
+                region.srcOffset += staging_offset;
+            }
+
+            batch->buffer_copies.emplace_back(std::move(copy));
+            batch->buffers.insert(buffer);
+        }
+    }
+    else
     {
-        result = AcquireInitializedStagingBuffer(
-            data_size, data, &staging_memory, &staging_buffer, &staging_memory_data, &staging_buffer_data);
+        VkQueue                               queue               = VK_NULL_HANDLE;
+        VkCommandBuffer                       command_buffer      = VK_NULL_HANDLE;
+        VkDeviceMemory                        staging_memory      = VK_NULL_HANDLE;
+        VkBuffer                              staging_buffer      = VK_NULL_HANDLE;
+        VulkanResourceAllocator::MemoryData   staging_memory_data = 0;
+        VulkanResourceAllocator::ResourceData staging_buffer_data = 0;
+
+        // Complete the batched commands before initializing the buffer immediately.
+        result = Flush();
 
         if (result == VK_SUCCESS)
         {
-            result = BeginCommandBuffer(command_buffer);
+            result = GetCommandExecObjects(queue_family_index, &queue, &command_buffer);
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            result = AcquireInitializedStagingBuffer(
+                data_size, data, &staging_memory, &staging_buffer, &staging_memory_data, &staging_buffer_data);
 
             if (result == VK_SUCCESS)
             {
-                device_table_->CmdCopyBuffer(command_buffer, staging_buffer, buffer, region_count, regions);
-                device_table_->EndCommandBuffer(command_buffer);
+                result = BeginCommandBuffer(command_buffer);
 
-                result = ExecuteCommandBuffer(queue, command_buffer);
-            }
+                if (result == VK_SUCCESS)
+                {
+                    device_table_->CmdCopyBuffer(command_buffer, staging_buffer, buffer, region_count, regions);
+                    device_table_->EndCommandBuffer(command_buffer);
 
-            ReleaseStagingBuffer(staging_memory, staging_buffer, staging_memory_data, staging_buffer_data);
+                    result = ExecuteCommandBuffer(queue, command_buffer);
+                }
+
+                ReleaseStagingBuffer(staging_memory, staging_buffer, staging_memory_data, staging_buffer_data);
+            }
         }
     }
 
@@ -153,65 +203,113 @@ VkResult VulkanResourceInitializer::InitializeImage(VkDeviceSize             dat
                                                     uint32_t                 level_count,
                                                     const VkBufferImageCopy* level_copies)
 {
-    VkDeviceMemory                        staging_memory      = VK_NULL_HANDLE;
-    VkBuffer                              staging_buffer      = VK_NULL_HANDLE;
-    VulkanResourceAllocator::MemoryData   staging_memory_data = 0;
-    VulkanResourceAllocator::ResourceData staging_buffer_data = 0;
-
-    VkResult result = AcquireInitializedStagingBuffer(
-        data_size, data, &staging_memory, &staging_buffer, &staging_memory_data, &staging_buffer_data);
+    VkResult result   = VK_SUCCESS;
+    bool     use_draw = UseDrawCopy(type, aspect, sample_count, usage);
 
-    if (result == VK_SUCCESS)
+    if (!use_draw && (data_size <= kStagingSegmentSize))
     {
-        result = LoadData(staging_memory, 0, data_size, data, staging_memory_data);
+        CommandBatch* batch          = nullptr;
+        VkDeviceSize  staging_offset = 0;
+        bool          submit_current = (batches_[current_batch_].images.count(image) > 0);
+
+        result = AcquireBatch(queue_family_index, submit_current, data_size, data, &batch, &staging_offset);
 
         if (result == VK_SUCCESS)
         {
-            bool use_transfer = ((usage & VK_IMAGE_USAGE_TRANSFER_DST_BIT) == VK_IMAGE_USAGE_TRANSFER_DST_BIT) &&
-                                (sample_count == VK_SAMPLE_COUNT_1_BIT);
-            bool use_color_write =
-                ((usage & VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) == VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) &&
-                (aspect == VK_IMAGE_ASPECT_COLOR_BIT);
-            bool use_depth_write = ((usage & VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) ==
-                                    VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) &&
-                                   (aspect == VK_IMAGE_ASPECT_DEPTH_BIT);
-            bool use_stencil_write = ((usage & VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) ==
-                                      VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) &&
-                                     (aspect == VK_IMAGE_ASPECT_STENCIL_BIT) && have_shader_stencil_write_;
-
-            if (!use_transfer && (use_color_write || use_depth_write || use_stencil_write) &&
-                (type == VK_IMAGE_TYPE_2D))
+            VkImageLayout      old_layout        = initial_layout;
+            VkImageAspectFlags transition_aspect = GetImageTransitionAspect(format, aspect, &old_layout);
+
+            VkImageMemoryBarrier memory_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
+            memory_barrier.pNext                           = nullptr;
+            memory_barrier.srcAccessMask                   = 0;
+            memory_barrier.dstAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
+            memory_barrier.oldLayout                       = old_layout;
+            memory_barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            memory_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+            memory_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+            memory_barrier.image                           = image;
+            memory_barrier.subresourceRange.aspectMask     = transition_aspect;
+            memory_barrier.subresourceRange.baseMipLevel   = 0;
+            memory_barrier.subresourceRange.levelCount     = level_count;
+            memory_barrier.subresourceRange.baseArrayLayer = 0;
+            memory_barrier.subresourceRange.layerCount     = layer_count;
+
+            batch->pre_copy_barriers.push_back(memory_barrier);
+
+            if ((final_layout != VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL) && (final_layout != VK_IMAGE_LAYOUT_UNDEFINED) &&
+                (final_layout != VK_IMAGE_LAYOUT_PREINITIALIZED))
             {
-                result = PixelShaderImageCopy(queue_family_index,
-                                              staging_buffer,
-                                              image,
-                                              type,
-                                              format,
-                                              extent,
-                                              aspect,
-                                              sample_count,
-                                              initial_layout,
-                                              final_layout,
-                                              layer_count,
-                                              level_count,
-                                              level_copies);
+                memory_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+                memory_barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+                memory_barrier.oldLayout     = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+                memory_barrier.newLayout     = final_layout;
+
+                batch->post_copy_barriers.push_back(memory_barrier);
             }
-            else
+
+            ImageCopy copy;
+            copy.image = image;
+            copy.regions.assign(level_copies, level_copies + level_count);
+
+            for (auto& region : copy.regions)
             {
-                result = BufferToImageCopy(queue_family_index,
-                                           staging_buffer,
-                                           image,
-                                           format,
-                                           aspect,
-                                           initial_layout,
-                                           final_layout,
-                                           layer_count,
-                                           level_count,
-                                           level_copies);
+                region.bufferOffset += staging_offset;
             }
+
+            batch->image_copies.emplace_back(std::move(copy));
+            batch->images.insert(image);
         }
+    }
+    else
+    {
+        VkDeviceMemory                        staging_memory      = VK_NULL_HANDLE;
+        VkBuffer                              staging_buffer      = VK_NULL_HANDLE;
+        VulkanResourceAllocator::MemoryData   staging_memory_data = 0;
+        VulkanResourceAllocator::ResourceData staging_buffer_data = 0;
 
-        ReleaseStagingBuffer(staging_memory, staging_buffer, staging_memory_data, staging_buffer_data);
+        // Complete the batched commands before initializing the image immediately.
+        result = Flush();
+
+        if (result == VK_SUCCESS)
+        {
+            result = AcquireInitializedStagingBuffer(
+                data_size, data, &staging_memory, &staging_buffer, &staging_memory_data, &staging_buffer_data);
+
+            if (result == VK_SUCCESS)
+            {
+                if (use_draw)
+                {
+                    result = PixelShaderImageCopy(queue_family_index,
+                                                  staging_buffer,
+                                                  image,
+                                                  type,
+                                                  format,
+                                                  extent,
+                                                  aspect,
+                                                  sample_count,
+                                                  initial_layout,
+                                                  final_layout,
+                                                  layer_count,
+                                                  level_count,
+                                                  level_copies);
+                }
+                else
+                {
+                    result = BufferToImageCopy(queue_family_index,
+                                               staging_buffer,
+                                               image,
+                                               format,
+                                               aspect,
+                                               initial_layout,
+                                               final_layout,
+                                               layer_count,
+                                               level_count,
+                                               level_copies);
+                }
+
+                ReleaseStagingBuffer(staging_memory, staging_buffer, staging_memory_data, staging_buffer_data);
+            }
+        }
     }
 
     return result;
@@ -226,55 +324,507 @@ VkResult VulkanResourceInitializer::TransitionImage(uint32_t              queue_
                                                     uint32_t              layer_count,
                                                     uint32_t              level_count)
 {
-    VkQueue         queue          = VK_NULL_HANDLE;
-    VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+    CommandBatch* batch          = nullptr;
+    VkDeviceSize  staging_offset = 0;
+    bool          submit_current = (batches_[current_batch_].images.count(image) > 0);
 
-    VkResult result = GetCommandExecObjects(queue_family_index, &queue, &command_buffer);
+    VkResult result = AcquireBatch(queue_family_index, submit_current, 0, nullptr, &batch, &staging_offset);
 
     if (result == VK_SUCCESS)
     {
-        result = BeginCommandBuffer(command_buffer);
+        VkImageLayout      old_layout        = initial_layout;
+        VkImageAspectFlags transition_aspect = GetImageTransitionAspect(format, aspect, &old_layout);
+
+        VkImageMemoryBarrier memory_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
+        memory_barrier.pNext                           = nullptr;
+        memory_barrier.srcAccessMask                   = 0;
+        memory_barrier.dstAccessMask                   = 0;
+        memory_barrier.oldLayout                       = old_layout;
+        memory_barrier.newLayout                       = final_layout;
+        memory_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        memory_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        memory_barrier.image                           = image;
+        memory_barrier.subresourceRange.aspectMask     = transition_aspect;
+        memory_barrier.subresourceRange.baseMipLevel   = 0;
+        memory_barrier.subresourceRange.levelCount     = level_count;
+        memory_barrier.subresourceRange.baseArrayLayer = 0;
+        memory_barrier.subresourceRange.layerCount     = layer_count;
+
+        batch->pre_copy_barriers.push_back(memory_barrier);
+        batch->images.insert(image);
+    }
+
+    return result;
+}
+
+uint8_t* VulkanResourceInitializer::GetBufferStagingData(VkDeviceSize data_size,
+                                                         uint32_t     queue_family_index,
+                                                         VkBuffer     buffer)
+{
+    uint8_t* staging_data = nullptr;
+
+    if ((data_size > 0) && (data_size <= kStagingSegmentSize))
+    {
+        CommandBatch* batch          = nullptr;
+        VkDeviceSize  staging_offset = 0;
+        bool          submit_current = (batches_[current_batch_].buffers.count(buffer) > 0);
+
+        if (PrepareBatch(queue_family_index, submit_current, data_size, &batch, &staging_offset) == VK_SUCCESS)
+        {
+            staging_data = staging_ring_data_ + staging_offset;
+        }
+    }
+
+    return staging_data;
+}
+
+uint8_t* VulkanResourceInitializer::GetImageStagingData(VkDeviceSize          data_size,
+                                                        uint32_t              queue_family_index,
+                                                        VkImage               image,
+                                                        VkImageType           type,
+                                                        VkImageAspectFlagBits aspect,
+                                                        VkSampleCountFlagBits sample_count,
+                                                        VkImageUsageFlags     usage)
+{
+    uint8_t* staging_data = nullptr;
+
+    if ((data_size > 0) && (data_size <= kStagingSegmentSize) && !UseDrawCopy(type, aspect, sample_count, usage))
+    {
+        CommandBatch* batch          = nullptr;
+        VkDeviceSize  staging_offset = 0;
+        bool          submit_current = (batches_[current_batch_].images.count(image) > 0);
+
+        if (PrepareBatch(queue_family_index, submit_current, data_size, &batch, &staging_offset) == VK_SUCCESS)
+        {
+            staging_data = staging_ring_data_ + staging_offset;
+        }
+    }
+
+    return staging_data;
+}
+
+VkResult VulkanResourceInitializer::Flush()
+{
+    VkResult result = VK_SUCCESS;
+
+    CommandBatch* current = &batches_[current_batch_];
+
+    if (!current->buffers.empty() || !current->images.empty())
+    {
+        result = SubmitBatch(current);
+    }
+
+    for (auto& batch : batches_)
+    {
+        VkResult wait_result = WaitForBatch(&batch);
 
         if (result == VK_SUCCESS)
         {
-            VkImageLayout      old_layout        = initial_layout;
-            VkImageAspectFlags transition_aspect = GetImageTransitionAspect(format, aspect, &old_layout);
+            result = wait_result;
+        }
+    }
 
-            VkImageMemoryBarrier memory_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
-            memory_barrier.pNext                           = nullptr;
-            memory_barrier.srcAccessMask                   = 0;
-            memory_barrier.dstAccessMask                   = 0;
-            memory_barrier.oldLayout                       = old_layout;
-            memory_barrier.newLayout                       = final_layout;
-            memory_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-            memory_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-            memory_barrier.image                           = image;
-            memory_barrier.subresourceRange.aspectMask     = transition_aspect;
-            memory_barrier.subresourceRange.baseMipLevel   = 0;
-            memory_barrier.subresourceRange.levelCount     = level_count;
-            memory_barrier.subresourceRange.baseArrayLayer = 0;
-            memory_barrier.subresourceRange.layerCount     = layer_count;
+    return result;
+}
 
-            device_table_->CmdPipelineBarrier(command_buffer,
+VkResult VulkanResourceInitializer::PrepareBatch(uint32_t       queue_family_index,
+                                                 bool           submit_current,
+                                                 VkDeviceSize   data_size,
+                                                 CommandBatch** batch,
+                                                 VkDeviceSize*  staging_offset)
+{
+    assert((data_size <= kStagingSegmentSize) && (batch != nullptr) && (staging_offset != nullptr));
+
+    VkResult      result  = VK_SUCCESS;
+    CommandBatch* current = &batches_[current_batch_];
+    VkDeviceSize  offset  = AlignStagingOffset(current->staging_size);
+
+    if ((!current->buffers.empty() || !current->images.empty()) &&
+        (submit_current || (current->queue_family_index != queue_family_index) ||
+         ((offset + data_size) > kStagingSegmentSize)))
+    {
+        result  = SubmitBatch(current);
+        current = &batches_[current_batch_];
+        offset  = 0;
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        // A batch that is reused must complete its previous submission before its staging ring segment is written.
+        result = WaitForBatch(current);
+    }
+
+    if ((result == VK_SUCCESS) &&
+        ((current->queue == VK_NULL_HANDLE) || (current->queue_family_index != queue_family_index)))
+    {
+        if (current->command_pool != VK_NULL_HANDLE)
+        {
+            device_table_->DestroyCommandPool(device_, current->command_pool, nullptr);
+            current->command_pool   = VK_NULL_HANDLE;
+            current->command_buffer = VK_NULL_HANDLE;
+        }
+
+        current->queue_family_index = queue_family_index;
+        device_table_->GetDeviceQueue(device_, queue_family_index, 0, &current->queue);
+    }
+
+    if ((result == VK_SUCCESS) && (data_size > 0) && (staging_ring_buffer_ == VK_NULL_HANDLE))
+    {
+        result = CreateStagingRing();
+    }
+
+    (*batch)          = current;
+    (*staging_offset) = current->staging_offset + offset;
+
+    return result;
+}
+
+VkResult VulkanResourceInitializer::AcquireBatch(uint32_t       queue_family_index,
+                                                 bool           submit_current,
+                                                 VkDeviceSize   data_size,
+                                                 const uint8_t* data,
+                                                 CommandBatch** batch,
+                                                 VkDeviceSize*  staging_offset)
+{
+    assert((batch != nullptr) && (staging_offset != nullptr));
+
+    VkResult result = PrepareBatch(queue_family_index, submit_current, data_size, batch, staging_offset);
+
+    if ((result == VK_SUCCESS) && (data_size > 0))
+    {
+        CommandBatch* current      = (*batch);
+        uint8_t*      staging_data = staging_ring_data_ + (*staging_offset);
+
+        // Data that was read directly to the staging ring through GetBufferStagingData or GetImageStagingData does
+        // not need to be copied.
+        if (data != staging_data)
+        {
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, data_size);
+            size_t copy_size = static_cast<size_t>(data_size);
+            util::platform::MemoryCopy(staging_data, copy_size, data, copy_size);
+        }
+
+        current->staging_size = ((*staging_offset) - current->staging_offset) + data_size;
+    }
+
+    return result;
+}
+
+VkResult VulkanResourceInitializer::SubmitBatch(CommandBatch* batch)
+{
+    assert(batch != nullptr);
+
+    VkResult result = RecordBatch(batch);
+
+    if ((result == VK_SUCCESS) && !staging_ring_coherent_ && (batch->staging_size > 0))
+    {
+        VkMappedMemoryRange memory_range = { VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE };
+        memory_range.pNext               = nullptr;
+        memory_range.memory              = staging_ring_memory_;
+        memory_range.offset              = 0;
+        memory_range.size                = VK_WHOLE_SIZE;
+
+        result = device_table_->FlushMappedMemoryRanges(device_, 1, &memory_range);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        VkSubmitInfo submit_info         = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+        submit_info.pNext                = nullptr;
+        submit_info.waitSemaphoreCount   = 0;
+        submit_info.pWaitSemaphores      = nullptr;
+        submit_info.pWaitDstStageMask    = nullptr;
+        submit_info.commandBufferCount   = 1;
+        submit_info.pCommandBuffers      = &batch->command_buffer;
+        submit_info.signalSemaphoreCount = 0;
+        submit_info.pSignalSemaphores    = nullptr;
+
+        result = device_table_->QueueSubmit(batch->queue, 1, &submit_info, batch->fence);
+    }
+
+    batch->in_flight = (result == VK_SUCCESS);
+    ClearBatch(batch);
+
+    current_batch_ = (current_batch_ + 1) % kBatchCount;
+
+    return result;
+}
+
+VkResult VulkanResourceInitializer::RecordBatch(CommandBatch* batch)
+{
+    assert(batch != nullptr);
+
+    VkResult result = VK_SUCCESS;
+
+    if (batch->command_pool == VK_NULL_HANDLE)
+    {
+        VkCommandPoolCreateInfo create_info = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
+        create_info.pNext                   = nullptr;
+        create_info.flags                   = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+        create_info.queueFamilyIndex        = batch->queue_family_index;
+
+        result = device_table_->CreateCommandPool(device_, &create_info, nullptr, &batch->command_pool);
+
+        if (result == VK_SUCCESS)
+        {
+            VkCommandBufferAllocateInfo alloc_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+            alloc_info.pNext                       = nullptr;
+            alloc_info.commandPool                 = batch->command_pool;
+            alloc_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            alloc_info.commandBufferCount          = 1;
+
+            result = device_table_->AllocateCommandBuffers(device_, &alloc_info, &batch->command_buffer);
+        }
+    }
+    else
+    {
+        result = device_table_->ResetCommandPool(device_, batch->command_pool, 0);
+    }
+
+    if ((result == VK_SUCCESS) && (batch->fence == VK_NULL_HANDLE))
+    {
+        VkFenceCreateInfo fence_info = { VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+        fence_info.pNext             = nullptr;
+        fence_info.flags             = 0;
+
+        result = device_table_->CreateFence(device_, &fence_info, nullptr, &batch->fence);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        result = BeginCommandBuffer(batch->command_buffer);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        if (!batch->pre_copy_barriers.empty())
+        {
+            device_table_->CmdPipelineBarrier(batch->command_buffer,
                                               VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-                                              VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                                              VK_PIPELINE_STAGE_TRANSFER_BIT,
                                               0,
                                               0,
                                               nullptr,
                                               0,
                                               nullptr,
-                                              1,
-                                              &memory_barrier);
+                                              static_cast<uint32_t>(batch->pre_copy_barriers.size()),
+                                              batch->pre_copy_barriers.data());
+        }
 
-            device_table_->EndCommandBuffer(command_buffer);
+        for (const auto& copy : batch->buffer_copies)
+        {
+            device_table_->CmdCopyBuffer(batch->command_buffer,
+                                         staging_ring_buffer_,
+                                         copy.buffer,
+                                         static_cast<uint32_t>(copy.regions.size()),
+                                         copy.regions.data());
+        }
 
-            result = ExecuteCommandBuffer(queue, command_buffer);
+        for (const auto& copy : batch->image_copies)
+        {
+            device_table_->CmdCopyBufferToImage(batch->command_buffer,
+                                                staging_ring_buffer_,
+                                                copy.image,
+                                                VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                                static_cast<uint32_t>(copy.regions.size()),
+                                                copy.regions.data());
+        }
+
+        // Make the copies visible to the commands of later queue submissions, and transition the copied images to
+        // their final layouts.
+        VkMemoryBarrier memory_barrier = { VK_STRUCTURE_TYPE_MEMORY_BARRIER };
+        memory_barrier.pNext           = nullptr;
+        memory_barrier.srcAccessMask   = VK_ACCESS_TRANSFER_WRITE_BIT;
+        memory_barrier.dstAccessMask   = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+
+        device_table_->CmdPipelineBarrier(batch->command_buffer,
+                                          VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                          VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                          0,
+                                          1,
+                                          &memory_barrier,
+                                          0,
+                                          nullptr,
+                                          static_cast<uint32_t>(batch->post_copy_barriers.size()),
+                                          batch->post_copy_barriers.data());
+
+        result = device_table_->EndCommandBuffer(batch->command_buffer);
+    }
+
+    return result;
+}
+
+VkResult VulkanResourceInitializer::WaitForBatch(CommandBatch* batch)
+{
+    assert(batch != nullptr);
+
+    VkResult result = VK_SUCCESS;
+
+    if (batch->in_flight)
+    {
+        result = device_table_->WaitForFences(device_, 1, &batch->fence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+
+        if (result == VK_SUCCESS)
+        {
+            result = device_table_->ResetFences(device_, 1, &batch->fence);
         }
+
+        batch->in_flight = false;
     }
 
     return result;
 }
 
+void VulkanResourceInitializer::ClearBatch(CommandBatch* batch)
+{
+    assert(batch != nullptr);
+
+    batch->staging_size = 0;
+    batch->pre_copy_barriers.clear();
+    batch->buffer_copies.clear();
+    batch->image_copies.clear();
+    batch->post_copy_barriers.clear();
+    batch->buffers.clear();
+    batch->images.clear();
+}
+
+void VulkanResourceInitializer::DestroyBatch(CommandBatch* batch)
+{
+    assert(batch != nullptr);
+
+    if (batch->in_flight)
+    {
+        device_table_->WaitForFences(device_, 1, &batch->fence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+        batch->in_flight = false;
+    }
+
+    if (batch->fence != VK_NULL_HANDLE)
+    {
+        device_table_->DestroyFence(device_, batch->fence, nullptr);
+        batch->fence = VK_NULL_HANDLE;
+    }
+
+    // The command buffer is freed with the command pool.
+    if (batch->command_pool != VK_NULL_HANDLE)
+    {
+        device_table_->DestroyCommandPool(device_, batch->command_pool, nullptr);
+        batch->command_pool   = VK_NULL_HANDLE;
+        batch->command_buffer = VK_NULL_HANDLE;
+    }
+
+    ClearBatch(batch);
+}
+
+VkResult VulkanResourceInitializer::CreateStagingRing()
+{
+    // The staging ring is created directly with the device, instead of with the resource allocator, so that its
+    // persistently mapped memory can be written directly when resource data is read from the capture file.
+    VkBufferCreateInfo create_info    = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
+    create_info.pNext                 = nullptr;
+    create_info.flags                 = 0;
+    create_info.size                  = kBatchCount * kStagingSegmentSize;
+    create_info.usage                 = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+    create_info.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
+    create_info.queueFamilyIndexCount = 0;
+    create_info.pQueueFamilyIndices   = nullptr;
+
+    VkResult result = device_table_->CreateBuffer(device_, &create_info, nullptr, &staging_ring_buffer_);
+
+    if (result == VK_SUCCESS)
+    {
+        VkMemoryRequirements memory_requirements;
+        device_table_->GetBufferMemoryRequirements(device_, staging_ring_buffer_, &memory_requirements);
+
+        // Prefer coherent memory, which does not need to be flushed after it is written.
+        uint32_t memory_type_index =
+            GetMemoryTypeIndex(memory_requirements.memoryTypeBits,
+                               VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+        staging_ring_coherent_ = (memory_type_index != std::numeric_limits<uint32_t>::max());
+
+        if (!staging_ring_coherent_)
+        {
+            memory_type_index =
+                GetMemoryTypeIndex(memory_requirements.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+        }
+
+        assert(memory_type_index != std::numeric_limits<uint32_t>::max());
+
+        VkMemoryAllocateInfo alloc_info = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
+        alloc_info.pNext                = nullptr;
+        alloc_info.allocationSize       = memory_requirements.size;
+        alloc_info.memoryTypeIndex      = memory_type_index;
+
+        result = device_table_->AllocateMemory(device_, &alloc_info, nullptr, &staging_ring_memory_);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        result = device_table_->BindBufferMemory(device_, staging_ring_buffer_, staging_ring_memory_, 0);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        // The staging ring remains mapped until it is destroyed.
+        void* mapped_memory = nullptr;
+
+        result = device_table_->MapMemory(device_, staging_ring_memory_, 0, VK_WHOLE_SIZE, 0, &mapped_memory);
+
+        if (result == VK_SUCCESS)
+        {
+            staging_ring_data_ = reinterpret_cast<uint8_t*>(mapped_memory);
+        }
+    }
+
+    if (result != VK_SUCCESS)
+    {
+        DestroyStagingRing();
+    }
+
+    return result;
+}
+
+void VulkanResourceInitializer::DestroyStagingRing()
+{
+    if (staging_ring_data_ != nullptr)
+    {
+        device_table_->UnmapMemory(device_, staging_ring_memory_);
+        staging_ring_data_ = nullptr;
+    }
+
+    if (staging_ring_buffer_ != VK_NULL_HANDLE)
+    {
+        device_table_->DestroyBuffer(device_, staging_ring_buffer_, nullptr);
+        staging_ring_buffer_ = VK_NULL_HANDLE;
+    }
+
+    if (staging_ring_memory_ != VK_NULL_HANDLE)
+    {
+        device_table_->FreeMemory(device_, staging_ring_memory_, nullptr);
+        staging_ring_memory_ = VK_NULL_HANDLE;
+    }
+}
+
+bool VulkanResourceInitializer::UseDrawCopy(VkImageType           type,
+                                            VkImageAspectFlagBits aspect,
+                                            VkSampleCountFlagBits sample_count,
+                                            VkImageUsageFlags     usage) const
+{
+    // Images that cannot be initialized with a transfer are initialized by drawing, when they are attachments.
+    bool use_transfer = ((usage & VK_IMAGE_USAGE_TRANSFER_DST_BIT) == VK_IMAGE_USAGE_TRANSFER_DST_BIT) &&
+                        (sample_count == VK_SAMPLE_COUNT_1_BIT);
+    bool use_color_write = ((usage & VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) == VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) &&
+                           (aspect == VK_IMAGE_ASPECT_COLOR_BIT);
+    bool use_depth_write =
+        ((usage & VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) == VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) &&
+        (aspect == VK_IMAGE_ASPECT_DEPTH_BIT);
+    bool use_stencil_write =
+        ((usage & VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) == VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) &&
+        (aspect == VK_IMAGE_ASPECT_STENCIL_BIT) && have_shader_stencil_write_;
+
+    return !use_transfer && (use_color_write || use_depth_write || use_stencil_write) && (type == VK_IMAGE_TYPE_2D);
+}
+
 VkResult VulkanResourceInitializer::GetCommandExecObjects(uint32_t         queue_family_index,
                                                           VkQueue*         queue,
                                                           VkCommandBuffer* command_buffer)
@@ -900,88 +1450,121 @@ void VulkanResourceInitializer::DestroyFramebufferResources(VkImageView view, Vk
     device_table_->DestroyImageView(device_, view, nullptr);
 }
 
-VkResult VulkanResourceInitializer::AcquireStagingBuffer(VkDeviceMemory*                        memory,
-                                                         VkBuffer*                              buffer,
-                                                         VkDeviceSize                           size,
-                                                         VulkanResourceAllocator::MemoryData*   allocator_memory_data,
-                                                         VulkanResourceAllocator::ResourceData* allocator_buffer_data)
+VkResult VulkanResourceInitializer::CreateStagingBuffer(VkDeviceSize                           size,
+                                                        VkDeviceMemory*                        memory,
+                                                        VkBuffer*                              buffer,
+                                                        VulkanResourceAllocator::MemoryData*   allocator_memory_data,
+                                                        VulkanResourceAllocator::ResourceData* allocator_buffer_data,
+                                                        VkMemoryPropertyFlags*                 memory_property_flags)
 {
     assert((memory != nullptr) && (buffer != nullptr) && (size > 0) && (allocator_memory_data != nullptr) &&
-           (allocator_buffer_data != nullptr));
+           (allocator_buffer_data != nullptr) && (memory_property_flags != nullptr));
 
-    VkResult result = VK_SUCCESS;
+    VkBuffer                              staging_buffer      = VK_NULL_HANDLE;
+    VulkanResourceAllocator::ResourceData staging_buffer_data = 0;
 
-    // Create the reusable staging_buffer_ object, with size equal to max_copy_size_, on first acquire, if the requested
-    // size is less than or equal to max_copy_size_.  It the requested size is larger than max_copy_size_, create a
-    // temporary staging buffer that will be destroyed on release.
-    if ((staging_buffer_ == VK_NULL_HANDLE) || (size > max_copy_size_))
-    {
-        VkBuffer                              staging_buffer      = VK_NULL_HANDLE;
-        VulkanResourceAllocator::ResourceData staging_buffer_data = 0;
+    VkBufferCreateInfo create_info    = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
+    create_info.pNext                 = nullptr;
+    create_info.flags                 = 0;
+    create_info.size                  = size;
+    create_info.usage                 = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+    create_info.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
+    create_info.queueFamilyIndexCount = 0;
+    create_info.pQueueFamilyIndices   = nullptr;
 
-        VkBufferCreateInfo create_info    = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
-        create_info.pNext                 = nullptr;
-        create_info.flags                 = 0;
-        create_info.size                  = std::max(size, max_copy_size_);
-        create_info.usage                 = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-        create_info.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
-        create_info.queueFamilyIndexCount = 0;
-        create_info.pQueueFamilyIndices   = nullptr;
+    VkResult result = resource_allocator_->CreateBuffer(&create_info, nullptr, &staging_buffer, &staging_buffer_data);
 
-        result = resource_allocator_->CreateBuffer(&create_info, nullptr, &staging_buffer, &staging_buffer_data);
+    if (result == VK_SUCCESS)
+    {
+        VkMemoryRequirements memory_requirements;
+        device_table_->GetBufferMemoryRequirements(device_, staging_buffer, &memory_requirements);
 
-        if (result == VK_SUCCESS)
-        {
-            VkMemoryRequirements memory_requirements;
-            device_table_->GetBufferMemoryRequirements(device_, staging_buffer, &memory_requirements);
+        // Prefer coherent memory, which does not need to be flushed after it is written.
+        uint32_t memory_type_index =
+            GetMemoryTypeIndex(memory_requirements.memoryTypeBits,
+                               VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
 
-            uint32_t memory_type_index =
+        if (memory_type_index == std::numeric_limits<uint32_t>::max())
+        {
+            memory_type_index =
                 GetMemoryTypeIndex(memory_requirements.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+        }
 
-            assert(memory_type_index != std::numeric_limits<uint32_t>::max());
+        assert(memory_type_index != std::numeric_limits<uint32_t>::max());
 
-            // Allocate the memory for the buffer.
-            VkDeviceMemory                      staging_memory      = VK_NULL_HANDLE;
-            VulkanResourceAllocator::MemoryData staging_memory_data = 0;
+        // Allocate the memory for the buffer.
+        VkDeviceMemory                      staging_memory      = VK_NULL_HANDLE;
+        VulkanResourceAllocator::MemoryData staging_memory_data = 0;
 
-            VkMemoryAllocateInfo alloc_info = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
-            alloc_info.pNext                = nullptr;
-            alloc_info.allocationSize       = memory_requirements.size;
-            alloc_info.memoryTypeIndex      = memory_type_index;
+        VkMemoryAllocateInfo alloc_info = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
+        alloc_info.pNext                = nullptr;
+        alloc_info.allocationSize       = memory_requirements.size;
+        alloc_info.memoryTypeIndex      = memory_type_index;
 
-            result = resource_allocator_->AllocateMemory(&alloc_info, nullptr, &staging_memory, &staging_memory_data);
+        result = resource_allocator_->AllocateMemory(&alloc_info, nullptr, &staging_memory, &staging_memory_data);
 
-            if (result == VK_SUCCESS)
+        if (result == VK_SUCCESS)
+        {
+            result = resource_allocator_->BindBufferMemory(staging_buffer,
+                                                           staging_memory,
+                                                           0,
+                                                           staging_buffer_data,
+                                                           staging_memory_data,
+                                                           memory_property_flags);
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            (*memory)                = staging_memory;
+            (*buffer)                = staging_buffer;
+            (*allocator_memory_data) = staging_memory_data;
+            (*allocator_buffer_data) = staging_buffer_data;
+        }
+        else
+        {
+            resource_allocator_->DestroyBuffer(staging_buffer, nullptr, staging_buffer_data);
+
+            if (staging_memory != VK_NULL_HANDLE)
             {
-                VkMemoryPropertyFlags flags;
-                result = resource_allocator_->BindBufferMemory(
-                    staging_buffer, staging_memory, 0, staging_buffer_data, staging_memory_data, &flags);
+                resource_allocator_->FreeMemory(staging_memory, nullptr, staging_memory_data);
             }
+        }
+    }
 
-            if (result == VK_SUCCESS)
-            {
-                (*memory)                = staging_memory;
-                (*buffer)                = staging_buffer;
-                (*allocator_memory_data) = staging_memory_data;
-                (*allocator_buffer_data) = staging_buffer_data;
+    return result;
+}
 
-                if (size <= max_copy_size_)
-                {
-                    staging_memory_      = staging_memory;
-                    staging_buffer_      = staging_buffer;
-                    staging_memory_data_ = staging_memory_data;
-                    staging_buffer_data_ = staging_buffer_data;
-                }
-            }
-            else
-            {
-                resource_allocator_->DestroyBuffer(staging_buffer, nullptr, staging_buffer_data);
+VkResult VulkanResourceInitializer::AcquireStagingBuffer(VkDeviceMemory*                        memory,
+                                                         VkBuffer*                              buffer,
+                                                         VkDeviceSize                           size,
+                                                         VulkanResourceAllocator::MemoryData*   allocator_memory_data,
+                                                         VulkanResourceAllocator::ResourceData* allocator_buffer_data)
+{
+    assert((memory != nullptr) && (buffer != nullptr) && (size > 0) && (allocator_memory_data != nullptr) &&
+           (allocator_buffer_data != nullptr));
 
-                if ((*memory) != VK_NULL_HANDLE)
-                {
-                    resource_allocator_->FreeMemory(staging_memory, nullptr, staging_memory_data);
-                }
-            }
+    VkResult result = VK_SUCCESS;
+
+    // Create the reusable staging_buffer_ object, with size equal to max_copy_size_, on first acquire, if the requested
+    // size is less than or equal to max_copy_size_.  It the requested size is larger than max_copy_size_, create a
+    // temporary staging buffer that will be destroyed on release.
+    if ((staging_buffer_ == VK_NULL_HANDLE) || (size > max_copy_size_))
+    {
+        VkMemoryPropertyFlags memory_property_flags = 0;
+
+        result = CreateStagingBuffer(std::max(size, max_copy_size_),
+                                     memory,
+                                     buffer,
+                                     allocator_memory_data,
+                                     allocator_buffer_data,
+                                     &memory_property_flags);
+
+        if ((result == VK_SUCCESS) && (size <= max_copy_size_))
+        {
+            staging_memory_      = (*memory);
+            staging_buffer_      = (*buffer);
+            staging_memory_data_ = (*allocator_memory_data);
+            staging_buffer_data_ = (*allocator_buffer_data);
         }
     }
     else
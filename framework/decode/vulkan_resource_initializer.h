@@ -24,11 +24,17 @@
 #include "vulkan/vulkan.h"
 
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+// Buffer and image initialization commands are batched, with many resource copies and layout transitions recorded to
+// one command buffer per queue submission.  Resource data is written to a segment of a persistently mapped staging
+// ring, with one ring segment per batch, and batches are reused in ring order, waiting for a batch's previous
+// submission to complete only when it is reused.  Resources with data that does not fit in a ring segment, and images
+// that are initialized by drawing, are initialized immediately with a dedicated staging resource.
 class VulkanResourceInitializer
 {
   public:
@@ -80,7 +86,109 @@ class VulkanResourceInitializer
                              uint32_t              layer_count,
                              uint32_t              level_count);
 
+    // Retrieve the staging memory that the data for a subsequent InitializeBuffer or InitializeImage call with the same
+    // arguments will be copied from, so that the data can be read directly to staging memory, and then provided to the
+    // initialize call, which will detect that the data is already in place.  Return nullptr when the resource is not
+    // initialized from the staging ring, and its data must be provided with the initialize call.
+    uint8_t* GetBufferStagingData(VkDeviceSize data_size, uint32_t queue_family_index, VkBuffer buffer);
+
+    uint8_t* GetImageStagingData(VkDeviceSize          data_size,
+                                 uint32_t              queue_family_index,
+                                 VkImage               image,
+                                 VkImageType           type,
+                                 VkImageAspectFlagBits aspect,
+                                 VkSampleCountFlagBits sample_count,
+                                 VkImageUsageFlags     usage);
+
+    // Submits the batched initialization commands and waits for all initialization submissions to complete.
+    VkResult Flush();
+
+    // Staging data is used as the source of buffer to image copies, so its offset from the start of the staging ring
+    // must be aligned.  The segment size is a multiple of the alignment, so that aligning an offset within a segment
+    // also aligns the offset from the start of the ring.
+    static const uint32_t     kBatchCount             = 4;
+    static const VkDeviceSize kStagingOffsetAlignment = 96; // Multiple of 4 and of all texel block sizes.
+    static const VkDeviceSize kStagingSegmentSize =
+        ((16 * 1024 * 1024) / kStagingOffsetAlignment) * kStagingOffsetAlignment;
+
+    static VkDeviceSize GetStagingSegmentOffset(uint32_t batch_index) { return batch_index * kStagingSegmentSize; }
+
+    static VkDeviceSize AlignStagingOffset(VkDeviceSize offset)
+    {
+        return ((offset + kStagingOffsetAlignment - 1) / kStagingOffsetAlignment) * kStagingOffsetAlignment;
+    }
+
+  private:
+
+    struct BufferCopy
+    {
+        VkBuffer                  buffer;
+        std::vector<VkBufferCopy> regions;
+    };
+
+    struct ImageCopy
+    {
+        VkImage                        image;
+        std::vector<VkBufferImageCopy> regions;
+    };
+
+    struct CommandBatch
+    {
+        VkDeviceSize                      staging_offset{ 0 }; // Start of the batch's segment in the staging ring.
+        VkDeviceSize                      staging_size{ 0 };
+        uint32_t                          queue_family_index{ 0 };
+        VkQueue                           queue{ VK_NULL_HANDLE };
+        VkCommandPool                     command_pool{ VK_NULL_HANDLE };
+        VkCommandBuffer                   command_buffer{ VK_NULL_HANDLE };
+        VkFence                           fence{ VK_NULL_HANDLE };
+        bool                              in_flight{ false };
+        std::vector<VkImageMemoryBarrier> pre_copy_barriers;
+        std::vector<BufferCopy>           buffer_copies;
+        std::vector<ImageCopy>            image_copies;
+        std::vector<VkImageMemoryBarrier> post_copy_barriers;
+        std::unordered_set<VkBuffer>      buffers;
+        std::unordered_set<VkImage>       images;
+    };
+
   private:
+    // Retrieves the current batch, after submitting it if it is for a different queue family, does not have space
+    // for the data, or submit_current is true.  The staging_offset parameter receives the offset from the start of the
+    // staging ring at which the data can be written.  The space is not reserved, so repeated calls with the same
+    // arguments retrieve the same batch and offset.
+    VkResult PrepareBatch(uint32_t       queue_family_index,
+                          bool           submit_current,
+                          VkDeviceSize   data_size,
+                          CommandBatch** batch,
+                          VkDeviceSize*  staging_offset);
+
+    // Retrieves the current batch as with PrepareBatch, and writes the data to the batch's staging ring segment.  The
+    // write is skipped when the data was already written to the staging ring at the prepared offset.
+    VkResult AcquireBatch(uint32_t       queue_family_index,
+                          bool           submit_current,
+                          VkDeviceSize   data_size,
+                          const uint8_t* data,
+                          CommandBatch** batch,
+                          VkDeviceSize*  staging_offset);
+
+    VkResult SubmitBatch(CommandBatch* batch);
+
+    VkResult RecordBatch(CommandBatch* batch);
+
+    VkResult WaitForBatch(CommandBatch* batch);
+
+    void ClearBatch(CommandBatch* batch);
+
+    void DestroyBatch(CommandBatch* batch);
+
+    VkResult CreateStagingRing();
+
+    void DestroyStagingRing();
+
+    bool UseDrawCopy(VkImageType           type,
+                     VkImageAspectFlagBits aspect,
+                     VkSampleCountFlagBits sample_count,
+                     VkImageUsageFlags     usage) const;
+
     VkResult GetCommandExecObjects(uint32_t queue_family_index, VkQueue* queue, VkCommandBuffer* command_buffer);
 
     VkResult GetDrawDescriptorObjects(VkSampler* sampler, VkDescriptorSetLayout* set_layout, VkDescriptorSet* set);
@@ -118,6 +226,13 @@ class VulkanResourceInitializer
 
     void DestroyFramebufferResources(VkImageView view, VkFramebuffer framebuffer);
 
+    VkResult CreateStagingBuffer(VkDeviceSize                           size,
+                                 VkDeviceMemory*                        memory,
+                                 VkBuffer*                              buffer,
+                                 VulkanResourceAllocator::MemoryData*   allocator_memory_data,
+                                 VulkanResourceAllocator::ResourceData* allocator_buffer_data,
+                                 VkMemoryPropertyFlags*                 memory_property_flags);
+
     VkResult AcquireStagingBuffer(VkDeviceMemory*                        memory,
                                   VkBuffer*                              buffer,
                                   VkDeviceSize                           size,
@@ -190,6 +305,12 @@ class VulkanResourceInitializer
     VulkanResourceAllocator::MemoryData   staging_memory_data_;
     VkBuffer                              staging_buffer_;
     VulkanResourceAllocator::ResourceData staging_buffer_data_;
+    VkDeviceMemory                        staging_ring_memory_;
+    VkBuffer                              staging_ring_buffer_;
+    uint8_t*                              staging_ring_data_;
+    bool                                  staging_ring_coherent_;
+    std::vector<CommandBatch>             batches_;
+    uint32_t                              current_batch_;
     VkSampler                             draw_sampler_;
     VkDescriptorPool                      draw_pool_;
     VkDescriptorSetLayout                 draw_set_layout_;
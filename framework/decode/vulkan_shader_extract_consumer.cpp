@@ -0,0 +1,102 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#include "decode/vulkan_shader_extract_consumer.h"
+
+#include "util/file_path.h"
+#include "util/logging.h"
+#include "util/platform.h"
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+bool VulkanShaderExtractConsumer::Initialize(const std::string& extract_dir)
+{
+    if (util::filepath::Exists(extract_dir))
+    {
+        if (!util::filepath::IsDirectory(extract_dir))
+        {
+            GFXRECON_LOG_ERROR("Error while creating directory %s: Already exists as file", extract_dir.c_str());
+            return false;
+        }
+    }
+    else
+    {
+        int32_t result = util::platform::MakeDirectory(extract_dir.c_str());
+        if (result < 0)
+        {
+            GFXRECON_LOG_ERROR("Error while creating directory %s: Could not open", extract_dir.c_str());
+            return false;
+        }
+    }
+
+    extract_dir_ = extract_dir;
+
+    return true;
+}
+
+std::string VulkanShaderExtractConsumer::GetDefaultExtractDirectory(const std::string& capture_filename)
+{
+    std::string extract_dir  = capture_filename;
+    size_t      dir_location = extract_dir.find_last_of("/\\");
+
+    if (dir_location != std::string::npos)
+    {
+        extract_dir.replace(0, dir_location + 1, "");
+    }
+
+    return extract_dir + ".shaders";
+}
+
+void VulkanShaderExtractConsumer::Process_vkCreateShaderModule(
+    VkResult                                                returnValue,
+    format::HandleId                                        device,
+    StructPointerDecoder<Decoded_VkShaderModuleCreateInfo>* pCreateInfo,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>*    pAllocator,
+    HandlePointerDecoder<VkShaderModule>*                   pShaderModule)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    if ((returnValue >= 0) && (pCreateInfo != nullptr) && !pCreateInfo->IsNull() && (pShaderModule != nullptr) &&
+        !pShaderModule->IsNull())
+    {
+        const uint32_t* orig_code = pCreateInfo->GetPointer()->pCode;
+        size_t          orig_size = pCreateInfo->GetPointer()->codeSize;
+        uint64_t        handle_id = *pShaderModule->GetPointer();
+        std::string     file_name = "sh" + std::to_string(handle_id);
+        std::string     file_path = util::filepath::Join(extract_dir_, file_name);
+
+        FILE*   fp     = nullptr;
+        int32_t result = util::platform::FileOpen(&fp, file_path.c_str(), "wb");
+        if (result == 0)
+        {
+            size_t written_size = util::platform::FileWrite(orig_code, sizeof(char), orig_size, fp);
+            if (written_size != orig_size)
+            {
+                GFXRECON_LOG_ERROR("Error while writing file %s: Could not complete", file_name.c_str());
+            }
+            util::platform::FileClose(fp);
+        }
+        else
+        {
+            GFXRECON_LOG_ERROR("Error while writing file %s: Could not open", file_name.c_str());
+        }
+    }
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
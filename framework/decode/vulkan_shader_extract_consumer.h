@@ -0,0 +1,65 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#ifndef GFXRECON_DECODE_VULKAN_SHADER_EXTRACT_CONSUMER_H
+#define GFXRECON_DECODE_VULKAN_SHADER_EXTRACT_CONSUMER_H
+
+#include "format/format.h"
+#include "generated/generated_vulkan_consumer.h"
+#include "util/defines.h"
+
+#include "vulkan/vulkan.h"
+
+#include <string>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Writes the SPIR-V code of each successful vkCreateShaderModule call to a file named sh<handle_id>, which is the
+// format expected by the gfxrecon-replay --replace-shaders option.
+class VulkanShaderExtractConsumer : public VulkanConsumer
+{
+  public:
+    // Creates the extract directory if it does not exist.  Returns false if the directory could not be created.
+    bool Initialize(const std::string& extract_dir);
+
+    const std::string& GetExtractDirectory() const { return extract_dir_; }
+
+    // Retrieves the default extract directory for a capture file, which is the capture file name, without the path,
+    // with a .shaders suffix.
+    static std::string GetDefaultExtractDirectory(const std::string& capture_filename);
+
+    virtual bool SupportsApiCall(format::ApiCallId call_id) const override
+    {
+        return (call_id == format::ApiCallId::ApiCall_vkCreateShaderModule);
+    }
+
+    virtual bool SupportsMetaDataCommand(format::MetaDataType meta_type) const override { return false; }
+
+    virtual void Process_vkCreateShaderModule(VkResult                                                returnValue,
+                                              format::HandleId                                        device,
+                                              StructPointerDecoder<Decoded_VkShaderModuleCreateInfo>* pCreateInfo,
+                                              StructPointerDecoder<Decoded_VkAllocationCallbacks>*    pAllocator,
+                                              HandlePointerDecoder<VkShaderModule>* pShaderModule) override;
+
+  private:
+    std::string extract_dir_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_VULKAN_SHADER_EXTRACT_CONSUMER_H
@@ -0,0 +1,247 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+
+#ifndef GFXRECON_DECODE_VULKAN_STATS_CONSUMER_H
+#define GFXRECON_DECODE_VULKAN_STATS_CONSUMER_H
+
+#include "format/format.h"
+#include "generated/generated_vulkan_consumer.h"
+#include "util/defines.h"
+
+#include "vulkan/vulkan.h"
+
+#include <cassert>
+#include <limits>
+#include <set>
+#include <string>
+#include <unordered_map>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Collects the application, physical device, memory allocation, and pipeline statistics that are reported by the
+// capture file info tools.
+class VulkanStatsConsumer : public VulkanConsumer
+{
+  public:
+    uint32_t           GetTrimmedStartFrame() const { return trimmed_frame_; }
+    const std::string& GetAppName() const { return app_name_; }
+    uint32_t           GetAppVersion() const { return app_version_; }
+    const std::string& GetEngineName() const { return engine_name_; }
+    uint32_t           GetEngineVersion() const { return engine_version_; }
+    uint32_t           GetApiVersion() const { return api_version_; }
+    uint64_t           GetGraphicsPipelineCount() const { return graphics_pipelines_; }
+    uint64_t           GetComputePipelineCount() const { return compute_pipelines_; }
+    uint64_t           GetAllocationCount() const { return allocation_count_; }
+    uint64_t           GetMinAllocationSize() const { return min_allocation_size_; }
+    uint64_t           GetMaxAllocationSize() const { return max_allocation_size_; }
+
+    const std::set<format::HandleId>& GetInstantiatedDevices() const { return used_physical_devices_; }
+    const VkPhysicalDeviceProperties* GetDeviceProperties(format::HandleId id) const
+    {
+        auto entry = physical_device_properties_.find(id);
+        if (entry != physical_device_properties_.end())
+        {
+            return &entry->second;
+        }
+
+        return nullptr;
+    }
+
+    virtual bool SupportsApiCall(format::ApiCallId call_id) const override
+    {
+        switch (call_id)
+        {
+            case format::ApiCallId::ApiCall_vkCreateInstance:
+            case format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties:
+            case format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties2:
+            case format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties2KHR:
+            case format::ApiCallId::ApiCall_vkCreateDevice:
+            case format::ApiCallId::ApiCall_vkCreateGraphicsPipelines:
+            case format::ApiCallId::ApiCall_vkCreateComputePipelines:
+            case format::ApiCallId::ApiCall_vkAllocateMemory:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    // Memory and resource initialization data is not used, so it is skipped without decompression.
+    virtual bool SupportsMetaDataCommand(format::MetaDataType meta_type) const override { return false; }
+
+    virtual void ProcessStateBeginMarker(uint64_t frame_number) override
+    {
+        // Theres should only be one of these in a capture file.
+        trimmed_frame_ = static_cast<uint32_t>(frame_number);
+    }
+
+    virtual void Process_vkCreateInstance(VkResult                                            returnValue,
+                                          StructPointerDecoder<Decoded_VkInstanceCreateInfo>* pCreateInfo,
+                                          StructPointerDecoder<Decoded_VkAllocationCallbacks>*,
+                                          HandlePointerDecoder<VkInstance>*) override
+    {
+        if ((pCreateInfo != nullptr) && (returnValue >= 0) && !pCreateInfo->IsNull())
+        {
+            auto create_info = pCreateInfo->GetPointer();
+            auto app_info    = create_info->pApplicationInfo;
+            if (app_info != nullptr)
+            {
+                if (app_info->pApplicationName != nullptr)
+                {
+                    app_name_ = app_info->pApplicationName;
+                }
+
+                if (app_info->pEngineName != nullptr)
+                {
+                    engine_name_ = app_info->pEngineName;
+                }
+
+                app_version_    = app_info->applicationVersion;
+                engine_version_ = app_info->engineVersion;
+                api_version_    = app_info->apiVersion;
+            }
+        }
+    }
+
+    virtual void Process_vkGetPhysicalDeviceProperties(
+        format::HandleId physicalDevice, StructPointerDecoder<Decoded_VkPhysicalDeviceProperties>* pProperties) override
+    {
+        if ((pProperties != nullptr) && !pProperties->IsNull())
+        {
+            physical_device_properties_[physicalDevice] = *pProperties->GetPointer();
+        }
+    }
+
+    virtual void Process_vkGetPhysicalDeviceProperties2(format::HandleId physicalDevice,
+                                                        StructPointerDecoder<Decoded_VkPhysicalDeviceProperties2>*
+                                                            pProperties) override
+    {
+        if ((pProperties != nullptr) && !pProperties->IsNull())
+        {
+            auto properties2                            = pProperties->GetPointer();
+            physical_device_properties_[physicalDevice] = properties2->properties;
+        }
+    }
+
+    virtual void Process_vkGetPhysicalDeviceProperties2KHR(format::HandleId physicalDevice,
+                                                           StructPointerDecoder<Decoded_VkPhysicalDeviceProperties2>*
+                                                               pProperties) override
+    {
+        if ((pProperties != nullptr) && !pProperties->IsNull())
+        {
+            auto properties2                            = pProperties->GetPointer();
+            physical_device_properties_[physicalDevice] = properties2->properties;
+        }
+    }
+
+    virtual void Process_vkCreateDevice(VkResult         returnValue,
+                                        format::HandleId physicalDevice,
+                                        StructPointerDecoder<Decoded_VkDeviceCreateInfo>*,
+                                        StructPointerDecoder<Decoded_VkAllocationCallbacks>*,
+                                        HandlePointerDecoder<VkDevice>*) override
+    {
+        if (returnValue >= 0)
+        {
+            used_physical_devices_.insert(physicalDevice);
+        }
+    }
+
+    virtual void Process_vkCreateGraphicsPipelines(VkResult returnValue,
+                                                   format::HandleId,
+                                                   format::HandleId,
+                                                   uint32_t createInfoCount,
+                                                   StructPointerDecoder<Decoded_VkGraphicsPipelineCreateInfo>*,
+                                                   StructPointerDecoder<Decoded_VkAllocationCallbacks>*,
+                                                   HandlePointerDecoder<VkPipeline>*) override
+    {
+        if (returnValue >= 0)
+        {
+            graphics_pipelines_ += createInfoCount;
+        }
+    }
+
+    virtual void Process_vkCreateComputePipelines(VkResult returnValue,
+                                                  format::HandleId,
+                                                  format::HandleId,
+                                                  uint32_t createInfoCount,
+                                                  StructPointerDecoder<Decoded_VkComputePipelineCreateInfo>*,
+                                                  StructPointerDecoder<Decoded_VkAllocationCallbacks>*,
+                                                  HandlePointerDecoder<VkPipeline>*) override
+    {
+        if (returnValue >= 0)
+        {
+            compute_pipelines_ += createInfoCount;
+        }
+    }
+
+    virtual void Process_vkAllocateMemory(VkResult returnValue,
+                                          format::HandleId,
+                                          StructPointerDecoder<Decoded_VkMemoryAllocateInfo>* pAllocateInfo,
+                                          StructPointerDecoder<Decoded_VkAllocationCallbacks>*,
+                                          HandlePointerDecoder<VkDeviceMemory>*) override
+    {
+        assert(pAllocateInfo != nullptr);
+
+        if (returnValue >= 0)
+        {
+            ++allocation_count_;
+
+            if (!pAllocateInfo->IsNull())
+            {
+                auto allocate_info = pAllocateInfo->GetPointer();
+
+                if (allocate_info->allocationSize < min_allocation_size_)
+                {
+                    min_allocation_size_ = allocate_info->allocationSize;
+                }
+
+                if (allocate_info->allocationSize > max_allocation_size_)
+                {
+                    max_allocation_size_ = allocate_info->allocationSize;
+                }
+            }
+        }
+    }
+
+  private:
+    uint32_t trimmed_frame_{ 0 };
+
+    // Application info.
+    std::string app_name_;
+    uint32_t    app_version_{ 0 };
+    std::string engine_name_;
+    uint32_t    engine_version_{ 0 };
+    uint32_t    api_version_{ 0 };
+
+    // Physical device info.
+    std::set<format::HandleId>                                       used_physical_devices_;
+    std::unordered_map<format::HandleId, VkPhysicalDeviceProperties> physical_device_properties_;
+
+    // Total pipeline counts by type.
+    uint64_t graphics_pipelines_{ 0 };
+    uint64_t compute_pipelines_{ 0 };
+
+    // Memory allocation info.
+    uint64_t allocation_count_{ 0 };
+    uint64_t min_allocation_size_{ std::numeric_limits<uint64_t>::max() };
+    uint64_t max_allocation_size_{ 0 };
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_VULKAN_STATS_CONSUMER_H
@@ -0,0 +1,292 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#include "decode/vulkan_submit_timer.h"
+
+#include "util/logging.h"
+
+#include <cassert>
+#include <limits>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+VulkanSubmitTimer::VulkanSubmitTimer(VkDevice                     device,
+                                     const encode::DeviceTable*   device_table,
+                                     float                        timestamp_period,
+                                     const std::vector<uint32_t>& timestamp_valid_bits,
+                                     ReplayStatistics*            statistics) :
+    device_(device), device_table_(device_table), timestamp_period_(timestamp_period),
+    timestamp_valid_bits_(timestamp_valid_bits), statistics_(statistics)
+{
+    assert((device_table != nullptr) && (statistics != nullptr));
+}
+
+VulkanSubmitTimer::~VulkanSubmitTimer()
+{
+    // The application is required to wait for submissions to complete before destroying the device, so all pending
+    // results are available.
+    for (const auto& entry : queue_timers_)
+    {
+        if (entry.second != nullptr)
+        {
+            CollectResults(entry.second.get());
+            DestroyQueueTimer(entry.second.get());
+        }
+    }
+}
+
+bool VulkanSubmitTimer::BeginSubmission(VkQueue          queue,
+                                        uint32_t         queue_family_index,
+                                        VkCommandBuffer* begin_command_buffer,
+                                        VkCommandBuffer* end_command_buffer)
+{
+    assert((begin_command_buffer != nullptr) && (end_command_buffer != nullptr));
+
+    QueueTimer* queue_timer = GetQueueTimer(queue, queue_family_index);
+
+    if (queue_timer == nullptr)
+    {
+        return false;
+    }
+
+    CollectResults(queue_timer);
+
+    if (queue_timer->pending_count == kSlotCount)
+    {
+        return false;
+    }
+
+    Slot& slot              = queue_timer->slots[queue_timer->next_slot];
+    slot.frame_index        = statistics_->GetCurrentFrameIndex();
+    slot.pending            = true;
+    (*begin_command_buffer) = slot.begin_command_buffer;
+    (*end_command_buffer)   = slot.end_command_buffer;
+
+    queue_timer->next_slot = (queue_timer->next_slot + 1) % kSlotCount;
+    ++queue_timer->pending_count;
+
+    return true;
+}
+
+void VulkanSubmitTimer::CancelSubmission(VkQueue queue)
+{
+    auto entry = queue_timers_.find(queue);
+
+    if ((entry != queue_timers_.end()) && (entry->second != nullptr) && (entry->second->pending_count > 0))
+    {
+        QueueTimer* queue_timer = entry->second.get();
+
+        queue_timer->next_slot = (queue_timer->next_slot + kSlotCount - 1) % kSlotCount;
+        queue_timer->slots[queue_timer->next_slot].pending = false;
+        --queue_timer->pending_count;
+    }
+}
+
+void VulkanSubmitTimer::CollectResults()
+{
+    for (const auto& entry : queue_timers_)
+    {
+        if (entry.second != nullptr)
+        {
+            CollectResults(entry.second.get());
+        }
+    }
+}
+
+VulkanSubmitTimer::QueueTimer* VulkanSubmitTimer::GetQueueTimer(VkQueue queue, uint32_t queue_family_index)
+{
+    auto entry = queue_timers_.find(queue);
+
+    if (entry != queue_timers_.end())
+    {
+        return entry->second.get();
+    }
+
+    // Queues that do not support timestamps are stored with a null timer, so that they are only checked once.
+    std::unique_ptr<QueueTimer> queue_timer;
+
+    if ((queue_family_index < timestamp_valid_bits_.size()) && (timestamp_valid_bits_[queue_family_index] != 0))
+    {
+        queue_timer = std::make_unique<QueueTimer>();
+
+        VkResult result = CreateQueueTimer(queue_family_index, queue_timer.get());
+
+        if (result != VK_SUCCESS)
+        {
+            GFXRECON_LOG_WARNING("Failed to create the timestamp queries for queue family %u (error = %x); queue "
+                                 "submissions will not be timed",
+                                 queue_family_index,
+                                 result);
+            DestroyQueueTimer(queue_timer.get());
+            queue_timer.reset();
+        }
+    }
+
+    QueueTimer* result = queue_timer.get();
+    queue_timers_.emplace(queue, std::move(queue_timer));
+
+    return result;
+}
+
+VkResult VulkanSubmitTimer::CreateQueueTimer(uint32_t queue_family_index, QueueTimer* queue_timer)
+{
+    assert(queue_timer != nullptr);
+
+    uint32_t valid_bits = timestamp_valid_bits_[queue_family_index];
+    queue_timer->timestamp_mask =
+        (valid_bits >= 64) ? std::numeric_limits<uint64_t>::max() : ((static_cast<uint64_t>(1) << valid_bits) - 1);
+
+    VkCommandPoolCreateInfo pool_info = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
+    pool_info.pNext                   = nullptr;
+    pool_info.flags                   = 0;
+    pool_info.queueFamilyIndex        = queue_family_index;
+
+    VkResult result = device_table_->CreateCommandPool(device_, &pool_info, nullptr, &queue_timer->command_pool);
+
+    if (result == VK_SUCCESS)
+    {
+        VkQueryPoolCreateInfo query_pool_info = { VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO };
+        query_pool_info.pNext                 = nullptr;
+        query_pool_info.flags                 = 0;
+        query_pool_info.queryType             = VK_QUERY_TYPE_TIMESTAMP;
+        query_pool_info.queryCount            = kSlotCount * 2;
+        query_pool_info.pipelineStatistics    = 0;
+
+        result = device_table_->CreateQueryPool(device_, &query_pool_info, nullptr, &queue_timer->query_pool);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        std::vector<VkCommandBuffer> command_buffers(kSlotCount * 2, VK_NULL_HANDLE);
+
+        VkCommandBufferAllocateInfo alloc_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+        alloc_info.pNext                       = nullptr;
+        alloc_info.commandPool                 = queue_timer->command_pool;
+        alloc_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        alloc_info.commandBufferCount          = kSlotCount * 2;
+
+        result = device_table_->AllocateCommandBuffers(device_, &alloc_info, command_buffers.data());
+
+        queue_timer->slots.resize(kSlotCount);
+
+        // Each slot has a pair of queries, with the query pair reset by the command buffer that writes the first query.
+        for (uint32_t i = 0; (i < kSlotCount) && (result == VK_SUCCESS); ++i)
+        {
+            Slot&    slot        = queue_timer->slots[i];
+            uint32_t begin_query = i * 2;
+
+            slot.begin_command_buffer = command_buffers[begin_query];
+            slot.end_command_buffer   = command_buffers[begin_query + 1];
+
+            VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+            begin_info.pNext                    = nullptr;
+            begin_info.flags                    = 0;
+            begin_info.pInheritanceInfo         = nullptr;
+
+            result = device_table_->BeginCommandBuffer(slot.begin_command_buffer, &begin_info);
+
+            if (result == VK_SUCCESS)
+            {
+                device_table_->CmdResetQueryPool(slot.begin_command_buffer, queue_timer->query_pool, begin_query, 2);
+                device_table_->CmdWriteTimestamp(
+                    slot.begin_command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, queue_timer->query_pool, begin_query);
+
+                result = device_table_->EndCommandBuffer(slot.begin_command_buffer);
+            }
+
+            if (result == VK_SUCCESS)
+            {
+                result = device_table_->BeginCommandBuffer(slot.end_command_buffer, &begin_info);
+            }
+
+            if (result == VK_SUCCESS)
+            {
+                device_table_->CmdWriteTimestamp(slot.end_command_buffer,
+                                                 VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                                                 queue_timer->query_pool,
+                                                 begin_query + 1);
+
+                result = device_table_->EndCommandBuffer(slot.end_command_buffer);
+            }
+        }
+    }
+
+    return result;
+}
+
+void VulkanSubmitTimer::DestroyQueueTimer(QueueTimer* queue_timer)
+{
+    assert(queue_timer != nullptr);
+
+    // Command buffers are freed with the command pool.
+    if (queue_timer->command_pool != VK_NULL_HANDLE)
+    {
+        device_table_->DestroyCommandPool(device_, queue_timer->command_pool, nullptr);
+        queue_timer->command_pool = VK_NULL_HANDLE;
+    }
+
+    if (queue_timer->query_pool != VK_NULL_HANDLE)
+    {
+        device_table_->DestroyQueryPool(device_, queue_timer->query_pool, nullptr);
+        queue_timer->query_pool = VK_NULL_HANDLE;
+    }
+}
+
+void VulkanSubmitTimer::CollectResults(QueueTimer* queue_timer)
+{
+    assert(queue_timer != nullptr);
+
+    // Submissions to a queue complete in submission order, so results are retrieved from the oldest pending slot until
+    // a slot is found with results that are not yet available.
+    while (queue_timer->pending_count > 0)
+    {
+        Slot& slot = queue_timer->slots[queue_timer->pending_slot];
+
+        if (slot.pending)
+        {
+            uint64_t timestamps[2] = { 0, 0 };
+
+            VkResult result = device_table_->GetQueryPoolResults(device_,
+                                                                 queue_timer->query_pool,
+                                                                 queue_timer->pending_slot * 2,
+                                                                 2,
+                                                                 sizeof(timestamps),
+                                                                 timestamps,
+                                                                 sizeof(timestamps[0]),
+                                                                 VK_QUERY_RESULT_64_BIT);
+
+            if (result == VK_NOT_READY)
+            {
+                break;
+            }
+            else if (result == VK_SUCCESS)
+            {
+                uint64_t ticks = (timestamps[1] - timestamps[0]) & queue_timer->timestamp_mask;
+                statistics_->AddSubmissionGpuTime(slot.frame_index,
+                                                  static_cast<int64_t>(static_cast<double>(ticks) * timestamp_period_));
+            }
+
+            slot.pending = false;
+        }
+
+        queue_timer->pending_slot = (queue_timer->pending_slot + 1) % kSlotCount;
+        --queue_timer->pending_count;
+    }
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,108 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#ifndef GFXRECON_DECODE_VULKAN_SUBMIT_TIMER_H
+#define GFXRECON_DECODE_VULKAN_SUBMIT_TIMER_H
+
+#include "decode/replay_statistics.h"
+#include "generated/generated_vulkan_dispatch_table.h"
+#include "util/defines.h"
+
+#include "vulkan/vulkan.h"
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Measures the GPU time of queue submissions with timestamp queries, which are written by pre-recorded command buffers
+// that are added to the start and end of each submission.  Each queue has a fixed number of query slots, which are
+// reused after the results of the submission that they timed have been retrieved.  Results are retrieved without
+// waiting, so a submission is not timed when all of its queue's slots are still in use.  The GPU times are
+// approximate, as the timestamp at the start of a submission may be written before its semaphore waits complete.
+class VulkanSubmitTimer
+{
+  public:
+    // The timestamp_valid_bits vector contains the VkQueueFamilyProperties::timestampValidBits value for each queue
+    // family, with queue families that have a value of zero not supporting timestamps.
+    VulkanSubmitTimer(VkDevice                     device,
+                      const encode::DeviceTable*   device_table,
+                      float                        timestamp_period,
+                      const std::vector<uint32_t>& timestamp_valid_bits,
+                      ReplayStatistics*            statistics);
+
+    ~VulkanSubmitTimer();
+
+    // Retrieves the command buffers to add to the start and end of a submission to the specified queue.  Returns false
+    // if the submission cannot be timed.
+    bool BeginSubmission(VkQueue          queue,
+                         uint32_t         queue_family_index,
+                         VkCommandBuffer* begin_command_buffer,
+                         VkCommandBuffer* end_command_buffer);
+
+    // Cancels the timing of the last submission to the queue, when the submission failed.
+    void CancelSubmission(VkQueue queue);
+
+    // Retrieves the results of completed submissions for all queues.
+    void CollectResults();
+
+  private:
+    static const uint32_t kSlotCount = 64;
+
+    struct Slot
+    {
+        VkCommandBuffer begin_command_buffer{ VK_NULL_HANDLE };
+        VkCommandBuffer end_command_buffer{ VK_NULL_HANDLE };
+        size_t          frame_index{ 0 };
+        bool            pending{ false };
+    };
+
+    struct QueueTimer
+    {
+        VkCommandPool     command_pool{ VK_NULL_HANDLE };
+        VkQueryPool       query_pool{ VK_NULL_HANDLE };
+        uint64_t          timestamp_mask{ 0 };
+        std::vector<Slot> slots;
+        uint32_t          next_slot{ 0 };    // The slot to use for the next submission.
+        uint32_t          pending_slot{ 0 }; // The oldest slot with a pending result.
+        uint32_t          pending_count{ 0 };
+    };
+
+  private:
+    QueueTimer* GetQueueTimer(VkQueue queue, uint32_t queue_family_index);
+
+    VkResult CreateQueueTimer(uint32_t queue_family_index, QueueTimer* queue_timer);
+
+    void DestroyQueueTimer(QueueTimer* queue_timer);
+
+    void CollectResults(QueueTimer* queue_timer);
+
+  private:
+    VkDevice                                                  device_;
+    const encode::DeviceTable*                                device_table_;
+    float                                                     timestamp_period_;
+    std::vector<uint32_t>                                     timestamp_valid_bits_;
+    ReplayStatistics*                                         statistics_;
+    std::unordered_map<VkQueue, std::unique_ptr<QueueTimer>> queue_timers_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_VULKAN_SUBMIT_TIMER_H
@@ -42,6 +42,8 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 #define CAPTURE_FILE_USE_TIMESTAMP_UPPER    "CAPTURE_FILE_TIMESTAMP"
 #define CAPTURE_FILE_FLUSH_LOWER            "capture_file_flush"
 #define CAPTURE_FILE_FLUSH_UPPER            "CAPTURE_FILE_FLUSH"
+#define CAPTURE_FILE_FRAME_INDEX_LOWER      "capture_file_frame_index"
+#define CAPTURE_FILE_FRAME_INDEX_UPPER      "CAPTURE_FILE_FRAME_INDEX"
 #define LOG_ALLOW_INDENTS_LOWER             "log_allow_indents"
 #define LOG_ALLOW_INDENTS_UPPER             "LOG_ALLOW_INDENTS"
 #define LOG_BREAK_ON_ERROR_LOWER            "log_break_on_error"
@@ -82,6 +84,14 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 #define PAGE_GUARD_TRACK_AHB_MEMORY_UPPER   "PAGE_GUARD_TRACK_AHB_MEMORY"
 #define PAGE_GUARD_EXTERNAL_MEMORY_LOWER    "page_guard_external_memory"
 #define PAGE_GUARD_EXTERNAL_MEMORY_UPPER    "PAGE_GUARD_EXTERNAL_MEMORY"
+#define UNASSISTED_HASH_BLOCKS_LOWER        "unassisted_hash_blocks"
+#define UNASSISTED_HASH_BLOCKS_UPPER        "UNASSISTED_HASH_BLOCKS"
+#define FILL_MEMORY_DEDUPLICATION_LOWER     "fill_memory_deduplication"
+#define FILL_MEMORY_DEDUPLICATION_UPPER     "FILL_MEMORY_DEDUPLICATION"
+#define MEMORY_TRACKING_STATS_LOWER         "memory_tracking_stats"
+#define MEMORY_TRACKING_STATS_UPPER         "MEMORY_TRACKING_STATS"
+#define MEMORY_TRACKING_STATS_FRAMES_LOWER  "memory_tracking_stats_frames"
+#define MEMORY_TRACKING_STATS_FRAMES_UPPER  "MEMORY_TRACKING_STATS_FRAMES"
 // clang-format on
 
 #if defined(__ANDROID__)
@@ -92,6 +102,7 @@ const char CaptureSettings::kDefaultCaptureFileName[] = "/sdcard/gfxrecon_captur
 
 const char kCaptureCompressionTypeEnvVar[]    = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_TYPE_LOWER;
 const char kCaptureFileFlushEnvVar[]          = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_FLUSH_LOWER;
+const char kCaptureFileFrameIndexEnvVar[]     = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_FRAME_INDEX_LOWER;
 const char kCaptureFileNameEnvVar[]           = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_NAME_LOWER;
 const char kCaptureFileUseTimestampEnvVar[]   = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_USE_TIMESTAMP_LOWER;
 const char kLogAllowIndentsEnvVar[]           = GFXRECON_ENV_VAR_PREFIX LOG_ALLOW_INDENTS_LOWER;
@@ -114,6 +125,10 @@ const char kPageGuardPersistentMemoryEnvVar[] = GFXRECON_ENV_VAR_PREFIX PAGE_GUA
 const char kPageGuardAlignBufferSizesEnvVar[] = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_ALIGN_BUFFER_SIZES_LOWER;
 const char kPageGuardTrackAhbMemoryEnvVar[]   = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_TRACK_AHB_MEMORY_LOWER;
 const char kPageGuardExternalMemoryEnvVar[]   = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_EXTERNAL_MEMORY_LOWER;
+const char kUnassistedHashBlocksEnvVar[]      = GFXRECON_ENV_VAR_PREFIX UNASSISTED_HASH_BLOCKS_LOWER;
+const char kFillMemoryDeduplicationEnvVar[]   = GFXRECON_ENV_VAR_PREFIX FILL_MEMORY_DEDUPLICATION_LOWER;
+const char kMemoryTrackingStatsEnvVar[]       = GFXRECON_ENV_VAR_PREFIX MEMORY_TRACKING_STATS_LOWER;
+const char kMemoryTrackingStatsFramesEnvVar[] = GFXRECON_ENV_VAR_PREFIX MEMORY_TRACKING_STATS_FRAMES_LOWER;
 
 #else
 // Desktop environment settings
@@ -123,6 +138,7 @@ const char CaptureSettings::kDefaultCaptureFileName[] = "gfxrecon_capture" GFXRE
 
 const char kCaptureCompressionTypeEnvVar[]    = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_TYPE_UPPER;
 const char kCaptureFileFlushEnvVar[]          = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_FLUSH_UPPER;
+const char kCaptureFileFrameIndexEnvVar[]     = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_FRAME_INDEX_UPPER;
 const char kCaptureFileNameEnvVar[]           = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_NAME_UPPER;
 const char kCaptureFileUseTimestampEnvVar[]   = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_USE_TIMESTAMP_UPPER;
 const char kLogAllowIndentsEnvVar[]           = GFXRECON_ENV_VAR_PREFIX LOG_ALLOW_INDENTS_UPPER;
@@ -144,6 +160,10 @@ const char kPageGuardPersistentMemoryEnvVar[] = GFXRECON_ENV_VAR_PREFIX PAGE_GUA
 const char kPageGuardAlignBufferSizesEnvVar[] = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_ALIGN_BUFFER_SIZES_UPPER;
 const char kPageGuardTrackAhbMemoryEnvVar[]   = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_TRACK_AHB_MEMORY_UPPER;
 const char kPageGuardExternalMemoryEnvVar[]   = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_EXTERNAL_MEMORY_UPPER;
+const char kUnassistedHashBlocksEnvVar[]      = GFXRECON_ENV_VAR_PREFIX UNASSISTED_HASH_BLOCKS_UPPER;
+const char kFillMemoryDeduplicationEnvVar[]   = GFXRECON_ENV_VAR_PREFIX FILL_MEMORY_DEDUPLICATION_UPPER;
+const char kMemoryTrackingStatsEnvVar[]       = GFXRECON_ENV_VAR_PREFIX MEMORY_TRACKING_STATS_UPPER;
+const char kMemoryTrackingStatsFramesEnvVar[] = GFXRECON_ENV_VAR_PREFIX MEMORY_TRACKING_STATS_FRAMES_UPPER;
 const char kCaptureTriggerEnvVar[]            = GFXRECON_ENV_VAR_PREFIX CAPTURE_TRIGGER_UPPER;
 #endif
 
@@ -154,6 +174,7 @@ const char kSettingsFilter[] = "lunarg_gfxreconstruct.";
 const std::string kOptionKeyCaptureCompressionType    = std::string(kSettingsFilter) + std::string(CAPTURE_COMPRESSION_TYPE_LOWER);
 const std::string kOptionKeyCaptureFile               = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_NAME_LOWER);
 const std::string kOptionKeyCaptureFileForceFlush     = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_FLUSH_LOWER);
+const std::string kOptionKeyCaptureFileFrameIndex     = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_FRAME_INDEX_LOWER);
 const std::string kOptionKeyCaptureFileUseTimestamp   = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_USE_TIMESTAMP_LOWER);
 const std::string kOptionKeyLogAllowIndents           = std::string(kSettingsFilter) + std::string(LOG_ALLOW_INDENTS_LOWER);
 const std::string kOptionKeyLogBreakOnError           = std::string(kSettingsFilter) + std::string(LOG_BREAK_ON_ERROR_LOWER);
@@ -175,6 +196,10 @@ const std::string kOptionKeyPageGuardPersistentMemory = std::string(kSettingsFil
 const std::string kOptionKeyPageGuardAlignBufferSizes = std::string(kSettingsFilter) + std::string(PAGE_GUARD_ALIGN_BUFFER_SIZES_LOWER);
 const std::string kOptionKeyPageGuardTrackAhbMemory   = std::string(kSettingsFilter) + std::string(PAGE_GUARD_TRACK_AHB_MEMORY_LOWER);
 const std::string kOptionKeyPageGuardExternalMemory   = std::string(kSettingsFilter) + std::string(PAGE_GUARD_EXTERNAL_MEMORY_LOWER);
+const std::string kOptionKeyUnassistedHashBlocks      = std::string(kSettingsFilter) + std::string(UNASSISTED_HASH_BLOCKS_LOWER);
+const std::string kOptionKeyFillMemoryDeduplication   = std::string(kSettingsFilter) + std::string(FILL_MEMORY_DEDUPLICATION_LOWER);
+const std::string kOptionKeyMemoryTrackingStats       = std::string(kSettingsFilter) + std::string(MEMORY_TRACKING_STATS_LOWER);
+const std::string kOptionKeyMemoryTrackingStatsFrames = std::string(kSettingsFilter) + std::string(MEMORY_TRACKING_STATS_FRAMES_LOWER);
 
 #if defined(ENABLE_LZ4_COMPRESSION)
 const format::CompressionType kDefaultCompressionType = format::CompressionType::kLz4;
@@ -234,6 +259,7 @@ void CaptureSettings::LoadOptionsEnvVar(OptionsMap* options)
     LoadSingleOptionEnvVar(options, kCaptureFileUseTimestampEnvVar, kOptionKeyCaptureFileUseTimestamp);
     LoadSingleOptionEnvVar(options, kCaptureCompressionTypeEnvVar, kOptionKeyCaptureCompressionType);
     LoadSingleOptionEnvVar(options, kCaptureFileFlushEnvVar, kOptionKeyCaptureFileForceFlush);
+    LoadSingleOptionEnvVar(options, kCaptureFileFrameIndexEnvVar, kOptionKeyCaptureFileFrameIndex);
 
     // Logging environment variables
     LoadSingleOptionEnvVar(options, kLogAllowIndentsEnvVar, kOptionKeyLogAllowIndents);
@@ -250,6 +276,9 @@ void CaptureSettings::LoadOptionsEnvVar(OptionsMap* options)
 
     // Memory environment variables
     LoadSingleOptionEnvVar(options, kMemoryTrackingModeEnvVar, kOptionKeyMemoryTrackingMode);
+    LoadSingleOptionEnvVar(options, kFillMemoryDeduplicationEnvVar, kOptionKeyFillMemoryDeduplication);
+    LoadSingleOptionEnvVar(options, kMemoryTrackingStatsEnvVar, kOptionKeyMemoryTrackingStats);
+    LoadSingleOptionEnvVar(options, kMemoryTrackingStatsFramesEnvVar, kOptionKeyMemoryTrackingStatsFrames);
 
     // Trimming environment variables
     LoadSingleOptionEnvVar(options, kCaptureFramesEnvVar, kOptionKeyCaptureFrames);
@@ -262,6 +291,9 @@ void CaptureSettings::LoadOptionsEnvVar(OptionsMap* options)
     LoadSingleOptionEnvVar(options, kPageGuardAlignBufferSizesEnvVar, kOptionKeyPageGuardAlignBufferSizes);
     LoadSingleOptionEnvVar(options, kPageGuardTrackAhbMemoryEnvVar, kOptionKeyPageGuardTrackAhbMemory);
     LoadSingleOptionEnvVar(options, kPageGuardExternalMemoryEnvVar, kOptionKeyPageGuardExternalMemory);
+
+    // Unassisted memory tracking environment variables
+    LoadSingleOptionEnvVar(options, kUnassistedHashBlocksEnvVar, kOptionKeyUnassistedHashBlocks);
 }
 
 void CaptureSettings::LoadOptionsFile(OptionsMap* options)
@@ -300,10 +332,19 @@ void CaptureSettings::ProcessOptions(OptionsMap* options, CaptureSettings* setti
                                                                 settings->trace_settings_.time_stamp_file);
     settings->trace_settings_.force_flush =
         ParseBoolString(FindOption(options, kOptionKeyCaptureFileForceFlush), settings->trace_settings_.force_flush);
+    settings->trace_settings_.frame_index =
+        ParseBoolString(FindOption(options, kOptionKeyCaptureFileFrameIndex), settings->trace_settings_.frame_index);
 
     // Memory tracking options
     settings->trace_settings_.memory_tracking_mode = ParseMemoryTrackingModeString(
         FindOption(options, kOptionKeyMemoryTrackingMode), settings->trace_settings_.memory_tracking_mode);
+    settings->trace_settings_.fill_memory_deduplication = ParseBoolString(
+        FindOption(options, kOptionKeyFillMemoryDeduplication), settings->trace_settings_.fill_memory_deduplication);
+    settings->trace_settings_.memory_tracking_stats = ParseBoolString(
+        FindOption(options, kOptionKeyMemoryTrackingStats), settings->trace_settings_.memory_tracking_stats);
+    settings->trace_settings_.memory_tracking_stats_frames =
+        ParseUnsignedIntegerString(FindOption(options, kOptionKeyMemoryTrackingStatsFrames),
+                                   settings->trace_settings_.memory_tracking_stats_frames);
 
     // Trimming options:
     // trim ranges and trim hotkey are exclusive
@@ -339,6 +380,10 @@ void CaptureSettings::ProcessOptions(OptionsMap* options, CaptureSettings* setti
     settings->trace_settings_.page_guard_external_memory = ParseBoolString(
         FindOption(options, kOptionKeyPageGuardExternalMemory), settings->trace_settings_.page_guard_external_memory);
 
+    // Unassisted memory tracking options
+    settings->trace_settings_.unassisted_hash_blocks = ParseBoolString(
+        FindOption(options, kOptionKeyUnassistedHashBlocks), settings->trace_settings_.unassisted_hash_blocks);
+
     // Log options
     settings->log_settings_.use_indent =
         ParseBoolString(FindOption(options, kOptionKeyLogAllowIndents), settings->log_settings_.use_indent);
@@ -408,6 +453,29 @@ bool CaptureSettings::ParseBoolString(const std::string& value_string, bool defa
     return result;
 }
 
+uint32_t CaptureSettings::ParseUnsignedIntegerString(const std::string& value_string, uint32_t default_value)
+{
+    uint32_t result = default_value;
+
+    if (!value_string.empty())
+    {
+        // Check that the value string only contains numbers and is in range.
+        size_t count = std::count_if(value_string.begin(), value_string.end(), ::isdigit);
+        if ((count == value_string.length()) && (value_string.length() <= 10) &&
+            (std::stoull(value_string) <= std::numeric_limits<uint32_t>::max()))
+        {
+            result = static_cast<uint32_t>(std::stoull(value_string));
+        }
+        else
+        {
+            GFXRECON_LOG_WARNING("Settings Loader: Ignoring unrecognized unsigned integer option value \"%s\"",
+                                 value_string.c_str());
+        }
+    }
+
+    return result;
+}
+
 CaptureSettings::MemoryTrackingMode
 CaptureSettings::ParseMemoryTrackingModeString(const std::string&                  value_string,
                                                CaptureSettings::MemoryTrackingMode default_value)
@@ -426,6 +494,10 @@ CaptureSettings::ParseMemoryTrackingModeString(const std::string&
     {
         result = MemoryTrackingMode::kUnassisted;
     }
+    else if (util::platform::StringCompareNoCase("auto", value_string.c_str()) == 0)
+    {
+        result = MemoryTrackingMode::kAuto;
+    }
     else
     {
         if (!value_string.empty())
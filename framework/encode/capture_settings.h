@@ -46,7 +46,12 @@ class CaptureSettings
         // Use guard pages to determine which regions of memory to write on unmap and queue submit.  This mode replaces
         // the mapped memory value returned by the driver with a shadow allocation that the capture layer can monitor
         // to determine which regions of memory have been modified by the application.
-        kPageGuard = 2
+        kPageGuard = 2,
+        // Select one of the other modes for each mapped memory object.  Memory without the host coherent property
+        // uses the assisted mode, as the application is required to flush it after writing to it.  Other memory uses
+        // the page guard mode, and switches to the unassisted mode on the next map when the page guard mode has
+        // observed that most of its pages are modified between queue submits.
+        kAuto = 3
     };
 
     struct TrimRange
@@ -61,6 +66,7 @@ class CaptureSettings
         format::EnabledOptions capture_file_options;
         bool                   time_stamp_file{ true };
         bool                   force_flush{ false };
+        bool                   frame_index{ false };
         MemoryTrackingMode     memory_tracking_mode{ kPageGuard };
         std::vector<TrimRange> trim_ranges;
         std::string            trim_key;
@@ -75,6 +81,20 @@ class CaptureSettings
         // memory allocation that the capture layer can monitor to determine which regions of memory have been modified
         // by the application.
         bool page_guard_external_memory{ false };
+
+        // An optimization for the unassisted memory tracking mode that keeps a hash for each fixed size block of mapped
+        // memory, only writing the blocks with hash values that have changed since the memory was last written to the
+        // capture file.
+        bool unassisted_hash_blocks{ false };
+
+        // Keep a hash for each recently written fill memory payload, writing a reference to the previously written
+        // payload instead of a copy of the data when the same payload is written again.
+        bool fill_memory_deduplication{ false };
+
+        // Collect per memory object statistics for mapped memory tracking, which are written to the log at exit and,
+        // when memory_tracking_stats_frames is not zero, every memory_tracking_stats_frames frames.
+        bool     memory_tracking_stats{ false };
+        uint32_t memory_tracking_stats_frames{ 0 };
     };
 
   public:
@@ -105,6 +125,8 @@ class CaptureSettings
 
     static bool ParseBoolString(const std::string& value_string, bool default_value);
 
+    static uint32_t ParseUnsignedIntegerString(const std::string& value_string, uint32_t default_value);
+
     static MemoryTrackingMode ParseMemoryTrackingModeString(const std::string& value_string,
                                                             MemoryTrackingMode default_value);
 
@@ -25,11 +25,14 @@
 #include "format/format_util.h"
 #include "generated/generated_vulkan_struct_handle_wrappers.h"
 #include "util/compressor.h"
+#include "util/date_time.h"
 #include "util/file_path.h"
+#include "util/hash.h"
 #include "util/logging.h"
 #include "util/page_guard_manager.h"
 #include "util/platform.h"
 
+#include <algorithm>
 #include <cassert>
 
 #if defined(__linux__) && !defined(__ANDROID__)
@@ -51,6 +54,29 @@ const util::Log::Severity kDefaultLogLevel = util::Log::Severity::kInfoSeverity;
 // One based frame count.
 const uint32_t kFirstFrame = 1;
 
+// Size of the memory blocks hashed by the unassisted memory tracking mode to detect modified memory.
+const size_t kUnassistedHashBlockSize = 64 * 1024;
+
+// Fill memory data smaller than this size is always written to the capture file, as the space saved by replacing it
+// with a reference would not justify the cost of hashing the data.
+const size_t kFillMemoryDeduplicationMinSize = 4 * 1024;
+
+// Maximum number of fill memory data hashes to retain for deduplication, with the oldest entries discarded first.
+const size_t kFillMemoryDeduplicationMaxEntries = 16 * 1024;
+
+// Maximum number of memory objects to include in the memory tracking statistics report.
+const size_t kMemoryTrackingStatsMaxEntries = 32;
+
+// The automatic memory tracking mode switches mapped memory from the page guard mode to the unassisted mode when at
+// least 3/4 of its pages were modified each time modified pages were processed, over a minimum number of samples.
+const uint64_t kAutoMemoryTrackingMinProcessCount       = 4;
+const uint64_t kAutoMemoryTrackingDirtyRatioNumerator   = 3;
+const uint64_t kAutoMemoryTrackingDirtyRatioDenominator = 4;
+
+// Number of maps using the unassisted mode before the automatic memory tracking mode returns to the page guard mode to
+// sample the modified page ratio again.
+const uint32_t kAutoMemoryTrackingResampleMapCount = 16;
+
 std::mutex                                     TraceManager::ThreadData::count_lock_;
 format::ThreadId                               TraceManager::ThreadData::thread_count_ = 0;
 std::unordered_map<uint64_t, format::ThreadId> TraceManager::ThreadData::id_map_;
@@ -92,13 +118,26 @@ format::ThreadId TraceManager::ThreadData::GetThreadId()
 TraceManager::TraceManager() :
     force_file_flush_(false), bytes_written_(0), timestamp_filename_(true),
     memory_tracking_mode_(CaptureSettings::MemoryTrackingMode::kPageGuard), page_guard_align_buffer_sizes_(false),
-    page_guard_track_ahb_memory_(false), page_guard_memory_mode_(kMemoryModeShadowInternal), trim_enabled_(false),
-    trim_current_range_(0), current_frame_(kFirstFrame), capture_mode_(kModeWrite), previous_hotkey_state_(false)
+    page_guard_track_ahb_memory_(false), unassisted_hash_blocks_(false), fill_memory_deduplication_(false),
+    memory_tracking_stats_(false), memory_tracking_stats_frames_(0), memory_tracking_stats_frame_count_(0),
+    frame_index_enabled_(false), current_frame_index_{ 0, 0 }, page_guard_memory_mode_(kMemoryModeShadowInternal),
+    trim_enabled_(false), trim_current_range_(0), current_frame_(kFirstFrame), capture_mode_(kModeWrite),
+    previous_hotkey_state_(false)
 {}
 
 TraceManager::~TraceManager()
 {
-    if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard)
+    if (file_stream_ != nullptr)
+    {
+        WriteFrameIndex();
+    }
+
+    if (memory_tracking_stats_)
+    {
+        LogMemoryTrackingStatistics();
+    }
+
+    if (IsPageGuardMemoryTrackingEnabled())
     {
         util::PageGuardManager::Destroy();
     }
@@ -215,7 +254,7 @@ bool TraceManager::Initialize(std::string base_filename, const CaptureSettings::
     memory_tracking_mode_ = trace_settings.memory_tracking_mode;
     force_file_flush_     = trace_settings.force_flush;
 
-    if (memory_tracking_mode_ == CaptureSettings::kPageGuard)
+    if (IsPageGuardMemoryTrackingEnabled())
     {
         page_guard_align_buffer_sizes_ = trace_settings.page_guard_align_buffer_sizes;
         page_guard_track_ahb_memory_   = trace_settings.page_guard_track_ahb_memory;
@@ -252,6 +291,20 @@ bool TraceManager::Initialize(std::string base_filename, const CaptureSettings::
         page_guard_memory_mode_        = kMemoryModeDisabled;
     }
 
+    fill_memory_deduplication_    = trace_settings.fill_memory_deduplication;
+    memory_tracking_stats_        = trace_settings.memory_tracking_stats;
+    memory_tracking_stats_frames_ = trace_settings.memory_tracking_stats_frames;
+    frame_index_enabled_          = trace_settings.frame_index;
+
+    if ((memory_tracking_mode_ == CaptureSettings::kUnassisted) || (memory_tracking_mode_ == CaptureSettings::kAuto))
+    {
+        unassisted_hash_blocks_ = trace_settings.unassisted_hash_blocks;
+    }
+    else
+    {
+        unassisted_hash_blocks_ = false;
+    }
+
     if (trace_settings.trim_ranges.empty() && trace_settings.trim_key.empty())
     {
         // Use default kModeWrite capture mode.
@@ -317,11 +370,12 @@ bool TraceManager::Initialize(std::string base_filename, const CaptureSettings::
 
     if (success)
     {
-        if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard)
+        if (IsPageGuardMemoryTrackingEnabled())
         {
             util::PageGuardManager::Create(trace_settings.page_guard_copy_on_map,
                                            trace_settings.page_guard_separate_read,
-                                           util::PageGuardManager::kDefaultEnableReadWriteSamePage);
+                                           util::PageGuardManager::kDefaultEnableReadWriteSamePage,
+                                           trace_settings.memory_tracking_stats);
         }
 
         if ((capture_mode_ & kModeTrack) == kModeTrack)
@@ -418,6 +472,16 @@ void TraceManager::EndApiCallTrace(ParameterEncoder* encoder)
             // Write parameter data.
             bytes_written_ += file_stream_->Write(data_pointer, data_size);
 
+            ++current_frame_index_.block_count;
+
+            if (frame_index_enabled_ && (thread_data->call_id_ == format::ApiCallId::ApiCall_vkQueuePresentKHR))
+            {
+                // The present call is the last block of the current frame.
+                frame_index_.push_back(current_frame_index_);
+                current_frame_index_.block_offset = file_stream_->Tell();
+                current_frame_index_.block_count  = 0;
+            }
+
             if (force_file_flush_)
             {
                 file_stream_->Flush();
@@ -450,6 +514,7 @@ void TraceManager::CheckContinueCaptureForWriteMode()
         {
             // Stop recording and close file.
             capture_mode_ &= ~kModeWrite;
+            WriteFrameIndex();
             file_stream_ = nullptr;
             GFXRECON_LOG_INFO("Finished recording graphics API capture");
 
@@ -486,6 +551,7 @@ void TraceManager::CheckContinueCaptureForWriteMode()
     {
         // Stop recording and close file.
         capture_mode_ &= ~kModeWrite;
+        WriteFrameIndex();
         file_stream_ = nullptr;
         GFXRECON_LOG_INFO("Finished recording graphics API capture");
     }
@@ -529,6 +595,17 @@ void TraceManager::CheckStartCaptureForTrackMode()
 
 void TraceManager::EndFrame()
 {
+    if (memory_tracking_stats_)
+    {
+        ++memory_tracking_stats_frame_count_;
+
+        if ((memory_tracking_stats_frames_ > 0) &&
+            ((memory_tracking_stats_frame_count_ % memory_tracking_stats_frames_) == 0))
+        {
+            LogMemoryTrackingStatistics();
+        }
+    }
+
     if (trim_enabled_)
     {
         ++current_frame_;
@@ -583,10 +660,24 @@ bool TraceManager::CreateCaptureFile(const std::string& base_filename)
 
     file_stream_ = std::make_unique<util::FileOutputStream>(capture_filename);
 
+    {
+        // Fill memory data from a previous capture file cannot be referenced by the new capture file.
+        std::lock_guard<std::mutex> lock(file_lock_);
+        fill_memory_payloads_.clear();
+        fill_memory_payload_order_.clear();
+        frame_index_.clear();
+        state_marker_index_.clear();
+        current_frame_index_.block_offset = 0;
+        current_frame_index_.block_count  = 0;
+    }
+
     if (file_stream_->IsValid())
     {
         GFXRECON_LOG_INFO("Recording graphics API capture to %s", capture_filename.c_str());
         WriteFileHeader();
+
+        std::lock_guard<std::mutex> lock(file_lock_);
+        current_frame_index_.block_offset = file_stream_->Tell();
     }
     else
     {
@@ -599,6 +690,8 @@ bool TraceManager::CreateCaptureFile(const std::string& base_filename)
 
 void TraceManager::ActivateTrimming()
 {
+    // The file lock is held while the state snapshot is written and the frame index is updated, so blocks written by
+    // other threads cannot be interleaved with the snapshot or counted in its block count.
     std::lock_guard<std::mutex> lock(file_lock_);
 
     capture_mode_ |= kModeWrite;
@@ -606,8 +699,35 @@ void TraceManager::ActivateTrimming()
     auto thread_data = GetThreadData();
     assert(thread_data != nullptr);
 
+    int64_t state_begin_offset = file_stream_->Tell();
+
     VulkanStateWriter state_writer(file_stream_.get(), compressor_.get(), thread_data->thread_id_);
     state_tracker_->WriteState(&state_writer, current_frame_);
+
+    // The state snapshot is replayed as part of the first frame.
+    current_frame_index_.block_count += state_writer.GetBlockCount();
+
+    if (frame_index_enabled_)
+    {
+        int64_t state_end_offset = file_stream_->Tell() - sizeof(format::Marker);
+
+        state_marker_index_.push_back(
+            { static_cast<uint64_t>(state_begin_offset), current_frame_, format::MarkerType::kBeginMarker });
+        state_marker_index_.push_back(
+            { static_cast<uint64_t>(state_end_offset), current_frame_, format::MarkerType::kEndMarker });
+    }
+
+    if (unassisted_hash_blocks_)
+    {
+        // Block hashes refer to data written to the previous capture file, so all mapped memory needs to be written to
+        // the new capture file on the next queue submit or unmap.
+        std::lock_guard<std::mutex> mapped_lock(mapped_memory_lock_);
+
+        for (auto wrapper : mapped_memory_)
+        {
+            wrapper->mapped_block_hashes.clear();
+        }
+    }
 }
 
 void TraceManager::WriteFileHeader()
@@ -631,6 +751,63 @@ void TraceManager::WriteFileHeader()
     }
 }
 
+void TraceManager::WriteFrameIndex()
+{
+    if (!frame_index_enabled_ || (file_stream_ == nullptr))
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(file_lock_);
+
+    // Blocks written after the last present belong to an incomplete frame, which is indexed so that it can be replayed.
+    if (current_frame_index_.block_count > 0)
+    {
+        frame_index_.push_back(current_frame_index_);
+        current_frame_index_.block_count = 0;
+    }
+
+    int64_t index_offset = file_stream_->Tell();
+    if (index_offset < 0)
+    {
+        GFXRECON_LOG_WARNING("Failed to determine capture file position; the frame index will not be written");
+        return;
+    }
+
+    size_t frame_index_size        = frame_index_.size() * sizeof(format::FrameIndexEntry);
+    size_t state_marker_index_size = state_marker_index_.size() * sizeof(format::StateMarkerIndexEntry);
+
+    format::FrameIndexCommandHeader index_header;
+    index_header.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+    index_header.meta_header.meta_data_type    = format::MetaDataType::kFrameIndexCommand;
+    index_header.frame_count                   = frame_index_.size();
+    index_header.state_marker_count            = state_marker_index_.size();
+    index_header.meta_header.block_header.size =
+        sizeof(index_header.meta_header.meta_data_type) + sizeof(index_header.frame_count) +
+        sizeof(index_header.state_marker_count) + frame_index_size + state_marker_index_size;
+
+    bytes_written_ += file_stream_->Write(&index_header, sizeof(index_header));
+    bytes_written_ += file_stream_->Write(frame_index_.data(), frame_index_size);
+    bytes_written_ += file_stream_->Write(state_marker_index_.data(), state_marker_index_size);
+
+    // The locator is a fixed size block at the end of the file, which allows the index to be found without reading
+    // the rest of the file.
+    format::FrameIndexLocatorCommand locator;
+    locator.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+    locator.meta_header.meta_data_type    = format::MetaDataType::kFrameIndexLocatorCommand;
+    locator.index_offset                  = static_cast<uint64_t>(index_offset);
+    locator.fourcc                        = GFXRECON_FRAME_INDEX_FOURCC;
+    locator.meta_header.block_header.size =
+        sizeof(locator.meta_header.meta_data_type) + sizeof(locator.index_offset) + sizeof(locator.fourcc);
+
+    bytes_written_ += file_stream_->Write(&locator, sizeof(locator));
+
+    file_stream_->Flush();
+
+    frame_index_.clear();
+    state_marker_index_.clear();
+}
+
 void TraceManager::BuildOptionList(const format::EnabledOptions&        enabled_options,
                                    std::vector<format::FileOptionPair>* option_list)
 {
@@ -655,6 +832,7 @@ void TraceManager::WriteDisplayMessageCmd(const char* message)
         {
             std::lock_guard<std::mutex> lock(file_lock_);
 
+            ++current_frame_index_.block_count;
             bytes_written_ += file_stream_->Write(&message_cmd, sizeof(message_cmd));
             bytes_written_ += file_stream_->Write(message, message_length);
 
@@ -684,6 +862,7 @@ void TraceManager::WriteResizeWindowCmd(format::HandleId surface_id, uint32_t wi
 
         {
             std::lock_guard<std::mutex> lock(file_lock_);
+            ++current_frame_index_.block_count;
             bytes_written_ += file_stream_->Write(&resize_cmd, sizeof(resize_cmd));
 
             if (force_file_flush_)
@@ -706,6 +885,21 @@ void TraceManager::WriteFillMemoryCmd(format::HandleId memory_id,
         format::FillMemoryCommandHeader fill_cmd;
         const uint8_t*                  write_address = (static_cast<const uint8_t*>(data) + offset);
         size_t                          write_size    = static_cast<size_t>(size);
+        bool                            deduplicate   = false;
+        FillMemoryPayloadKey            payload_key   = {};
+
+        if (fill_memory_deduplication_ && (write_size >= kFillMemoryDeduplicationMinSize))
+        {
+            deduplicate      = true;
+            payload_key.size = size;
+            payload_key.hash = util::hash::GenerateHash128(write_address, write_size);
+
+            if (WriteFillMemoryReferenceCmd(memory_id, offset, payload_key))
+            {
+                // The data was previously written to the capture file, and a reference to it has been written.
+                return;
+            }
+        }
 
         auto thread_data = GetThreadData();
         assert(thread_data != nullptr);
@@ -740,9 +934,20 @@ void TraceManager::WriteFillMemoryCmd(format::HandleId memory_id,
         {
             std::lock_guard<std::mutex> lock(file_lock_);
 
+            if (deduplicate)
+            {
+                AddFillMemoryPayload(payload_key, file_stream_->Tell());
+            }
+
+            ++current_frame_index_.block_count;
             bytes_written_ += file_stream_->Write(&fill_cmd, sizeof(fill_cmd));
             bytes_written_ += file_stream_->Write(write_address, write_size);
 
+            if (memory_tracking_stats_)
+            {
+                UpdateFillMemoryStatistics(memory_id, size, sizeof(fill_cmd) + write_size);
+            }
+
             if (force_file_flush_)
             {
                 file_stream_->Flush();
@@ -751,6 +956,280 @@ void TraceManager::WriteFillMemoryCmd(format::HandleId memory_id,
     }
 }
 
+bool TraceManager::WriteFillMemoryReferenceCmd(format::HandleId            memory_id,
+                                               VkDeviceSize                offset,
+                                               const FillMemoryPayloadKey& payload_key)
+{
+    auto thread_data = GetThreadData();
+    assert(thread_data != nullptr);
+
+    std::lock_guard<std::mutex> lock(file_lock_);
+
+    auto entry = fill_memory_payloads_.find(payload_key);
+    if (entry == fill_memory_payloads_.end())
+    {
+        return false;
+    }
+
+    format::FillMemoryReferenceCommand reference_cmd;
+
+    reference_cmd.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+    reference_cmd.meta_header.block_header.size =
+        sizeof(reference_cmd.meta_header.meta_data_type) + sizeof(reference_cmd.thread_id) +
+        sizeof(reference_cmd.memory_id) + sizeof(reference_cmd.memory_offset) + sizeof(reference_cmd.memory_size) +
+        sizeof(reference_cmd.block_offset);
+    reference_cmd.meta_header.meta_data_type = format::MetaDataType::kFillMemoryReferenceCommand;
+    reference_cmd.thread_id                  = thread_data->thread_id_;
+    reference_cmd.memory_id                  = memory_id;
+    reference_cmd.memory_offset              = offset;
+    reference_cmd.memory_size                = payload_key.size;
+    reference_cmd.block_offset               = entry->second;
+
+    ++current_frame_index_.block_count;
+    bytes_written_ += file_stream_->Write(&reference_cmd, sizeof(reference_cmd));
+
+    if (memory_tracking_stats_)
+    {
+        UpdateFillMemoryStatistics(memory_id, payload_key.size, sizeof(reference_cmd));
+    }
+
+    if (force_file_flush_)
+    {
+        file_stream_->Flush();
+    }
+
+    return true;
+}
+
+void TraceManager::AddFillMemoryPayload(const FillMemoryPayloadKey& payload_key, int64_t block_offset)
+{
+    // Expected to be called with file_lock_ held.
+    if (block_offset < 0)
+    {
+        // The file offset is not available, so the data cannot be referenced.
+        return;
+    }
+
+    auto entry = fill_memory_payloads_.find(payload_key);
+    if (entry != fill_memory_payloads_.end())
+    {
+        // Another thread may have written the same data after this thread failed to find it; reference the most
+        // recently written copy.
+        entry->second = static_cast<uint64_t>(block_offset);
+    }
+    else
+    {
+        if (fill_memory_payload_order_.size() >= kFillMemoryDeduplicationMaxEntries)
+        {
+            fill_memory_payloads_.erase(fill_memory_payload_order_.front());
+            fill_memory_payload_order_.pop_front();
+        }
+
+        fill_memory_payloads_[payload_key] = static_cast<uint64_t>(block_offset);
+        fill_memory_payload_order_.push_back(payload_key);
+    }
+}
+
+void TraceManager::UpdateFillMemoryStatistics(format::HandleId memory_id, uint64_t fill_size, uint64_t written_size)
+{
+    // Expected to be called with file_lock_ held.
+    FillMemoryStatistics& statistics = fill_memory_statistics_[memory_id];
+
+    ++statistics.fill_count;
+    statistics.fill_bytes += fill_size;
+    statistics.written_bytes += written_size;
+}
+
+void TraceManager::LogMemoryTrackingStatistics()
+{
+    struct MemoryTrackingStatistics
+    {
+        format::HandleId                         memory_id{ 0 };
+        FillMemoryStatistics                     fill;
+        util::PageGuardManager::MemoryStatistics page_guard;
+    };
+
+    std::unordered_map<format::HandleId, MemoryTrackingStatistics> combined;
+
+    {
+        std::lock_guard<std::mutex> lock(file_lock_);
+
+        for (const auto& entry : fill_memory_statistics_)
+        {
+            combined[entry.first].fill = entry.second;
+        }
+    }
+
+    util::PageGuardManager* manager = util::PageGuardManager::Get();
+    if ((manager != nullptr) && manager->IsStatisticsEnabled())
+    {
+        util::PageGuardManager::MemoryStatisticsMap page_guard_statistics;
+        manager->GetMemoryStatistics(&page_guard_statistics);
+
+        for (const auto& entry : page_guard_statistics)
+        {
+            combined[entry.first].page_guard = entry.second;
+        }
+    }
+
+    std::vector<MemoryTrackingStatistics> sorted;
+    sorted.reserve(combined.size());
+
+    for (auto& entry : combined)
+    {
+        entry.second.memory_id = entry.first;
+        sorted.emplace_back(entry.second);
+    }
+
+    // Sort by the amount of data written to the capture file, with the number of guard page violations determining
+    // the order of memory objects with the same amount of data.
+    std::sort(sorted.begin(), sorted.end(), [](const MemoryTrackingStatistics& a, const MemoryTrackingStatistics& b) {
+        if (a.fill.written_bytes != b.fill.written_bytes)
+        {
+            return a.fill.written_bytes > b.fill.written_bytes;
+        }
+
+        return (a.page_guard.write_faults + a.page_guard.read_faults) >
+               (b.page_guard.write_faults + b.page_guard.read_faults);
+    });
+
+    GFXRECON_LOG_INFO("Memory tracking statistics after %u frames for %" PRIuPTR " memory objects:",
+                      memory_tracking_stats_frame_count_,
+                      sorted.size());
+
+    size_t count = std::min(sorted.size(), kMemoryTrackingStatsMaxEntries);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const MemoryTrackingStatistics& entry = sorted[i];
+
+        GFXRECON_LOG_INFO("  Memory ID %" PRIu64 ": %" PRIu64 " fill commands, %" PRIu64 " bytes filled, %" PRIu64
+                          " bytes written",
+                          entry.memory_id,
+                          entry.fill.fill_count,
+                          entry.fill.fill_bytes,
+                          entry.fill.written_bytes);
+
+        if (IsPageGuardMemoryTrackingEnabled())
+        {
+            const util::PageGuardManager::MemoryStatistics& page_guard = entry.page_guard;
+
+            double average_dirty_pages = 0.0;
+            if (page_guard.process_count > 0)
+            {
+                average_dirty_pages =
+                    static_cast<double>(page_guard.dirty_pages) / static_cast<double>(page_guard.process_count);
+            }
+
+            GFXRECON_LOG_INFO("    %" PRIu64 " write faults, %" PRIu64 " read faults, %.1f dirty pages per process "
+                              "(max %" PRIu64 "), %" PRIu64 " modified bytes",
+                              page_guard.write_faults,
+                              page_guard.read_faults,
+                              average_dirty_pages,
+                              page_guard.max_dirty_pages,
+                              page_guard.modified_bytes);
+            GFXRECON_LOG_INFO("    %" PRIu64 " protection changes in %.3f ms, %" PRIu64 " bytes copied in %.3f ms",
+                              page_guard.protect_count,
+                              util::datetime::ConvertTimestampToMilliseconds(page_guard.protect_time),
+                              page_guard.copy_bytes,
+                              util::datetime::ConvertTimestampToMilliseconds(page_guard.copy_time));
+        }
+    }
+
+    if (sorted.size() > count)
+    {
+        GFXRECON_LOG_INFO("  Omitted statistics for %" PRIuPTR " memory objects", sorted.size() - count);
+    }
+}
+
+void TraceManager::WriteUnassistedMappedMemory(DeviceMemoryWrapper* wrapper)
+{
+    assert((wrapper != nullptr) && (wrapper->mapped_data != nullptr));
+
+    VkDeviceSize size = wrapper->mapped_size;
+    if (size == VK_WHOLE_SIZE)
+    {
+        assert(wrapper->mapped_offset <= wrapper->allocation_size);
+        size = wrapper->allocation_size - wrapper->mapped_offset;
+    }
+
+    if (!unassisted_hash_blocks_)
+    {
+        // Write the entire mapped region.
+        // We set offset to 0, because the pointer returned by vkMapMemory already includes the offset.
+        WriteFillMemoryCmd(wrapper->handle_id, 0, size, wrapper->mapped_data);
+    }
+    else if ((capture_mode_ & kModeWrite) == kModeWrite)
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, size);
+
+        const uint8_t* data        = static_cast<const uint8_t*>(wrapper->mapped_data);
+        size_t         mapped_size = static_cast<size_t>(size);
+        size_t         block_count = (mapped_size + kUnassistedHashBlockSize - 1) / kUnassistedHashBlockSize;
+        bool           write_all   = false;
+
+        // With no hashes from a previous write, every block needs to be written.
+        if (wrapper->mapped_block_hashes.size() != block_count)
+        {
+            wrapper->mapped_block_hashes.resize(block_count);
+            write_all = true;
+        }
+
+        bool   active_range = false;
+        size_t start_index  = 0;
+
+        for (size_t i = 0; i < block_count; ++i)
+        {
+            size_t   block_offset = i * kUnassistedHashBlockSize;
+            size_t   block_size   = std::min(kUnassistedHashBlockSize, mapped_size - block_offset);
+            uint64_t block_hash   = util::hash::GenerateHash64(data + block_offset, block_size);
+
+            if (write_all || (block_hash != wrapper->mapped_block_hashes[i]))
+            {
+                wrapper->mapped_block_hashes[i] = block_hash;
+
+                // Concatenate modified blocks to write as large a range as possible with a single fill command.
+                if (!active_range)
+                {
+                    active_range = true;
+                    start_index  = i;
+                }
+            }
+            else if (active_range)
+            {
+                active_range = false;
+
+                size_t range_offset = start_index * kUnassistedHashBlockSize;
+                WriteFillMemoryCmd(wrapper->handle_id, range_offset, block_offset - range_offset, data);
+            }
+        }
+
+        if (active_range)
+        {
+            size_t range_offset = start_index * kUnassistedHashBlockSize;
+            WriteFillMemoryCmd(wrapper->handle_id, range_offset, mapped_size - range_offset, data);
+        }
+    }
+}
+
+void TraceManager::WriteAssistedMappedMemory(const DeviceMemoryWrapper* wrapper,
+                                             const VkMappedMemoryRange& memory_range)
+{
+    assert((wrapper != nullptr) && (wrapper->mapped_data != nullptr));
+    assert(memory_range.offset >= wrapper->mapped_offset);
+
+    // The mapped pointer already includes the mapped offset.  Because the memory range offset is relative to the start
+    // of the memory object, we need to adjust it to be relative to the start of the mapped pointer.
+    VkDeviceSize relative_offset = memory_range.offset - wrapper->mapped_offset;
+    VkDeviceSize size            = memory_range.size;
+    if (size == VK_WHOLE_SIZE)
+    {
+        assert(memory_range.offset <= wrapper->allocation_size);
+        size = wrapper->allocation_size - memory_range.offset;
+    }
+
+    WriteFillMemoryCmd(wrapper->handle_id, relative_offset, size, wrapper->mapped_data);
+}
+
 void TraceManager::WriteCreateHardwareBufferCmd(format::HandleId                                    memory_id,
                                                 AHardwareBuffer*                                    buffer,
                                                 const std::vector<format::HardwareBufferPlaneInfo>& plane_info)
@@ -801,6 +1280,7 @@ void TraceManager::WriteCreateHardwareBufferCmd(format::HandleId
         {
             std::lock_guard<std::mutex> lock(file_lock_);
 
+            ++current_frame_index_.block_count;
             bytes_written_ += file_stream_->Write(&create_buffer_cmd, sizeof(create_buffer_cmd));
 
             if (planes_size > 0)
@@ -845,6 +1325,7 @@ void TraceManager::WriteDestroyHardwareBufferCmd(AHardwareBuffer* buffer)
         {
             std::lock_guard<std::mutex> lock(file_lock_);
 
+            ++current_frame_index_.block_count;
             bytes_written_ += file_stream_->Write(&destroy_buffer_cmd, sizeof(destroy_buffer_cmd));
 
             if (force_file_flush_)
@@ -888,6 +1369,7 @@ void TraceManager::WriteSetDevicePropertiesCommand(format::HandleId
         {
             std::lock_guard<std::mutex> lock(file_lock_);
 
+            ++current_frame_index_.block_count;
             bytes_written_ += file_stream_->Write(&properties_cmd, sizeof(properties_cmd));
             bytes_written_ += file_stream_->Write(properties.deviceName, properties_cmd.device_name_len);
 
@@ -923,6 +1405,7 @@ void TraceManager::WriteSetDeviceMemoryPropertiesCommand(format::HandleId
         {
             std::lock_guard<std::mutex> lock(file_lock_);
 
+            ++current_frame_index_.block_count;
             bytes_written_ += file_stream_->Write(&memory_properties_cmd, sizeof(memory_properties_cmd));
 
             format::DeviceMemoryType type;
@@ -1358,6 +1841,107 @@ VkResult TraceManager::OverrideGetPhysicalDeviceToolPropertiesEXT(VkPhysicalDevi
     return result;
 }
 
+void TraceManager::SelectMemoryTrackingMode(VkDevice device, DeviceMemoryWrapper* wrapper)
+{
+    assert((device != VK_NULL_HANDLE) && (wrapper != nullptr));
+
+    auto                  device_wrapper = reinterpret_cast<DeviceWrapper*>(device);
+    VkMemoryPropertyFlags properties     = GetMemoryProperties(device_wrapper, wrapper->memory_type_index);
+
+    if ((properties & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)
+    {
+        // The application must flush writes to non-coherent memory, so only the flushed ranges need to be written.
+        wrapper->mapped_tracking_mode = CaptureSettings::MemoryTrackingMode::kAssisted;
+    }
+    else if (wrapper->mapped_tracking_mode == CaptureSettings::MemoryTrackingMode::kUnassisted)
+    {
+        // Periodically return to the page guard mode to determine if most of the memory is still being modified.
+        if (++wrapper->unassisted_map_count >= kAutoMemoryTrackingResampleMapCount)
+        {
+            wrapper->mapped_tracking_mode    = CaptureSettings::MemoryTrackingMode::kPageGuard;
+            wrapper->unassisted_map_count    = 0;
+            wrapper->tracked_process_count   = 0;
+            wrapper->tracked_modified_pages  = 0;
+            wrapper->tracked_processed_pages = 0;
+        }
+    }
+    else if (IsMostlyModified(wrapper))
+    {
+        // Most of the memory is modified between queue submits, so writing all of it is cheaper than processing the
+        // guard page violations.
+        wrapper->mapped_tracking_mode = CaptureSettings::MemoryTrackingMode::kUnassisted;
+        wrapper->unassisted_map_count = 0;
+    }
+    else
+    {
+        wrapper->mapped_tracking_mode = CaptureSettings::MemoryTrackingMode::kPageGuard;
+    }
+}
+
+void TraceManager::UpdateModifiedPageHistory(DeviceMemoryWrapper* wrapper)
+{
+    assert(wrapper != nullptr);
+
+    util::PageGuardManager* manager = util::PageGuardManager::Get();
+    assert(manager != nullptr);
+
+    uint64_t process_count   = 0;
+    uint64_t modified_pages  = 0;
+    uint64_t processed_pages = 0;
+
+    if (manager->TakeModifiedPageCounts(wrapper->handle_id, &process_count, &modified_pages, &processed_pages))
+    {
+        wrapper->tracked_process_count += process_count;
+        wrapper->tracked_modified_pages += modified_pages;
+        wrapper->tracked_processed_pages += processed_pages;
+    }
+}
+
+void TraceManager::SampleModifiedPageHistory()
+{
+    util::PageGuardManager* manager = util::PageGuardManager::Get();
+    assert(manager != nullptr);
+
+    std::lock_guard<std::mutex> lock(mapped_memory_lock_);
+
+    for (auto entry = page_guard_memory_.begin(); entry != page_guard_memory_.end();)
+    {
+        DeviceMemoryWrapper* wrapper = (*entry);
+
+        // Memory that remains mapped is sampled at each queue submit, so the history is available for the next map.
+        UpdateModifiedPageHistory(wrapper);
+
+        // Without shadow memory, the application writes directly to the mapped memory, so the mode can be switched
+        // while the memory is mapped.  Shadow memory mappings switch at the next map, as the application may still
+        // hold a pointer to the shadow memory.
+        if ((page_guard_memory_mode_ == kMemoryModeExternal) && IsMostlyModified(wrapper))
+        {
+            // No writes are lost when tracking is removed, as the next queue submit writes all of the mapped memory
+            // for the first unassisted write.
+            manager->RemoveTrackedMemory(wrapper->handle_id);
+
+            wrapper->mapped_tracking_mode = CaptureSettings::MemoryTrackingMode::kUnassisted;
+            wrapper->unassisted_map_count = 0;
+            mapped_memory_.insert(wrapper);
+
+            entry = page_guard_memory_.erase(entry);
+        }
+        else
+        {
+            ++entry;
+        }
+    }
+}
+
+bool TraceManager::IsMostlyModified(const DeviceMemoryWrapper* wrapper)
+{
+    assert(wrapper != nullptr);
+
+    return ((wrapper->tracked_process_count >= kAutoMemoryTrackingMinProcessCount) &&
+            ((wrapper->tracked_modified_pages * kAutoMemoryTrackingDirtyRatioDenominator) >=
+             (wrapper->tracked_processed_pages * kAutoMemoryTrackingDirtyRatioNumerator)));
+}
+
 VkMemoryPropertyFlags TraceManager::GetMemoryProperties(DeviceWrapper* device_wrapper, uint32_t memory_type_index)
 {
     PhysicalDeviceWrapper*                  physical_device_wrapper = device_wrapper->physical_device;
@@ -1466,8 +2050,7 @@ void TraceManager::ProcessImportAndroidHardwareBuffer(VkDevice         device,
             WriteCreateHardwareBufferCmd(memory_id, hardware_buffer, plane_info);
             WriteFillMemoryCmd(memory_id, 0, memory_wrapper->allocation_size, data);
 
-            if ((memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard) &&
-                page_guard_track_ahb_memory_)
+            if (IsPageGuardMemoryTrackingEnabled() && page_guard_track_ahb_memory_)
             {
                 GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, memory_wrapper->allocation_size);
 
@@ -1511,7 +2094,7 @@ void TraceManager::ReleaseAndroidHardwareBuffer(AHardwareBuffer* hardware_buffer
     auto entry = hardware_buffers_.find(hardware_buffer);
     if ((entry != hardware_buffers_.end()) && (--entry->second.reference_count == 0))
     {
-        if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard)
+        if (IsPageGuardMemoryTrackingEnabled())
         {
             util::PageGuardManager* manager = util::PageGuardManager::Get();
             assert(manager != nullptr);
@@ -1704,7 +2287,14 @@ void TraceManager::PostProcess_vkMapMemory(VkResult         result,
                 wrapper->mapped_size   = size;
             }
 
-            if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard
+            if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kAuto)
+            {
+                SelectMemoryTrackingMode(device, wrapper);
+            }
+
+            CaptureSettings::MemoryTrackingMode tracking_mode = GetMemoryTrackingMode(wrapper);
+
+            if (tracking_mode == CaptureSettings::MemoryTrackingMode::kPageGuard
 #if defined(VK_USE_PLATFORM_ANDROID_KHR)
                 // Hardware buffer memory is tracked separately, so VkDeviceMemory mappings should be ignored to avoid
                 // duplicate memory tracking entries.
@@ -1749,9 +2339,17 @@ void TraceManager::PostProcess_vkMapMemory(VkResult         result,
                                                           wrapper->shadow_allocation,
                                                           use_shadow_memory,
                                                           use_write_watch);
+
+                    if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kAuto)
+                    {
+                        // Need to keep track of page guard mapped memory so the modified page history can be sampled
+                        // at queue submit.
+                        std::lock_guard<std::mutex> lock(mapped_memory_lock_);
+                        page_guard_memory_.insert(wrapper);
+                    }
                 }
             }
-            else if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kUnassisted)
+            else if (tracking_mode == CaptureSettings::MemoryTrackingMode::kUnassisted)
             {
                 // Need to keep track of mapped memory objects so memory content can be written at queue submit.
                 std::lock_guard<std::mutex> lock(mapped_memory_lock_);
@@ -1766,7 +2364,7 @@ void TraceManager::PostProcess_vkMapMemory(VkResult         result,
             GFXRECON_LOG_WARNING("VkDeviceMemory object with handle = %" PRIx64 " has been mapped more than once",
                                  memory);
 
-            if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard)
+            if (GetMemoryTrackingMode(wrapper) == CaptureSettings::MemoryTrackingMode::kPageGuard)
             {
                 assert((wrapper->mapped_offset == offset) && (wrapper->mapped_size == size));
 
@@ -1833,21 +2431,46 @@ void TraceManager::PreProcess_vkFlushMappedMemoryRanges(VkDevice
 
                 if ((current_memory_wrapper != nullptr) && (current_memory_wrapper->mapped_data != nullptr))
                 {
-                    assert(pMemoryRanges[i].offset >= current_memory_wrapper->mapped_offset);
-
-                    // The mapped pointer already includes the mapped offset.  Because the memory range
-                    // offset is relative to the start of the memory object, we need to adjust it to be
-                    // relative to the start of the mapped pointer.
-                    VkDeviceSize relative_offset = pMemoryRanges[i].offset - current_memory_wrapper->mapped_offset;
-                    VkDeviceSize size            = pMemoryRanges[i].size;
-                    if (size == VK_WHOLE_SIZE)
+                    WriteAssistedMappedMemory(current_memory_wrapper, pMemoryRanges[i]);
+                }
+            }
+        }
+        else if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kAuto)
+        {
+            const DeviceMemoryWrapper* processed_memory_wrapper = nullptr;
+            util::PageGuardManager*    manager                  = util::PageGuardManager::Get();
+            assert(manager != nullptr);
+
+            for (uint32_t i = 0; i < memoryRangeCount; ++i)
+            {
+                auto current_memory_wrapper = reinterpret_cast<const DeviceMemoryWrapper*>(pMemoryRanges[i].memory);
+
+                if ((current_memory_wrapper != nullptr) && (current_memory_wrapper->mapped_data != nullptr))
+                {
+                    if (current_memory_wrapper->mapped_tracking_mode == CaptureSettings::MemoryTrackingMode::kAssisted)
                     {
-                        assert(pMemoryRanges[i].offset <= current_memory_wrapper->allocation_size);
-                        size = current_memory_wrapper->allocation_size - pMemoryRanges[i].offset;
+                        WriteAssistedMappedMemory(current_memory_wrapper, pMemoryRanges[i]);
                     }
+                    else if ((current_memory_wrapper->mapped_tracking_mode ==
+                              CaptureSettings::MemoryTrackingMode::kPageGuard) &&
+                             (current_memory_wrapper != processed_memory_wrapper))
+                    {
+                        // Currently processing all dirty pages for the mapped memory, so filter multiple ranges from
+                        // the same object.
+                        processed_memory_wrapper = current_memory_wrapper;
 
-                    WriteFillMemoryCmd(
-                        current_memory_wrapper->handle_id, relative_offset, size, current_memory_wrapper->mapped_data);
+                        manager->ProcessMemoryEntry(
+                            current_memory_wrapper->handle_id,
+                            [this](uint64_t memory_id, void* start_address, size_t offset, size_t size) {
+                                WriteFillMemoryCmd(memory_id, offset, size, start_address);
+                            });
+                    }
+
+                    // Memory using the unassisted mode is written on unmap and queue submit.
+                }
+                else
+                {
+                    GFXRECON_LOG_WARNING("vkFlushMappedMemoryRanges called for memory that is not mapped");
                 }
             }
         }
@@ -1861,7 +2484,9 @@ void TraceManager::PreProcess_vkUnmapMemory(VkDevice device, VkDeviceMemory memo
 
     if (wrapper->mapped_data != nullptr)
     {
-        if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard)
+        CaptureSettings::MemoryTrackingMode tracking_mode = GetMemoryTrackingMode(wrapper);
+
+        if (tracking_mode == CaptureSettings::MemoryTrackingMode::kPageGuard)
         {
             util::PageGuardManager* manager = util::PageGuardManager::Get();
             assert(manager != nullptr);
@@ -1871,25 +2496,24 @@ void TraceManager::PreProcess_vkUnmapMemory(VkDevice device, VkDeviceMemory memo
                                             WriteFillMemoryCmd(memory_id, offset, size, start_address);
                                         });
 
+            if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kAuto)
+            {
+                std::lock_guard<std::mutex> lock(mapped_memory_lock_);
+
+                UpdateModifiedPageHistory(wrapper);
+                page_guard_memory_.erase(wrapper);
+            }
+
             manager->RemoveTrackedMemory(wrapper->handle_id);
         }
-        else if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kUnassisted)
+        else if (tracking_mode == CaptureSettings::MemoryTrackingMode::kUnassisted)
         {
-            VkDeviceSize size = wrapper->mapped_size;
-            if (size == VK_WHOLE_SIZE)
-            {
-                assert(wrapper->mapped_offset <= wrapper->allocation_size);
-                size = wrapper->allocation_size - wrapper->mapped_offset;
-            }
+            std::lock_guard<std::mutex> lock(mapped_memory_lock_);
 
-            // Write the entire mapped region.
-            // We set offset to 0, because the pointer returned by vkMapMemory already includes the offset.
-            WriteFillMemoryCmd(wrapper->handle_id, 0, size, wrapper->mapped_data);
+            WriteUnassistedMappedMemory(wrapper);
 
-            {
-                std::lock_guard<std::mutex> lock(mapped_memory_lock_);
-                mapped_memory_.erase(wrapper);
-            }
+            wrapper->mapped_block_hashes.clear();
+            mapped_memory_.erase(wrapper);
         }
 
         if ((capture_mode_ & kModeTrack) == kModeTrack)
@@ -1924,14 +2548,30 @@ void TraceManager::PreProcess_vkFreeMemory(VkDevice                     device,
     {
         auto wrapper = reinterpret_cast<DeviceMemoryWrapper*>(memory);
 
-        if ((memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard) &&
-            (wrapper->mapped_data != nullptr))
+        if (wrapper->mapped_data != nullptr)
         {
-            util::PageGuardManager* manager = util::PageGuardManager::Get();
-            assert(manager != nullptr);
+            CaptureSettings::MemoryTrackingMode tracking_mode = GetMemoryTrackingMode(wrapper);
 
-            // Remove memory tracking.
-            manager->RemoveTrackedMemory(wrapper->handle_id);
+            if (tracking_mode == CaptureSettings::MemoryTrackingMode::kPageGuard)
+            {
+                util::PageGuardManager* manager = util::PageGuardManager::Get();
+                assert(manager != nullptr);
+
+                // Remove memory tracking.
+                manager->RemoveTrackedMemory(wrapper->handle_id);
+
+                if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kAuto)
+                {
+                    std::lock_guard<std::mutex> lock(mapped_memory_lock_);
+                    page_guard_memory_.erase(wrapper);
+                }
+            }
+            else if (tracking_mode == CaptureSettings::MemoryTrackingMode::kUnassisted)
+            {
+                // Memory that is freed while mapped is implicitly unmapped.
+                std::lock_guard<std::mutex> lock(mapped_memory_lock_);
+                mapped_memory_.erase(wrapper);
+            }
         }
     }
 }
@@ -1948,7 +2588,7 @@ void TraceManager::PostProcess_vkFreeMemory(VkDevice                     device,
         // Destroy external resources.
         auto wrapper = reinterpret_cast<DeviceMemoryWrapper*>(memory);
 
-        if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard)
+        if (IsPageGuardMemoryTrackingEnabled())
         {
             util::PageGuardManager* manager = util::PageGuardManager::Get();
             assert(manager != nullptr);
@@ -1984,7 +2624,7 @@ void TraceManager::PreProcess_vkQueueSubmit(VkQueue             queue,
     GFXRECON_UNREFERENCED_PARAMETER(pSubmits);
     GFXRECON_UNREFERENCED_PARAMETER(fence);
 
-    if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard)
+    if (IsPageGuardMemoryTrackingEnabled())
     {
         util::PageGuardManager* manager = util::PageGuardManager::Get();
         assert(manager != nullptr);
@@ -1993,24 +2633,25 @@ void TraceManager::PreProcess_vkQueueSubmit(VkQueue             queue,
             WriteFillMemoryCmd(memory_id, offset, size, start_address);
         });
     }
-    else if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kUnassisted)
+
+    if ((memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kUnassisted) ||
+        (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kAuto))
     {
         std::lock_guard<std::mutex> lock(mapped_memory_lock_);
 
         for (auto wrapper : mapped_memory_)
         {
-            VkDeviceSize size = wrapper->mapped_size;
-            if (size == VK_WHOLE_SIZE)
-            {
-                assert(wrapper->mapped_offset <= wrapper->allocation_size);
-                size = wrapper->allocation_size - wrapper->mapped_offset;
-            }
-
-            // If the memory is mapped, write the entire mapped region.
-            // We set offset to 0, because the pointer returned by vkMapMemory already includes the offset.
-            WriteFillMemoryCmd(wrapper->handle_id, 0, size, wrapper->mapped_data);
+            // If the memory is mapped, write the mapped region.
+            WriteUnassistedMappedMemory(wrapper);
         }
     }
+
+    if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kAuto)
+    {
+        // Sampled after the unassisted writes, so memory that switches to the unassisted mode is first written by the
+        // next queue submit.
+        SampleModifiedPageHistory();
+    }
 }
 
 void TraceManager::PreProcess_vkCreateDescriptorUpdateTemplate(VkResult                                    result,
@@ -33,6 +33,7 @@
 #include "util/compressor.h"
 #include "util/defines.h"
 #include "util/file_output_stream.h"
+#include "util/hash.h"
 #include "util/keyboard.h"
 #include "util/memory_output_stream.h"
 
@@ -40,6 +41,7 @@
 
 #include <atomic>
 #include <cassert>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <set>
@@ -494,8 +496,7 @@ class TraceManager
         GFXRECON_UNREFERENCED_PARAMETER(device);
         GFXRECON_UNREFERENCED_PARAMETER(buffer);
 
-        if ((memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard) &&
-            page_guard_align_buffer_sizes_ && (pMemoryRequirements != nullptr))
+        if (IsPageGuardMemoryTrackingEnabled() && page_guard_align_buffer_sizes_ && (pMemoryRequirements != nullptr))
         {
             util::PageGuardManager* manager = util::PageGuardManager::Get();
             assert(manager != nullptr);
@@ -516,8 +517,7 @@ class TraceManager
         GFXRECON_UNREFERENCED_PARAMETER(device);
         GFXRECON_UNREFERENCED_PARAMETER(pInfo);
 
-        if ((memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard) &&
-            page_guard_align_buffer_sizes_ && (pMemoryRequirements != nullptr))
+        if (IsPageGuardMemoryTrackingEnabled() && page_guard_align_buffer_sizes_ && (pMemoryRequirements != nullptr))
         {
             util::PageGuardManager* manager = util::PageGuardManager::Get();
             assert(manager != nullptr);
@@ -929,6 +929,37 @@ class TraceManager
 
     typedef std::unordered_map<AHardwareBuffer*, HardwareBufferInfo> HardwareBufferMap;
 
+    // Identifies fill memory data by its uncompressed size and a 128-bit hash of its content.  The data is not compared
+    // before it is replaced with a reference, so two different payloads with the same size and hash would replay the
+    // wrong data, but the probability of a collision for a 128-bit hash is negligible for any realistic capture.
+    struct FillMemoryPayloadKey
+    {
+        uint64_t            size;
+        util::hash::Hash128 hash;
+
+        bool operator==(const FillMemoryPayloadKey& other) const
+        {
+            return (size == other.size) && (hash == other.hash);
+        }
+    };
+
+    struct FillMemoryPayloadKeyHash
+    {
+        size_t operator()(const FillMemoryPayloadKey& key) const { return static_cast<size_t>(key.hash.low); }
+    };
+
+    // Maps fill memory data to the capture file offset of the fill memory command containing the data.
+    typedef std::unordered_map<FillMemoryPayloadKey, uint64_t, FillMemoryPayloadKeyHash> FillMemoryPayloadMap;
+
+    struct FillMemoryStatistics
+    {
+        uint64_t fill_count{ 0 };    // Number of fill memory commands written for the memory object.
+        uint64_t fill_bytes{ 0 };    // Total size of the memory ranges written by the fill memory commands.
+        uint64_t written_bytes{ 0 }; // Total size of the fill memory command blocks written to the capture file.
+    };
+
+    typedef std::unordered_map<format::HandleId, FillMemoryStatistics> FillMemoryStatisticsMap;
+
   private:
     ThreadData* GetThreadData()
     {
@@ -944,6 +975,7 @@ class TraceManager
     void        ActivateTrimming();
 
     void WriteFileHeader();
+    void WriteFrameIndex();
     void BuildOptionList(const format::EnabledOptions&        enabled_options,
                          std::vector<format::FileOptionPair>* option_list);
 
@@ -951,6 +983,14 @@ class TraceManager
 
     void WriteResizeWindowCmd(format::HandleId surface_id, uint32_t width, uint32_t height);
     void WriteFillMemoryCmd(format::HandleId memory_id, VkDeviceSize offset, VkDeviceSize size, const void* data);
+    bool WriteFillMemoryReferenceCmd(format::HandleId            memory_id,
+                                     VkDeviceSize                offset,
+                                     const FillMemoryPayloadKey& payload_key);
+    void AddFillMemoryPayload(const FillMemoryPayloadKey& payload_key, int64_t block_offset);
+    void UpdateFillMemoryStatistics(format::HandleId memory_id, uint64_t fill_size, uint64_t written_size);
+    void LogMemoryTrackingStatistics();
+    void WriteUnassistedMappedMemory(DeviceMemoryWrapper* wrapper);
+    void WriteAssistedMappedMemory(const DeviceMemoryWrapper* wrapper, const VkMappedMemoryRange& memory_range);
     void WriteCreateHardwareBufferCmd(format::HandleId                                    memory_id,
                                       AHardwareBuffer*                                    buffer,
                                       const std::vector<format::HardwareBufferPlaneInfo>& plane_info);
@@ -969,6 +1009,28 @@ class TraceManager
 
     VkMemoryPropertyFlags GetMemoryProperties(DeviceWrapper* device_wrapper, uint32_t memory_type_index);
 
+    // Returns true when the page guard manager tracks modifications to some or all mapped memory.
+    bool IsPageGuardMemoryTrackingEnabled() const
+    {
+        return ((memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard) ||
+                (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kAuto));
+    }
+
+    // Returns the memory tracking mode to use for the mapped memory object.
+    CaptureSettings::MemoryTrackingMode GetMemoryTrackingMode(const DeviceMemoryWrapper* wrapper) const
+    {
+        assert(wrapper != nullptr);
+        return (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kAuto) ? wrapper->mapped_tracking_mode
+                                                                                     : memory_tracking_mode_;
+    }
+
+    void SelectMemoryTrackingMode(VkDevice device, DeviceMemoryWrapper* wrapper);
+    void UpdateModifiedPageHistory(DeviceMemoryWrapper* wrapper);
+    void SampleModifiedPageHistory();
+
+    // Returns true when most of the pages of the memory object were modified each time modified pages were processed.
+    static bool IsMostlyModified(const DeviceMemoryWrapper* wrapper);
+
     const VkImportAndroidHardwareBufferInfoANDROID*
     FindAllocateMemoryExtensions(const VkMemoryAllocateInfo* allocate_info);
 
@@ -993,9 +1055,22 @@ class TraceManager
     CaptureSettings::MemoryTrackingMode             memory_tracking_mode_;
     bool                                            page_guard_align_buffer_sizes_;
     bool                                            page_guard_track_ahb_memory_;
+    bool                                            unassisted_hash_blocks_;
+    bool                                            fill_memory_deduplication_;
+    FillMemoryPayloadMap                            fill_memory_payloads_;      // Protected by file_lock_.
+    std::deque<FillMemoryPayloadKey>                fill_memory_payload_order_; // Protected by file_lock_.
+    bool                                            memory_tracking_stats_;
+    uint32_t                                        memory_tracking_stats_frames_;
+    uint32_t                                        memory_tracking_stats_frame_count_;
+    FillMemoryStatisticsMap                         fill_memory_statistics_; // Protected by file_lock_.
+    bool                                            frame_index_enabled_;
+    std::vector<format::FrameIndexEntry>            frame_index_;         // Protected by file_lock_.
+    std::vector<format::StateMarkerIndexEntry>      state_marker_index_;  // Protected by file_lock_.
+    format::FrameIndexEntry                         current_frame_index_; // Protected by file_lock_.
     PageGuardMemoryMode                             page_guard_memory_mode_;
     std::mutex                                      mapped_memory_lock_;
     std::set<DeviceMemoryWrapper*>                  mapped_memory_; // Track mapped memory for unassisted tracking mode.
+    std::set<DeviceMemoryWrapper*>                  page_guard_memory_; // Track page guard mapped memory for auto mode.
     bool                                            trim_enabled_;
     std::vector<CaptureSettings::TrimRange>         trim_ranges_;
     std::string                                     trim_key_;
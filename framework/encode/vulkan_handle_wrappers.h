@@ -17,6 +17,7 @@
 #ifndef GFXRECON_ENCODE_VULKAN_HANDLE_WRAPPERS_H
 #define GFXRECON_ENCODE_VULKAN_HANDLE_WRAPPERS_H
 
+#include "encode/capture_settings.h"
 #include "encode/descriptor_update_template_info.h"
 #include "encode/vulkan_state_info.h"
 #include "format/format.h"
@@ -154,6 +155,18 @@ struct DeviceMemoryWrapper : public HandleWrapper<VkDeviceMemory>
     uintptr_t        shadow_allocation{ util::PageGuardManager::kNullShadowHandle };
     AHardwareBuffer* hardware_buffer{ nullptr };
     format::HandleId hardware_buffer_memory_id{ 0 };
+
+    // Hashes of the mapped memory blocks that were last written to the capture file, for the unassisted memory tracking
+    // mode with block hashing.  Empty when the mapped memory has not been written since it was mapped.
+    std::vector<uint64_t> mapped_block_hashes;
+
+    // Memory tracking mode selected for the current mapping by the automatic memory tracking mode, with the modified
+    // page counts from previous page guard tracked mappings that are used to select the mode.
+    CaptureSettings::MemoryTrackingMode mapped_tracking_mode{ CaptureSettings::MemoryTrackingMode::kPageGuard };
+    uint64_t                            tracked_process_count{ 0 };
+    uint64_t                            tracked_modified_pages{ 0 };
+    uint64_t                            tracked_processed_pages{ 0 };
+    uint32_t                            unassisted_map_count{ 0 };
 };
 
 struct BufferWrapper : public HandleWrapper<VkBuffer>
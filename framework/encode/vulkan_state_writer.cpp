@@ -78,7 +78,7 @@ VulkanStateWriter::VulkanStateWriter(util::FileOutputStream* output_stream,
                                      util::Compressor*       compressor,
                                      format::ThreadId        thread_id) :
     output_stream_(output_stream),
-    compressor_(compressor), thread_id_(thread_id), encoder_(&parameter_stream_)
+    compressor_(compressor), thread_id_(thread_id), encoder_(&parameter_stream_), blocks_written_(0)
 {
     assert(output_stream != nullptr);
     assert(compressor != nullptr);
@@ -96,6 +96,7 @@ void VulkanStateWriter::WriteState(const VulkanStateTable& state_table, uint64_t
     marker.marker_type = format::kBeginMarker;
     marker.frame_number = frame_number;
     output_stream_->Write(&marker, sizeof(marker));
+    ++blocks_written_;
 
     // Instance, device, and queue creation.
     StandardCreateWrite<InstanceWrapper>(state_table);
@@ -168,6 +169,7 @@ void VulkanStateWriter::WriteState(const VulkanStateTable& state_table, uint64_t
 
     marker.marker_type = format::kEndMarker;
     output_stream_->Write(&marker, sizeof(marker));
+    ++blocks_written_;
 
     // clang-format on
 }
@@ -1049,6 +1051,7 @@ void VulkanStateWriter::ProcessBufferMemory(const DeviceWrapper*
                 (sizeof(upload_cmd) - sizeof(upload_cmd.meta_header.block_header)) + data_size;
 
             output_stream_->Write(&upload_cmd, sizeof(upload_cmd));
+            ++blocks_written_;
             output_stream_->Write(bytes, data_size);
 
             if (snapshot_entry.need_staging_copy)
@@ -1335,6 +1338,7 @@ void VulkanStateWriter::ProcessImageMemory(const DeviceWrapper*
             upload_cmd.meta_header.block_header.size += levels_size + data_size;
 
             output_stream_->Write(&upload_cmd, sizeof(upload_cmd));
+            ++blocks_written_;
             output_stream_->Write(snapshot_entry.level_sizes.data(), levels_size);
             output_stream_->Write(bytes, data_size);
 
@@ -1358,6 +1362,7 @@ void VulkanStateWriter::ProcessImageMemory(const DeviceWrapper*
             upload_cmd.level_count = 0;
 
             output_stream_->Write(&upload_cmd, sizeof(upload_cmd));
+            ++blocks_written_;
         }
     }
 }
@@ -1621,6 +1626,7 @@ void VulkanStateWriter::WriteResourceMemoryState(const VulkanStateTable& state_t
             begin_cmd.max_copy_size                 = max_staging_copy_size;
 
             output_stream_->Write(&begin_cmd, sizeof(begin_cmd));
+            ++blocks_written_;
 
             for (const auto& queue_family_entry : resource_entry.second)
             {
@@ -1682,6 +1688,7 @@ void VulkanStateWriter::WriteResourceMemoryState(const VulkanStateTable& state_t
             end_cmd.device_id                     = device_wrapper->handle_id;
 
             output_stream_->Write(&end_cmd, sizeof(end_cmd));
+            ++blocks_written_;
 
             if (max_staging_copy_size > 0)
             {
@@ -1749,6 +1756,7 @@ void VulkanStateWriter::WriteSwapchainImageState(const VulkanStateTable& state_t
         header.image_info_count           = static_cast<uint32_t>(wrapper->child_images.size());
 
         output_stream_->Write(&header, sizeof(header));
+        ++blocks_written_;
 
         for (size_t i = 0; i < wrapper->child_images.size(); ++i)
         {
@@ -2373,6 +2381,7 @@ void VulkanStateWriter::WriteFunctionCall(format::ApiCallId call_id, util::Memor
 
     // Write appropriate function call block header.
     output_stream_->Write(header_pointer, header_size);
+    ++blocks_written_;
 
     // Write parameter data.
     output_stream_->Write(data_pointer, data_size);
@@ -2419,6 +2428,7 @@ void VulkanStateWriter::WriteFillMemoryCmd(format::HandleId memory_id,
                                              sizeof(fill_cmd.memory_size) + write_size;
 
     output_stream_->Write(&fill_cmd, sizeof(fill_cmd));
+    ++blocks_written_;
     output_stream_->Write(write_address, write_size);
 }
 
@@ -2439,6 +2449,7 @@ void VulkanStateWriter::WriteResizeWindowCmd(format::HandleId surface_id, uint32
     resize_cmd.height     = height;
 
     output_stream_->Write(&resize_cmd, sizeof(resize_cmd));
+    ++blocks_written_;
 }
 
 // TODO: This is the same code used by TraceManager to write command data. It could be moved to a format
@@ -2486,6 +2497,7 @@ void VulkanStateWriter::WriteCreateHardwareBufferCmd(format::HandleId memory_id,
     }
 
     output_stream_->Write(&create_buffer_cmd, sizeof(create_buffer_cmd));
+    ++blocks_written_;
 
     if (planes_size > 0)
     {
@@ -2521,6 +2533,7 @@ void VulkanStateWriter::WriteSetDevicePropertiesCommand(format::HandleId
     properties_cmd.device_name_len = device_name_len;
 
     output_stream_->Write(&properties_cmd, sizeof(properties_cmd));
+    ++blocks_written_;
     output_stream_->Write(properties.deviceName, properties_cmd.device_name_len);
 }
 
@@ -2541,6 +2554,7 @@ void VulkanStateWriter::WriteSetDeviceMemoryPropertiesCommand(format::HandleId p
     memory_properties_cmd.memory_heap_count          = memory_properties.memoryHeapCount;
 
     output_stream_->Write(&memory_properties_cmd, sizeof(memory_properties_cmd));
+    ++blocks_written_;
 
     format::DeviceMemoryType type;
     for (uint32_t i = 0; i < memory_properties.memoryTypeCount; ++i)
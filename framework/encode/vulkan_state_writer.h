@@ -46,6 +46,9 @@ class VulkanStateWriter
     // Returns number of bytes written to the output_stream.
     void WriteState(const VulkanStateTable& state_table, uint64_t frame_number);
 
+    // Returns the number of blocks written to the output stream.
+    uint64_t GetBlockCount() const { return blocks_written_; }
+
   private:
     // Data structures for processing resource memory snapshots.
     struct BufferSnapshotInfo
@@ -344,6 +347,7 @@ class VulkanStateWriter
     format::ThreadId         thread_id_;
     util::MemoryOutputStream parameter_stream_;
     ParameterEncoder         encoder_;
+    uint64_t                 blocks_written_;
 };
 
 GFXRECON_END_NAMESPACE(encode)
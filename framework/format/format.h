@@ -26,6 +26,8 @@
 #include <type_traits>
 
 #define GFXRECON_FOURCC GFXRECON_MAKE_FOURCC('G', 'F', 'X', 'R')
+#define GFXRECON_FRAME_INDEX_FOURCC GFXRECON_MAKE_FOURCC('G', 'F', 'X', 'I')
+#define GFXRECON_BLOCK_INDEX_FOURCC GFXRECON_MAKE_FOURCC('G', 'F', 'X', 'B')
 #define GFXRECON_FILE_EXTENSION ".gfxr"
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -87,7 +89,10 @@ enum MetaDataType : uint32_t
     kCreateHardwareBufferCommand        = 9,
     kDestroyHardwareBufferCommand       = 10,
     kSetDevicePropertiesCommand         = 11,
-    kSetDeviceMemoryPropertiesCommand   = 12
+    kSetDeviceMemoryPropertiesCommand   = 12,
+    kFillMemoryReferenceCommand         = 13,
+    kFrameIndexCommand                  = 14,
+    kFrameIndexLocatorCommand           = 15
 };
 
 enum CompressionType : uint32_t
@@ -200,6 +205,18 @@ struct FillMemoryCommandHeader
     uint64_t memory_size;   // Uncompressed size of the data encoded after the header.
 };
 
+// Not a header because this command does not include a variable length data payload.
+// All of the command data is present in the struct.
+struct FillMemoryReferenceCommand
+{
+    MetaDataHeader   meta_header;
+    format::ThreadId thread_id;
+    HandleId         memory_id;
+    uint64_t         memory_offset; // Offset from the start of the mapped pointer, not the start of the memory object.
+    uint64_t         memory_size;   // Uncompressed size of the referenced fill memory data.
+    uint64_t         block_offset;  // File offset of the kFillMemoryCommand block with the data to write to memory.
+};
+
 struct DisplayMessageCommandHeader
 {
     MetaDataHeader   meta_header;
@@ -346,6 +363,60 @@ struct SetDevicePropertiesCommand
     uint32_t         device_name_len;
 };
 
+// The frame index is written at the end of the capture file, followed by a fixed size locator block that can be read
+// from the end of the file to find the index.  The index header is followed by an array of FrameIndexEntry structures
+// with one entry for each frame in the file, and then an array of StateMarkerIndexEntry structures.
+struct FrameIndexCommandHeader
+{
+    MetaDataHeader meta_header;
+    uint64_t       frame_count;
+    uint64_t       state_marker_count;
+};
+
+struct FrameIndexEntry
+{
+    uint64_t block_offset; // File offset of the first block of the frame.
+    uint64_t block_count;  // Number of blocks in the frame, including the frame delimiter.
+};
+
+struct StateMarkerIndexEntry
+{
+    uint64_t   block_offset; // File offset of the state marker block.
+    uint64_t   frame_number; // Frame number of the state marker.
+    MarkerType marker_type;
+};
+
+// Not a header because this command does not include a variable length data payload.
+// All of the command data is present in the struct.
+struct FrameIndexLocatorCommand
+{
+    MetaDataHeader meta_header;
+    uint64_t       index_offset; // File offset of the kFrameIndexCommand block.
+    uint32_t       fourcc;       // Identifies a valid locator when read from the end of the file.
+};
+
+// Sidecar block index file, written by the gfxrecon-index tool, which describes every block of a capture file.  The
+// header is followed by an array of BlockIndexEntry structures, with one entry for each block in file order.
+struct BlockIndexFileHeader
+{
+    uint32_t fourcc;
+    uint32_t version;
+    uint64_t capture_file_size; // Size of the indexed capture file, used to detect an out of date index.
+    uint64_t block_count;
+    uint64_t frame_count;
+};
+
+struct BlockIndexEntry
+{
+    uint64_t  block_offset;      // File offset of the block header.
+    uint64_t  block_size;        // Size of the block body, as stored in the file.
+    uint64_t  uncompressed_size; // Size of the block body after decompression.
+    ThreadId  thread_id;         // Zero for blocks that do not contain a thread ID.
+    uint32_t  frame_number;      // Frame containing the block, counted from the start of the file.
+    BlockType block_type;
+    uint32_t  block_id; // ApiCallId, MetaDataType, or MarkerType of the block, depending on the block type.
+};
+
 #pragma pack(pop)
 
 GFXRECON_END_NAMESPACE(format)
@@ -82,5 +82,72 @@ util::Compressor* CreateCompressor(CompressionType type)
     return compressor;
 }
 
+bool IsFrameDelimiter(ApiCallId call_id)
+{
+    // TODO: IDs of API calls that were treated as frame delimiters by the GFXReconstruct layer should be in the capture
+    // file header.
+    return (call_id == ApiCallId::ApiCall_vkQueuePresentKHR);
+}
+
+const char* GetBlockTypeName(BlockType type)
+{
+    switch (RemoveCompressedBlockBit(type))
+    {
+        case BlockType::kFrameMarkerBlock:
+            return "Frame marker";
+        case BlockType::kStateMarkerBlock:
+            return "State marker";
+        case BlockType::kMetaDataBlock:
+            return "Meta-data";
+        case BlockType::kFunctionCallBlock:
+            return "Function call";
+        default:
+            break;
+    }
+
+    return "Unknown";
+}
+
+const char* GetMetaDataTypeName(MetaDataType type)
+{
+    switch (type)
+    {
+        case MetaDataType::kDisplayMessageCommand:
+            return "DisplayMessage";
+        case MetaDataType::kFillMemoryCommand:
+            return "FillMemory";
+        case MetaDataType::kResizeWindowCommand:
+            return "ResizeWindow";
+        case MetaDataType::kSetSwapchainImageStateCommand:
+            return "SetSwapchainImageState";
+        case MetaDataType::kBeginResourceInitCommand:
+            return "BeginResourceInit";
+        case MetaDataType::kEndResourceInitCommand:
+            return "EndResourceInit";
+        case MetaDataType::kInitBufferCommand:
+            return "InitBuffer";
+        case MetaDataType::kInitImageCommand:
+            return "InitImage";
+        case MetaDataType::kCreateHardwareBufferCommand:
+            return "CreateHardwareBuffer";
+        case MetaDataType::kDestroyHardwareBufferCommand:
+            return "DestroyHardwareBuffer";
+        case MetaDataType::kSetDevicePropertiesCommand:
+            return "SetDeviceProperties";
+        case MetaDataType::kSetDeviceMemoryPropertiesCommand:
+            return "SetDeviceMemoryProperties";
+        case MetaDataType::kFillMemoryReferenceCommand:
+            return "FillMemoryReference";
+        case MetaDataType::kFrameIndexCommand:
+            return "FrameIndex";
+        case MetaDataType::kFrameIndexLocatorCommand:
+            return "FrameIndexLocator";
+        default:
+            break;
+    }
+
+    return "Unknown";
+}
+
 GFXRECON_END_NAMESPACE(format)
 GFXRECON_END_NAMESPACE(gfxrecon)
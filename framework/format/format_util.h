@@ -72,6 +72,19 @@ bool ValidateFileHeader(const FileHeader& header);
 // Utilities for object creation.
 util::Compressor* CreateCompressor(CompressionType type);
 
+// Returns true for the API calls that end a frame, which are used to assign frame numbers to the blocks of a capture
+// file.
+bool IsFrameDelimiter(ApiCallId call_id);
+
+// Utilities for reporting.  Returns "Unknown" for API call IDs that are not recognized.  The API call name
+// table is generated from the Vulkan registry; see generated/generated_vulkan_api_call_names.cpp.
+const char* GetApiCallName(ApiCallId call_id);
+
+// Returns the same name for the compressed and uncompressed versions of a block type.
+const char* GetBlockTypeName(BlockType type);
+
+const char* GetMetaDataTypeName(MetaDataType type);
+
 GFXRECON_END_NAMESPACE(format)
 GFXRECON_END_NAMESPACE(gfxrecon)
 
@@ -50,7 +50,8 @@ generate_targets = [
     'generated_vulkan_replay_consumer.h',
     'generated_vulkan_replay_consumer.cpp',
     'generated_vulkan_struct_handle_mappers.h',
-    'generated_vulkan_struct_handle_mappers.cpp'
+    'generated_vulkan_struct_handle_mappers.cpp',
+    'generated_vulkan_api_call_names.cpp'
 ]
 
 if __name__ == '__main__':
@@ -0,0 +1,932 @@
+/*
+** Copyright (c) 2018-2020 Valve Corporation
+** Copyright (c) 2018-2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+/*
+** This file is generated from the Khronos Vulkan XML API Registry.
+**
+*/
+
+#include "format/api_call_id.h"
+#include "format/format_util.h"
+#include "util/defines.h"
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(format)
+
+const char* GetApiCallName(ApiCallId call_id)
+{
+    switch (call_id)
+    {
+        case ApiCallId::ApiCall_vkCreateInstance:
+            return "vkCreateInstance";
+        case ApiCallId::ApiCall_vkDestroyInstance:
+            return "vkDestroyInstance";
+        case ApiCallId::ApiCall_vkEnumeratePhysicalDevices:
+            return "vkEnumeratePhysicalDevices";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceFeatures:
+            return "vkGetPhysicalDeviceFeatures";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceFormatProperties:
+            return "vkGetPhysicalDeviceFormatProperties";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceImageFormatProperties:
+            return "vkGetPhysicalDeviceImageFormatProperties";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceProperties:
+            return "vkGetPhysicalDeviceProperties";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyProperties:
+            return "vkGetPhysicalDeviceQueueFamilyProperties";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceMemoryProperties:
+            return "vkGetPhysicalDeviceMemoryProperties";
+        case ApiCallId::ApiCall_vkGetInstanceProcAddr:
+            return "vkGetInstanceProcAddr";
+        case ApiCallId::ApiCall_vkGetDeviceProcAddr:
+            return "vkGetDeviceProcAddr";
+        case ApiCallId::ApiCall_vkCreateDevice:
+            return "vkCreateDevice";
+        case ApiCallId::ApiCall_vkDestroyDevice:
+            return "vkDestroyDevice";
+        case ApiCallId::ApiCall_vkEnumerateInstanceExtensionProperties:
+            return "vkEnumerateInstanceExtensionProperties";
+        case ApiCallId::ApiCall_vkEnumerateDeviceExtensionProperties:
+            return "vkEnumerateDeviceExtensionProperties";
+        case ApiCallId::ApiCall_vkEnumerateInstanceLayerProperties:
+            return "vkEnumerateInstanceLayerProperties";
+        case ApiCallId::ApiCall_vkEnumerateDeviceLayerProperties:
+            return "vkEnumerateDeviceLayerProperties";
+        case ApiCallId::ApiCall_vkGetDeviceQueue:
+            return "vkGetDeviceQueue";
+        case ApiCallId::ApiCall_vkQueueSubmit:
+            return "vkQueueSubmit";
+        case ApiCallId::ApiCall_vkQueueWaitIdle:
+            return "vkQueueWaitIdle";
+        case ApiCallId::ApiCall_vkDeviceWaitIdle:
+            return "vkDeviceWaitIdle";
+        case ApiCallId::ApiCall_vkAllocateMemory:
+            return "vkAllocateMemory";
+        case ApiCallId::ApiCall_vkFreeMemory:
+            return "vkFreeMemory";
+        case ApiCallId::ApiCall_vkMapMemory:
+            return "vkMapMemory";
+        case ApiCallId::ApiCall_vkUnmapMemory:
+            return "vkUnmapMemory";
+        case ApiCallId::ApiCall_vkFlushMappedMemoryRanges:
+            return "vkFlushMappedMemoryRanges";
+        case ApiCallId::ApiCall_vkInvalidateMappedMemoryRanges:
+            return "vkInvalidateMappedMemoryRanges";
+        case ApiCallId::ApiCall_vkGetDeviceMemoryCommitment:
+            return "vkGetDeviceMemoryCommitment";
+        case ApiCallId::ApiCall_vkBindBufferMemory:
+            return "vkBindBufferMemory";
+        case ApiCallId::ApiCall_vkBindImageMemory:
+            return "vkBindImageMemory";
+        case ApiCallId::ApiCall_vkGetBufferMemoryRequirements:
+            return "vkGetBufferMemoryRequirements";
+        case ApiCallId::ApiCall_vkGetImageMemoryRequirements:
+            return "vkGetImageMemoryRequirements";
+        case ApiCallId::ApiCall_vkGetImageSparseMemoryRequirements:
+            return "vkGetImageSparseMemoryRequirements";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceSparseImageFormatProperties:
+            return "vkGetPhysicalDeviceSparseImageFormatProperties";
+        case ApiCallId::ApiCall_vkQueueBindSparse:
+            return "vkQueueBindSparse";
+        case ApiCallId::ApiCall_vkCreateFence:
+            return "vkCreateFence";
+        case ApiCallId::ApiCall_vkDestroyFence:
+            return "vkDestroyFence";
+        case ApiCallId::ApiCall_vkResetFences:
+            return "vkResetFences";
+        case ApiCallId::ApiCall_vkGetFenceStatus:
+            return "vkGetFenceStatus";
+        case ApiCallId::ApiCall_vkWaitForFences:
+            return "vkWaitForFences";
+        case ApiCallId::ApiCall_vkCreateSemaphore:
+            return "vkCreateSemaphore";
+        case ApiCallId::ApiCall_vkDestroySemaphore:
+            return "vkDestroySemaphore";
+        case ApiCallId::ApiCall_vkCreateEvent:
+            return "vkCreateEvent";
+        case ApiCallId::ApiCall_vkDestroyEvent:
+            return "vkDestroyEvent";
+        case ApiCallId::ApiCall_vkGetEventStatus:
+            return "vkGetEventStatus";
+        case ApiCallId::ApiCall_vkSetEvent:
+            return "vkSetEvent";
+        case ApiCallId::ApiCall_vkResetEvent:
+            return "vkResetEvent";
+        case ApiCallId::ApiCall_vkCreateQueryPool:
+            return "vkCreateQueryPool";
+        case ApiCallId::ApiCall_vkDestroyQueryPool:
+            return "vkDestroyQueryPool";
+        case ApiCallId::ApiCall_vkGetQueryPoolResults:
+            return "vkGetQueryPoolResults";
+        case ApiCallId::ApiCall_vkCreateBuffer:
+            return "vkCreateBuffer";
+        case ApiCallId::ApiCall_vkDestroyBuffer:
+            return "vkDestroyBuffer";
+        case ApiCallId::ApiCall_vkCreateBufferView:
+            return "vkCreateBufferView";
+        case ApiCallId::ApiCall_vkDestroyBufferView:
+            return "vkDestroyBufferView";
+        case ApiCallId::ApiCall_vkCreateImage:
+            return "vkCreateImage";
+        case ApiCallId::ApiCall_vkDestroyImage:
+            return "vkDestroyImage";
+        case ApiCallId::ApiCall_vkGetImageSubresourceLayout:
+            return "vkGetImageSubresourceLayout";
+        case ApiCallId::ApiCall_vkCreateImageView:
+            return "vkCreateImageView";
+        case ApiCallId::ApiCall_vkDestroyImageView:
+            return "vkDestroyImageView";
+        case ApiCallId::ApiCall_vkCreateShaderModule:
+            return "vkCreateShaderModule";
+        case ApiCallId::ApiCall_vkDestroyShaderModule:
+            return "vkDestroyShaderModule";
+        case ApiCallId::ApiCall_vkCreatePipelineCache:
+            return "vkCreatePipelineCache";
+        case ApiCallId::ApiCall_vkDestroyPipelineCache:
+            return "vkDestroyPipelineCache";
+        case ApiCallId::ApiCall_vkGetPipelineCacheData:
+            return "vkGetPipelineCacheData";
+        case ApiCallId::ApiCall_vkMergePipelineCaches:
+            return "vkMergePipelineCaches";
+        case ApiCallId::ApiCall_vkCreateGraphicsPipelines:
+            return "vkCreateGraphicsPipelines";
+        case ApiCallId::ApiCall_vkCreateComputePipelines:
+            return "vkCreateComputePipelines";
+        case ApiCallId::ApiCall_vkDestroyPipeline:
+            return "vkDestroyPipeline";
+        case ApiCallId::ApiCall_vkCreatePipelineLayout:
+            return "vkCreatePipelineLayout";
+        case ApiCallId::ApiCall_vkDestroyPipelineLayout:
+            return "vkDestroyPipelineLayout";
+        case ApiCallId::ApiCall_vkCreateSampler:
+            return "vkCreateSampler";
+        case ApiCallId::ApiCall_vkDestroySampler:
+            return "vkDestroySampler";
+        case ApiCallId::ApiCall_vkCreateDescriptorSetLayout:
+            return "vkCreateDescriptorSetLayout";
+        case ApiCallId::ApiCall_vkDestroyDescriptorSetLayout:
+            return "vkDestroyDescriptorSetLayout";
+        case ApiCallId::ApiCall_vkCreateDescriptorPool:
+            return "vkCreateDescriptorPool";
+        case ApiCallId::ApiCall_vkDestroyDescriptorPool:
+            return "vkDestroyDescriptorPool";
+        case ApiCallId::ApiCall_vkResetDescriptorPool:
+            return "vkResetDescriptorPool";
+        case ApiCallId::ApiCall_vkAllocateDescriptorSets:
+            return "vkAllocateDescriptorSets";
+        case ApiCallId::ApiCall_vkFreeDescriptorSets:
+            return "vkFreeDescriptorSets";
+        case ApiCallId::ApiCall_vkUpdateDescriptorSets:
+            return "vkUpdateDescriptorSets";
+        case ApiCallId::ApiCall_vkCreateFramebuffer:
+            return "vkCreateFramebuffer";
+        case ApiCallId::ApiCall_vkDestroyFramebuffer:
+            return "vkDestroyFramebuffer";
+        case ApiCallId::ApiCall_vkCreateRenderPass:
+            return "vkCreateRenderPass";
+        case ApiCallId::ApiCall_vkDestroyRenderPass:
+            return "vkDestroyRenderPass";
+        case ApiCallId::ApiCall_vkGetRenderAreaGranularity:
+            return "vkGetRenderAreaGranularity";
+        case ApiCallId::ApiCall_vkCreateCommandPool:
+            return "vkCreateCommandPool";
+        case ApiCallId::ApiCall_vkDestroyCommandPool:
+            return "vkDestroyCommandPool";
+        case ApiCallId::ApiCall_vkResetCommandPool:
+            return "vkResetCommandPool";
+        case ApiCallId::ApiCall_vkAllocateCommandBuffers:
+            return "vkAllocateCommandBuffers";
+        case ApiCallId::ApiCall_vkFreeCommandBuffers:
+            return "vkFreeCommandBuffers";
+        case ApiCallId::ApiCall_vkBeginCommandBuffer:
+            return "vkBeginCommandBuffer";
+        case ApiCallId::ApiCall_vkEndCommandBuffer:
+            return "vkEndCommandBuffer";
+        case ApiCallId::ApiCall_vkResetCommandBuffer:
+            return "vkResetCommandBuffer";
+        case ApiCallId::ApiCall_vkCmdBindPipeline:
+            return "vkCmdBindPipeline";
+        case ApiCallId::ApiCall_vkCmdSetViewport:
+            return "vkCmdSetViewport";
+        case ApiCallId::ApiCall_vkCmdSetScissor:
+            return "vkCmdSetScissor";
+        case ApiCallId::ApiCall_vkCmdSetLineWidth:
+            return "vkCmdSetLineWidth";
+        case ApiCallId::ApiCall_vkCmdSetDepthBias:
+            return "vkCmdSetDepthBias";
+        case ApiCallId::ApiCall_vkCmdSetBlendConstants:
+            return "vkCmdSetBlendConstants";
+        case ApiCallId::ApiCall_vkCmdSetDepthBounds:
+            return "vkCmdSetDepthBounds";
+        case ApiCallId::ApiCall_vkCmdSetStencilCompareMask:
+            return "vkCmdSetStencilCompareMask";
+        case ApiCallId::ApiCall_vkCmdSetStencilWriteMask:
+            return "vkCmdSetStencilWriteMask";
+        case ApiCallId::ApiCall_vkCmdSetStencilReference:
+            return "vkCmdSetStencilReference";
+        case ApiCallId::ApiCall_vkCmdBindDescriptorSets:
+            return "vkCmdBindDescriptorSets";
+        case ApiCallId::ApiCall_vkCmdBindIndexBuffer:
+            return "vkCmdBindIndexBuffer";
+        case ApiCallId::ApiCall_vkCmdBindVertexBuffers:
+            return "vkCmdBindVertexBuffers";
+        case ApiCallId::ApiCall_vkCmdDraw:
+            return "vkCmdDraw";
+        case ApiCallId::ApiCall_vkCmdDrawIndexed:
+            return "vkCmdDrawIndexed";
+        case ApiCallId::ApiCall_vkCmdDrawIndirect:
+            return "vkCmdDrawIndirect";
+        case ApiCallId::ApiCall_vkCmdDrawIndexedIndirect:
+            return "vkCmdDrawIndexedIndirect";
+        case ApiCallId::ApiCall_vkCmdDispatch:
+            return "vkCmdDispatch";
+        case ApiCallId::ApiCall_vkCmdDispatchIndirect:
+            return "vkCmdDispatchIndirect";
+        case ApiCallId::ApiCall_vkCmdCopyBuffer:
+            return "vkCmdCopyBuffer";
+        case ApiCallId::ApiCall_vkCmdCopyImage:
+            return "vkCmdCopyImage";
+        case ApiCallId::ApiCall_vkCmdBlitImage:
+            return "vkCmdBlitImage";
+        case ApiCallId::ApiCall_vkCmdCopyBufferToImage:
+            return "vkCmdCopyBufferToImage";
+        case ApiCallId::ApiCall_vkCmdCopyImageToBuffer:
+            return "vkCmdCopyImageToBuffer";
+        case ApiCallId::ApiCall_vkCmdUpdateBuffer:
+            return "vkCmdUpdateBuffer";
+        case ApiCallId::ApiCall_vkCmdFillBuffer:
+            return "vkCmdFillBuffer";
+        case ApiCallId::ApiCall_vkCmdClearColorImage:
+            return "vkCmdClearColorImage";
+        case ApiCallId::ApiCall_vkCmdClearDepthStencilImage:
+            return "vkCmdClearDepthStencilImage";
+        case ApiCallId::ApiCall_vkCmdClearAttachments:
+            return "vkCmdClearAttachments";
+        case ApiCallId::ApiCall_vkCmdResolveImage:
+            return "vkCmdResolveImage";
+        case ApiCallId::ApiCall_vkCmdSetEvent:
+            return "vkCmdSetEvent";
+        case ApiCallId::ApiCall_vkCmdResetEvent:
+            return "vkCmdResetEvent";
+        case ApiCallId::ApiCall_vkCmdWaitEvents:
+            return "vkCmdWaitEvents";
+        case ApiCallId::ApiCall_vkCmdPipelineBarrier:
+            return "vkCmdPipelineBarrier";
+        case ApiCallId::ApiCall_vkCmdBeginQuery:
+            return "vkCmdBeginQuery";
+        case ApiCallId::ApiCall_vkCmdEndQuery:
+            return "vkCmdEndQuery";
+        case ApiCallId::ApiCall_vkCmdResetQueryPool:
+            return "vkCmdResetQueryPool";
+        case ApiCallId::ApiCall_vkCmdWriteTimestamp:
+            return "vkCmdWriteTimestamp";
+        case ApiCallId::ApiCall_vkCmdCopyQueryPoolResults:
+            return "vkCmdCopyQueryPoolResults";
+        case ApiCallId::ApiCall_vkCmdPushConstants:
+            return "vkCmdPushConstants";
+        case ApiCallId::ApiCall_vkCmdBeginRenderPass:
+            return "vkCmdBeginRenderPass";
+        case ApiCallId::ApiCall_vkCmdNextSubpass:
+            return "vkCmdNextSubpass";
+        case ApiCallId::ApiCall_vkCmdEndRenderPass:
+            return "vkCmdEndRenderPass";
+        case ApiCallId::ApiCall_vkCmdExecuteCommands:
+            return "vkCmdExecuteCommands";
+        case ApiCallId::ApiCall_vkEnumerateInstanceVersion:
+            return "vkEnumerateInstanceVersion";
+        case ApiCallId::ApiCall_vkBindBufferMemory2:
+            return "vkBindBufferMemory2";
+        case ApiCallId::ApiCall_vkBindImageMemory2:
+            return "vkBindImageMemory2";
+        case ApiCallId::ApiCall_vkGetDeviceGroupPeerMemoryFeatures:
+            return "vkGetDeviceGroupPeerMemoryFeatures";
+        case ApiCallId::ApiCall_vkCmdSetDeviceMask:
+            return "vkCmdSetDeviceMask";
+        case ApiCallId::ApiCall_vkCmdDispatchBase:
+            return "vkCmdDispatchBase";
+        case ApiCallId::ApiCall_vkEnumeratePhysicalDeviceGroups:
+            return "vkEnumeratePhysicalDeviceGroups";
+        case ApiCallId::ApiCall_vkGetImageMemoryRequirements2:
+            return "vkGetImageMemoryRequirements2";
+        case ApiCallId::ApiCall_vkGetBufferMemoryRequirements2:
+            return "vkGetBufferMemoryRequirements2";
+        case ApiCallId::ApiCall_vkGetImageSparseMemoryRequirements2:
+            return "vkGetImageSparseMemoryRequirements2";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceFeatures2:
+            return "vkGetPhysicalDeviceFeatures2";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceProperties2:
+            return "vkGetPhysicalDeviceProperties2";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceFormatProperties2:
+            return "vkGetPhysicalDeviceFormatProperties2";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceImageFormatProperties2:
+            return "vkGetPhysicalDeviceImageFormatProperties2";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyProperties2:
+            return "vkGetPhysicalDeviceQueueFamilyProperties2";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceMemoryProperties2:
+            return "vkGetPhysicalDeviceMemoryProperties2";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceSparseImageFormatProperties2:
+            return "vkGetPhysicalDeviceSparseImageFormatProperties2";
+        case ApiCallId::ApiCall_vkTrimCommandPool:
+            return "vkTrimCommandPool";
+        case ApiCallId::ApiCall_vkGetDeviceQueue2:
+            return "vkGetDeviceQueue2";
+        case ApiCallId::ApiCall_vkCreateSamplerYcbcrConversion:
+            return "vkCreateSamplerYcbcrConversion";
+        case ApiCallId::ApiCall_vkDestroySamplerYcbcrConversion:
+            return "vkDestroySamplerYcbcrConversion";
+        case ApiCallId::ApiCall_vkCreateDescriptorUpdateTemplate:
+            return "vkCreateDescriptorUpdateTemplate";
+        case ApiCallId::ApiCall_vkDestroyDescriptorUpdateTemplate:
+            return "vkDestroyDescriptorUpdateTemplate";
+        case ApiCallId::ApiCall_vkUpdateDescriptorSetWithTemplate:
+            return "vkUpdateDescriptorSetWithTemplate";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceExternalBufferProperties:
+            return "vkGetPhysicalDeviceExternalBufferProperties";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceExternalFenceProperties:
+            return "vkGetPhysicalDeviceExternalFenceProperties";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceExternalSemaphoreProperties:
+            return "vkGetPhysicalDeviceExternalSemaphoreProperties";
+        case ApiCallId::ApiCall_vkGetDescriptorSetLayoutSupport:
+            return "vkGetDescriptorSetLayoutSupport";
+        case ApiCallId::ApiCall_vkDestroySurfaceKHR:
+            return "vkDestroySurfaceKHR";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceSupportKHR:
+            return "vkGetPhysicalDeviceSurfaceSupportKHR";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceCapabilitiesKHR:
+            return "vkGetPhysicalDeviceSurfaceCapabilitiesKHR";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceFormatsKHR:
+            return "vkGetPhysicalDeviceSurfaceFormatsKHR";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceSurfacePresentModesKHR:
+            return "vkGetPhysicalDeviceSurfacePresentModesKHR";
+        case ApiCallId::ApiCall_vkCreateSwapchainKHR:
+            return "vkCreateSwapchainKHR";
+        case ApiCallId::ApiCall_vkDestroySwapchainKHR:
+            return "vkDestroySwapchainKHR";
+        case ApiCallId::ApiCall_vkGetSwapchainImagesKHR:
+            return "vkGetSwapchainImagesKHR";
+        case ApiCallId::ApiCall_vkAcquireNextImageKHR:
+            return "vkAcquireNextImageKHR";
+        case ApiCallId::ApiCall_vkQueuePresentKHR:
+            return "vkQueuePresentKHR";
+        case ApiCallId::ApiCall_vkGetDeviceGroupPresentCapabilitiesKHR:
+            return "vkGetDeviceGroupPresentCapabilitiesKHR";
+        case ApiCallId::ApiCall_vkGetDeviceGroupSurfacePresentModesKHR:
+            return "vkGetDeviceGroupSurfacePresentModesKHR";
+        case ApiCallId::ApiCall_vkGetPhysicalDevicePresentRectanglesKHR:
+            return "vkGetPhysicalDevicePresentRectanglesKHR";
+        case ApiCallId::ApiCall_vkAcquireNextImage2KHR:
+            return "vkAcquireNextImage2KHR";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceDisplayPropertiesKHR:
+            return "vkGetPhysicalDeviceDisplayPropertiesKHR";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceDisplayPlanePropertiesKHR:
+            return "vkGetPhysicalDeviceDisplayPlanePropertiesKHR";
+        case ApiCallId::ApiCall_vkGetDisplayPlaneSupportedDisplaysKHR:
+            return "vkGetDisplayPlaneSupportedDisplaysKHR";
+        case ApiCallId::ApiCall_vkGetDisplayModePropertiesKHR:
+            return "vkGetDisplayModePropertiesKHR";
+        case ApiCallId::ApiCall_vkCreateDisplayModeKHR:
+            return "vkCreateDisplayModeKHR";
+        case ApiCallId::ApiCall_vkGetDisplayPlaneCapabilitiesKHR:
+            return "vkGetDisplayPlaneCapabilitiesKHR";
+        case ApiCallId::ApiCall_vkCreateDisplayPlaneSurfaceKHR:
+            return "vkCreateDisplayPlaneSurfaceKHR";
+        case ApiCallId::ApiCall_vkCreateSharedSwapchainsKHR:
+            return "vkCreateSharedSwapchainsKHR";
+        case ApiCallId::ApiCall_vkCreateXlibSurfaceKHR:
+            return "vkCreateXlibSurfaceKHR";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceXlibPresentationSupportKHR:
+            return "vkGetPhysicalDeviceXlibPresentationSupportKHR";
+        case ApiCallId::ApiCall_vkCreateXcbSurfaceKHR:
+            return "vkCreateXcbSurfaceKHR";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceXcbPresentationSupportKHR:
+            return "vkGetPhysicalDeviceXcbPresentationSupportKHR";
+        case ApiCallId::ApiCall_vkCreateWaylandSurfaceKHR:
+            return "vkCreateWaylandSurfaceKHR";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceWaylandPresentationSupportKHR:
+            return "vkGetPhysicalDeviceWaylandPresentationSupportKHR";
+        case ApiCallId::ApiCall_vkCreateMirSurfaceKHR:
+            return "vkCreateMirSurfaceKHR";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceMirPresentationSupportKHR:
+            return "vkGetPhysicalDeviceMirPresentationSupportKHR";
+        case ApiCallId::ApiCall_vkCreateAndroidSurfaceKHR:
+            return "vkCreateAndroidSurfaceKHR";
+        case ApiCallId::ApiCall_vkCreateWin32SurfaceKHR:
+            return "vkCreateWin32SurfaceKHR";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceWin32PresentationSupportKHR:
+            return "vkGetPhysicalDeviceWin32PresentationSupportKHR";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceFeatures2KHR:
+            return "vkGetPhysicalDeviceFeatures2KHR";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceProperties2KHR:
+            return "vkGetPhysicalDeviceProperties2KHR";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceFormatProperties2KHR:
+            return "vkGetPhysicalDeviceFormatProperties2KHR";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceImageFormatProperties2KHR:
+            return "vkGetPhysicalDeviceImageFormatProperties2KHR";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyProperties2KHR:
+            return "vkGetPhysicalDeviceQueueFamilyProperties2KHR";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceMemoryProperties2KHR:
+            return "vkGetPhysicalDeviceMemoryProperties2KHR";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceSparseImageFormatProperties2KHR:
+            return "vkGetPhysicalDeviceSparseImageFormatProperties2KHR";
+        case ApiCallId::ApiCall_vkGetDeviceGroupPeerMemoryFeaturesKHR:
+            return "vkGetDeviceGroupPeerMemoryFeaturesKHR";
+        case ApiCallId::ApiCall_vkCmdSetDeviceMaskKHR:
+            return "vkCmdSetDeviceMaskKHR";
+        case ApiCallId::ApiCall_vkCmdDispatchBaseKHR:
+            return "vkCmdDispatchBaseKHR";
+        case ApiCallId::ApiCall_vkTrimCommandPoolKHR:
+            return "vkTrimCommandPoolKHR";
+        case ApiCallId::ApiCall_vkEnumeratePhysicalDeviceGroupsKHR:
+            return "vkEnumeratePhysicalDeviceGroupsKHR";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceExternalBufferPropertiesKHR:
+            return "vkGetPhysicalDeviceExternalBufferPropertiesKHR";
+        case ApiCallId::ApiCall_vkGetMemoryWin32HandleKHR:
+            return "vkGetMemoryWin32HandleKHR";
+        case ApiCallId::ApiCall_vkGetMemoryWin32HandlePropertiesKHR:
+            return "vkGetMemoryWin32HandlePropertiesKHR";
+        case ApiCallId::ApiCall_vkGetMemoryFdKHR:
+            return "vkGetMemoryFdKHR";
+        case ApiCallId::ApiCall_vkGetMemoryFdPropertiesKHR:
+            return "vkGetMemoryFdPropertiesKHR";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR:
+            return "vkGetPhysicalDeviceExternalSemaphorePropertiesKHR";
+        case ApiCallId::ApiCall_vkImportSemaphoreWin32HandleKHR:
+            return "vkImportSemaphoreWin32HandleKHR";
+        case ApiCallId::ApiCall_vkGetSemaphoreWin32HandleKHR:
+            return "vkGetSemaphoreWin32HandleKHR";
+        case ApiCallId::ApiCall_vkImportSemaphoreFdKHR:
+            return "vkImportSemaphoreFdKHR";
+        case ApiCallId::ApiCall_vkGetSemaphoreFdKHR:
+            return "vkGetSemaphoreFdKHR";
+        case ApiCallId::ApiCall_vkCmdPushDescriptorSetKHR:
+            return "vkCmdPushDescriptorSetKHR";
+        case ApiCallId::ApiCall_vkCmdPushDescriptorSetWithTemplateKHR:
+            return "vkCmdPushDescriptorSetWithTemplateKHR";
+        case ApiCallId::ApiCall_vkCreateDescriptorUpdateTemplateKHR:
+            return "vkCreateDescriptorUpdateTemplateKHR";
+        case ApiCallId::ApiCall_vkDestroyDescriptorUpdateTemplateKHR:
+            return "vkDestroyDescriptorUpdateTemplateKHR";
+        case ApiCallId::ApiCall_vkUpdateDescriptorSetWithTemplateKHR:
+            return "vkUpdateDescriptorSetWithTemplateKHR";
+        case ApiCallId::ApiCall_vkCreateRenderPass2KHR:
+            return "vkCreateRenderPass2KHR";
+        case ApiCallId::ApiCall_vkCmdBeginRenderPass2KHR:
+            return "vkCmdBeginRenderPass2KHR";
+        case ApiCallId::ApiCall_vkCmdNextSubpass2KHR:
+            return "vkCmdNextSubpass2KHR";
+        case ApiCallId::ApiCall_vkCmdEndRenderPass2KHR:
+            return "vkCmdEndRenderPass2KHR";
+        case ApiCallId::ApiCall_vkGetSwapchainStatusKHR:
+            return "vkGetSwapchainStatusKHR";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceExternalFencePropertiesKHR:
+            return "vkGetPhysicalDeviceExternalFencePropertiesKHR";
+        case ApiCallId::ApiCall_vkImportFenceWin32HandleKHR:
+            return "vkImportFenceWin32HandleKHR";
+        case ApiCallId::ApiCall_vkGetFenceWin32HandleKHR:
+            return "vkGetFenceWin32HandleKHR";
+        case ApiCallId::ApiCall_vkImportFenceFdKHR:
+            return "vkImportFenceFdKHR";
+        case ApiCallId::ApiCall_vkGetFenceFdKHR:
+            return "vkGetFenceFdKHR";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceCapabilities2KHR:
+            return "vkGetPhysicalDeviceSurfaceCapabilities2KHR";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceFormats2KHR:
+            return "vkGetPhysicalDeviceSurfaceFormats2KHR";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceDisplayProperties2KHR:
+            return "vkGetPhysicalDeviceDisplayProperties2KHR";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceDisplayPlaneProperties2KHR:
+            return "vkGetPhysicalDeviceDisplayPlaneProperties2KHR";
+        case ApiCallId::ApiCall_vkGetDisplayModeProperties2KHR:
+            return "vkGetDisplayModeProperties2KHR";
+        case ApiCallId::ApiCall_vkGetDisplayPlaneCapabilities2KHR:
+            return "vkGetDisplayPlaneCapabilities2KHR";
+        case ApiCallId::ApiCall_vkGetImageMemoryRequirements2KHR:
+            return "vkGetImageMemoryRequirements2KHR";
+        case ApiCallId::ApiCall_vkGetBufferMemoryRequirements2KHR:
+            return "vkGetBufferMemoryRequirements2KHR";
+        case ApiCallId::ApiCall_vkGetImageSparseMemoryRequirements2KHR:
+            return "vkGetImageSparseMemoryRequirements2KHR";
+        case ApiCallId::ApiCall_vkCreateSamplerYcbcrConversionKHR:
+            return "vkCreateSamplerYcbcrConversionKHR";
+        case ApiCallId::ApiCall_vkDestroySamplerYcbcrConversionKHR:
+            return "vkDestroySamplerYcbcrConversionKHR";
+        case ApiCallId::ApiCall_vkBindBufferMemory2KHR:
+            return "vkBindBufferMemory2KHR";
+        case ApiCallId::ApiCall_vkBindImageMemory2KHR:
+            return "vkBindImageMemory2KHR";
+        case ApiCallId::ApiCall_vkGetDescriptorSetLayoutSupportKHR:
+            return "vkGetDescriptorSetLayoutSupportKHR";
+        case ApiCallId::ApiCall_vkCmdDrawIndirectCountKHR:
+            return "vkCmdDrawIndirectCountKHR";
+        case ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountKHR:
+            return "vkCmdDrawIndexedIndirectCountKHR";
+        case ApiCallId::ApiCall_vkCreateDebugReportCallbackEXT:
+            return "vkCreateDebugReportCallbackEXT";
+        case ApiCallId::ApiCall_vkDestroyDebugReportCallbackEXT:
+            return "vkDestroyDebugReportCallbackEXT";
+        case ApiCallId::ApiCall_vkDebugReportMessageEXT:
+            return "vkDebugReportMessageEXT";
+        case ApiCallId::ApiCall_vkDebugMarkerSetObjectTagEXT:
+            return "vkDebugMarkerSetObjectTagEXT";
+        case ApiCallId::ApiCall_vkDebugMarkerSetObjectNameEXT:
+            return "vkDebugMarkerSetObjectNameEXT";
+        case ApiCallId::ApiCall_vkCmdDebugMarkerBeginEXT:
+            return "vkCmdDebugMarkerBeginEXT";
+        case ApiCallId::ApiCall_vkCmdDebugMarkerEndEXT:
+            return "vkCmdDebugMarkerEndEXT";
+        case ApiCallId::ApiCall_vkCmdDebugMarkerInsertEXT:
+            return "vkCmdDebugMarkerInsertEXT";
+        case ApiCallId::ApiCall_vkCmdDrawIndirectCountAMD:
+            return "vkCmdDrawIndirectCountAMD";
+        case ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountAMD:
+            return "vkCmdDrawIndexedIndirectCountAMD";
+        case ApiCallId::ApiCall_vkGetShaderInfoAMD:
+            return "vkGetShaderInfoAMD";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceExternalImageFormatPropertiesNV:
+            return "vkGetPhysicalDeviceExternalImageFormatPropertiesNV";
+        case ApiCallId::ApiCall_vkGetMemoryWin32HandleNV:
+            return "vkGetMemoryWin32HandleNV";
+        case ApiCallId::ApiCall_vkCreateViSurfaceNN:
+            return "vkCreateViSurfaceNN";
+        case ApiCallId::ApiCall_vkCmdBeginConditionalRenderingEXT:
+            return "vkCmdBeginConditionalRenderingEXT";
+        case ApiCallId::ApiCall_vkCmdEndConditionalRenderingEXT:
+            return "vkCmdEndConditionalRenderingEXT";
+        case ApiCallId::ApiCall_vkCmdProcessCommandsNVX:
+            return "vkCmdProcessCommandsNVX";
+        case ApiCallId::ApiCall_vkCmdReserveSpaceForCommandsNVX:
+            return "vkCmdReserveSpaceForCommandsNVX";
+        case ApiCallId::ApiCall_vkCreateIndirectCommandsLayoutNVX:
+            return "vkCreateIndirectCommandsLayoutNVX";
+        case ApiCallId::ApiCall_vkDestroyIndirectCommandsLayoutNVX:
+            return "vkDestroyIndirectCommandsLayoutNVX";
+        case ApiCallId::ApiCall_vkCreateObjectTableNVX:
+            return "vkCreateObjectTableNVX";
+        case ApiCallId::ApiCall_vkDestroyObjectTableNVX:
+            return "vkDestroyObjectTableNVX";
+        case ApiCallId::ApiCall_vkRegisterObjectsNVX:
+            return "vkRegisterObjectsNVX";
+        case ApiCallId::ApiCall_vkUnregisterObjectsNVX:
+            return "vkUnregisterObjectsNVX";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX:
+            return "vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX";
+        case ApiCallId::ApiCall_vkCmdSetViewportWScalingNV:
+            return "vkCmdSetViewportWScalingNV";
+        case ApiCallId::ApiCall_vkReleaseDisplayEXT:
+            return "vkReleaseDisplayEXT";
+        case ApiCallId::ApiCall_vkAcquireXlibDisplayEXT:
+            return "vkAcquireXlibDisplayEXT";
+        case ApiCallId::ApiCall_vkGetRandROutputDisplayEXT:
+            return "vkGetRandROutputDisplayEXT";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceCapabilities2EXT:
+            return "vkGetPhysicalDeviceSurfaceCapabilities2EXT";
+        case ApiCallId::ApiCall_vkDisplayPowerControlEXT:
+            return "vkDisplayPowerControlEXT";
+        case ApiCallId::ApiCall_vkRegisterDeviceEventEXT:
+            return "vkRegisterDeviceEventEXT";
+        case ApiCallId::ApiCall_vkRegisterDisplayEventEXT:
+            return "vkRegisterDisplayEventEXT";
+        case ApiCallId::ApiCall_vkGetSwapchainCounterEXT:
+            return "vkGetSwapchainCounterEXT";
+        case ApiCallId::ApiCall_vkGetRefreshCycleDurationGOOGLE:
+            return "vkGetRefreshCycleDurationGOOGLE";
+        case ApiCallId::ApiCall_vkGetPastPresentationTimingGOOGLE:
+            return "vkGetPastPresentationTimingGOOGLE";
+        case ApiCallId::ApiCall_vkCmdSetDiscardRectangleEXT:
+            return "vkCmdSetDiscardRectangleEXT";
+        case ApiCallId::ApiCall_vkSetHdrMetadataEXT:
+            return "vkSetHdrMetadataEXT";
+        case ApiCallId::ApiCall_vkCreateIOSSurfaceMVK:
+            return "vkCreateIOSSurfaceMVK";
+        case ApiCallId::ApiCall_vkCreateMacOSSurfaceMVK:
+            return "vkCreateMacOSSurfaceMVK";
+        case ApiCallId::ApiCall_vkSetDebugUtilsObjectNameEXT:
+            return "vkSetDebugUtilsObjectNameEXT";
+        case ApiCallId::ApiCall_vkSetDebugUtilsObjectTagEXT:
+            return "vkSetDebugUtilsObjectTagEXT";
+        case ApiCallId::ApiCall_vkQueueBeginDebugUtilsLabelEXT:
+            return "vkQueueBeginDebugUtilsLabelEXT";
+        case ApiCallId::ApiCall_vkQueueEndDebugUtilsLabelEXT:
+            return "vkQueueEndDebugUtilsLabelEXT";
+        case ApiCallId::ApiCall_vkQueueInsertDebugUtilsLabelEXT:
+            return "vkQueueInsertDebugUtilsLabelEXT";
+        case ApiCallId::ApiCall_vkCmdBeginDebugUtilsLabelEXT:
+            return "vkCmdBeginDebugUtilsLabelEXT";
+        case ApiCallId::ApiCall_vkCmdEndDebugUtilsLabelEXT:
+            return "vkCmdEndDebugUtilsLabelEXT";
+        case ApiCallId::ApiCall_vkCmdInsertDebugUtilsLabelEXT:
+            return "vkCmdInsertDebugUtilsLabelEXT";
+        case ApiCallId::ApiCall_vkCreateDebugUtilsMessengerEXT:
+            return "vkCreateDebugUtilsMessengerEXT";
+        case ApiCallId::ApiCall_vkDestroyDebugUtilsMessengerEXT:
+            return "vkDestroyDebugUtilsMessengerEXT";
+        case ApiCallId::ApiCall_vkSubmitDebugUtilsMessageEXT:
+            return "vkSubmitDebugUtilsMessageEXT";
+        case ApiCallId::ApiCall_vkGetAndroidHardwareBufferPropertiesANDROID:
+            return "vkGetAndroidHardwareBufferPropertiesANDROID";
+        case ApiCallId::ApiCall_vkGetMemoryAndroidHardwareBufferANDROID:
+            return "vkGetMemoryAndroidHardwareBufferANDROID";
+        case ApiCallId::ApiCall_vkCmdSetSampleLocationsEXT:
+            return "vkCmdSetSampleLocationsEXT";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceMultisamplePropertiesEXT:
+            return "vkGetPhysicalDeviceMultisamplePropertiesEXT";
+        case ApiCallId::ApiCall_vkCreateValidationCacheEXT:
+            return "vkCreateValidationCacheEXT";
+        case ApiCallId::ApiCall_vkDestroyValidationCacheEXT:
+            return "vkDestroyValidationCacheEXT";
+        case ApiCallId::ApiCall_vkMergeValidationCachesEXT:
+            return "vkMergeValidationCachesEXT";
+        case ApiCallId::ApiCall_vkGetValidationCacheDataEXT:
+            return "vkGetValidationCacheDataEXT";
+        case ApiCallId::ApiCall_vkGetMemoryHostPointerPropertiesEXT:
+            return "vkGetMemoryHostPointerPropertiesEXT";
+        case ApiCallId::ApiCall_vkCmdWriteBufferMarkerAMD:
+            return "vkCmdWriteBufferMarkerAMD";
+        case ApiCallId::ApiCall_vkCmdBindShadingRateImageNV:
+            return "vkCmdBindShadingRateImageNV";
+        case ApiCallId::ApiCall_vkCmdSetViewportShadingRatePaletteNV:
+            return "vkCmdSetViewportShadingRatePaletteNV";
+        case ApiCallId::ApiCall_vkCmdSetCoarseSampleOrderNV:
+            return "vkCmdSetCoarseSampleOrderNV";
+        case ApiCallId::ApiCall_vkGetImageDrmFormatModifierPropertiesEXT:
+            return "vkGetImageDrmFormatModifierPropertiesEXT";
+        case ApiCallId::ApiCall_vkCreateAccelerationStructureNV:
+            return "vkCreateAccelerationStructureNV";
+        case ApiCallId::ApiCall_vkDestroyAccelerationStructureNV:
+            return "vkDestroyAccelerationStructureNV";
+        case ApiCallId::ApiCall_vkGetAccelerationStructureMemoryRequirementsNV:
+            return "vkGetAccelerationStructureMemoryRequirementsNV";
+        case ApiCallId::ApiCall_vkBindAccelerationStructureMemoryNV:
+            return "vkBindAccelerationStructureMemoryNV";
+        case ApiCallId::ApiCall_vkCmdBuildAccelerationStructureNV:
+            return "vkCmdBuildAccelerationStructureNV";
+        case ApiCallId::ApiCall_vkCmdCopyAccelerationStructureNV:
+            return "vkCmdCopyAccelerationStructureNV";
+        case ApiCallId::ApiCall_vkCmdTraceRaysNV:
+            return "vkCmdTraceRaysNV";
+        case ApiCallId::ApiCall_vkCreateRayTracingPipelinesNV:
+            return "vkCreateRayTracingPipelinesNV";
+        case ApiCallId::ApiCall_vkGetRayTracingShaderGroupHandlesNV:
+            return "vkGetRayTracingShaderGroupHandlesNV";
+        case ApiCallId::ApiCall_vkGetAccelerationStructureHandleNV:
+            return "vkGetAccelerationStructureHandleNV";
+        case ApiCallId::ApiCall_vkCmdWriteAccelerationStructuresPropertiesNV:
+            return "vkCmdWriteAccelerationStructuresPropertiesNV";
+        case ApiCallId::ApiCall_vkCompileDeferredNV:
+            return "vkCompileDeferredNV";
+        case ApiCallId::ApiCall_vkCmdDrawMeshTasksNV:
+            return "vkCmdDrawMeshTasksNV";
+        case ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectNV:
+            return "vkCmdDrawMeshTasksIndirectNV";
+        case ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectCountNV:
+            return "vkCmdDrawMeshTasksIndirectCountNV";
+        case ApiCallId::ApiCall_vkCmdSetExclusiveScissorNV:
+            return "vkCmdSetExclusiveScissorNV";
+        case ApiCallId::ApiCall_vkCmdSetCheckpointNV:
+            return "vkCmdSetCheckpointNV";
+        case ApiCallId::ApiCall_vkGetQueueCheckpointDataNV:
+            return "vkGetQueueCheckpointDataNV";
+        case ApiCallId::ApiCall_vkCreateImagePipeSurfaceFUCHSIA:
+            return "vkCreateImagePipeSurfaceFUCHSIA";
+        case ApiCallId::ApiCall_vkCmdBindTransformFeedbackBuffersEXT:
+            return "vkCmdBindTransformFeedbackBuffersEXT";
+        case ApiCallId::ApiCall_vkCmdBeginTransformFeedbackEXT:
+            return "vkCmdBeginTransformFeedbackEXT";
+        case ApiCallId::ApiCall_vkCmdEndTransformFeedbackEXT:
+            return "vkCmdEndTransformFeedbackEXT";
+        case ApiCallId::ApiCall_vkCmdBeginQueryIndexedEXT:
+            return "vkCmdBeginQueryIndexedEXT";
+        case ApiCallId::ApiCall_vkCmdEndQueryIndexedEXT:
+            return "vkCmdEndQueryIndexedEXT";
+        case ApiCallId::ApiCall_vkCmdDrawIndirectByteCountEXT:
+            return "vkCmdDrawIndirectByteCountEXT";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT:
+            return "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT";
+        case ApiCallId::ApiCall_vkGetCalibratedTimestampsEXT:
+            return "vkGetCalibratedTimestampsEXT";
+        case ApiCallId::ApiCall_vkGetBufferDeviceAddressEXT:
+            return "vkGetBufferDeviceAddressEXT";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV:
+            return "vkGetPhysicalDeviceCooperativeMatrixPropertiesNV";
+        case ApiCallId::ApiCall_vkGetImageViewHandleNVX:
+            return "vkGetImageViewHandleNVX";
+        case ApiCallId::ApiCall_vkCreateMetalSurfaceEXT:
+            return "vkCreateMetalSurfaceEXT";
+        case ApiCallId::ApiCall_vkCreateStreamDescriptorSurfaceGGP:
+            return "vkCreateStreamDescriptorSurfaceGGP";
+        case ApiCallId::ApiCall_vkSetLocalDimmingAMD:
+            return "vkSetLocalDimmingAMD";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV:
+            return "vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceSurfacePresentModes2EXT:
+            return "vkGetPhysicalDeviceSurfacePresentModes2EXT";
+        case ApiCallId::ApiCall_vkAcquireFullScreenExclusiveModeEXT:
+            return "vkAcquireFullScreenExclusiveModeEXT";
+        case ApiCallId::ApiCall_vkReleaseFullScreenExclusiveModeEXT:
+            return "vkReleaseFullScreenExclusiveModeEXT";
+        case ApiCallId::ApiCall_vkGetDeviceGroupSurfacePresentModes2EXT:
+            return "vkGetDeviceGroupSurfacePresentModes2EXT";
+        case ApiCallId::ApiCall_vkCreateHeadlessSurfaceEXT:
+            return "vkCreateHeadlessSurfaceEXT";
+        case ApiCallId::ApiCall_vkResetQueryPoolEXT:
+            return "vkResetQueryPoolEXT";
+        case ApiCallId::ApiCall_vkGetPipelineExecutablePropertiesKHR:
+            return "vkGetPipelineExecutablePropertiesKHR";
+        case ApiCallId::ApiCall_vkGetPipelineExecutableStatisticsKHR:
+            return "vkGetPipelineExecutableStatisticsKHR";
+        case ApiCallId::ApiCall_vkGetPipelineExecutableInternalRepresentationsKHR:
+            return "vkGetPipelineExecutableInternalRepresentationsKHR";
+        case ApiCallId::ApiCall_vkInitializePerformanceApiINTEL:
+            return "vkInitializePerformanceApiINTEL";
+        case ApiCallId::ApiCall_vkUninitializePerformanceApiINTEL:
+            return "vkUninitializePerformanceApiINTEL";
+        case ApiCallId::ApiCall_vkCmdSetPerformanceMarkerINTEL:
+            return "vkCmdSetPerformanceMarkerINTEL";
+        case ApiCallId::ApiCall_vkCmdSetPerformanceStreamMarkerINTEL:
+            return "vkCmdSetPerformanceStreamMarkerINTEL";
+        case ApiCallId::ApiCall_vkCmdSetPerformanceOverrideINTEL:
+            return "vkCmdSetPerformanceOverrideINTEL";
+        case ApiCallId::ApiCall_vkAcquirePerformanceConfigurationINTEL:
+            return "vkAcquirePerformanceConfigurationINTEL";
+        case ApiCallId::ApiCall_vkReleasePerformanceConfigurationINTEL:
+            return "vkReleasePerformanceConfigurationINTEL";
+        case ApiCallId::ApiCall_vkQueueSetPerformanceConfigurationINTEL:
+            return "vkQueueSetPerformanceConfigurationINTEL";
+        case ApiCallId::ApiCall_vkGetPerformanceParameterINTEL:
+            return "vkGetPerformanceParameterINTEL";
+        case ApiCallId::ApiCall_vkCmdSetLineStippleEXT:
+            return "vkCmdSetLineStippleEXT";
+        case ApiCallId::ApiCall_vkGetSemaphoreCounterValueKHR:
+            return "vkGetSemaphoreCounterValueKHR";
+        case ApiCallId::ApiCall_vkWaitSemaphoresKHR:
+            return "vkWaitSemaphoresKHR";
+        case ApiCallId::ApiCall_vkSignalSemaphoreKHR:
+            return "vkSignalSemaphoreKHR";
+        case ApiCallId::ApiCall_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR:
+            return "vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR:
+            return "vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR";
+        case ApiCallId::ApiCall_vkAcquireProfilingLockKHR:
+            return "vkAcquireProfilingLockKHR";
+        case ApiCallId::ApiCall_vkReleaseProfilingLockKHR:
+            return "vkReleaseProfilingLockKHR";
+        case ApiCallId::ApiCall_vkGetBufferDeviceAddressKHR:
+            return "vkGetBufferDeviceAddressKHR";
+        case ApiCallId::ApiCall_vkGetBufferOpaqueCaptureAddressKHR:
+            return "vkGetBufferOpaqueCaptureAddressKHR";
+        case ApiCallId::ApiCall_vkGetDeviceMemoryOpaqueCaptureAddressKHR:
+            return "vkGetDeviceMemoryOpaqueCaptureAddressKHR";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceToolPropertiesEXT:
+            return "vkGetPhysicalDeviceToolPropertiesEXT";
+        case ApiCallId::ApiCall_vkCmdDrawIndirectCount:
+            return "vkCmdDrawIndirectCount";
+        case ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCount:
+            return "vkCmdDrawIndexedIndirectCount";
+        case ApiCallId::ApiCall_vkCreateRenderPass2:
+            return "vkCreateRenderPass2";
+        case ApiCallId::ApiCall_vkCmdBeginRenderPass2:
+            return "vkCmdBeginRenderPass2";
+        case ApiCallId::ApiCall_vkCmdNextSubpass2:
+            return "vkCmdNextSubpass2";
+        case ApiCallId::ApiCall_vkCmdEndRenderPass2:
+            return "vkCmdEndRenderPass2";
+        case ApiCallId::ApiCall_vkResetQueryPool:
+            return "vkResetQueryPool";
+        case ApiCallId::ApiCall_vkGetSemaphoreCounterValue:
+            return "vkGetSemaphoreCounterValue";
+        case ApiCallId::ApiCall_vkWaitSemaphores:
+            return "vkWaitSemaphores";
+        case ApiCallId::ApiCall_vkSignalSemaphore:
+            return "vkSignalSemaphore";
+        case ApiCallId::ApiCall_vkGetBufferDeviceAddress:
+            return "vkGetBufferDeviceAddress";
+        case ApiCallId::ApiCall_vkGetBufferOpaqueCaptureAddress:
+            return "vkGetBufferOpaqueCaptureAddress";
+        case ApiCallId::ApiCall_vkGetDeviceMemoryOpaqueCaptureAddress:
+            return "vkGetDeviceMemoryOpaqueCaptureAddress";
+        case ApiCallId::ApiCall_vkCreateDeferredOperationKHR:
+            return "vkCreateDeferredOperationKHR";
+        case ApiCallId::ApiCall_vkDestroyDeferredOperationKHR:
+            return "vkDestroyDeferredOperationKHR";
+        case ApiCallId::ApiCall_vkGetDeferredOperationMaxConcurrencyKHR:
+            return "vkGetDeferredOperationMaxConcurrencyKHR";
+        case ApiCallId::ApiCall_vkGetDeferredOperationResultKHR:
+            return "vkGetDeferredOperationResultKHR";
+        case ApiCallId::ApiCall_vkDeferredOperationJoinKHR:
+            return "vkDeferredOperationJoinKHR";
+        case ApiCallId::ApiCall_vkCreateAccelerationStructureKHR:
+            return "vkCreateAccelerationStructureKHR";
+        case ApiCallId::ApiCall_vkDestroyAccelerationStructureKHR:
+            return "vkDestroyAccelerationStructureKHR";
+        case ApiCallId::ApiCall_vkGetAccelerationStructureMemoryRequirementsKHR:
+            return "vkGetAccelerationStructureMemoryRequirementsKHR";
+        case ApiCallId::ApiCall_vkBindAccelerationStructureMemoryKHR:
+            return "vkBindAccelerationStructureMemoryKHR";
+        case ApiCallId::ApiCall_vkCmdBuildAccelerationStructureKHR:
+            return "vkCmdBuildAccelerationStructureKHR";
+        case ApiCallId::ApiCall_vkCmdBuildAccelerationStructureIndirectKHR:
+            return "vkCmdBuildAccelerationStructureIndirectKHR";
+        case ApiCallId::ApiCall_vkBuildAccelerationStructureKHR:
+            return "vkBuildAccelerationStructureKHR";
+        case ApiCallId::ApiCall_vkCopyAccelerationStructureKHR:
+            return "vkCopyAccelerationStructureKHR";
+        case ApiCallId::ApiCall_vkCopyAccelerationStructureToMemoryKHR:
+            return "vkCopyAccelerationStructureToMemoryKHR";
+        case ApiCallId::ApiCall_vkCopyMemoryToAccelerationStructureKHR:
+            return "vkCopyMemoryToAccelerationStructureKHR";
+        case ApiCallId::ApiCall_vkWriteAccelerationStructuresPropertiesKHR:
+            return "vkWriteAccelerationStructuresPropertiesKHR";
+        case ApiCallId::ApiCall_vkCmdCopyAccelerationStructureKHR:
+            return "vkCmdCopyAccelerationStructureKHR";
+        case ApiCallId::ApiCall_vkCmdCopyAccelerationStructureToMemoryKHR:
+            return "vkCmdCopyAccelerationStructureToMemoryKHR";
+        case ApiCallId::ApiCall_vkCmdCopyMemoryToAccelerationStructureKHR:
+            return "vkCmdCopyMemoryToAccelerationStructureKHR";
+        case ApiCallId::ApiCall_vkCmdTraceRaysKHR:
+            return "vkCmdTraceRaysKHR";
+        case ApiCallId::ApiCall_vkCreateRayTracingPipelinesKHR:
+            return "vkCreateRayTracingPipelinesKHR";
+        case ApiCallId::ApiCall_vkGetRayTracingShaderGroupHandlesKHR:
+            return "vkGetRayTracingShaderGroupHandlesKHR";
+        case ApiCallId::ApiCall_vkCmdWriteAccelerationStructuresPropertiesKHR:
+            return "vkCmdWriteAccelerationStructuresPropertiesKHR";
+        case ApiCallId::ApiCall_vkGetAccelerationStructureDeviceAddressKHR:
+            return "vkGetAccelerationStructureDeviceAddressKHR";
+        case ApiCallId::ApiCall_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR:
+            return "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR";
+        case ApiCallId::ApiCall_vkCmdTraceRaysIndirectKHR:
+            return "vkCmdTraceRaysIndirectKHR";
+        case ApiCallId::ApiCall_vkGetDeviceAccelerationStructureCompatibilityKHR:
+            return "vkGetDeviceAccelerationStructureCompatibilityKHR";
+        case ApiCallId::ApiCall_vkGetGeneratedCommandsMemoryRequirementsNV:
+            return "vkGetGeneratedCommandsMemoryRequirementsNV";
+        case ApiCallId::ApiCall_vkCmdPreprocessGeneratedCommandsNV:
+            return "vkCmdPreprocessGeneratedCommandsNV";
+        case ApiCallId::ApiCall_vkCmdExecuteGeneratedCommandsNV:
+            return "vkCmdExecuteGeneratedCommandsNV";
+        case ApiCallId::ApiCall_vkCmdBindPipelineShaderGroupNV:
+            return "vkCmdBindPipelineShaderGroupNV";
+        case ApiCallId::ApiCall_vkCreateIndirectCommandsLayoutNV:
+            return "vkCreateIndirectCommandsLayoutNV";
+        case ApiCallId::ApiCall_vkDestroyIndirectCommandsLayoutNV:
+            return "vkDestroyIndirectCommandsLayoutNV";
+        case ApiCallId::ApiCall_vkGetImageViewAddressNVX:
+            return "vkGetImageViewAddressNVX";
+        case ApiCallId::ApiCall_vkCreatePrivateDataSlotEXT:
+            return "vkCreatePrivateDataSlotEXT";
+        case ApiCallId::ApiCall_vkDestroyPrivateDataSlotEXT:
+            return "vkDestroyPrivateDataSlotEXT";
+        case ApiCallId::ApiCall_vkSetPrivateDataEXT:
+            return "vkSetPrivateDataEXT";
+        case ApiCallId::ApiCall_vkGetPrivateDataEXT:
+            return "vkGetPrivateDataEXT";
+        case ApiCallId::ApiCall_vkCmdSetCullModeEXT:
+            return "vkCmdSetCullModeEXT";
+        case ApiCallId::ApiCall_vkCmdSetFrontFaceEXT:
+            return "vkCmdSetFrontFaceEXT";
+        case ApiCallId::ApiCall_vkCmdSetPrimitiveTopologyEXT:
+            return "vkCmdSetPrimitiveTopologyEXT";
+        case ApiCallId::ApiCall_vkCmdSetViewportWithCountEXT:
+            return "vkCmdSetViewportWithCountEXT";
+        case ApiCallId::ApiCall_vkCmdSetScissorWithCountEXT:
+            return "vkCmdSetScissorWithCountEXT";
+        case ApiCallId::ApiCall_vkCmdBindVertexBuffers2EXT:
+            return "vkCmdBindVertexBuffers2EXT";
+        case ApiCallId::ApiCall_vkCmdSetDepthTestEnableEXT:
+            return "vkCmdSetDepthTestEnableEXT";
+        case ApiCallId::ApiCall_vkCmdSetDepthWriteEnableEXT:
+            return "vkCmdSetDepthWriteEnableEXT";
+        case ApiCallId::ApiCall_vkCmdSetDepthCompareOpEXT:
+            return "vkCmdSetDepthCompareOpEXT";
+        case ApiCallId::ApiCall_vkCmdSetDepthBoundsTestEnableEXT:
+            return "vkCmdSetDepthBoundsTestEnableEXT";
+        case ApiCallId::ApiCall_vkCmdSetStencilTestEnableEXT:
+            return "vkCmdSetStencilTestEnableEXT";
+        case ApiCallId::ApiCall_vkCmdSetStencilOpEXT:
+            return "vkCmdSetStencilOpEXT";
+        case ApiCallId::ApiCall_vkCreateDirectFBSurfaceEXT:
+            return "vkCreateDirectFBSurfaceEXT";
+        case ApiCallId::ApiCall_vkGetPhysicalDeviceDirectFBPresentationSupportEXT:
+            return "vkGetPhysicalDeviceDirectFBPresentationSupportEXT";
+        default:
+            break;
+    }
+
+    return "Unknown";
+}
+
+GFXRECON_END_NAMESPACE(format)
+GFXRECON_END_NAMESPACE(gfxrecon)
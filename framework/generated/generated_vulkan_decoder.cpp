@@ -34,6 +34,7 @@
 #include "vulkan/vulkan.h"
 
 #include <cstddef>
+#include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
@@ -52,6 +53,8 @@ size_t VulkanDecoder::Decode_vkCreateInstance(const uint8_t* parameter_buffer, s
     bytes_read += pInstance.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateInstance(return_value, &pCreateInfo, &pAllocator, &pInstance);
@@ -70,6 +73,8 @@ size_t VulkanDecoder::Decode_vkDestroyInstance(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &instance);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDestroyInstance(instance, &pAllocator);
@@ -92,6 +97,8 @@ size_t VulkanDecoder::Decode_vkEnumeratePhysicalDevices(const uint8_t* parameter
     bytes_read += pPhysicalDevices.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkEnumeratePhysicalDevices(return_value, instance, &pPhysicalDeviceCount, &pPhysicalDevices);
@@ -110,6 +117,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceFeatures(const uint8_t* paramete
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &physicalDevice);
     bytes_read += pFeatures.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceFeatures(physicalDevice, &pFeatures);
@@ -130,6 +139,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceFormatProperties(const uint8_t*
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &format);
     bytes_read += pFormatProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceFormatProperties(physicalDevice, format, &pFormatProperties);
@@ -160,6 +171,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceImageFormatProperties(const uint
     bytes_read += pImageFormatProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceImageFormatProperties(return_value, physicalDevice, format, type, tiling, usage, flags, &pImageFormatProperties);
@@ -178,6 +191,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceProperties(const uint8_t* parame
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &physicalDevice);
     bytes_read += pProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceProperties(physicalDevice, &pProperties);
@@ -198,6 +213,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceQueueFamilyProperties(const uint
     bytes_read += pQueueFamilyPropertyCount.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pQueueFamilyProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &pQueueFamilyPropertyCount, &pQueueFamilyProperties);
@@ -216,6 +233,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceMemoryProperties(const uint8_t*
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &physicalDevice);
     bytes_read += pMemoryProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceMemoryProperties(physicalDevice, &pMemoryProperties);
@@ -240,6 +259,8 @@ size_t VulkanDecoder::Decode_vkCreateDevice(const uint8_t* parameter_buffer, siz
     bytes_read += pDevice.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateDevice(return_value, physicalDevice, &pCreateInfo, &pAllocator, &pDevice);
@@ -258,6 +279,8 @@ size_t VulkanDecoder::Decode_vkDestroyDevice(const uint8_t* parameter_buffer, si
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &device);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDestroyDevice(device, &pAllocator);
@@ -280,6 +303,8 @@ size_t VulkanDecoder::Decode_vkGetDeviceQueue(const uint8_t* parameter_buffer, s
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &queueIndex);
     bytes_read += pQueue.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetDeviceQueue(device, queueFamilyIndex, queueIndex, &pQueue);
@@ -304,6 +329,8 @@ size_t VulkanDecoder::Decode_vkQueueSubmit(const uint8_t* parameter_buffer, size
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &fence);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkQueueSubmit(return_value, queue, submitCount, &pSubmits, fence);
@@ -322,6 +349,8 @@ size_t VulkanDecoder::Decode_vkQueueWaitIdle(const uint8_t* parameter_buffer, si
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &queue);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkQueueWaitIdle(return_value, queue);
@@ -340,6 +369,8 @@ size_t VulkanDecoder::Decode_vkDeviceWaitIdle(const uint8_t* parameter_buffer, s
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &device);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDeviceWaitIdle(return_value, device);
@@ -364,6 +395,8 @@ size_t VulkanDecoder::Decode_vkAllocateMemory(const uint8_t* parameter_buffer, s
     bytes_read += pMemory.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkAllocateMemory(return_value, device, &pAllocateInfo, &pAllocator, &pMemory);
@@ -384,6 +417,8 @@ size_t VulkanDecoder::Decode_vkFreeMemory(const uint8_t* parameter_buffer, size_
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &memory);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkFreeMemory(device, memory, &pAllocator);
@@ -412,6 +447,8 @@ size_t VulkanDecoder::Decode_vkMapMemory(const uint8_t* parameter_buffer, size_t
     bytes_read += ppData.DecodeVoidPtr((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkMapMemory(return_value, device, memory, offset, size, flags, &ppData);
@@ -430,6 +467,8 @@ size_t VulkanDecoder::Decode_vkUnmapMemory(const uint8_t* parameter_buffer, size
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &device);
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &memory);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkUnmapMemory(device, memory);
@@ -452,6 +491,8 @@ size_t VulkanDecoder::Decode_vkFlushMappedMemoryRanges(const uint8_t* parameter_
     bytes_read += pMemoryRanges.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkFlushMappedMemoryRanges(return_value, device, memoryRangeCount, &pMemoryRanges);
@@ -474,6 +515,8 @@ size_t VulkanDecoder::Decode_vkInvalidateMappedMemoryRanges(const uint8_t* param
     bytes_read += pMemoryRanges.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkInvalidateMappedMemoryRanges(return_value, device, memoryRangeCount, &pMemoryRanges);
@@ -494,6 +537,8 @@ size_t VulkanDecoder::Decode_vkGetDeviceMemoryCommitment(const uint8_t* paramete
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &memory);
     bytes_read += pCommittedMemoryInBytes.DecodeVkDeviceSize((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetDeviceMemoryCommitment(device, memory, &pCommittedMemoryInBytes);
@@ -518,6 +563,8 @@ size_t VulkanDecoder::Decode_vkBindBufferMemory(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeVkDeviceSizeValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &memoryOffset);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkBindBufferMemory(return_value, device, buffer, memory, memoryOffset);
@@ -542,6 +589,8 @@ size_t VulkanDecoder::Decode_vkBindImageMemory(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeVkDeviceSizeValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &memoryOffset);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkBindImageMemory(return_value, device, image, memory, memoryOffset);
@@ -562,6 +611,8 @@ size_t VulkanDecoder::Decode_vkGetBufferMemoryRequirements(const uint8_t* parame
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &buffer);
     bytes_read += pMemoryRequirements.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetBufferMemoryRequirements(device, buffer, &pMemoryRequirements);
@@ -582,6 +633,8 @@ size_t VulkanDecoder::Decode_vkGetImageMemoryRequirements(const uint8_t* paramet
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &image);
     bytes_read += pMemoryRequirements.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetImageMemoryRequirements(device, image, &pMemoryRequirements);
@@ -604,6 +657,8 @@ size_t VulkanDecoder::Decode_vkGetImageSparseMemoryRequirements(const uint8_t* p
     bytes_read += pSparseMemoryRequirementCount.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pSparseMemoryRequirements.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetImageSparseMemoryRequirements(device, image, &pSparseMemoryRequirementCount, &pSparseMemoryRequirements);
@@ -634,6 +689,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceSparseImageFormatProperties(cons
     bytes_read += pPropertyCount.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceSparseImageFormatProperties(physicalDevice, format, type, samples, usage, tiling, &pPropertyCount, &pProperties);
@@ -658,6 +715,8 @@ size_t VulkanDecoder::Decode_vkQueueBindSparse(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &fence);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkQueueBindSparse(return_value, queue, bindInfoCount, &pBindInfo, fence);
@@ -682,6 +741,8 @@ size_t VulkanDecoder::Decode_vkCreateFence(const uint8_t* parameter_buffer, size
     bytes_read += pFence.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateFence(return_value, device, &pCreateInfo, &pAllocator, &pFence);
@@ -702,6 +763,8 @@ size_t VulkanDecoder::Decode_vkDestroyFence(const uint8_t* parameter_buffer, siz
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &fence);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDestroyFence(device, fence, &pAllocator);
@@ -724,6 +787,8 @@ size_t VulkanDecoder::Decode_vkResetFences(const uint8_t* parameter_buffer, size
     bytes_read += pFences.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkResetFences(return_value, device, fenceCount, &pFences);
@@ -744,6 +809,8 @@ size_t VulkanDecoder::Decode_vkGetFenceStatus(const uint8_t* parameter_buffer, s
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &fence);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetFenceStatus(return_value, device, fence);
@@ -770,6 +837,8 @@ size_t VulkanDecoder::Decode_vkWaitForFences(const uint8_t* parameter_buffer, si
     bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &timeout);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkWaitForFences(return_value, device, fenceCount, &pFences, waitAll, timeout);
@@ -794,6 +863,8 @@ size_t VulkanDecoder::Decode_vkCreateSemaphore(const uint8_t* parameter_buffer,
     bytes_read += pSemaphore.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateSemaphore(return_value, device, &pCreateInfo, &pAllocator, &pSemaphore);
@@ -814,6 +885,8 @@ size_t VulkanDecoder::Decode_vkDestroySemaphore(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &semaphore);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDestroySemaphore(device, semaphore, &pAllocator);
@@ -838,6 +911,8 @@ size_t VulkanDecoder::Decode_vkCreateEvent(const uint8_t* parameter_buffer, size
     bytes_read += pEvent.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateEvent(return_value, device, &pCreateInfo, &pAllocator, &pEvent);
@@ -858,6 +933,8 @@ size_t VulkanDecoder::Decode_vkDestroyEvent(const uint8_t* parameter_buffer, siz
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &event);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDestroyEvent(device, event, &pAllocator);
@@ -878,6 +955,8 @@ size_t VulkanDecoder::Decode_vkGetEventStatus(const uint8_t* parameter_buffer, s
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &event);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetEventStatus(return_value, device, event);
@@ -898,6 +977,8 @@ size_t VulkanDecoder::Decode_vkSetEvent(const uint8_t* parameter_buffer, size_t
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &event);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkSetEvent(return_value, device, event);
@@ -918,6 +999,8 @@ size_t VulkanDecoder::Decode_vkResetEvent(const uint8_t* parameter_buffer, size_
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &event);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkResetEvent(return_value, device, event);
@@ -942,6 +1025,8 @@ size_t VulkanDecoder::Decode_vkCreateQueryPool(const uint8_t* parameter_buffer,
     bytes_read += pQueryPool.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateQueryPool(return_value, device, &pCreateInfo, &pAllocator, &pQueryPool);
@@ -962,6 +1047,8 @@ size_t VulkanDecoder::Decode_vkDestroyQueryPool(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &queryPool);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDestroyQueryPool(device, queryPool, &pAllocator);
@@ -994,6 +1081,8 @@ size_t VulkanDecoder::Decode_vkGetQueryPoolResults(const uint8_t* parameter_buff
     bytes_read += ValueDecoder::DecodeFlagsValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &flags);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetQueryPoolResults(return_value, device, queryPool, firstQuery, queryCount, dataSize, &pData, stride, flags);
@@ -1018,6 +1107,8 @@ size_t VulkanDecoder::Decode_vkCreateBuffer(const uint8_t* parameter_buffer, siz
     bytes_read += pBuffer.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateBuffer(return_value, device, &pCreateInfo, &pAllocator, &pBuffer);
@@ -1038,6 +1129,8 @@ size_t VulkanDecoder::Decode_vkDestroyBuffer(const uint8_t* parameter_buffer, si
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &buffer);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDestroyBuffer(device, buffer, &pAllocator);
@@ -1062,6 +1155,8 @@ size_t VulkanDecoder::Decode_vkCreateBufferView(const uint8_t* parameter_buffer,
     bytes_read += pView.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateBufferView(return_value, device, &pCreateInfo, &pAllocator, &pView);
@@ -1082,6 +1177,8 @@ size_t VulkanDecoder::Decode_vkDestroyBufferView(const uint8_t* parameter_buffer
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &bufferView);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDestroyBufferView(device, bufferView, &pAllocator);
@@ -1106,6 +1203,8 @@ size_t VulkanDecoder::Decode_vkCreateImage(const uint8_t* parameter_buffer, size
     bytes_read += pImage.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateImage(return_value, device, &pCreateInfo, &pAllocator, &pImage);
@@ -1126,6 +1225,8 @@ size_t VulkanDecoder::Decode_vkDestroyImage(const uint8_t* parameter_buffer, siz
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &image);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDestroyImage(device, image, &pAllocator);
@@ -1148,6 +1249,8 @@ size_t VulkanDecoder::Decode_vkGetImageSubresourceLayout(const uint8_t* paramete
     bytes_read += pSubresource.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pLayout.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetImageSubresourceLayout(device, image, &pSubresource, &pLayout);
@@ -1172,6 +1275,8 @@ size_t VulkanDecoder::Decode_vkCreateImageView(const uint8_t* parameter_buffer,
     bytes_read += pView.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateImageView(return_value, device, &pCreateInfo, &pAllocator, &pView);
@@ -1192,6 +1297,8 @@ size_t VulkanDecoder::Decode_vkDestroyImageView(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &imageView);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDestroyImageView(device, imageView, &pAllocator);
@@ -1216,6 +1323,8 @@ size_t VulkanDecoder::Decode_vkCreateShaderModule(const uint8_t* parameter_buffe
     bytes_read += pShaderModule.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateShaderModule(return_value, device, &pCreateInfo, &pAllocator, &pShaderModule);
@@ -1236,6 +1345,8 @@ size_t VulkanDecoder::Decode_vkDestroyShaderModule(const uint8_t* parameter_buff
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &shaderModule);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDestroyShaderModule(device, shaderModule, &pAllocator);
@@ -1260,6 +1371,8 @@ size_t VulkanDecoder::Decode_vkCreatePipelineCache(const uint8_t* parameter_buff
     bytes_read += pPipelineCache.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreatePipelineCache(return_value, device, &pCreateInfo, &pAllocator, &pPipelineCache);
@@ -1280,6 +1393,8 @@ size_t VulkanDecoder::Decode_vkDestroyPipelineCache(const uint8_t* parameter_buf
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pipelineCache);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDestroyPipelineCache(device, pipelineCache, &pAllocator);
@@ -1304,6 +1419,8 @@ size_t VulkanDecoder::Decode_vkGetPipelineCacheData(const uint8_t* parameter_buf
     bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPipelineCacheData(return_value, device, pipelineCache, &pDataSize, &pData);
@@ -1328,6 +1445,8 @@ size_t VulkanDecoder::Decode_vkMergePipelineCaches(const uint8_t* parameter_buff
     bytes_read += pSrcCaches.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkMergePipelineCaches(return_value, device, dstCache, srcCacheCount, &pSrcCaches);
@@ -1356,6 +1475,8 @@ size_t VulkanDecoder::Decode_vkCreateGraphicsPipelines(const uint8_t* parameter_
     bytes_read += pPipelines.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateGraphicsPipelines(return_value, device, pipelineCache, createInfoCount, &pCreateInfos, &pAllocator, &pPipelines);
@@ -1384,6 +1505,8 @@ size_t VulkanDecoder::Decode_vkCreateComputePipelines(const uint8_t* parameter_b
     bytes_read += pPipelines.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateComputePipelines(return_value, device, pipelineCache, createInfoCount, &pCreateInfos, &pAllocator, &pPipelines);
@@ -1404,6 +1527,8 @@ size_t VulkanDecoder::Decode_vkDestroyPipeline(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pipeline);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDestroyPipeline(device, pipeline, &pAllocator);
@@ -1428,6 +1553,8 @@ size_t VulkanDecoder::Decode_vkCreatePipelineLayout(const uint8_t* parameter_buf
     bytes_read += pPipelineLayout.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreatePipelineLayout(return_value, device, &pCreateInfo, &pAllocator, &pPipelineLayout);
@@ -1448,6 +1575,8 @@ size_t VulkanDecoder::Decode_vkDestroyPipelineLayout(const uint8_t* parameter_bu
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pipelineLayout);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDestroyPipelineLayout(device, pipelineLayout, &pAllocator);
@@ -1472,6 +1601,8 @@ size_t VulkanDecoder::Decode_vkCreateSampler(const uint8_t* parameter_buffer, si
     bytes_read += pSampler.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateSampler(return_value, device, &pCreateInfo, &pAllocator, &pSampler);
@@ -1492,6 +1623,8 @@ size_t VulkanDecoder::Decode_vkDestroySampler(const uint8_t* parameter_buffer, s
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &sampler);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDestroySampler(device, sampler, &pAllocator);
@@ -1516,6 +1649,8 @@ size_t VulkanDecoder::Decode_vkCreateDescriptorSetLayout(const uint8_t* paramete
     bytes_read += pSetLayout.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateDescriptorSetLayout(return_value, device, &pCreateInfo, &pAllocator, &pSetLayout);
@@ -1536,6 +1671,8 @@ size_t VulkanDecoder::Decode_vkDestroyDescriptorSetLayout(const uint8_t* paramet
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &descriptorSetLayout);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDestroyDescriptorSetLayout(device, descriptorSetLayout, &pAllocator);
@@ -1560,6 +1697,8 @@ size_t VulkanDecoder::Decode_vkCreateDescriptorPool(const uint8_t* parameter_buf
     bytes_read += pDescriptorPool.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateDescriptorPool(return_value, device, &pCreateInfo, &pAllocator, &pDescriptorPool);
@@ -1580,6 +1719,8 @@ size_t VulkanDecoder::Decode_vkDestroyDescriptorPool(const uint8_t* parameter_bu
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &descriptorPool);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDestroyDescriptorPool(device, descriptorPool, &pAllocator);
@@ -1602,6 +1743,8 @@ size_t VulkanDecoder::Decode_vkResetDescriptorPool(const uint8_t* parameter_buff
     bytes_read += ValueDecoder::DecodeFlagsValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &flags);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkResetDescriptorPool(return_value, device, descriptorPool, flags);
@@ -1624,6 +1767,8 @@ size_t VulkanDecoder::Decode_vkAllocateDescriptorSets(const uint8_t* parameter_b
     bytes_read += pDescriptorSets.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkAllocateDescriptorSets(return_value, device, &pAllocateInfo, &pDescriptorSets);
@@ -1648,6 +1793,8 @@ size_t VulkanDecoder::Decode_vkFreeDescriptorSets(const uint8_t* parameter_buffe
     bytes_read += pDescriptorSets.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkFreeDescriptorSets(return_value, device, descriptorPool, descriptorSetCount, &pDescriptorSets);
@@ -1672,6 +1819,8 @@ size_t VulkanDecoder::Decode_vkUpdateDescriptorSets(const uint8_t* parameter_buf
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &descriptorCopyCount);
     bytes_read += pDescriptorCopies.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkUpdateDescriptorSets(device, descriptorWriteCount, &pDescriptorWrites, descriptorCopyCount, &pDescriptorCopies);
@@ -1696,6 +1845,8 @@ size_t VulkanDecoder::Decode_vkCreateFramebuffer(const uint8_t* parameter_buffer
     bytes_read += pFramebuffer.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateFramebuffer(return_value, device, &pCreateInfo, &pAllocator, &pFramebuffer);
@@ -1716,6 +1867,8 @@ size_t VulkanDecoder::Decode_vkDestroyFramebuffer(const uint8_t* parameter_buffe
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &framebuffer);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDestroyFramebuffer(device, framebuffer, &pAllocator);
@@ -1740,6 +1893,8 @@ size_t VulkanDecoder::Decode_vkCreateRenderPass(const uint8_t* parameter_buffer,
     bytes_read += pRenderPass.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateRenderPass(return_value, device, &pCreateInfo, &pAllocator, &pRenderPass);
@@ -1760,6 +1915,8 @@ size_t VulkanDecoder::Decode_vkDestroyRenderPass(const uint8_t* parameter_buffer
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &renderPass);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDestroyRenderPass(device, renderPass, &pAllocator);
@@ -1780,6 +1937,8 @@ size_t VulkanDecoder::Decode_vkGetRenderAreaGranularity(const uint8_t* parameter
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &renderPass);
     bytes_read += pGranularity.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetRenderAreaGranularity(device, renderPass, &pGranularity);
@@ -1804,6 +1963,8 @@ size_t VulkanDecoder::Decode_vkCreateCommandPool(const uint8_t* parameter_buffer
     bytes_read += pCommandPool.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateCommandPool(return_value, device, &pCreateInfo, &pAllocator, &pCommandPool);
@@ -1824,6 +1985,8 @@ size_t VulkanDecoder::Decode_vkDestroyCommandPool(const uint8_t* parameter_buffe
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandPool);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDestroyCommandPool(device, commandPool, &pAllocator);
@@ -1846,6 +2009,8 @@ size_t VulkanDecoder::Decode_vkResetCommandPool(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeFlagsValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &flags);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkResetCommandPool(return_value, device, commandPool, flags);
@@ -1868,6 +2033,8 @@ size_t VulkanDecoder::Decode_vkAllocateCommandBuffers(const uint8_t* parameter_b
     bytes_read += pCommandBuffers.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkAllocateCommandBuffers(return_value, device, &pAllocateInfo, &pCommandBuffers);
@@ -1890,6 +2057,8 @@ size_t VulkanDecoder::Decode_vkFreeCommandBuffers(const uint8_t* parameter_buffe
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBufferCount);
     bytes_read += pCommandBuffers.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkFreeCommandBuffers(device, commandPool, commandBufferCount, &pCommandBuffers);
@@ -1910,6 +2079,8 @@ size_t VulkanDecoder::Decode_vkBeginCommandBuffer(const uint8_t* parameter_buffe
     bytes_read += pBeginInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkBeginCommandBuffer(return_value, commandBuffer, &pBeginInfo);
@@ -1928,6 +2099,8 @@ size_t VulkanDecoder::Decode_vkEndCommandBuffer(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkEndCommandBuffer(return_value, commandBuffer);
@@ -1948,6 +2121,8 @@ size_t VulkanDecoder::Decode_vkResetCommandBuffer(const uint8_t* parameter_buffe
     bytes_read += ValueDecoder::DecodeFlagsValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &flags);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkResetCommandBuffer(return_value, commandBuffer, flags);
@@ -1968,6 +2143,8 @@ size_t VulkanDecoder::Decode_vkCmdBindPipeline(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pipelineBindPoint);
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pipeline);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
@@ -1990,6 +2167,8 @@ size_t VulkanDecoder::Decode_vkCmdSetViewport(const uint8_t* parameter_buffer, s
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &viewportCount);
     bytes_read += pViewports.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdSetViewport(commandBuffer, firstViewport, viewportCount, &pViewports);
@@ -2012,6 +2191,8 @@ size_t VulkanDecoder::Decode_vkCmdSetScissor(const uint8_t* parameter_buffer, si
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &scissorCount);
     bytes_read += pScissors.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdSetScissor(commandBuffer, firstScissor, scissorCount, &pScissors);
@@ -2030,6 +2211,8 @@ size_t VulkanDecoder::Decode_vkCmdSetLineWidth(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += ValueDecoder::DecodeFloatValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &lineWidth);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdSetLineWidth(commandBuffer, lineWidth);
@@ -2052,6 +2235,8 @@ size_t VulkanDecoder::Decode_vkCmdSetDepthBias(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeFloatValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &depthBiasClamp);
     bytes_read += ValueDecoder::DecodeFloatValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &depthBiasSlopeFactor);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
@@ -2070,6 +2255,8 @@ size_t VulkanDecoder::Decode_vkCmdSetBlendConstants(const uint8_t* parameter_buf
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += blendConstants.DecodeFloat((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdSetBlendConstants(commandBuffer, &blendConstants);
@@ -2090,6 +2277,8 @@ size_t VulkanDecoder::Decode_vkCmdSetDepthBounds(const uint8_t* parameter_buffer
     bytes_read += ValueDecoder::DecodeFloatValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &minDepthBounds);
     bytes_read += ValueDecoder::DecodeFloatValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &maxDepthBounds);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
@@ -2110,6 +2299,8 @@ size_t VulkanDecoder::Decode_vkCmdSetStencilCompareMask(const uint8_t* parameter
     bytes_read += ValueDecoder::DecodeFlagsValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &faceMask);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &compareMask);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
@@ -2130,6 +2321,8 @@ size_t VulkanDecoder::Decode_vkCmdSetStencilWriteMask(const uint8_t* parameter_b
     bytes_read += ValueDecoder::DecodeFlagsValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &faceMask);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &writeMask);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
@@ -2150,6 +2343,8 @@ size_t VulkanDecoder::Decode_vkCmdSetStencilReference(const uint8_t* parameter_b
     bytes_read += ValueDecoder::DecodeFlagsValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &faceMask);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &reference);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdSetStencilReference(commandBuffer, faceMask, reference);
@@ -2180,6 +2375,8 @@ size_t VulkanDecoder::Decode_vkCmdBindDescriptorSets(const uint8_t* parameter_bu
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &dynamicOffsetCount);
     bytes_read += pDynamicOffsets.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, &pDescriptorSets, dynamicOffsetCount, &pDynamicOffsets);
@@ -2202,6 +2399,8 @@ size_t VulkanDecoder::Decode_vkCmdBindIndexBuffer(const uint8_t* parameter_buffe
     bytes_read += ValueDecoder::DecodeVkDeviceSizeValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &offset);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &indexType);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
@@ -2226,6 +2425,8 @@ size_t VulkanDecoder::Decode_vkCmdBindVertexBuffers(const uint8_t* parameter_buf
     bytes_read += pBuffers.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pOffsets.DecodeVkDeviceSize((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, &pBuffers, &pOffsets);
@@ -2250,6 +2451,8 @@ size_t VulkanDecoder::Decode_vkCmdDraw(const uint8_t* parameter_buffer, size_t b
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &firstVertex);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &firstInstance);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
@@ -2276,6 +2479,8 @@ size_t VulkanDecoder::Decode_vkCmdDrawIndexed(const uint8_t* parameter_buffer, s
     bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &vertexOffset);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &firstInstance);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
@@ -2300,6 +2505,8 @@ size_t VulkanDecoder::Decode_vkCmdDrawIndirect(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &drawCount);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &stride);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
@@ -2324,6 +2531,8 @@ size_t VulkanDecoder::Decode_vkCmdDrawIndexedIndirect(const uint8_t* parameter_b
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &drawCount);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &stride);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
@@ -2346,6 +2555,8 @@ size_t VulkanDecoder::Decode_vkCmdDispatch(const uint8_t* parameter_buffer, size
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &groupCountY);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &groupCountZ);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
@@ -2366,6 +2577,8 @@ size_t VulkanDecoder::Decode_vkCmdDispatchIndirect(const uint8_t* parameter_buff
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &buffer);
     bytes_read += ValueDecoder::DecodeVkDeviceSizeValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &offset);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdDispatchIndirect(commandBuffer, buffer, offset);
@@ -2390,6 +2603,8 @@ size_t VulkanDecoder::Decode_vkCmdCopyBuffer(const uint8_t* parameter_buffer, si
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &regionCount);
     bytes_read += pRegions.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, &pRegions);
@@ -2418,6 +2633,8 @@ size_t VulkanDecoder::Decode_vkCmdCopyImage(const uint8_t* parameter_buffer, siz
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &regionCount);
     bytes_read += pRegions.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, &pRegions);
@@ -2448,6 +2665,8 @@ size_t VulkanDecoder::Decode_vkCmdBlitImage(const uint8_t* parameter_buffer, siz
     bytes_read += pRegions.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &filter);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, &pRegions, filter);
@@ -2474,6 +2693,8 @@ size_t VulkanDecoder::Decode_vkCmdCopyBufferToImage(const uint8_t* parameter_buf
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &regionCount);
     bytes_read += pRegions.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, &pRegions);
@@ -2500,6 +2721,8 @@ size_t VulkanDecoder::Decode_vkCmdCopyImageToBuffer(const uint8_t* parameter_buf
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &regionCount);
     bytes_read += pRegions.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, &pRegions);
@@ -2524,6 +2747,8 @@ size_t VulkanDecoder::Decode_vkCmdUpdateBuffer(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeVkDeviceSizeValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &dataSize);
     bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, &pData);
@@ -2548,6 +2773,8 @@ size_t VulkanDecoder::Decode_vkCmdFillBuffer(const uint8_t* parameter_buffer, si
     bytes_read += ValueDecoder::DecodeVkDeviceSizeValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &size);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &data);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
@@ -2574,6 +2801,8 @@ size_t VulkanDecoder::Decode_vkCmdClearColorImage(const uint8_t* parameter_buffe
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &rangeCount);
     bytes_read += pRanges.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdClearColorImage(commandBuffer, image, imageLayout, &pColor, rangeCount, &pRanges);
@@ -2600,6 +2829,8 @@ size_t VulkanDecoder::Decode_vkCmdClearDepthStencilImage(const uint8_t* paramete
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &rangeCount);
     bytes_read += pRanges.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdClearDepthStencilImage(commandBuffer, image, imageLayout, &pDepthStencil, rangeCount, &pRanges);
@@ -2624,6 +2855,8 @@ size_t VulkanDecoder::Decode_vkCmdClearAttachments(const uint8_t* parameter_buff
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &rectCount);
     bytes_read += pRects.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdClearAttachments(commandBuffer, attachmentCount, &pAttachments, rectCount, &pRects);
@@ -2652,6 +2885,8 @@ size_t VulkanDecoder::Decode_vkCmdResolveImage(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &regionCount);
     bytes_read += pRegions.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, &pRegions);
@@ -2672,6 +2907,8 @@ size_t VulkanDecoder::Decode_vkCmdSetEvent(const uint8_t* parameter_buffer, size
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &event);
     bytes_read += ValueDecoder::DecodeFlagsValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &stageMask);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdSetEvent(commandBuffer, event, stageMask);
@@ -2692,6 +2929,8 @@ size_t VulkanDecoder::Decode_vkCmdResetEvent(const uint8_t* parameter_buffer, si
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &event);
     bytes_read += ValueDecoder::DecodeFlagsValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &stageMask);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdResetEvent(commandBuffer, event, stageMask);
@@ -2728,6 +2967,8 @@ size_t VulkanDecoder::Decode_vkCmdWaitEvents(const uint8_t* parameter_buffer, si
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &imageMemoryBarrierCount);
     bytes_read += pImageMemoryBarriers.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdWaitEvents(commandBuffer, eventCount, &pEvents, srcStageMask, dstStageMask, memoryBarrierCount, &pMemoryBarriers, bufferMemoryBarrierCount, &pBufferMemoryBarriers, imageMemoryBarrierCount, &pImageMemoryBarriers);
@@ -2762,6 +3003,8 @@ size_t VulkanDecoder::Decode_vkCmdPipelineBarrier(const uint8_t* parameter_buffe
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &imageMemoryBarrierCount);
     bytes_read += pImageMemoryBarriers.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, &pMemoryBarriers, bufferMemoryBarrierCount, &pBufferMemoryBarriers, imageMemoryBarrierCount, &pImageMemoryBarriers);
@@ -2784,6 +3027,8 @@ size_t VulkanDecoder::Decode_vkCmdBeginQuery(const uint8_t* parameter_buffer, si
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &query);
     bytes_read += ValueDecoder::DecodeFlagsValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &flags);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdBeginQuery(commandBuffer, queryPool, query, flags);
@@ -2804,6 +3049,8 @@ size_t VulkanDecoder::Decode_vkCmdEndQuery(const uint8_t* parameter_buffer, size
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &queryPool);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &query);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdEndQuery(commandBuffer, queryPool, query);
@@ -2826,6 +3073,8 @@ size_t VulkanDecoder::Decode_vkCmdResetQueryPool(const uint8_t* parameter_buffer
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &firstQuery);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &queryCount);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
@@ -2848,6 +3097,8 @@ size_t VulkanDecoder::Decode_vkCmdWriteTimestamp(const uint8_t* parameter_buffer
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &queryPool);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &query);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
@@ -2878,6 +3129,8 @@ size_t VulkanDecoder::Decode_vkCmdCopyQueryPoolResults(const uint8_t* parameter_
     bytes_read += ValueDecoder::DecodeVkDeviceSizeValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &stride);
     bytes_read += ValueDecoder::DecodeFlagsValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &flags);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
@@ -2904,6 +3157,8 @@ size_t VulkanDecoder::Decode_vkCmdPushConstants(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &size);
     bytes_read += pValues.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, &pValues);
@@ -2924,6 +3179,8 @@ size_t VulkanDecoder::Decode_vkCmdBeginRenderPass(const uint8_t* parameter_buffe
     bytes_read += pRenderPassBegin.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &contents);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdBeginRenderPass(commandBuffer, &pRenderPassBegin, contents);
@@ -2942,6 +3199,8 @@ size_t VulkanDecoder::Decode_vkCmdNextSubpass(const uint8_t* parameter_buffer, s
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &contents);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdNextSubpass(commandBuffer, contents);
@@ -2958,6 +3217,8 @@ size_t VulkanDecoder::Decode_vkCmdEndRenderPass(const uint8_t* parameter_buffer,
 
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdEndRenderPass(commandBuffer);
@@ -2978,6 +3239,8 @@ size_t VulkanDecoder::Decode_vkCmdExecuteCommands(const uint8_t* parameter_buffe
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBufferCount);
     bytes_read += pCommandBuffers.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdExecuteCommands(commandBuffer, commandBufferCount, &pCommandBuffers);
@@ -3000,6 +3263,8 @@ size_t VulkanDecoder::Decode_vkBindBufferMemory2(const uint8_t* parameter_buffer
     bytes_read += pBindInfos.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkBindBufferMemory2(return_value, device, bindInfoCount, &pBindInfos);
@@ -3022,6 +3287,8 @@ size_t VulkanDecoder::Decode_vkBindImageMemory2(const uint8_t* parameter_buffer,
     bytes_read += pBindInfos.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkBindImageMemory2(return_value, device, bindInfoCount, &pBindInfos);
@@ -3046,6 +3313,8 @@ size_t VulkanDecoder::Decode_vkGetDeviceGroupPeerMemoryFeatures(const uint8_t* p
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &remoteDeviceIndex);
     bytes_read += pPeerMemoryFeatures.DecodeFlags((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex, &pPeerMemoryFeatures);
@@ -3064,6 +3333,8 @@ size_t VulkanDecoder::Decode_vkCmdSetDeviceMask(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &deviceMask);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdSetDeviceMask(commandBuffer, deviceMask);
@@ -3092,6 +3363,8 @@ size_t VulkanDecoder::Decode_vkCmdDispatchBase(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &groupCountY);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &groupCountZ);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
@@ -3114,6 +3387,8 @@ size_t VulkanDecoder::Decode_vkEnumeratePhysicalDeviceGroups(const uint8_t* para
     bytes_read += pPhysicalDeviceGroupProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkEnumeratePhysicalDeviceGroups(return_value, instance, &pPhysicalDeviceGroupCount, &pPhysicalDeviceGroupProperties);
@@ -3134,6 +3409,8 @@ size_t VulkanDecoder::Decode_vkGetImageMemoryRequirements2(const uint8_t* parame
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pMemoryRequirements.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetImageMemoryRequirements2(device, &pInfo, &pMemoryRequirements);
@@ -3154,6 +3431,8 @@ size_t VulkanDecoder::Decode_vkGetBufferMemoryRequirements2(const uint8_t* param
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pMemoryRequirements.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetBufferMemoryRequirements2(device, &pInfo, &pMemoryRequirements);
@@ -3176,6 +3455,8 @@ size_t VulkanDecoder::Decode_vkGetImageSparseMemoryRequirements2(const uint8_t*
     bytes_read += pSparseMemoryRequirementCount.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pSparseMemoryRequirements.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetImageSparseMemoryRequirements2(device, &pInfo, &pSparseMemoryRequirementCount, &pSparseMemoryRequirements);
@@ -3194,6 +3475,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceFeatures2(const uint8_t* paramet
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &physicalDevice);
     bytes_read += pFeatures.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceFeatures2(physicalDevice, &pFeatures);
@@ -3212,6 +3495,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceProperties2(const uint8_t* param
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &physicalDevice);
     bytes_read += pProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceProperties2(physicalDevice, &pProperties);
@@ -3232,6 +3517,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceFormatProperties2(const uint8_t*
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &format);
     bytes_read += pFormatProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceFormatProperties2(physicalDevice, format, &pFormatProperties);
@@ -3254,6 +3541,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceImageFormatProperties2(const uin
     bytes_read += pImageFormatProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceImageFormatProperties2(return_value, physicalDevice, &pImageFormatInfo, &pImageFormatProperties);
@@ -3274,6 +3563,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceQueueFamilyProperties2(const uin
     bytes_read += pQueueFamilyPropertyCount.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pQueueFamilyProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceQueueFamilyProperties2(physicalDevice, &pQueueFamilyPropertyCount, &pQueueFamilyProperties);
@@ -3292,6 +3583,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceMemoryProperties2(const uint8_t*
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &physicalDevice);
     bytes_read += pMemoryProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceMemoryProperties2(physicalDevice, &pMemoryProperties);
@@ -3314,6 +3607,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceSparseImageFormatProperties2(con
     bytes_read += pPropertyCount.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceSparseImageFormatProperties2(physicalDevice, &pFormatInfo, &pPropertyCount, &pProperties);
@@ -3334,6 +3629,8 @@ size_t VulkanDecoder::Decode_vkTrimCommandPool(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandPool);
     bytes_read += ValueDecoder::DecodeFlagsValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &flags);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkTrimCommandPool(device, commandPool, flags);
@@ -3354,6 +3651,8 @@ size_t VulkanDecoder::Decode_vkGetDeviceQueue2(const uint8_t* parameter_buffer,
     bytes_read += pQueueInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pQueue.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetDeviceQueue2(device, &pQueueInfo, &pQueue);
@@ -3378,6 +3677,8 @@ size_t VulkanDecoder::Decode_vkCreateSamplerYcbcrConversion(const uint8_t* param
     bytes_read += pYcbcrConversion.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateSamplerYcbcrConversion(return_value, device, &pCreateInfo, &pAllocator, &pYcbcrConversion);
@@ -3398,6 +3699,8 @@ size_t VulkanDecoder::Decode_vkDestroySamplerYcbcrConversion(const uint8_t* para
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &ycbcrConversion);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDestroySamplerYcbcrConversion(device, ycbcrConversion, &pAllocator);
@@ -3422,6 +3725,8 @@ size_t VulkanDecoder::Decode_vkCreateDescriptorUpdateTemplate(const uint8_t* par
     bytes_read += pDescriptorUpdateTemplate.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateDescriptorUpdateTemplate(return_value, device, &pCreateInfo, &pAllocator, &pDescriptorUpdateTemplate);
@@ -3442,6 +3747,8 @@ size_t VulkanDecoder::Decode_vkDestroyDescriptorUpdateTemplate(const uint8_t* pa
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &descriptorUpdateTemplate);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, &pAllocator);
@@ -3462,6 +3769,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceExternalBufferProperties(const u
     bytes_read += pExternalBufferInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pExternalBufferProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceExternalBufferProperties(physicalDevice, &pExternalBufferInfo, &pExternalBufferProperties);
@@ -3482,6 +3791,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceExternalFenceProperties(const ui
     bytes_read += pExternalFenceInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pExternalFenceProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceExternalFenceProperties(physicalDevice, &pExternalFenceInfo, &pExternalFenceProperties);
@@ -3502,6 +3813,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceExternalSemaphoreProperties(cons
     bytes_read += pExternalSemaphoreInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pExternalSemaphoreProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceExternalSemaphoreProperties(physicalDevice, &pExternalSemaphoreInfo, &pExternalSemaphoreProperties);
@@ -3522,6 +3835,8 @@ size_t VulkanDecoder::Decode_vkGetDescriptorSetLayoutSupport(const uint8_t* para
     bytes_read += pCreateInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pSupport.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetDescriptorSetLayoutSupport(device, &pCreateInfo, &pSupport);
@@ -3550,6 +3865,8 @@ size_t VulkanDecoder::Decode_vkCmdDrawIndirectCount(const uint8_t* parameter_buf
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &maxDrawCount);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &stride);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
@@ -3578,6 +3895,8 @@ size_t VulkanDecoder::Decode_vkCmdDrawIndexedIndirectCount(const uint8_t* parame
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &maxDrawCount);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &stride);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
@@ -3602,6 +3921,8 @@ size_t VulkanDecoder::Decode_vkCreateRenderPass2(const uint8_t* parameter_buffer
     bytes_read += pRenderPass.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateRenderPass2(return_value, device, &pCreateInfo, &pAllocator, &pRenderPass);
@@ -3622,6 +3943,8 @@ size_t VulkanDecoder::Decode_vkCmdBeginRenderPass2(const uint8_t* parameter_buff
     bytes_read += pRenderPassBegin.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pSubpassBeginInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdBeginRenderPass2(commandBuffer, &pRenderPassBegin, &pSubpassBeginInfo);
@@ -3642,6 +3965,8 @@ size_t VulkanDecoder::Decode_vkCmdNextSubpass2(const uint8_t* parameter_buffer,
     bytes_read += pSubpassBeginInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pSubpassEndInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdNextSubpass2(commandBuffer, &pSubpassBeginInfo, &pSubpassEndInfo);
@@ -3660,6 +3985,8 @@ size_t VulkanDecoder::Decode_vkCmdEndRenderPass2(const uint8_t* parameter_buffer
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += pSubpassEndInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdEndRenderPass2(commandBuffer, &pSubpassEndInfo);
@@ -3682,6 +4009,8 @@ size_t VulkanDecoder::Decode_vkResetQueryPool(const uint8_t* parameter_buffer, s
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &firstQuery);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &queryCount);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkResetQueryPool(device, queryPool, firstQuery, queryCount);
@@ -3704,6 +4033,8 @@ size_t VulkanDecoder::Decode_vkGetSemaphoreCounterValue(const uint8_t* parameter
     bytes_read += pValue.DecodeUInt64((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetSemaphoreCounterValue(return_value, device, semaphore, &pValue);
@@ -3726,6 +4057,8 @@ size_t VulkanDecoder::Decode_vkWaitSemaphores(const uint8_t* parameter_buffer, s
     bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &timeout);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkWaitSemaphores(return_value, device, &pWaitInfo, timeout);
@@ -3746,6 +4079,8 @@ size_t VulkanDecoder::Decode_vkSignalSemaphore(const uint8_t* parameter_buffer,
     bytes_read += pSignalInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkSignalSemaphore(return_value, device, &pSignalInfo);
@@ -3766,6 +4101,8 @@ size_t VulkanDecoder::Decode_vkGetBufferDeviceAddress(const uint8_t* parameter_b
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeVkDeviceAddressValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetBufferDeviceAddress(return_value, device, &pInfo);
@@ -3786,6 +4123,8 @@ size_t VulkanDecoder::Decode_vkGetBufferOpaqueCaptureAddress(const uint8_t* para
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetBufferOpaqueCaptureAddress(return_value, device, &pInfo);
@@ -3806,6 +4145,8 @@ size_t VulkanDecoder::Decode_vkGetDeviceMemoryOpaqueCaptureAddress(const uint8_t
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetDeviceMemoryOpaqueCaptureAddress(return_value, device, &pInfo);
@@ -3826,6 +4167,8 @@ size_t VulkanDecoder::Decode_vkDestroySurfaceKHR(const uint8_t* parameter_buffer
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &surface);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDestroySurfaceKHR(instance, surface, &pAllocator);
@@ -3850,6 +4193,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceSurfaceSupportKHR(const uint8_t*
     bytes_read += pSupported.DecodeVkBool32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceSurfaceSupportKHR(return_value, physicalDevice, queueFamilyIndex, surface, &pSupported);
@@ -3872,6 +4217,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceSurfaceCapabilitiesKHR(const uin
     bytes_read += pSurfaceCapabilities.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceSurfaceCapabilitiesKHR(return_value, physicalDevice, surface, &pSurfaceCapabilities);
@@ -3896,6 +4243,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceSurfaceFormatsKHR(const uint8_t*
     bytes_read += pSurfaceFormats.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceSurfaceFormatsKHR(return_value, physicalDevice, surface, &pSurfaceFormatCount, &pSurfaceFormats);
@@ -3920,6 +4269,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceSurfacePresentModesKHR(const uin
     bytes_read += pPresentModes.DecodeEnum((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceSurfacePresentModesKHR(return_value, physicalDevice, surface, &pPresentModeCount, &pPresentModes);
@@ -3944,6 +4295,8 @@ size_t VulkanDecoder::Decode_vkCreateSwapchainKHR(const uint8_t* parameter_buffe
     bytes_read += pSwapchain.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateSwapchainKHR(return_value, device, &pCreateInfo, &pAllocator, &pSwapchain);
@@ -3964,6 +4317,8 @@ size_t VulkanDecoder::Decode_vkDestroySwapchainKHR(const uint8_t* parameter_buff
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &swapchain);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDestroySwapchainKHR(device, swapchain, &pAllocator);
@@ -3988,6 +4343,8 @@ size_t VulkanDecoder::Decode_vkGetSwapchainImagesKHR(const uint8_t* parameter_bu
     bytes_read += pSwapchainImages.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetSwapchainImagesKHR(return_value, device, swapchain, &pSwapchainImageCount, &pSwapchainImages);
@@ -4016,6 +4373,8 @@ size_t VulkanDecoder::Decode_vkAcquireNextImageKHR(const uint8_t* parameter_buff
     bytes_read += pImageIndex.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkAcquireNextImageKHR(return_value, device, swapchain, timeout, semaphore, fence, &pImageIndex);
@@ -4036,6 +4395,8 @@ size_t VulkanDecoder::Decode_vkQueuePresentKHR(const uint8_t* parameter_buffer,
     bytes_read += pPresentInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkQueuePresentKHR(return_value, queue, &pPresentInfo);
@@ -4056,6 +4417,8 @@ size_t VulkanDecoder::Decode_vkGetDeviceGroupPresentCapabilitiesKHR(const uint8_
     bytes_read += pDeviceGroupPresentCapabilities.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetDeviceGroupPresentCapabilitiesKHR(return_value, device, &pDeviceGroupPresentCapabilities);
@@ -4078,6 +4441,8 @@ size_t VulkanDecoder::Decode_vkGetDeviceGroupSurfacePresentModesKHR(const uint8_
     bytes_read += pModes.DecodeFlags((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetDeviceGroupSurfacePresentModesKHR(return_value, device, surface, &pModes);
@@ -4102,6 +4467,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDevicePresentRectanglesKHR(const uint8
     bytes_read += pRects.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDevicePresentRectanglesKHR(return_value, physicalDevice, surface, &pRectCount, &pRects);
@@ -4124,6 +4491,8 @@ size_t VulkanDecoder::Decode_vkAcquireNextImage2KHR(const uint8_t* parameter_buf
     bytes_read += pImageIndex.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkAcquireNextImage2KHR(return_value, device, &pAcquireInfo, &pImageIndex);
@@ -4146,6 +4515,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceDisplayPropertiesKHR(const uint8
     bytes_read += pProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceDisplayPropertiesKHR(return_value, physicalDevice, &pPropertyCount, &pProperties);
@@ -4168,6 +4539,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceDisplayPlanePropertiesKHR(const
     bytes_read += pProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceDisplayPlanePropertiesKHR(return_value, physicalDevice, &pPropertyCount, &pProperties);
@@ -4192,6 +4565,8 @@ size_t VulkanDecoder::Decode_vkGetDisplayPlaneSupportedDisplaysKHR(const uint8_t
     bytes_read += pDisplays.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetDisplayPlaneSupportedDisplaysKHR(return_value, physicalDevice, planeIndex, &pDisplayCount, &pDisplays);
@@ -4216,6 +4591,8 @@ size_t VulkanDecoder::Decode_vkGetDisplayModePropertiesKHR(const uint8_t* parame
     bytes_read += pProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetDisplayModePropertiesKHR(return_value, physicalDevice, display, &pPropertyCount, &pProperties);
@@ -4242,6 +4619,8 @@ size_t VulkanDecoder::Decode_vkCreateDisplayModeKHR(const uint8_t* parameter_buf
     bytes_read += pMode.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateDisplayModeKHR(return_value, physicalDevice, display, &pCreateInfo, &pAllocator, &pMode);
@@ -4266,6 +4645,8 @@ size_t VulkanDecoder::Decode_vkGetDisplayPlaneCapabilitiesKHR(const uint8_t* par
     bytes_read += pCapabilities.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetDisplayPlaneCapabilitiesKHR(return_value, physicalDevice, mode, planeIndex, &pCapabilities);
@@ -4290,6 +4671,8 @@ size_t VulkanDecoder::Decode_vkCreateDisplayPlaneSurfaceKHR(const uint8_t* param
     bytes_read += pSurface.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateDisplayPlaneSurfaceKHR(return_value, instance, &pCreateInfo, &pAllocator, &pSurface);
@@ -4316,6 +4699,8 @@ size_t VulkanDecoder::Decode_vkCreateSharedSwapchainsKHR(const uint8_t* paramete
     bytes_read += pSwapchains.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateSharedSwapchainsKHR(return_value, device, swapchainCount, &pCreateInfos, &pAllocator, &pSwapchains);
@@ -4340,6 +4725,8 @@ size_t VulkanDecoder::Decode_vkCreateXlibSurfaceKHR(const uint8_t* parameter_buf
     bytes_read += pSurface.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateXlibSurfaceKHR(return_value, instance, &pCreateInfo, &pAllocator, &pSurface);
@@ -4364,6 +4751,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceXlibPresentationSupportKHR(const
     bytes_read += ValueDecoder::DecodeSizeTValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &visualID);
     bytes_read += ValueDecoder::DecodeVkBool32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceXlibPresentationSupportKHR(return_value, physicalDevice, queueFamilyIndex, dpy, visualID);
@@ -4388,6 +4777,8 @@ size_t VulkanDecoder::Decode_vkCreateXcbSurfaceKHR(const uint8_t* parameter_buff
     bytes_read += pSurface.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateXcbSurfaceKHR(return_value, instance, &pCreateInfo, &pAllocator, &pSurface);
@@ -4412,6 +4803,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceXcbPresentationSupportKHR(const
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &visual_id);
     bytes_read += ValueDecoder::DecodeVkBool32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceXcbPresentationSupportKHR(return_value, physicalDevice, queueFamilyIndex, connection, visual_id);
@@ -4436,6 +4829,8 @@ size_t VulkanDecoder::Decode_vkCreateWaylandSurfaceKHR(const uint8_t* parameter_
     bytes_read += pSurface.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateWaylandSurfaceKHR(return_value, instance, &pCreateInfo, &pAllocator, &pSurface);
@@ -4458,6 +4853,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceWaylandPresentationSupportKHR(co
     bytes_read += ValueDecoder::DecodeAddress((parameter_buffer + bytes_read), (buffer_size - bytes_read), &display);
     bytes_read += ValueDecoder::DecodeVkBool32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceWaylandPresentationSupportKHR(return_value, physicalDevice, queueFamilyIndex, display);
@@ -4482,6 +4879,8 @@ size_t VulkanDecoder::Decode_vkCreateAndroidSurfaceKHR(const uint8_t* parameter_
     bytes_read += pSurface.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateAndroidSurfaceKHR(return_value, instance, &pCreateInfo, &pAllocator, &pSurface);
@@ -4506,6 +4905,8 @@ size_t VulkanDecoder::Decode_vkCreateWin32SurfaceKHR(const uint8_t* parameter_bu
     bytes_read += pSurface.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateWin32SurfaceKHR(return_value, instance, &pCreateInfo, &pAllocator, &pSurface);
@@ -4526,6 +4927,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceWin32PresentationSupportKHR(cons
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &queueFamilyIndex);
     bytes_read += ValueDecoder::DecodeVkBool32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceWin32PresentationSupportKHR(return_value, physicalDevice, queueFamilyIndex);
@@ -4544,6 +4947,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceFeatures2KHR(const uint8_t* para
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &physicalDevice);
     bytes_read += pFeatures.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceFeatures2KHR(physicalDevice, &pFeatures);
@@ -4562,6 +4967,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceProperties2KHR(const uint8_t* pa
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &physicalDevice);
     bytes_read += pProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceProperties2KHR(physicalDevice, &pProperties);
@@ -4582,6 +4989,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceFormatProperties2KHR(const uint8
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &format);
     bytes_read += pFormatProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceFormatProperties2KHR(physicalDevice, format, &pFormatProperties);
@@ -4604,6 +5013,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceImageFormatProperties2KHR(const
     bytes_read += pImageFormatProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceImageFormatProperties2KHR(return_value, physicalDevice, &pImageFormatInfo, &pImageFormatProperties);
@@ -4624,6 +5035,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceQueueFamilyProperties2KHR(const
     bytes_read += pQueueFamilyPropertyCount.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pQueueFamilyProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceQueueFamilyProperties2KHR(physicalDevice, &pQueueFamilyPropertyCount, &pQueueFamilyProperties);
@@ -4642,6 +5055,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceMemoryProperties2KHR(const uint8
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &physicalDevice);
     bytes_read += pMemoryProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceMemoryProperties2KHR(physicalDevice, &pMemoryProperties);
@@ -4664,6 +5079,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceSparseImageFormatProperties2KHR(
     bytes_read += pPropertyCount.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceSparseImageFormatProperties2KHR(physicalDevice, &pFormatInfo, &pPropertyCount, &pProperties);
@@ -4688,6 +5105,8 @@ size_t VulkanDecoder::Decode_vkGetDeviceGroupPeerMemoryFeaturesKHR(const uint8_t
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &remoteDeviceIndex);
     bytes_read += pPeerMemoryFeatures.DecodeFlags((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex, &pPeerMemoryFeatures);
@@ -4706,6 +5125,8 @@ size_t VulkanDecoder::Decode_vkCmdSetDeviceMaskKHR(const uint8_t* parameter_buff
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &deviceMask);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdSetDeviceMaskKHR(commandBuffer, deviceMask);
@@ -4734,6 +5155,8 @@ size_t VulkanDecoder::Decode_vkCmdDispatchBaseKHR(const uint8_t* parameter_buffe
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &groupCountY);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &groupCountZ);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
@@ -4754,6 +5177,8 @@ size_t VulkanDecoder::Decode_vkTrimCommandPoolKHR(const uint8_t* parameter_buffe
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandPool);
     bytes_read += ValueDecoder::DecodeFlagsValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &flags);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkTrimCommandPoolKHR(device, commandPool, flags);
@@ -4776,6 +5201,8 @@ size_t VulkanDecoder::Decode_vkEnumeratePhysicalDeviceGroupsKHR(const uint8_t* p
     bytes_read += pPhysicalDeviceGroupProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkEnumeratePhysicalDeviceGroupsKHR(return_value, instance, &pPhysicalDeviceGroupCount, &pPhysicalDeviceGroupProperties);
@@ -4796,6 +5223,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceExternalBufferPropertiesKHR(cons
     bytes_read += pExternalBufferInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pExternalBufferProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceExternalBufferPropertiesKHR(physicalDevice, &pExternalBufferInfo, &pExternalBufferProperties);
@@ -4818,6 +5247,8 @@ size_t VulkanDecoder::Decode_vkGetMemoryWin32HandleKHR(const uint8_t* parameter_
     bytes_read += pHandle.DecodeVoidPtr((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetMemoryWin32HandleKHR(return_value, device, &pGetWin32HandleInfo, &pHandle);
@@ -4842,6 +5273,8 @@ size_t VulkanDecoder::Decode_vkGetMemoryWin32HandlePropertiesKHR(const uint8_t*
     bytes_read += pMemoryWin32HandleProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetMemoryWin32HandlePropertiesKHR(return_value, device, handleType, handle, &pMemoryWin32HandleProperties);
@@ -4864,6 +5297,8 @@ size_t VulkanDecoder::Decode_vkGetMemoryFdKHR(const uint8_t* parameter_buffer, s
     bytes_read += pFd.DecodeInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetMemoryFdKHR(return_value, device, &pGetFdInfo, &pFd);
@@ -4888,6 +5323,8 @@ size_t VulkanDecoder::Decode_vkGetMemoryFdPropertiesKHR(const uint8_t* parameter
     bytes_read += pMemoryFdProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetMemoryFdPropertiesKHR(return_value, device, handleType, fd, &pMemoryFdProperties);
@@ -4908,6 +5345,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR(c
     bytes_read += pExternalSemaphoreInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pExternalSemaphoreProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR(physicalDevice, &pExternalSemaphoreInfo, &pExternalSemaphoreProperties);
@@ -4928,6 +5367,8 @@ size_t VulkanDecoder::Decode_vkImportSemaphoreWin32HandleKHR(const uint8_t* para
     bytes_read += pImportSemaphoreWin32HandleInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkImportSemaphoreWin32HandleKHR(return_value, device, &pImportSemaphoreWin32HandleInfo);
@@ -4950,6 +5391,8 @@ size_t VulkanDecoder::Decode_vkGetSemaphoreWin32HandleKHR(const uint8_t* paramet
     bytes_read += pHandle.DecodeVoidPtr((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetSemaphoreWin32HandleKHR(return_value, device, &pGetWin32HandleInfo, &pHandle);
@@ -4970,6 +5413,8 @@ size_t VulkanDecoder::Decode_vkImportSemaphoreFdKHR(const uint8_t* parameter_buf
     bytes_read += pImportSemaphoreFdInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkImportSemaphoreFdKHR(return_value, device, &pImportSemaphoreFdInfo);
@@ -4992,6 +5437,8 @@ size_t VulkanDecoder::Decode_vkGetSemaphoreFdKHR(const uint8_t* parameter_buffer
     bytes_read += pFd.DecodeInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetSemaphoreFdKHR(return_value, device, &pGetFdInfo, &pFd);
@@ -5018,6 +5465,8 @@ size_t VulkanDecoder::Decode_vkCmdPushDescriptorSetKHR(const uint8_t* parameter_
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &descriptorWriteCount);
     bytes_read += pDescriptorWrites.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, &pDescriptorWrites);
@@ -5042,6 +5491,8 @@ size_t VulkanDecoder::Decode_vkCreateDescriptorUpdateTemplateKHR(const uint8_t*
     bytes_read += pDescriptorUpdateTemplate.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateDescriptorUpdateTemplateKHR(return_value, device, &pCreateInfo, &pAllocator, &pDescriptorUpdateTemplate);
@@ -5062,6 +5513,8 @@ size_t VulkanDecoder::Decode_vkDestroyDescriptorUpdateTemplateKHR(const uint8_t*
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &descriptorUpdateTemplate);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, &pAllocator);
@@ -5086,6 +5539,8 @@ size_t VulkanDecoder::Decode_vkCreateRenderPass2KHR(const uint8_t* parameter_buf
     bytes_read += pRenderPass.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateRenderPass2KHR(return_value, device, &pCreateInfo, &pAllocator, &pRenderPass);
@@ -5106,6 +5561,8 @@ size_t VulkanDecoder::Decode_vkCmdBeginRenderPass2KHR(const uint8_t* parameter_b
     bytes_read += pRenderPassBegin.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pSubpassBeginInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdBeginRenderPass2KHR(commandBuffer, &pRenderPassBegin, &pSubpassBeginInfo);
@@ -5126,6 +5583,8 @@ size_t VulkanDecoder::Decode_vkCmdNextSubpass2KHR(const uint8_t* parameter_buffe
     bytes_read += pSubpassBeginInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pSubpassEndInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdNextSubpass2KHR(commandBuffer, &pSubpassBeginInfo, &pSubpassEndInfo);
@@ -5144,6 +5603,8 @@ size_t VulkanDecoder::Decode_vkCmdEndRenderPass2KHR(const uint8_t* parameter_buf
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += pSubpassEndInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdEndRenderPass2KHR(commandBuffer, &pSubpassEndInfo);
@@ -5164,6 +5625,8 @@ size_t VulkanDecoder::Decode_vkGetSwapchainStatusKHR(const uint8_t* parameter_bu
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &swapchain);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetSwapchainStatusKHR(return_value, device, swapchain);
@@ -5184,6 +5647,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceExternalFencePropertiesKHR(const
     bytes_read += pExternalFenceInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pExternalFenceProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceExternalFencePropertiesKHR(physicalDevice, &pExternalFenceInfo, &pExternalFenceProperties);
@@ -5204,6 +5669,8 @@ size_t VulkanDecoder::Decode_vkImportFenceWin32HandleKHR(const uint8_t* paramete
     bytes_read += pImportFenceWin32HandleInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkImportFenceWin32HandleKHR(return_value, device, &pImportFenceWin32HandleInfo);
@@ -5226,6 +5693,8 @@ size_t VulkanDecoder::Decode_vkGetFenceWin32HandleKHR(const uint8_t* parameter_b
     bytes_read += pHandle.DecodeVoidPtr((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetFenceWin32HandleKHR(return_value, device, &pGetWin32HandleInfo, &pHandle);
@@ -5246,6 +5715,8 @@ size_t VulkanDecoder::Decode_vkImportFenceFdKHR(const uint8_t* parameter_buffer,
     bytes_read += pImportFenceFdInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkImportFenceFdKHR(return_value, device, &pImportFenceFdInfo);
@@ -5268,6 +5739,8 @@ size_t VulkanDecoder::Decode_vkGetFenceFdKHR(const uint8_t* parameter_buffer, si
     bytes_read += pFd.DecodeInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetFenceFdKHR(return_value, device, &pGetFdInfo, &pFd);
@@ -5294,6 +5767,8 @@ size_t VulkanDecoder::Decode_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQuer
     bytes_read += pCounterDescriptions.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(return_value, physicalDevice, queueFamilyIndex, &pCounterCount, &pCounters, &pCounterDescriptions);
@@ -5314,6 +5789,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPasse
     bytes_read += pPerformanceQueryCreateInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pNumPasses.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(physicalDevice, &pPerformanceQueryCreateInfo, &pNumPasses);
@@ -5334,6 +5811,8 @@ size_t VulkanDecoder::Decode_vkAcquireProfilingLockKHR(const uint8_t* parameter_
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkAcquireProfilingLockKHR(return_value, device, &pInfo);
@@ -5350,6 +5829,8 @@ size_t VulkanDecoder::Decode_vkReleaseProfilingLockKHR(const uint8_t* parameter_
 
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &device);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkReleaseProfilingLockKHR(device);
@@ -5372,6 +5853,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceSurfaceCapabilities2KHR(const ui
     bytes_read += pSurfaceCapabilities.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceSurfaceCapabilities2KHR(return_value, physicalDevice, &pSurfaceInfo, &pSurfaceCapabilities);
@@ -5396,6 +5879,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceSurfaceFormats2KHR(const uint8_t
     bytes_read += pSurfaceFormats.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceSurfaceFormats2KHR(return_value, physicalDevice, &pSurfaceInfo, &pSurfaceFormatCount, &pSurfaceFormats);
@@ -5418,6 +5903,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceDisplayProperties2KHR(const uint
     bytes_read += pProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceDisplayProperties2KHR(return_value, physicalDevice, &pPropertyCount, &pProperties);
@@ -5440,6 +5927,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceDisplayPlaneProperties2KHR(const
     bytes_read += pProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceDisplayPlaneProperties2KHR(return_value, physicalDevice, &pPropertyCount, &pProperties);
@@ -5464,6 +5953,8 @@ size_t VulkanDecoder::Decode_vkGetDisplayModeProperties2KHR(const uint8_t* param
     bytes_read += pProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetDisplayModeProperties2KHR(return_value, physicalDevice, display, &pPropertyCount, &pProperties);
@@ -5486,6 +5977,8 @@ size_t VulkanDecoder::Decode_vkGetDisplayPlaneCapabilities2KHR(const uint8_t* pa
     bytes_read += pCapabilities.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetDisplayPlaneCapabilities2KHR(return_value, physicalDevice, &pDisplayPlaneInfo, &pCapabilities);
@@ -5506,6 +5999,8 @@ size_t VulkanDecoder::Decode_vkGetImageMemoryRequirements2KHR(const uint8_t* par
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pMemoryRequirements.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetImageMemoryRequirements2KHR(device, &pInfo, &pMemoryRequirements);
@@ -5526,6 +6021,8 @@ size_t VulkanDecoder::Decode_vkGetBufferMemoryRequirements2KHR(const uint8_t* pa
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pMemoryRequirements.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetBufferMemoryRequirements2KHR(device, &pInfo, &pMemoryRequirements);
@@ -5548,6 +6045,8 @@ size_t VulkanDecoder::Decode_vkGetImageSparseMemoryRequirements2KHR(const uint8_
     bytes_read += pSparseMemoryRequirementCount.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pSparseMemoryRequirements.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetImageSparseMemoryRequirements2KHR(device, &pInfo, &pSparseMemoryRequirementCount, &pSparseMemoryRequirements);
@@ -5572,6 +6071,8 @@ size_t VulkanDecoder::Decode_vkCreateSamplerYcbcrConversionKHR(const uint8_t* pa
     bytes_read += pYcbcrConversion.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateSamplerYcbcrConversionKHR(return_value, device, &pCreateInfo, &pAllocator, &pYcbcrConversion);
@@ -5592,6 +6093,8 @@ size_t VulkanDecoder::Decode_vkDestroySamplerYcbcrConversionKHR(const uint8_t* p
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &ycbcrConversion);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, &pAllocator);
@@ -5614,6 +6117,8 @@ size_t VulkanDecoder::Decode_vkBindBufferMemory2KHR(const uint8_t* parameter_buf
     bytes_read += pBindInfos.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkBindBufferMemory2KHR(return_value, device, bindInfoCount, &pBindInfos);
@@ -5636,6 +6141,8 @@ size_t VulkanDecoder::Decode_vkBindImageMemory2KHR(const uint8_t* parameter_buff
     bytes_read += pBindInfos.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkBindImageMemory2KHR(return_value, device, bindInfoCount, &pBindInfos);
@@ -5656,6 +6163,8 @@ size_t VulkanDecoder::Decode_vkGetDescriptorSetLayoutSupportKHR(const uint8_t* p
     bytes_read += pCreateInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pSupport.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetDescriptorSetLayoutSupportKHR(device, &pCreateInfo, &pSupport);
@@ -5684,6 +6193,8 @@ size_t VulkanDecoder::Decode_vkCmdDrawIndirectCountKHR(const uint8_t* parameter_
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &maxDrawCount);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &stride);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
@@ -5712,6 +6223,8 @@ size_t VulkanDecoder::Decode_vkCmdDrawIndexedIndirectCountKHR(const uint8_t* par
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &maxDrawCount);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &stride);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
@@ -5734,6 +6247,8 @@ size_t VulkanDecoder::Decode_vkGetSemaphoreCounterValueKHR(const uint8_t* parame
     bytes_read += pValue.DecodeUInt64((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetSemaphoreCounterValueKHR(return_value, device, semaphore, &pValue);
@@ -5756,6 +6271,8 @@ size_t VulkanDecoder::Decode_vkWaitSemaphoresKHR(const uint8_t* parameter_buffer
     bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &timeout);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkWaitSemaphoresKHR(return_value, device, &pWaitInfo, timeout);
@@ -5776,6 +6293,8 @@ size_t VulkanDecoder::Decode_vkSignalSemaphoreKHR(const uint8_t* parameter_buffe
     bytes_read += pSignalInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkSignalSemaphoreKHR(return_value, device, &pSignalInfo);
@@ -5796,6 +6315,8 @@ size_t VulkanDecoder::Decode_vkGetBufferDeviceAddressKHR(const uint8_t* paramete
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeVkDeviceAddressValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetBufferDeviceAddressKHR(return_value, device, &pInfo);
@@ -5816,6 +6337,8 @@ size_t VulkanDecoder::Decode_vkGetBufferOpaqueCaptureAddressKHR(const uint8_t* p
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetBufferOpaqueCaptureAddressKHR(return_value, device, &pInfo);
@@ -5836,6 +6359,8 @@ size_t VulkanDecoder::Decode_vkGetDeviceMemoryOpaqueCaptureAddressKHR(const uint
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetDeviceMemoryOpaqueCaptureAddressKHR(return_value, device, &pInfo);
@@ -5858,6 +6383,8 @@ size_t VulkanDecoder::Decode_vkCreateDeferredOperationKHR(const uint8_t* paramet
     bytes_read += pDeferredOperation.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateDeferredOperationKHR(return_value, device, &pAllocator, &pDeferredOperation);
@@ -5878,6 +6405,8 @@ size_t VulkanDecoder::Decode_vkDestroyDeferredOperationKHR(const uint8_t* parame
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &operation);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDestroyDeferredOperationKHR(device, operation, &pAllocator);
@@ -5898,6 +6427,8 @@ size_t VulkanDecoder::Decode_vkGetDeferredOperationMaxConcurrencyKHR(const uint8
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &operation);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetDeferredOperationMaxConcurrencyKHR(return_value, device, operation);
@@ -5918,6 +6449,8 @@ size_t VulkanDecoder::Decode_vkGetDeferredOperationResultKHR(const uint8_t* para
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &operation);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetDeferredOperationResultKHR(return_value, device, operation);
@@ -5938,6 +6471,8 @@ size_t VulkanDecoder::Decode_vkDeferredOperationJoinKHR(const uint8_t* parameter
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &operation);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDeferredOperationJoinKHR(return_value, device, operation);
@@ -5962,6 +6497,8 @@ size_t VulkanDecoder::Decode_vkGetPipelineExecutablePropertiesKHR(const uint8_t*
     bytes_read += pProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPipelineExecutablePropertiesKHR(return_value, device, &pPipelineInfo, &pExecutableCount, &pProperties);
@@ -5986,6 +6523,8 @@ size_t VulkanDecoder::Decode_vkGetPipelineExecutableStatisticsKHR(const uint8_t*
     bytes_read += pStatistics.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPipelineExecutableStatisticsKHR(return_value, device, &pExecutableInfo, &pStatisticCount, &pStatistics);
@@ -6010,6 +6549,8 @@ size_t VulkanDecoder::Decode_vkGetPipelineExecutableInternalRepresentationsKHR(c
     bytes_read += pInternalRepresentations.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPipelineExecutableInternalRepresentationsKHR(return_value, device, &pExecutableInfo, &pInternalRepresentationCount, &pInternalRepresentations);
@@ -6034,6 +6575,8 @@ size_t VulkanDecoder::Decode_vkCreateDebugReportCallbackEXT(const uint8_t* param
     bytes_read += pCallback.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateDebugReportCallbackEXT(return_value, instance, &pCreateInfo, &pAllocator, &pCallback);
@@ -6054,6 +6597,8 @@ size_t VulkanDecoder::Decode_vkDestroyDebugReportCallbackEXT(const uint8_t* para
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &callback);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDestroyDebugReportCallbackEXT(instance, callback, &pAllocator);
@@ -6084,6 +6629,8 @@ size_t VulkanDecoder::Decode_vkDebugReportMessageEXT(const uint8_t* parameter_bu
     bytes_read += pLayerPrefix.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pMessage.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDebugReportMessageEXT(instance, flags, objectType, object, location, messageCode, &pLayerPrefix, &pMessage);
@@ -6104,6 +6651,8 @@ size_t VulkanDecoder::Decode_vkDebugMarkerSetObjectTagEXT(const uint8_t* paramet
     bytes_read += pTagInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDebugMarkerSetObjectTagEXT(return_value, device, &pTagInfo);
@@ -6124,6 +6673,8 @@ size_t VulkanDecoder::Decode_vkDebugMarkerSetObjectNameEXT(const uint8_t* parame
     bytes_read += pNameInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDebugMarkerSetObjectNameEXT(return_value, device, &pNameInfo);
@@ -6142,6 +6693,8 @@ size_t VulkanDecoder::Decode_vkCmdDebugMarkerBeginEXT(const uint8_t* parameter_b
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += pMarkerInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdDebugMarkerBeginEXT(commandBuffer, &pMarkerInfo);
@@ -6158,6 +6711,8 @@ size_t VulkanDecoder::Decode_vkCmdDebugMarkerEndEXT(const uint8_t* parameter_buf
 
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdDebugMarkerEndEXT(commandBuffer);
@@ -6176,6 +6731,8 @@ size_t VulkanDecoder::Decode_vkCmdDebugMarkerInsertEXT(const uint8_t* parameter_
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += pMarkerInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdDebugMarkerInsertEXT(commandBuffer, &pMarkerInfo);
@@ -6202,6 +6759,8 @@ size_t VulkanDecoder::Decode_vkCmdBindTransformFeedbackBuffersEXT(const uint8_t*
     bytes_read += pOffsets.DecodeVkDeviceSize((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pSizes.DecodeVkDeviceSize((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, &pBuffers, &pOffsets, &pSizes);
@@ -6226,6 +6785,8 @@ size_t VulkanDecoder::Decode_vkCmdBeginTransformFeedbackEXT(const uint8_t* param
     bytes_read += pCounterBuffers.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pCounterBufferOffsets.DecodeVkDeviceSize((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, &pCounterBuffers, &pCounterBufferOffsets);
@@ -6250,6 +6811,8 @@ size_t VulkanDecoder::Decode_vkCmdEndTransformFeedbackEXT(const uint8_t* paramet
     bytes_read += pCounterBuffers.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pCounterBufferOffsets.DecodeVkDeviceSize((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, &pCounterBuffers, &pCounterBufferOffsets);
@@ -6274,6 +6837,8 @@ size_t VulkanDecoder::Decode_vkCmdBeginQueryIndexedEXT(const uint8_t* parameter_
     bytes_read += ValueDecoder::DecodeFlagsValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &flags);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &index);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
@@ -6296,6 +6861,8 @@ size_t VulkanDecoder::Decode_vkCmdEndQueryIndexedEXT(const uint8_t* parameter_bu
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &query);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &index);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
@@ -6324,6 +6891,8 @@ size_t VulkanDecoder::Decode_vkCmdDrawIndirectByteCountEXT(const uint8_t* parame
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &counterOffset);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &vertexStride);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
@@ -6344,6 +6913,8 @@ size_t VulkanDecoder::Decode_vkGetImageViewHandleNVX(const uint8_t* parameter_bu
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetImageViewHandleNVX(return_value, device, &pInfo);
@@ -6366,6 +6937,8 @@ size_t VulkanDecoder::Decode_vkGetImageViewAddressNVX(const uint8_t* parameter_b
     bytes_read += pProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetImageViewAddressNVX(return_value, device, imageView, &pProperties);
@@ -6394,6 +6967,8 @@ size_t VulkanDecoder::Decode_vkCmdDrawIndirectCountAMD(const uint8_t* parameter_
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &maxDrawCount);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &stride);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
@@ -6422,6 +6997,8 @@ size_t VulkanDecoder::Decode_vkCmdDrawIndexedIndirectCountAMD(const uint8_t* par
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &maxDrawCount);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &stride);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
@@ -6450,6 +7027,8 @@ size_t VulkanDecoder::Decode_vkGetShaderInfoAMD(const uint8_t* parameter_buffer,
     bytes_read += pInfo.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetShaderInfoAMD(return_value, device, pipeline, shaderStage, infoType, &pInfoSize, &pInfo);
@@ -6474,6 +7053,8 @@ size_t VulkanDecoder::Decode_vkCreateStreamDescriptorSurfaceGGP(const uint8_t* p
     bytes_read += pSurface.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateStreamDescriptorSurfaceGGP(return_value, instance, &pCreateInfo, &pAllocator, &pSurface);
@@ -6506,6 +7087,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceExternalImageFormatPropertiesNV(
     bytes_read += pExternalImageFormatProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceExternalImageFormatPropertiesNV(return_value, physicalDevice, format, type, tiling, usage, flags, externalHandleType, &pExternalImageFormatProperties);
@@ -6530,6 +7113,8 @@ size_t VulkanDecoder::Decode_vkGetMemoryWin32HandleNV(const uint8_t* parameter_b
     bytes_read += pHandle.DecodeVoidPtr((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetMemoryWin32HandleNV(return_value, device, memory, handleType, &pHandle);
@@ -6554,6 +7139,8 @@ size_t VulkanDecoder::Decode_vkCreateViSurfaceNN(const uint8_t* parameter_buffer
     bytes_read += pSurface.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateViSurfaceNN(return_value, instance, &pCreateInfo, &pAllocator, &pSurface);
@@ -6572,6 +7159,8 @@ size_t VulkanDecoder::Decode_vkCmdBeginConditionalRenderingEXT(const uint8_t* pa
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += pConditionalRenderingBegin.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdBeginConditionalRenderingEXT(commandBuffer, &pConditionalRenderingBegin);
@@ -6588,6 +7177,8 @@ size_t VulkanDecoder::Decode_vkCmdEndConditionalRenderingEXT(const uint8_t* para
 
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdEndConditionalRenderingEXT(commandBuffer);
@@ -6610,6 +7201,8 @@ size_t VulkanDecoder::Decode_vkCmdSetViewportWScalingNV(const uint8_t* parameter
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &viewportCount);
     bytes_read += pViewportWScalings.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, &pViewportWScalings);
@@ -6630,6 +7223,8 @@ size_t VulkanDecoder::Decode_vkReleaseDisplayEXT(const uint8_t* parameter_buffer
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &display);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkReleaseDisplayEXT(return_value, physicalDevice, display);
@@ -6652,6 +7247,8 @@ size_t VulkanDecoder::Decode_vkAcquireXlibDisplayEXT(const uint8_t* parameter_bu
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &display);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkAcquireXlibDisplayEXT(return_value, physicalDevice, dpy, display);
@@ -6676,6 +7273,8 @@ size_t VulkanDecoder::Decode_vkGetRandROutputDisplayEXT(const uint8_t* parameter
     bytes_read += pDisplay.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetRandROutputDisplayEXT(return_value, physicalDevice, dpy, rrOutput, &pDisplay);
@@ -6698,6 +7297,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceSurfaceCapabilities2EXT(const ui
     bytes_read += pSurfaceCapabilities.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceSurfaceCapabilities2EXT(return_value, physicalDevice, surface, &pSurfaceCapabilities);
@@ -6720,6 +7321,8 @@ size_t VulkanDecoder::Decode_vkDisplayPowerControlEXT(const uint8_t* parameter_b
     bytes_read += pDisplayPowerInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDisplayPowerControlEXT(return_value, device, display, &pDisplayPowerInfo);
@@ -6744,6 +7347,8 @@ size_t VulkanDecoder::Decode_vkRegisterDeviceEventEXT(const uint8_t* parameter_b
     bytes_read += pFence.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkRegisterDeviceEventEXT(return_value, device, &pDeviceEventInfo, &pAllocator, &pFence);
@@ -6770,6 +7375,8 @@ size_t VulkanDecoder::Decode_vkRegisterDisplayEventEXT(const uint8_t* parameter_
     bytes_read += pFence.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkRegisterDisplayEventEXT(return_value, device, display, &pDisplayEventInfo, &pAllocator, &pFence);
@@ -6794,6 +7401,8 @@ size_t VulkanDecoder::Decode_vkGetSwapchainCounterEXT(const uint8_t* parameter_b
     bytes_read += pCounterValue.DecodeUInt64((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetSwapchainCounterEXT(return_value, device, swapchain, counter, &pCounterValue);
@@ -6816,6 +7425,8 @@ size_t VulkanDecoder::Decode_vkGetRefreshCycleDurationGOOGLE(const uint8_t* para
     bytes_read += pDisplayTimingProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetRefreshCycleDurationGOOGLE(return_value, device, swapchain, &pDisplayTimingProperties);
@@ -6840,6 +7451,8 @@ size_t VulkanDecoder::Decode_vkGetPastPresentationTimingGOOGLE(const uint8_t* pa
     bytes_read += pPresentationTimings.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPastPresentationTimingGOOGLE(return_value, device, swapchain, &pPresentationTimingCount, &pPresentationTimings);
@@ -6862,6 +7475,8 @@ size_t VulkanDecoder::Decode_vkCmdSetDiscardRectangleEXT(const uint8_t* paramete
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &discardRectangleCount);
     bytes_read += pDiscardRectangles.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, &pDiscardRectangles);
@@ -6884,6 +7499,8 @@ size_t VulkanDecoder::Decode_vkSetHdrMetadataEXT(const uint8_t* parameter_buffer
     bytes_read += pSwapchains.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pMetadata.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkSetHdrMetadataEXT(device, swapchainCount, &pSwapchains, &pMetadata);
@@ -6908,6 +7525,8 @@ size_t VulkanDecoder::Decode_vkCreateIOSSurfaceMVK(const uint8_t* parameter_buff
     bytes_read += pSurface.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateIOSSurfaceMVK(return_value, instance, &pCreateInfo, &pAllocator, &pSurface);
@@ -6932,6 +7551,8 @@ size_t VulkanDecoder::Decode_vkCreateMacOSSurfaceMVK(const uint8_t* parameter_bu
     bytes_read += pSurface.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateMacOSSurfaceMVK(return_value, instance, &pCreateInfo, &pAllocator, &pSurface);
@@ -6952,6 +7573,8 @@ size_t VulkanDecoder::Decode_vkSetDebugUtilsObjectNameEXT(const uint8_t* paramet
     bytes_read += pNameInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkSetDebugUtilsObjectNameEXT(return_value, device, &pNameInfo);
@@ -6972,6 +7595,8 @@ size_t VulkanDecoder::Decode_vkSetDebugUtilsObjectTagEXT(const uint8_t* paramete
     bytes_read += pTagInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkSetDebugUtilsObjectTagEXT(return_value, device, &pTagInfo);
@@ -6990,6 +7615,8 @@ size_t VulkanDecoder::Decode_vkQueueBeginDebugUtilsLabelEXT(const uint8_t* param
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &queue);
     bytes_read += pLabelInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkQueueBeginDebugUtilsLabelEXT(queue, &pLabelInfo);
@@ -7006,6 +7633,8 @@ size_t VulkanDecoder::Decode_vkQueueEndDebugUtilsLabelEXT(const uint8_t* paramet
 
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &queue);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkQueueEndDebugUtilsLabelEXT(queue);
@@ -7024,6 +7653,8 @@ size_t VulkanDecoder::Decode_vkQueueInsertDebugUtilsLabelEXT(const uint8_t* para
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &queue);
     bytes_read += pLabelInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkQueueInsertDebugUtilsLabelEXT(queue, &pLabelInfo);
@@ -7042,6 +7673,8 @@ size_t VulkanDecoder::Decode_vkCmdBeginDebugUtilsLabelEXT(const uint8_t* paramet
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += pLabelInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdBeginDebugUtilsLabelEXT(commandBuffer, &pLabelInfo);
@@ -7058,6 +7691,8 @@ size_t VulkanDecoder::Decode_vkCmdEndDebugUtilsLabelEXT(const uint8_t* parameter
 
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdEndDebugUtilsLabelEXT(commandBuffer);
@@ -7076,6 +7711,8 @@ size_t VulkanDecoder::Decode_vkCmdInsertDebugUtilsLabelEXT(const uint8_t* parame
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += pLabelInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdInsertDebugUtilsLabelEXT(commandBuffer, &pLabelInfo);
@@ -7100,6 +7737,8 @@ size_t VulkanDecoder::Decode_vkCreateDebugUtilsMessengerEXT(const uint8_t* param
     bytes_read += pMessenger.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateDebugUtilsMessengerEXT(return_value, instance, &pCreateInfo, &pAllocator, &pMessenger);
@@ -7120,6 +7759,8 @@ size_t VulkanDecoder::Decode_vkDestroyDebugUtilsMessengerEXT(const uint8_t* para
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &messenger);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDestroyDebugUtilsMessengerEXT(instance, messenger, &pAllocator);
@@ -7142,6 +7783,8 @@ size_t VulkanDecoder::Decode_vkSubmitDebugUtilsMessageEXT(const uint8_t* paramet
     bytes_read += ValueDecoder::DecodeFlagsValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &messageTypes);
     bytes_read += pCallbackData.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkSubmitDebugUtilsMessageEXT(instance, messageSeverity, messageTypes, &pCallbackData);
@@ -7164,6 +7807,8 @@ size_t VulkanDecoder::Decode_vkGetAndroidHardwareBufferPropertiesANDROID(const u
     bytes_read += pProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetAndroidHardwareBufferPropertiesANDROID(return_value, device, buffer, &pProperties);
@@ -7186,6 +7831,8 @@ size_t VulkanDecoder::Decode_vkGetMemoryAndroidHardwareBufferANDROID(const uint8
     bytes_read += pBuffer.DecodeVoidPtr((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetMemoryAndroidHardwareBufferANDROID(return_value, device, &pInfo, &pBuffer);
@@ -7204,6 +7851,8 @@ size_t VulkanDecoder::Decode_vkCmdSetSampleLocationsEXT(const uint8_t* parameter
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += pSampleLocationsInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdSetSampleLocationsEXT(commandBuffer, &pSampleLocationsInfo);
@@ -7224,6 +7873,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceMultisamplePropertiesEXT(const u
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &samples);
     bytes_read += pMultisampleProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceMultisamplePropertiesEXT(physicalDevice, samples, &pMultisampleProperties);
@@ -7246,6 +7897,8 @@ size_t VulkanDecoder::Decode_vkGetImageDrmFormatModifierPropertiesEXT(const uint
     bytes_read += pProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetImageDrmFormatModifierPropertiesEXT(return_value, device, image, &pProperties);
@@ -7270,6 +7923,8 @@ size_t VulkanDecoder::Decode_vkCreateValidationCacheEXT(const uint8_t* parameter
     bytes_read += pValidationCache.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateValidationCacheEXT(return_value, device, &pCreateInfo, &pAllocator, &pValidationCache);
@@ -7290,6 +7945,8 @@ size_t VulkanDecoder::Decode_vkDestroyValidationCacheEXT(const uint8_t* paramete
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &validationCache);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDestroyValidationCacheEXT(device, validationCache, &pAllocator);
@@ -7314,6 +7971,8 @@ size_t VulkanDecoder::Decode_vkMergeValidationCachesEXT(const uint8_t* parameter
     bytes_read += pSrcCaches.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkMergeValidationCachesEXT(return_value, device, dstCache, srcCacheCount, &pSrcCaches);
@@ -7338,6 +7997,8 @@ size_t VulkanDecoder::Decode_vkGetValidationCacheDataEXT(const uint8_t* paramete
     bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetValidationCacheDataEXT(return_value, device, validationCache, &pDataSize, &pData);
@@ -7358,6 +8019,8 @@ size_t VulkanDecoder::Decode_vkCmdBindShadingRateImageNV(const uint8_t* paramete
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &imageView);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &imageLayout);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
@@ -7380,6 +8043,8 @@ size_t VulkanDecoder::Decode_vkCmdSetViewportShadingRatePaletteNV(const uint8_t*
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &viewportCount);
     bytes_read += pShadingRatePalettes.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, &pShadingRatePalettes);
@@ -7402,6 +8067,8 @@ size_t VulkanDecoder::Decode_vkCmdSetCoarseSampleOrderNV(const uint8_t* paramete
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &customSampleOrderCount);
     bytes_read += pCustomSampleOrders.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, &pCustomSampleOrders);
@@ -7426,6 +8093,8 @@ size_t VulkanDecoder::Decode_vkCreateAccelerationStructureNV(const uint8_t* para
     bytes_read += pAccelerationStructure.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateAccelerationStructureNV(return_value, device, &pCreateInfo, &pAllocator, &pAccelerationStructure);
@@ -7446,6 +8115,8 @@ size_t VulkanDecoder::Decode_vkDestroyAccelerationStructureKHR(const uint8_t* pa
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &accelerationStructure);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDestroyAccelerationStructureKHR(device, accelerationStructure, &pAllocator);
@@ -7466,6 +8137,8 @@ size_t VulkanDecoder::Decode_vkDestroyAccelerationStructureNV(const uint8_t* par
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &accelerationStructure);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDestroyAccelerationStructureNV(device, accelerationStructure, &pAllocator);
@@ -7486,6 +8159,8 @@ size_t VulkanDecoder::Decode_vkGetAccelerationStructureMemoryRequirementsNV(cons
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pMemoryRequirements.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetAccelerationStructureMemoryRequirementsNV(device, &pInfo, &pMemoryRequirements);
@@ -7508,6 +8183,8 @@ size_t VulkanDecoder::Decode_vkBindAccelerationStructureMemoryKHR(const uint8_t*
     bytes_read += pBindInfos.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkBindAccelerationStructureMemoryKHR(return_value, device, bindInfoCount, &pBindInfos);
@@ -7530,6 +8207,8 @@ size_t VulkanDecoder::Decode_vkBindAccelerationStructureMemoryNV(const uint8_t*
     bytes_read += pBindInfos.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkBindAccelerationStructureMemoryNV(return_value, device, bindInfoCount, &pBindInfos);
@@ -7562,6 +8241,8 @@ size_t VulkanDecoder::Decode_vkCmdBuildAccelerationStructureNV(const uint8_t* pa
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &scratch);
     bytes_read += ValueDecoder::DecodeVkDeviceSizeValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &scratchOffset);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdBuildAccelerationStructureNV(commandBuffer, &pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
@@ -7584,6 +8265,8 @@ size_t VulkanDecoder::Decode_vkCmdCopyAccelerationStructureNV(const uint8_t* par
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &src);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &mode);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
@@ -7628,6 +8311,8 @@ size_t VulkanDecoder::Decode_vkCmdTraceRaysNV(const uint8_t* parameter_buffer, s
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &height);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &depth);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
@@ -7656,6 +8341,8 @@ size_t VulkanDecoder::Decode_vkCreateRayTracingPipelinesNV(const uint8_t* parame
     bytes_read += pPipelines.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateRayTracingPipelinesNV(return_value, device, pipelineCache, createInfoCount, &pCreateInfos, &pAllocator, &pPipelines);
@@ -7684,6 +8371,8 @@ size_t VulkanDecoder::Decode_vkGetRayTracingShaderGroupHandlesKHR(const uint8_t*
     bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetRayTracingShaderGroupHandlesKHR(return_value, device, pipeline, firstGroup, groupCount, dataSize, &pData);
@@ -7712,6 +8401,8 @@ size_t VulkanDecoder::Decode_vkGetRayTracingShaderGroupHandlesNV(const uint8_t*
     bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetRayTracingShaderGroupHandlesNV(return_value, device, pipeline, firstGroup, groupCount, dataSize, &pData);
@@ -7736,6 +8427,8 @@ size_t VulkanDecoder::Decode_vkGetAccelerationStructureHandleNV(const uint8_t* p
     bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetAccelerationStructureHandleNV(return_value, device, accelerationStructure, dataSize, &pData);
@@ -7762,6 +8455,8 @@ size_t VulkanDecoder::Decode_vkCmdWriteAccelerationStructuresPropertiesKHR(const
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &queryPool);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &firstQuery);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount, &pAccelerationStructures, queryType, queryPool, firstQuery);
@@ -7788,6 +8483,8 @@ size_t VulkanDecoder::Decode_vkCmdWriteAccelerationStructuresPropertiesNV(const
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &queryPool);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &firstQuery);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, &pAccelerationStructures, queryType, queryPool, firstQuery);
@@ -7810,6 +8507,8 @@ size_t VulkanDecoder::Decode_vkCompileDeferredNV(const uint8_t* parameter_buffer
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &shader);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCompileDeferredNV(return_value, device, pipeline, shader);
@@ -7834,6 +8533,8 @@ size_t VulkanDecoder::Decode_vkGetMemoryHostPointerPropertiesEXT(const uint8_t*
     bytes_read += pMemoryHostPointerProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetMemoryHostPointerPropertiesEXT(return_value, device, handleType, pHostPointer, &pMemoryHostPointerProperties);
@@ -7858,6 +8559,8 @@ size_t VulkanDecoder::Decode_vkCmdWriteBufferMarkerAMD(const uint8_t* parameter_
     bytes_read += ValueDecoder::DecodeVkDeviceSizeValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &dstOffset);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &marker);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
@@ -7880,6 +8583,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT(cons
     bytes_read += pTimeDomains.DecodeEnum((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT(return_value, physicalDevice, &pTimeDomainCount, &pTimeDomains);
@@ -7906,6 +8611,8 @@ size_t VulkanDecoder::Decode_vkGetCalibratedTimestampsEXT(const uint8_t* paramet
     bytes_read += pMaxDeviation.DecodeUInt64((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetCalibratedTimestampsEXT(return_value, device, timestampCount, &pTimestampInfos, &pTimestamps, &pMaxDeviation);
@@ -7926,6 +8633,8 @@ size_t VulkanDecoder::Decode_vkCmdDrawMeshTasksNV(const uint8_t* parameter_buffe
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &taskCount);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &firstTask);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
@@ -7950,6 +8659,8 @@ size_t VulkanDecoder::Decode_vkCmdDrawMeshTasksIndirectNV(const uint8_t* paramet
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &drawCount);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &stride);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
@@ -7978,6 +8689,8 @@ size_t VulkanDecoder::Decode_vkCmdDrawMeshTasksIndirectCountNV(const uint8_t* pa
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &maxDrawCount);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &stride);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
@@ -8000,6 +8713,8 @@ size_t VulkanDecoder::Decode_vkCmdSetExclusiveScissorNV(const uint8_t* parameter
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &exclusiveScissorCount);
     bytes_read += pExclusiveScissors.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, &pExclusiveScissors);
@@ -8018,6 +8733,8 @@ size_t VulkanDecoder::Decode_vkCmdSetCheckpointNV(const uint8_t* parameter_buffe
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += ValueDecoder::DecodeAddress((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pCheckpointMarker);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
@@ -8038,6 +8755,8 @@ size_t VulkanDecoder::Decode_vkGetQueueCheckpointDataNV(const uint8_t* parameter
     bytes_read += pCheckpointDataCount.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pCheckpointData.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetQueueCheckpointDataNV(queue, &pCheckpointDataCount, &pCheckpointData);
@@ -8058,6 +8777,8 @@ size_t VulkanDecoder::Decode_vkInitializePerformanceApiINTEL(const uint8_t* para
     bytes_read += pInitializeInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkInitializePerformanceApiINTEL(return_value, device, &pInitializeInfo);
@@ -8074,6 +8795,8 @@ size_t VulkanDecoder::Decode_vkUninitializePerformanceApiINTEL(const uint8_t* pa
 
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &device);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkUninitializePerformanceApiINTEL(device);
@@ -8094,6 +8817,8 @@ size_t VulkanDecoder::Decode_vkCmdSetPerformanceMarkerINTEL(const uint8_t* param
     bytes_read += pMarkerInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdSetPerformanceMarkerINTEL(return_value, commandBuffer, &pMarkerInfo);
@@ -8114,6 +8839,8 @@ size_t VulkanDecoder::Decode_vkCmdSetPerformanceStreamMarkerINTEL(const uint8_t*
     bytes_read += pMarkerInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdSetPerformanceStreamMarkerINTEL(return_value, commandBuffer, &pMarkerInfo);
@@ -8134,6 +8861,8 @@ size_t VulkanDecoder::Decode_vkCmdSetPerformanceOverrideINTEL(const uint8_t* par
     bytes_read += pOverrideInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdSetPerformanceOverrideINTEL(return_value, commandBuffer, &pOverrideInfo);
@@ -8156,6 +8885,8 @@ size_t VulkanDecoder::Decode_vkAcquirePerformanceConfigurationINTEL(const uint8_
     bytes_read += pConfiguration.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkAcquirePerformanceConfigurationINTEL(return_value, device, &pAcquireInfo, &pConfiguration);
@@ -8176,6 +8907,8 @@ size_t VulkanDecoder::Decode_vkReleasePerformanceConfigurationINTEL(const uint8_
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &configuration);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkReleasePerformanceConfigurationINTEL(return_value, device, configuration);
@@ -8196,6 +8929,8 @@ size_t VulkanDecoder::Decode_vkQueueSetPerformanceConfigurationINTEL(const uint8
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &configuration);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkQueueSetPerformanceConfigurationINTEL(return_value, queue, configuration);
@@ -8218,6 +8953,8 @@ size_t VulkanDecoder::Decode_vkGetPerformanceParameterINTEL(const uint8_t* param
     bytes_read += pValue.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPerformanceParameterINTEL(return_value, device, parameter, &pValue);
@@ -8238,6 +8975,8 @@ size_t VulkanDecoder::Decode_vkSetLocalDimmingAMD(const uint8_t* parameter_buffe
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &swapChain);
     bytes_read += ValueDecoder::DecodeVkBool32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &localDimmingEnable);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkSetLocalDimmingAMD(device, swapChain, localDimmingEnable);
@@ -8262,6 +9001,8 @@ size_t VulkanDecoder::Decode_vkCreateImagePipeSurfaceFUCHSIA(const uint8_t* para
     bytes_read += pSurface.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateImagePipeSurfaceFUCHSIA(return_value, instance, &pCreateInfo, &pAllocator, &pSurface);
@@ -8286,6 +9027,8 @@ size_t VulkanDecoder::Decode_vkCreateMetalSurfaceEXT(const uint8_t* parameter_bu
     bytes_read += pSurface.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateMetalSurfaceEXT(return_value, instance, &pCreateInfo, &pAllocator, &pSurface);
@@ -8306,6 +9049,8 @@ size_t VulkanDecoder::Decode_vkGetBufferDeviceAddressEXT(const uint8_t* paramete
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeVkDeviceAddressValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetBufferDeviceAddressEXT(return_value, device, &pInfo);
@@ -8328,6 +9073,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceToolPropertiesEXT(const uint8_t*
     bytes_read += pToolProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceToolPropertiesEXT(return_value, physicalDevice, &pToolCount, &pToolProperties);
@@ -8350,6 +9097,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV(co
     bytes_read += pProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV(return_value, physicalDevice, &pPropertyCount, &pProperties);
@@ -8372,6 +9121,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceSupportedFramebufferMixedSamples
     bytes_read += pCombinations.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV(return_value, physicalDevice, &pCombinationCount, &pCombinations);
@@ -8396,6 +9147,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceSurfacePresentModes2EXT(const ui
     bytes_read += pPresentModes.DecodeEnum((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceSurfacePresentModes2EXT(return_value, physicalDevice, &pSurfaceInfo, &pPresentModeCount, &pPresentModes);
@@ -8416,6 +9169,8 @@ size_t VulkanDecoder::Decode_vkAcquireFullScreenExclusiveModeEXT(const uint8_t*
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &swapchain);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkAcquireFullScreenExclusiveModeEXT(return_value, device, swapchain);
@@ -8436,6 +9191,8 @@ size_t VulkanDecoder::Decode_vkReleaseFullScreenExclusiveModeEXT(const uint8_t*
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &swapchain);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkReleaseFullScreenExclusiveModeEXT(return_value, device, swapchain);
@@ -8458,6 +9215,8 @@ size_t VulkanDecoder::Decode_vkGetDeviceGroupSurfacePresentModes2EXT(const uint8
     bytes_read += pModes.DecodeFlags((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetDeviceGroupSurfacePresentModes2EXT(return_value, device, &pSurfaceInfo, &pModes);
@@ -8482,6 +9241,8 @@ size_t VulkanDecoder::Decode_vkCreateHeadlessSurfaceEXT(const uint8_t* parameter
     bytes_read += pSurface.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateHeadlessSurfaceEXT(return_value, instance, &pCreateInfo, &pAllocator, &pSurface);
@@ -8502,6 +9263,8 @@ size_t VulkanDecoder::Decode_vkCmdSetLineStippleEXT(const uint8_t* parameter_buf
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &lineStippleFactor);
     bytes_read += ValueDecoder::DecodeUInt16Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &lineStipplePattern);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
@@ -8524,6 +9287,8 @@ size_t VulkanDecoder::Decode_vkResetQueryPoolEXT(const uint8_t* parameter_buffer
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &firstQuery);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &queryCount);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
@@ -8542,6 +9307,8 @@ size_t VulkanDecoder::Decode_vkCmdSetCullModeEXT(const uint8_t* parameter_buffer
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += ValueDecoder::DecodeFlagsValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &cullMode);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdSetCullModeEXT(commandBuffer, cullMode);
@@ -8560,6 +9327,8 @@ size_t VulkanDecoder::Decode_vkCmdSetFrontFaceEXT(const uint8_t* parameter_buffe
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &frontFace);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdSetFrontFaceEXT(commandBuffer, frontFace);
@@ -8578,6 +9347,8 @@ size_t VulkanDecoder::Decode_vkCmdSetPrimitiveTopologyEXT(const uint8_t* paramet
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &primitiveTopology);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdSetPrimitiveTopologyEXT(commandBuffer, primitiveTopology);
@@ -8598,6 +9369,8 @@ size_t VulkanDecoder::Decode_vkCmdSetViewportWithCountEXT(const uint8_t* paramet
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &viewportCount);
     bytes_read += pViewports.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdSetViewportWithCountEXT(commandBuffer, viewportCount, &pViewports);
@@ -8618,6 +9391,8 @@ size_t VulkanDecoder::Decode_vkCmdSetScissorWithCountEXT(const uint8_t* paramete
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &scissorCount);
     bytes_read += pScissors.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdSetScissorWithCountEXT(commandBuffer, scissorCount, &pScissors);
@@ -8646,6 +9421,8 @@ size_t VulkanDecoder::Decode_vkCmdBindVertexBuffers2EXT(const uint8_t* parameter
     bytes_read += pSizes.DecodeVkDeviceSize((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pStrides.DecodeVkDeviceSize((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, &pBuffers, &pOffsets, &pSizes, &pStrides);
@@ -8664,6 +9441,8 @@ size_t VulkanDecoder::Decode_vkCmdSetDepthTestEnableEXT(const uint8_t* parameter
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += ValueDecoder::DecodeVkBool32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &depthTestEnable);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdSetDepthTestEnableEXT(commandBuffer, depthTestEnable);
@@ -8682,6 +9461,8 @@ size_t VulkanDecoder::Decode_vkCmdSetDepthWriteEnableEXT(const uint8_t* paramete
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += ValueDecoder::DecodeVkBool32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &depthWriteEnable);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdSetDepthWriteEnableEXT(commandBuffer, depthWriteEnable);
@@ -8700,6 +9481,8 @@ size_t VulkanDecoder::Decode_vkCmdSetDepthCompareOpEXT(const uint8_t* parameter_
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &depthCompareOp);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdSetDepthCompareOpEXT(commandBuffer, depthCompareOp);
@@ -8718,6 +9501,8 @@ size_t VulkanDecoder::Decode_vkCmdSetDepthBoundsTestEnableEXT(const uint8_t* par
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += ValueDecoder::DecodeVkBool32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &depthBoundsTestEnable);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdSetDepthBoundsTestEnableEXT(commandBuffer, depthBoundsTestEnable);
@@ -8736,6 +9521,8 @@ size_t VulkanDecoder::Decode_vkCmdSetStencilTestEnableEXT(const uint8_t* paramet
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += ValueDecoder::DecodeVkBool32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &stencilTestEnable);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdSetStencilTestEnableEXT(commandBuffer, stencilTestEnable);
@@ -8762,6 +9549,8 @@ size_t VulkanDecoder::Decode_vkCmdSetStencilOpEXT(const uint8_t* parameter_buffe
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &depthFailOp);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &compareOp);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdSetStencilOpEXT(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
@@ -8782,6 +9571,8 @@ size_t VulkanDecoder::Decode_vkGetGeneratedCommandsMemoryRequirementsNV(const ui
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pMemoryRequirements.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetGeneratedCommandsMemoryRequirementsNV(device, &pInfo, &pMemoryRequirements);
@@ -8800,6 +9591,8 @@ size_t VulkanDecoder::Decode_vkCmdPreprocessGeneratedCommandsNV(const uint8_t* p
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += pGeneratedCommandsInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdPreprocessGeneratedCommandsNV(commandBuffer, &pGeneratedCommandsInfo);
@@ -8820,6 +9613,8 @@ size_t VulkanDecoder::Decode_vkCmdExecuteGeneratedCommandsNV(const uint8_t* para
     bytes_read += ValueDecoder::DecodeVkBool32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &isPreprocessed);
     bytes_read += pGeneratedCommandsInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdExecuteGeneratedCommandsNV(commandBuffer, isPreprocessed, &pGeneratedCommandsInfo);
@@ -8842,6 +9637,8 @@ size_t VulkanDecoder::Decode_vkCmdBindPipelineShaderGroupNV(const uint8_t* param
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pipeline);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &groupIndex);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdBindPipelineShaderGroupNV(commandBuffer, pipelineBindPoint, pipeline, groupIndex);
@@ -8866,6 +9663,8 @@ size_t VulkanDecoder::Decode_vkCreateIndirectCommandsLayoutNV(const uint8_t* par
     bytes_read += pIndirectCommandsLayout.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateIndirectCommandsLayoutNV(return_value, device, &pCreateInfo, &pAllocator, &pIndirectCommandsLayout);
@@ -8886,6 +9685,8 @@ size_t VulkanDecoder::Decode_vkDestroyIndirectCommandsLayoutNV(const uint8_t* pa
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &indirectCommandsLayout);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDestroyIndirectCommandsLayoutNV(device, indirectCommandsLayout, &pAllocator);
@@ -8910,6 +9711,8 @@ size_t VulkanDecoder::Decode_vkCreatePrivateDataSlotEXT(const uint8_t* parameter
     bytes_read += pPrivateDataSlot.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreatePrivateDataSlotEXT(return_value, device, &pCreateInfo, &pAllocator, &pPrivateDataSlot);
@@ -8930,6 +9733,8 @@ size_t VulkanDecoder::Decode_vkDestroyPrivateDataSlotEXT(const uint8_t* paramete
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &privateDataSlot);
     bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkDestroyPrivateDataSlotEXT(device, privateDataSlot, &pAllocator);
@@ -8956,6 +9761,8 @@ size_t VulkanDecoder::Decode_vkSetPrivateDataEXT(const uint8_t* parameter_buffer
     bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &data);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkSetPrivateDataEXT(return_value, device, objectType, objectHandle, privateDataSlot, data);
@@ -8980,6 +9787,8 @@ size_t VulkanDecoder::Decode_vkGetPrivateDataEXT(const uint8_t* parameter_buffer
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &privateDataSlot);
     bytes_read += pData.DecodeUInt64((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, &pData);
@@ -9004,6 +9813,8 @@ size_t VulkanDecoder::Decode_vkCreateDirectFBSurfaceEXT(const uint8_t* parameter
     bytes_read += pSurface.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateDirectFBSurfaceEXT(return_value, instance, &pCreateInfo, &pAllocator, &pSurface);
@@ -9026,6 +9837,8 @@ size_t VulkanDecoder::Decode_vkGetPhysicalDeviceDirectFBPresentationSupportEXT(c
     bytes_read += ValueDecoder::DecodeAddress((parameter_buffer + bytes_read), (buffer_size - bytes_read), &dfb);
     bytes_read += ValueDecoder::DecodeVkBool32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetPhysicalDeviceDirectFBPresentationSupportEXT(return_value, physicalDevice, queueFamilyIndex, dfb);
@@ -9050,6 +9863,8 @@ size_t VulkanDecoder::Decode_vkCreateAccelerationStructureKHR(const uint8_t* par
     bytes_read += pAccelerationStructure.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateAccelerationStructureKHR(return_value, device, &pCreateInfo, &pAllocator, &pAccelerationStructure);
@@ -9070,6 +9885,8 @@ size_t VulkanDecoder::Decode_vkGetAccelerationStructureMemoryRequirementsKHR(con
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += pMemoryRequirements.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetAccelerationStructureMemoryRequirementsKHR(device, &pInfo, &pMemoryRequirements);
@@ -9094,6 +9911,8 @@ size_t VulkanDecoder::Decode_vkCmdBuildAccelerationStructureIndirectKHR(const ui
     bytes_read += ValueDecoder::DecodeVkDeviceSizeValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &indirectOffset);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &indirectStride);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdBuildAccelerationStructureIndirectKHR(commandBuffer, &pInfo, indirectBuffer, indirectOffset, indirectStride);
@@ -9114,6 +9933,8 @@ size_t VulkanDecoder::Decode_vkCopyAccelerationStructureKHR(const uint8_t* param
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCopyAccelerationStructureKHR(return_value, device, &pInfo);
@@ -9134,6 +9955,8 @@ size_t VulkanDecoder::Decode_vkCopyAccelerationStructureToMemoryKHR(const uint8_
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCopyAccelerationStructureToMemoryKHR(return_value, device, &pInfo);
@@ -9154,6 +9977,8 @@ size_t VulkanDecoder::Decode_vkCopyMemoryToAccelerationStructureKHR(const uint8_
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCopyMemoryToAccelerationStructureKHR(return_value, device, &pInfo);
@@ -9184,6 +10009,8 @@ size_t VulkanDecoder::Decode_vkWriteAccelerationStructuresPropertiesKHR(const ui
     bytes_read += ValueDecoder::DecodeSizeTValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &stride);
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkWriteAccelerationStructuresPropertiesKHR(return_value, device, accelerationStructureCount, &pAccelerationStructures, queryType, dataSize, &pData, stride);
@@ -9202,6 +10029,8 @@ size_t VulkanDecoder::Decode_vkCmdCopyAccelerationStructureKHR(const uint8_t* pa
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdCopyAccelerationStructureKHR(commandBuffer, &pInfo);
@@ -9220,6 +10049,8 @@ size_t VulkanDecoder::Decode_vkCmdCopyAccelerationStructureToMemoryKHR(const uin
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdCopyAccelerationStructureToMemoryKHR(commandBuffer, &pInfo);
@@ -9238,6 +10069,8 @@ size_t VulkanDecoder::Decode_vkCmdCopyMemoryToAccelerationStructureKHR(const uin
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdCopyMemoryToAccelerationStructureKHR(commandBuffer, &pInfo);
@@ -9268,6 +10101,8 @@ size_t VulkanDecoder::Decode_vkCmdTraceRaysKHR(const uint8_t* parameter_buffer,
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &height);
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &depth);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdTraceRaysKHR(commandBuffer, &pRaygenShaderBindingTable, &pMissShaderBindingTable, &pHitShaderBindingTable, &pCallableShaderBindingTable, width, height, depth);
@@ -9296,6 +10131,8 @@ size_t VulkanDecoder::Decode_vkCreateRayTracingPipelinesKHR(const uint8_t* param
     bytes_read += pPipelines.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCreateRayTracingPipelinesKHR(return_value, device, pipelineCache, createInfoCount, &pCreateInfos, &pAllocator, &pPipelines);
@@ -9316,6 +10153,8 @@ size_t VulkanDecoder::Decode_vkGetAccelerationStructureDeviceAddressKHR(const ui
     bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeVkDeviceAddressValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetAccelerationStructureDeviceAddressKHR(return_value, device, &pInfo);
@@ -9344,6 +10183,8 @@ size_t VulkanDecoder::Decode_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR(c
     bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR(return_value, device, pipeline, firstGroup, groupCount, dataSize, &pData);
@@ -9372,6 +10213,8 @@ size_t VulkanDecoder::Decode_vkCmdTraceRaysIndirectKHR(const uint8_t* parameter_
     bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &buffer);
     bytes_read += ValueDecoder::DecodeVkDeviceSizeValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &offset);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdTraceRaysIndirectKHR(commandBuffer, &pRaygenShaderBindingTable, &pMissShaderBindingTable, &pHitShaderBindingTable, &pCallableShaderBindingTable, buffer, offset);
@@ -9392,6 +10235,8 @@ size_t VulkanDecoder::Decode_vkGetDeviceAccelerationStructureCompatibilityKHR(co
     bytes_read += version.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
     bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
 
+    EndCallDecodeStatistics();
+
     for (auto consumer : GetConsumers())
     {
         consumer->Process_vkGetDeviceAccelerationStructureCompatibilityKHR(return_value, device, &version);
@@ -9400,1283 +10245,463 @@ size_t VulkanDecoder::Decode_vkGetDeviceAccelerationStructureCompatibilityKHR(co
     return bytes_read;
 }
 
+const std::vector<VulkanDecoder::DecodeFunction>& VulkanDecoder::GetDecodeFunctions()
+{
+    static const std::vector<DecodeFunction> decode_functions = []() {
+        std::vector<DecodeFunction> functions(GetApiCallIndexCount(), nullptr);
+
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateInstance)] = &VulkanDecoder::Decode_vkCreateInstance;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDestroyInstance)] = &VulkanDecoder::Decode_vkDestroyInstance;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkEnumeratePhysicalDevices)] = &VulkanDecoder::Decode_vkEnumeratePhysicalDevices;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceFeatures)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceFeatures;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceFormatProperties)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceFormatProperties;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceImageFormatProperties)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceImageFormatProperties;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceProperties;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyProperties)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceQueueFamilyProperties;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceMemoryProperties)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceMemoryProperties;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateDevice)] = &VulkanDecoder::Decode_vkCreateDevice;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDestroyDevice)] = &VulkanDecoder::Decode_vkDestroyDevice;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetDeviceQueue)] = &VulkanDecoder::Decode_vkGetDeviceQueue;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkQueueSubmit)] = &VulkanDecoder::Decode_vkQueueSubmit;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkQueueWaitIdle)] = &VulkanDecoder::Decode_vkQueueWaitIdle;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDeviceWaitIdle)] = &VulkanDecoder::Decode_vkDeviceWaitIdle;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkAllocateMemory)] = &VulkanDecoder::Decode_vkAllocateMemory;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkFreeMemory)] = &VulkanDecoder::Decode_vkFreeMemory;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkMapMemory)] = &VulkanDecoder::Decode_vkMapMemory;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkUnmapMemory)] = &VulkanDecoder::Decode_vkUnmapMemory;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkFlushMappedMemoryRanges)] = &VulkanDecoder::Decode_vkFlushMappedMemoryRanges;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkInvalidateMappedMemoryRanges)] = &VulkanDecoder::Decode_vkInvalidateMappedMemoryRanges;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetDeviceMemoryCommitment)] = &VulkanDecoder::Decode_vkGetDeviceMemoryCommitment;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkBindBufferMemory)] = &VulkanDecoder::Decode_vkBindBufferMemory;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkBindImageMemory)] = &VulkanDecoder::Decode_vkBindImageMemory;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetBufferMemoryRequirements)] = &VulkanDecoder::Decode_vkGetBufferMemoryRequirements;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetImageMemoryRequirements)] = &VulkanDecoder::Decode_vkGetImageMemoryRequirements;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetImageSparseMemoryRequirements)] = &VulkanDecoder::Decode_vkGetImageSparseMemoryRequirements;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceSparseImageFormatProperties)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceSparseImageFormatProperties;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkQueueBindSparse)] = &VulkanDecoder::Decode_vkQueueBindSparse;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateFence)] = &VulkanDecoder::Decode_vkCreateFence;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDestroyFence)] = &VulkanDecoder::Decode_vkDestroyFence;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkResetFences)] = &VulkanDecoder::Decode_vkResetFences;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetFenceStatus)] = &VulkanDecoder::Decode_vkGetFenceStatus;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkWaitForFences)] = &VulkanDecoder::Decode_vkWaitForFences;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateSemaphore)] = &VulkanDecoder::Decode_vkCreateSemaphore;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDestroySemaphore)] = &VulkanDecoder::Decode_vkDestroySemaphore;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateEvent)] = &VulkanDecoder::Decode_vkCreateEvent;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDestroyEvent)] = &VulkanDecoder::Decode_vkDestroyEvent;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetEventStatus)] = &VulkanDecoder::Decode_vkGetEventStatus;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkSetEvent)] = &VulkanDecoder::Decode_vkSetEvent;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkResetEvent)] = &VulkanDecoder::Decode_vkResetEvent;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateQueryPool)] = &VulkanDecoder::Decode_vkCreateQueryPool;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDestroyQueryPool)] = &VulkanDecoder::Decode_vkDestroyQueryPool;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetQueryPoolResults)] = &VulkanDecoder::Decode_vkGetQueryPoolResults;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateBuffer)] = &VulkanDecoder::Decode_vkCreateBuffer;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDestroyBuffer)] = &VulkanDecoder::Decode_vkDestroyBuffer;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateBufferView)] = &VulkanDecoder::Decode_vkCreateBufferView;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDestroyBufferView)] = &VulkanDecoder::Decode_vkDestroyBufferView;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateImage)] = &VulkanDecoder::Decode_vkCreateImage;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDestroyImage)] = &VulkanDecoder::Decode_vkDestroyImage;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetImageSubresourceLayout)] = &VulkanDecoder::Decode_vkGetImageSubresourceLayout;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateImageView)] = &VulkanDecoder::Decode_vkCreateImageView;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDestroyImageView)] = &VulkanDecoder::Decode_vkDestroyImageView;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateShaderModule)] = &VulkanDecoder::Decode_vkCreateShaderModule;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDestroyShaderModule)] = &VulkanDecoder::Decode_vkDestroyShaderModule;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreatePipelineCache)] = &VulkanDecoder::Decode_vkCreatePipelineCache;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDestroyPipelineCache)] = &VulkanDecoder::Decode_vkDestroyPipelineCache;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPipelineCacheData)] = &VulkanDecoder::Decode_vkGetPipelineCacheData;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkMergePipelineCaches)] = &VulkanDecoder::Decode_vkMergePipelineCaches;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateGraphicsPipelines)] = &VulkanDecoder::Decode_vkCreateGraphicsPipelines;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateComputePipelines)] = &VulkanDecoder::Decode_vkCreateComputePipelines;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDestroyPipeline)] = &VulkanDecoder::Decode_vkDestroyPipeline;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreatePipelineLayout)] = &VulkanDecoder::Decode_vkCreatePipelineLayout;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDestroyPipelineLayout)] = &VulkanDecoder::Decode_vkDestroyPipelineLayout;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateSampler)] = &VulkanDecoder::Decode_vkCreateSampler;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDestroySampler)] = &VulkanDecoder::Decode_vkDestroySampler;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateDescriptorSetLayout)] = &VulkanDecoder::Decode_vkCreateDescriptorSetLayout;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDestroyDescriptorSetLayout)] = &VulkanDecoder::Decode_vkDestroyDescriptorSetLayout;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateDescriptorPool)] = &VulkanDecoder::Decode_vkCreateDescriptorPool;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDestroyDescriptorPool)] = &VulkanDecoder::Decode_vkDestroyDescriptorPool;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkResetDescriptorPool)] = &VulkanDecoder::Decode_vkResetDescriptorPool;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkAllocateDescriptorSets)] = &VulkanDecoder::Decode_vkAllocateDescriptorSets;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkFreeDescriptorSets)] = &VulkanDecoder::Decode_vkFreeDescriptorSets;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkUpdateDescriptorSets)] = &VulkanDecoder::Decode_vkUpdateDescriptorSets;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateFramebuffer)] = &VulkanDecoder::Decode_vkCreateFramebuffer;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDestroyFramebuffer)] = &VulkanDecoder::Decode_vkDestroyFramebuffer;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateRenderPass)] = &VulkanDecoder::Decode_vkCreateRenderPass;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDestroyRenderPass)] = &VulkanDecoder::Decode_vkDestroyRenderPass;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetRenderAreaGranularity)] = &VulkanDecoder::Decode_vkGetRenderAreaGranularity;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateCommandPool)] = &VulkanDecoder::Decode_vkCreateCommandPool;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDestroyCommandPool)] = &VulkanDecoder::Decode_vkDestroyCommandPool;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkResetCommandPool)] = &VulkanDecoder::Decode_vkResetCommandPool;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkAllocateCommandBuffers)] = &VulkanDecoder::Decode_vkAllocateCommandBuffers;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkFreeCommandBuffers)] = &VulkanDecoder::Decode_vkFreeCommandBuffers;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkBeginCommandBuffer)] = &VulkanDecoder::Decode_vkBeginCommandBuffer;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkEndCommandBuffer)] = &VulkanDecoder::Decode_vkEndCommandBuffer;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkResetCommandBuffer)] = &VulkanDecoder::Decode_vkResetCommandBuffer;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdBindPipeline)] = &VulkanDecoder::Decode_vkCmdBindPipeline;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdSetViewport)] = &VulkanDecoder::Decode_vkCmdSetViewport;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdSetScissor)] = &VulkanDecoder::Decode_vkCmdSetScissor;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdSetLineWidth)] = &VulkanDecoder::Decode_vkCmdSetLineWidth;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdSetDepthBias)] = &VulkanDecoder::Decode_vkCmdSetDepthBias;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdSetBlendConstants)] = &VulkanDecoder::Decode_vkCmdSetBlendConstants;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdSetDepthBounds)] = &VulkanDecoder::Decode_vkCmdSetDepthBounds;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdSetStencilCompareMask)] = &VulkanDecoder::Decode_vkCmdSetStencilCompareMask;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdSetStencilWriteMask)] = &VulkanDecoder::Decode_vkCmdSetStencilWriteMask;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdSetStencilReference)] = &VulkanDecoder::Decode_vkCmdSetStencilReference;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdBindDescriptorSets)] = &VulkanDecoder::Decode_vkCmdBindDescriptorSets;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdBindIndexBuffer)] = &VulkanDecoder::Decode_vkCmdBindIndexBuffer;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdBindVertexBuffers)] = &VulkanDecoder::Decode_vkCmdBindVertexBuffers;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdDraw)] = &VulkanDecoder::Decode_vkCmdDraw;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdDrawIndexed)] = &VulkanDecoder::Decode_vkCmdDrawIndexed;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdDrawIndirect)] = &VulkanDecoder::Decode_vkCmdDrawIndirect;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirect)] = &VulkanDecoder::Decode_vkCmdDrawIndexedIndirect;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdDispatch)] = &VulkanDecoder::Decode_vkCmdDispatch;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdDispatchIndirect)] = &VulkanDecoder::Decode_vkCmdDispatchIndirect;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdCopyBuffer)] = &VulkanDecoder::Decode_vkCmdCopyBuffer;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdCopyImage)] = &VulkanDecoder::Decode_vkCmdCopyImage;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdBlitImage)] = &VulkanDecoder::Decode_vkCmdBlitImage;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdCopyBufferToImage)] = &VulkanDecoder::Decode_vkCmdCopyBufferToImage;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdCopyImageToBuffer)] = &VulkanDecoder::Decode_vkCmdCopyImageToBuffer;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdUpdateBuffer)] = &VulkanDecoder::Decode_vkCmdUpdateBuffer;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdFillBuffer)] = &VulkanDecoder::Decode_vkCmdFillBuffer;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdClearColorImage)] = &VulkanDecoder::Decode_vkCmdClearColorImage;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdClearDepthStencilImage)] = &VulkanDecoder::Decode_vkCmdClearDepthStencilImage;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdClearAttachments)] = &VulkanDecoder::Decode_vkCmdClearAttachments;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdResolveImage)] = &VulkanDecoder::Decode_vkCmdResolveImage;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdSetEvent)] = &VulkanDecoder::Decode_vkCmdSetEvent;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdResetEvent)] = &VulkanDecoder::Decode_vkCmdResetEvent;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdWaitEvents)] = &VulkanDecoder::Decode_vkCmdWaitEvents;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdPipelineBarrier)] = &VulkanDecoder::Decode_vkCmdPipelineBarrier;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdBeginQuery)] = &VulkanDecoder::Decode_vkCmdBeginQuery;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdEndQuery)] = &VulkanDecoder::Decode_vkCmdEndQuery;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdResetQueryPool)] = &VulkanDecoder::Decode_vkCmdResetQueryPool;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdWriteTimestamp)] = &VulkanDecoder::Decode_vkCmdWriteTimestamp;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdCopyQueryPoolResults)] = &VulkanDecoder::Decode_vkCmdCopyQueryPoolResults;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdPushConstants)] = &VulkanDecoder::Decode_vkCmdPushConstants;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdBeginRenderPass)] = &VulkanDecoder::Decode_vkCmdBeginRenderPass;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdNextSubpass)] = &VulkanDecoder::Decode_vkCmdNextSubpass;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdEndRenderPass)] = &VulkanDecoder::Decode_vkCmdEndRenderPass;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdExecuteCommands)] = &VulkanDecoder::Decode_vkCmdExecuteCommands;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkBindBufferMemory2)] = &VulkanDecoder::Decode_vkBindBufferMemory2;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkBindImageMemory2)] = &VulkanDecoder::Decode_vkBindImageMemory2;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetDeviceGroupPeerMemoryFeatures)] = &VulkanDecoder::Decode_vkGetDeviceGroupPeerMemoryFeatures;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdSetDeviceMask)] = &VulkanDecoder::Decode_vkCmdSetDeviceMask;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdDispatchBase)] = &VulkanDecoder::Decode_vkCmdDispatchBase;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkEnumeratePhysicalDeviceGroups)] = &VulkanDecoder::Decode_vkEnumeratePhysicalDeviceGroups;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetImageMemoryRequirements2)] = &VulkanDecoder::Decode_vkGetImageMemoryRequirements2;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetBufferMemoryRequirements2)] = &VulkanDecoder::Decode_vkGetBufferMemoryRequirements2;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetImageSparseMemoryRequirements2)] = &VulkanDecoder::Decode_vkGetImageSparseMemoryRequirements2;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceFeatures2)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceFeatures2;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties2)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceProperties2;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceFormatProperties2)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceFormatProperties2;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceImageFormatProperties2)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceImageFormatProperties2;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyProperties2)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceQueueFamilyProperties2;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceMemoryProperties2)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceMemoryProperties2;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceSparseImageFormatProperties2)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceSparseImageFormatProperties2;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkTrimCommandPool)] = &VulkanDecoder::Decode_vkTrimCommandPool;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetDeviceQueue2)] = &VulkanDecoder::Decode_vkGetDeviceQueue2;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateSamplerYcbcrConversion)] = &VulkanDecoder::Decode_vkCreateSamplerYcbcrConversion;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDestroySamplerYcbcrConversion)] = &VulkanDecoder::Decode_vkDestroySamplerYcbcrConversion;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateDescriptorUpdateTemplate)] = &VulkanDecoder::Decode_vkCreateDescriptorUpdateTemplate;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDestroyDescriptorUpdateTemplate)] = &VulkanDecoder::Decode_vkDestroyDescriptorUpdateTemplate;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalBufferProperties)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceExternalBufferProperties;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalFenceProperties)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceExternalFenceProperties;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalSemaphoreProperties)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceExternalSemaphoreProperties;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetDescriptorSetLayoutSupport)] = &VulkanDecoder::Decode_vkGetDescriptorSetLayoutSupport;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdDrawIndirectCount)] = &VulkanDecoder::Decode_vkCmdDrawIndirectCount;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCount)] = &VulkanDecoder::Decode_vkCmdDrawIndexedIndirectCount;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateRenderPass2)] = &VulkanDecoder::Decode_vkCreateRenderPass2;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdBeginRenderPass2)] = &VulkanDecoder::Decode_vkCmdBeginRenderPass2;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdNextSubpass2)] = &VulkanDecoder::Decode_vkCmdNextSubpass2;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdEndRenderPass2)] = &VulkanDecoder::Decode_vkCmdEndRenderPass2;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkResetQueryPool)] = &VulkanDecoder::Decode_vkResetQueryPool;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetSemaphoreCounterValue)] = &VulkanDecoder::Decode_vkGetSemaphoreCounterValue;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkWaitSemaphores)] = &VulkanDecoder::Decode_vkWaitSemaphores;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkSignalSemaphore)] = &VulkanDecoder::Decode_vkSignalSemaphore;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetBufferDeviceAddress)] = &VulkanDecoder::Decode_vkGetBufferDeviceAddress;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetBufferOpaqueCaptureAddress)] = &VulkanDecoder::Decode_vkGetBufferOpaqueCaptureAddress;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetDeviceMemoryOpaqueCaptureAddress)] = &VulkanDecoder::Decode_vkGetDeviceMemoryOpaqueCaptureAddress;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDestroySurfaceKHR)] = &VulkanDecoder::Decode_vkDestroySurfaceKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceSupportKHR)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceSurfaceSupportKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceCapabilitiesKHR)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceSurfaceCapabilitiesKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceFormatsKHR)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceSurfaceFormatsKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfacePresentModesKHR)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceSurfacePresentModesKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateSwapchainKHR)] = &VulkanDecoder::Decode_vkCreateSwapchainKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDestroySwapchainKHR)] = &VulkanDecoder::Decode_vkDestroySwapchainKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetSwapchainImagesKHR)] = &VulkanDecoder::Decode_vkGetSwapchainImagesKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkAcquireNextImageKHR)] = &VulkanDecoder::Decode_vkAcquireNextImageKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkQueuePresentKHR)] = &VulkanDecoder::Decode_vkQueuePresentKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetDeviceGroupPresentCapabilitiesKHR)] = &VulkanDecoder::Decode_vkGetDeviceGroupPresentCapabilitiesKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetDeviceGroupSurfacePresentModesKHR)] = &VulkanDecoder::Decode_vkGetDeviceGroupSurfacePresentModesKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDevicePresentRectanglesKHR)] = &VulkanDecoder::Decode_vkGetPhysicalDevicePresentRectanglesKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkAcquireNextImage2KHR)] = &VulkanDecoder::Decode_vkAcquireNextImage2KHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceDisplayPropertiesKHR)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceDisplayPropertiesKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceDisplayPlanePropertiesKHR)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceDisplayPlanePropertiesKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetDisplayPlaneSupportedDisplaysKHR)] = &VulkanDecoder::Decode_vkGetDisplayPlaneSupportedDisplaysKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetDisplayModePropertiesKHR)] = &VulkanDecoder::Decode_vkGetDisplayModePropertiesKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateDisplayModeKHR)] = &VulkanDecoder::Decode_vkCreateDisplayModeKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetDisplayPlaneCapabilitiesKHR)] = &VulkanDecoder::Decode_vkGetDisplayPlaneCapabilitiesKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateDisplayPlaneSurfaceKHR)] = &VulkanDecoder::Decode_vkCreateDisplayPlaneSurfaceKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateSharedSwapchainsKHR)] = &VulkanDecoder::Decode_vkCreateSharedSwapchainsKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateXlibSurfaceKHR)] = &VulkanDecoder::Decode_vkCreateXlibSurfaceKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceXlibPresentationSupportKHR)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceXlibPresentationSupportKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateXcbSurfaceKHR)] = &VulkanDecoder::Decode_vkCreateXcbSurfaceKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceXcbPresentationSupportKHR)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceXcbPresentationSupportKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateWaylandSurfaceKHR)] = &VulkanDecoder::Decode_vkCreateWaylandSurfaceKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceWaylandPresentationSupportKHR)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceWaylandPresentationSupportKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateAndroidSurfaceKHR)] = &VulkanDecoder::Decode_vkCreateAndroidSurfaceKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateWin32SurfaceKHR)] = &VulkanDecoder::Decode_vkCreateWin32SurfaceKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceWin32PresentationSupportKHR)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceWin32PresentationSupportKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceFeatures2KHR)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceFeatures2KHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties2KHR)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceProperties2KHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceFormatProperties2KHR)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceFormatProperties2KHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceImageFormatProperties2KHR)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceImageFormatProperties2KHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyProperties2KHR)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceQueueFamilyProperties2KHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceMemoryProperties2KHR)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceMemoryProperties2KHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceSparseImageFormatProperties2KHR)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceSparseImageFormatProperties2KHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetDeviceGroupPeerMemoryFeaturesKHR)] = &VulkanDecoder::Decode_vkGetDeviceGroupPeerMemoryFeaturesKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdSetDeviceMaskKHR)] = &VulkanDecoder::Decode_vkCmdSetDeviceMaskKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdDispatchBaseKHR)] = &VulkanDecoder::Decode_vkCmdDispatchBaseKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkTrimCommandPoolKHR)] = &VulkanDecoder::Decode_vkTrimCommandPoolKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkEnumeratePhysicalDeviceGroupsKHR)] = &VulkanDecoder::Decode_vkEnumeratePhysicalDeviceGroupsKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalBufferPropertiesKHR)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceExternalBufferPropertiesKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetMemoryWin32HandleKHR)] = &VulkanDecoder::Decode_vkGetMemoryWin32HandleKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetMemoryWin32HandlePropertiesKHR)] = &VulkanDecoder::Decode_vkGetMemoryWin32HandlePropertiesKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetMemoryFdKHR)] = &VulkanDecoder::Decode_vkGetMemoryFdKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetMemoryFdPropertiesKHR)] = &VulkanDecoder::Decode_vkGetMemoryFdPropertiesKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkImportSemaphoreWin32HandleKHR)] = &VulkanDecoder::Decode_vkImportSemaphoreWin32HandleKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetSemaphoreWin32HandleKHR)] = &VulkanDecoder::Decode_vkGetSemaphoreWin32HandleKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkImportSemaphoreFdKHR)] = &VulkanDecoder::Decode_vkImportSemaphoreFdKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetSemaphoreFdKHR)] = &VulkanDecoder::Decode_vkGetSemaphoreFdKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdPushDescriptorSetKHR)] = &VulkanDecoder::Decode_vkCmdPushDescriptorSetKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateDescriptorUpdateTemplateKHR)] = &VulkanDecoder::Decode_vkCreateDescriptorUpdateTemplateKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDestroyDescriptorUpdateTemplateKHR)] = &VulkanDecoder::Decode_vkDestroyDescriptorUpdateTemplateKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateRenderPass2KHR)] = &VulkanDecoder::Decode_vkCreateRenderPass2KHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdBeginRenderPass2KHR)] = &VulkanDecoder::Decode_vkCmdBeginRenderPass2KHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdNextSubpass2KHR)] = &VulkanDecoder::Decode_vkCmdNextSubpass2KHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdEndRenderPass2KHR)] = &VulkanDecoder::Decode_vkCmdEndRenderPass2KHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetSwapchainStatusKHR)] = &VulkanDecoder::Decode_vkGetSwapchainStatusKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalFencePropertiesKHR)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceExternalFencePropertiesKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkImportFenceWin32HandleKHR)] = &VulkanDecoder::Decode_vkImportFenceWin32HandleKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetFenceWin32HandleKHR)] = &VulkanDecoder::Decode_vkGetFenceWin32HandleKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkImportFenceFdKHR)] = &VulkanDecoder::Decode_vkImportFenceFdKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetFenceFdKHR)] = &VulkanDecoder::Decode_vkGetFenceFdKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR)] = &VulkanDecoder::Decode_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkAcquireProfilingLockKHR)] = &VulkanDecoder::Decode_vkAcquireProfilingLockKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkReleaseProfilingLockKHR)] = &VulkanDecoder::Decode_vkReleaseProfilingLockKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceCapabilities2KHR)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceSurfaceCapabilities2KHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceFormats2KHR)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceSurfaceFormats2KHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceDisplayProperties2KHR)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceDisplayProperties2KHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceDisplayPlaneProperties2KHR)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceDisplayPlaneProperties2KHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetDisplayModeProperties2KHR)] = &VulkanDecoder::Decode_vkGetDisplayModeProperties2KHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetDisplayPlaneCapabilities2KHR)] = &VulkanDecoder::Decode_vkGetDisplayPlaneCapabilities2KHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetImageMemoryRequirements2KHR)] = &VulkanDecoder::Decode_vkGetImageMemoryRequirements2KHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetBufferMemoryRequirements2KHR)] = &VulkanDecoder::Decode_vkGetBufferMemoryRequirements2KHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetImageSparseMemoryRequirements2KHR)] = &VulkanDecoder::Decode_vkGetImageSparseMemoryRequirements2KHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateSamplerYcbcrConversionKHR)] = &VulkanDecoder::Decode_vkCreateSamplerYcbcrConversionKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDestroySamplerYcbcrConversionKHR)] = &VulkanDecoder::Decode_vkDestroySamplerYcbcrConversionKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkBindBufferMemory2KHR)] = &VulkanDecoder::Decode_vkBindBufferMemory2KHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkBindImageMemory2KHR)] = &VulkanDecoder::Decode_vkBindImageMemory2KHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetDescriptorSetLayoutSupportKHR)] = &VulkanDecoder::Decode_vkGetDescriptorSetLayoutSupportKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdDrawIndirectCountKHR)] = &VulkanDecoder::Decode_vkCmdDrawIndirectCountKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountKHR)] = &VulkanDecoder::Decode_vkCmdDrawIndexedIndirectCountKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetSemaphoreCounterValueKHR)] = &VulkanDecoder::Decode_vkGetSemaphoreCounterValueKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkWaitSemaphoresKHR)] = &VulkanDecoder::Decode_vkWaitSemaphoresKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkSignalSemaphoreKHR)] = &VulkanDecoder::Decode_vkSignalSemaphoreKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetBufferDeviceAddressKHR)] = &VulkanDecoder::Decode_vkGetBufferDeviceAddressKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetBufferOpaqueCaptureAddressKHR)] = &VulkanDecoder::Decode_vkGetBufferOpaqueCaptureAddressKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetDeviceMemoryOpaqueCaptureAddressKHR)] = &VulkanDecoder::Decode_vkGetDeviceMemoryOpaqueCaptureAddressKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateDeferredOperationKHR)] = &VulkanDecoder::Decode_vkCreateDeferredOperationKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDestroyDeferredOperationKHR)] = &VulkanDecoder::Decode_vkDestroyDeferredOperationKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetDeferredOperationMaxConcurrencyKHR)] = &VulkanDecoder::Decode_vkGetDeferredOperationMaxConcurrencyKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetDeferredOperationResultKHR)] = &VulkanDecoder::Decode_vkGetDeferredOperationResultKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDeferredOperationJoinKHR)] = &VulkanDecoder::Decode_vkDeferredOperationJoinKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPipelineExecutablePropertiesKHR)] = &VulkanDecoder::Decode_vkGetPipelineExecutablePropertiesKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPipelineExecutableStatisticsKHR)] = &VulkanDecoder::Decode_vkGetPipelineExecutableStatisticsKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPipelineExecutableInternalRepresentationsKHR)] = &VulkanDecoder::Decode_vkGetPipelineExecutableInternalRepresentationsKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateDebugReportCallbackEXT)] = &VulkanDecoder::Decode_vkCreateDebugReportCallbackEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDestroyDebugReportCallbackEXT)] = &VulkanDecoder::Decode_vkDestroyDebugReportCallbackEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDebugReportMessageEXT)] = &VulkanDecoder::Decode_vkDebugReportMessageEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDebugMarkerSetObjectTagEXT)] = &VulkanDecoder::Decode_vkDebugMarkerSetObjectTagEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDebugMarkerSetObjectNameEXT)] = &VulkanDecoder::Decode_vkDebugMarkerSetObjectNameEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdDebugMarkerBeginEXT)] = &VulkanDecoder::Decode_vkCmdDebugMarkerBeginEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdDebugMarkerEndEXT)] = &VulkanDecoder::Decode_vkCmdDebugMarkerEndEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdDebugMarkerInsertEXT)] = &VulkanDecoder::Decode_vkCmdDebugMarkerInsertEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdBindTransformFeedbackBuffersEXT)] = &VulkanDecoder::Decode_vkCmdBindTransformFeedbackBuffersEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdBeginTransformFeedbackEXT)] = &VulkanDecoder::Decode_vkCmdBeginTransformFeedbackEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdEndTransformFeedbackEXT)] = &VulkanDecoder::Decode_vkCmdEndTransformFeedbackEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdBeginQueryIndexedEXT)] = &VulkanDecoder::Decode_vkCmdBeginQueryIndexedEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdEndQueryIndexedEXT)] = &VulkanDecoder::Decode_vkCmdEndQueryIndexedEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdDrawIndirectByteCountEXT)] = &VulkanDecoder::Decode_vkCmdDrawIndirectByteCountEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetImageViewHandleNVX)] = &VulkanDecoder::Decode_vkGetImageViewHandleNVX;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetImageViewAddressNVX)] = &VulkanDecoder::Decode_vkGetImageViewAddressNVX;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdDrawIndirectCountAMD)] = &VulkanDecoder::Decode_vkCmdDrawIndirectCountAMD;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountAMD)] = &VulkanDecoder::Decode_vkCmdDrawIndexedIndirectCountAMD;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetShaderInfoAMD)] = &VulkanDecoder::Decode_vkGetShaderInfoAMD;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateStreamDescriptorSurfaceGGP)] = &VulkanDecoder::Decode_vkCreateStreamDescriptorSurfaceGGP;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalImageFormatPropertiesNV)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceExternalImageFormatPropertiesNV;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetMemoryWin32HandleNV)] = &VulkanDecoder::Decode_vkGetMemoryWin32HandleNV;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateViSurfaceNN)] = &VulkanDecoder::Decode_vkCreateViSurfaceNN;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdBeginConditionalRenderingEXT)] = &VulkanDecoder::Decode_vkCmdBeginConditionalRenderingEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdEndConditionalRenderingEXT)] = &VulkanDecoder::Decode_vkCmdEndConditionalRenderingEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdSetViewportWScalingNV)] = &VulkanDecoder::Decode_vkCmdSetViewportWScalingNV;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkReleaseDisplayEXT)] = &VulkanDecoder::Decode_vkReleaseDisplayEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkAcquireXlibDisplayEXT)] = &VulkanDecoder::Decode_vkAcquireXlibDisplayEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetRandROutputDisplayEXT)] = &VulkanDecoder::Decode_vkGetRandROutputDisplayEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceCapabilities2EXT)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceSurfaceCapabilities2EXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDisplayPowerControlEXT)] = &VulkanDecoder::Decode_vkDisplayPowerControlEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkRegisterDeviceEventEXT)] = &VulkanDecoder::Decode_vkRegisterDeviceEventEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkRegisterDisplayEventEXT)] = &VulkanDecoder::Decode_vkRegisterDisplayEventEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetSwapchainCounterEXT)] = &VulkanDecoder::Decode_vkGetSwapchainCounterEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetRefreshCycleDurationGOOGLE)] = &VulkanDecoder::Decode_vkGetRefreshCycleDurationGOOGLE;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPastPresentationTimingGOOGLE)] = &VulkanDecoder::Decode_vkGetPastPresentationTimingGOOGLE;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdSetDiscardRectangleEXT)] = &VulkanDecoder::Decode_vkCmdSetDiscardRectangleEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkSetHdrMetadataEXT)] = &VulkanDecoder::Decode_vkSetHdrMetadataEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateIOSSurfaceMVK)] = &VulkanDecoder::Decode_vkCreateIOSSurfaceMVK;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateMacOSSurfaceMVK)] = &VulkanDecoder::Decode_vkCreateMacOSSurfaceMVK;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkSetDebugUtilsObjectNameEXT)] = &VulkanDecoder::Decode_vkSetDebugUtilsObjectNameEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkSetDebugUtilsObjectTagEXT)] = &VulkanDecoder::Decode_vkSetDebugUtilsObjectTagEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkQueueBeginDebugUtilsLabelEXT)] = &VulkanDecoder::Decode_vkQueueBeginDebugUtilsLabelEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkQueueEndDebugUtilsLabelEXT)] = &VulkanDecoder::Decode_vkQueueEndDebugUtilsLabelEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkQueueInsertDebugUtilsLabelEXT)] = &VulkanDecoder::Decode_vkQueueInsertDebugUtilsLabelEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdBeginDebugUtilsLabelEXT)] = &VulkanDecoder::Decode_vkCmdBeginDebugUtilsLabelEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdEndDebugUtilsLabelEXT)] = &VulkanDecoder::Decode_vkCmdEndDebugUtilsLabelEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdInsertDebugUtilsLabelEXT)] = &VulkanDecoder::Decode_vkCmdInsertDebugUtilsLabelEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateDebugUtilsMessengerEXT)] = &VulkanDecoder::Decode_vkCreateDebugUtilsMessengerEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDestroyDebugUtilsMessengerEXT)] = &VulkanDecoder::Decode_vkDestroyDebugUtilsMessengerEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkSubmitDebugUtilsMessageEXT)] = &VulkanDecoder::Decode_vkSubmitDebugUtilsMessageEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetAndroidHardwareBufferPropertiesANDROID)] = &VulkanDecoder::Decode_vkGetAndroidHardwareBufferPropertiesANDROID;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetMemoryAndroidHardwareBufferANDROID)] = &VulkanDecoder::Decode_vkGetMemoryAndroidHardwareBufferANDROID;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdSetSampleLocationsEXT)] = &VulkanDecoder::Decode_vkCmdSetSampleLocationsEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceMultisamplePropertiesEXT)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceMultisamplePropertiesEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetImageDrmFormatModifierPropertiesEXT)] = &VulkanDecoder::Decode_vkGetImageDrmFormatModifierPropertiesEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateValidationCacheEXT)] = &VulkanDecoder::Decode_vkCreateValidationCacheEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDestroyValidationCacheEXT)] = &VulkanDecoder::Decode_vkDestroyValidationCacheEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkMergeValidationCachesEXT)] = &VulkanDecoder::Decode_vkMergeValidationCachesEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetValidationCacheDataEXT)] = &VulkanDecoder::Decode_vkGetValidationCacheDataEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdBindShadingRateImageNV)] = &VulkanDecoder::Decode_vkCmdBindShadingRateImageNV;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdSetViewportShadingRatePaletteNV)] = &VulkanDecoder::Decode_vkCmdSetViewportShadingRatePaletteNV;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdSetCoarseSampleOrderNV)] = &VulkanDecoder::Decode_vkCmdSetCoarseSampleOrderNV;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateAccelerationStructureNV)] = &VulkanDecoder::Decode_vkCreateAccelerationStructureNV;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDestroyAccelerationStructureKHR)] = &VulkanDecoder::Decode_vkDestroyAccelerationStructureKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDestroyAccelerationStructureNV)] = &VulkanDecoder::Decode_vkDestroyAccelerationStructureNV;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetAccelerationStructureMemoryRequirementsNV)] = &VulkanDecoder::Decode_vkGetAccelerationStructureMemoryRequirementsNV;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkBindAccelerationStructureMemoryKHR)] = &VulkanDecoder::Decode_vkBindAccelerationStructureMemoryKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkBindAccelerationStructureMemoryNV)] = &VulkanDecoder::Decode_vkBindAccelerationStructureMemoryNV;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructureNV)] = &VulkanDecoder::Decode_vkCmdBuildAccelerationStructureNV;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureNV)] = &VulkanDecoder::Decode_vkCmdCopyAccelerationStructureNV;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdTraceRaysNV)] = &VulkanDecoder::Decode_vkCmdTraceRaysNV;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateRayTracingPipelinesNV)] = &VulkanDecoder::Decode_vkCreateRayTracingPipelinesNV;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetRayTracingShaderGroupHandlesKHR)] = &VulkanDecoder::Decode_vkGetRayTracingShaderGroupHandlesKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetRayTracingShaderGroupHandlesNV)] = &VulkanDecoder::Decode_vkGetRayTracingShaderGroupHandlesNV;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetAccelerationStructureHandleNV)] = &VulkanDecoder::Decode_vkGetAccelerationStructureHandleNV;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdWriteAccelerationStructuresPropertiesKHR)] = &VulkanDecoder::Decode_vkCmdWriteAccelerationStructuresPropertiesKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdWriteAccelerationStructuresPropertiesNV)] = &VulkanDecoder::Decode_vkCmdWriteAccelerationStructuresPropertiesNV;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCompileDeferredNV)] = &VulkanDecoder::Decode_vkCompileDeferredNV;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetMemoryHostPointerPropertiesEXT)] = &VulkanDecoder::Decode_vkGetMemoryHostPointerPropertiesEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdWriteBufferMarkerAMD)] = &VulkanDecoder::Decode_vkCmdWriteBufferMarkerAMD;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetCalibratedTimestampsEXT)] = &VulkanDecoder::Decode_vkGetCalibratedTimestampsEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdDrawMeshTasksNV)] = &VulkanDecoder::Decode_vkCmdDrawMeshTasksNV;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectNV)] = &VulkanDecoder::Decode_vkCmdDrawMeshTasksIndirectNV;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectCountNV)] = &VulkanDecoder::Decode_vkCmdDrawMeshTasksIndirectCountNV;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdSetExclusiveScissorNV)] = &VulkanDecoder::Decode_vkCmdSetExclusiveScissorNV;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdSetCheckpointNV)] = &VulkanDecoder::Decode_vkCmdSetCheckpointNV;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetQueueCheckpointDataNV)] = &VulkanDecoder::Decode_vkGetQueueCheckpointDataNV;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkInitializePerformanceApiINTEL)] = &VulkanDecoder::Decode_vkInitializePerformanceApiINTEL;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkUninitializePerformanceApiINTEL)] = &VulkanDecoder::Decode_vkUninitializePerformanceApiINTEL;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdSetPerformanceMarkerINTEL)] = &VulkanDecoder::Decode_vkCmdSetPerformanceMarkerINTEL;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdSetPerformanceStreamMarkerINTEL)] = &VulkanDecoder::Decode_vkCmdSetPerformanceStreamMarkerINTEL;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdSetPerformanceOverrideINTEL)] = &VulkanDecoder::Decode_vkCmdSetPerformanceOverrideINTEL;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkAcquirePerformanceConfigurationINTEL)] = &VulkanDecoder::Decode_vkAcquirePerformanceConfigurationINTEL;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkReleasePerformanceConfigurationINTEL)] = &VulkanDecoder::Decode_vkReleasePerformanceConfigurationINTEL;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkQueueSetPerformanceConfigurationINTEL)] = &VulkanDecoder::Decode_vkQueueSetPerformanceConfigurationINTEL;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPerformanceParameterINTEL)] = &VulkanDecoder::Decode_vkGetPerformanceParameterINTEL;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkSetLocalDimmingAMD)] = &VulkanDecoder::Decode_vkSetLocalDimmingAMD;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateImagePipeSurfaceFUCHSIA)] = &VulkanDecoder::Decode_vkCreateImagePipeSurfaceFUCHSIA;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateMetalSurfaceEXT)] = &VulkanDecoder::Decode_vkCreateMetalSurfaceEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetBufferDeviceAddressEXT)] = &VulkanDecoder::Decode_vkGetBufferDeviceAddressEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceToolPropertiesEXT)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceToolPropertiesEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfacePresentModes2EXT)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceSurfacePresentModes2EXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkAcquireFullScreenExclusiveModeEXT)] = &VulkanDecoder::Decode_vkAcquireFullScreenExclusiveModeEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkReleaseFullScreenExclusiveModeEXT)] = &VulkanDecoder::Decode_vkReleaseFullScreenExclusiveModeEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetDeviceGroupSurfacePresentModes2EXT)] = &VulkanDecoder::Decode_vkGetDeviceGroupSurfacePresentModes2EXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateHeadlessSurfaceEXT)] = &VulkanDecoder::Decode_vkCreateHeadlessSurfaceEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdSetLineStippleEXT)] = &VulkanDecoder::Decode_vkCmdSetLineStippleEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkResetQueryPoolEXT)] = &VulkanDecoder::Decode_vkResetQueryPoolEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdSetCullModeEXT)] = &VulkanDecoder::Decode_vkCmdSetCullModeEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdSetFrontFaceEXT)] = &VulkanDecoder::Decode_vkCmdSetFrontFaceEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdSetPrimitiveTopologyEXT)] = &VulkanDecoder::Decode_vkCmdSetPrimitiveTopologyEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdSetViewportWithCountEXT)] = &VulkanDecoder::Decode_vkCmdSetViewportWithCountEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdSetScissorWithCountEXT)] = &VulkanDecoder::Decode_vkCmdSetScissorWithCountEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdBindVertexBuffers2EXT)] = &VulkanDecoder::Decode_vkCmdBindVertexBuffers2EXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdSetDepthTestEnableEXT)] = &VulkanDecoder::Decode_vkCmdSetDepthTestEnableEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdSetDepthWriteEnableEXT)] = &VulkanDecoder::Decode_vkCmdSetDepthWriteEnableEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdSetDepthCompareOpEXT)] = &VulkanDecoder::Decode_vkCmdSetDepthCompareOpEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdSetDepthBoundsTestEnableEXT)] = &VulkanDecoder::Decode_vkCmdSetDepthBoundsTestEnableEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdSetStencilTestEnableEXT)] = &VulkanDecoder::Decode_vkCmdSetStencilTestEnableEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdSetStencilOpEXT)] = &VulkanDecoder::Decode_vkCmdSetStencilOpEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetGeneratedCommandsMemoryRequirementsNV)] = &VulkanDecoder::Decode_vkGetGeneratedCommandsMemoryRequirementsNV;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdPreprocessGeneratedCommandsNV)] = &VulkanDecoder::Decode_vkCmdPreprocessGeneratedCommandsNV;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdExecuteGeneratedCommandsNV)] = &VulkanDecoder::Decode_vkCmdExecuteGeneratedCommandsNV;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdBindPipelineShaderGroupNV)] = &VulkanDecoder::Decode_vkCmdBindPipelineShaderGroupNV;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateIndirectCommandsLayoutNV)] = &VulkanDecoder::Decode_vkCreateIndirectCommandsLayoutNV;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDestroyIndirectCommandsLayoutNV)] = &VulkanDecoder::Decode_vkDestroyIndirectCommandsLayoutNV;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreatePrivateDataSlotEXT)] = &VulkanDecoder::Decode_vkCreatePrivateDataSlotEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkDestroyPrivateDataSlotEXT)] = &VulkanDecoder::Decode_vkDestroyPrivateDataSlotEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkSetPrivateDataEXT)] = &VulkanDecoder::Decode_vkSetPrivateDataEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPrivateDataEXT)] = &VulkanDecoder::Decode_vkGetPrivateDataEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateDirectFBSurfaceEXT)] = &VulkanDecoder::Decode_vkCreateDirectFBSurfaceEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetPhysicalDeviceDirectFBPresentationSupportEXT)] = &VulkanDecoder::Decode_vkGetPhysicalDeviceDirectFBPresentationSupportEXT;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateAccelerationStructureKHR)] = &VulkanDecoder::Decode_vkCreateAccelerationStructureKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetAccelerationStructureMemoryRequirementsKHR)] = &VulkanDecoder::Decode_vkGetAccelerationStructureMemoryRequirementsKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructureIndirectKHR)] = &VulkanDecoder::Decode_vkCmdBuildAccelerationStructureIndirectKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCopyAccelerationStructureKHR)] = &VulkanDecoder::Decode_vkCopyAccelerationStructureKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCopyAccelerationStructureToMemoryKHR)] = &VulkanDecoder::Decode_vkCopyAccelerationStructureToMemoryKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCopyMemoryToAccelerationStructureKHR)] = &VulkanDecoder::Decode_vkCopyMemoryToAccelerationStructureKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkWriteAccelerationStructuresPropertiesKHR)] = &VulkanDecoder::Decode_vkWriteAccelerationStructuresPropertiesKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureKHR)] = &VulkanDecoder::Decode_vkCmdCopyAccelerationStructureKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureToMemoryKHR)] = &VulkanDecoder::Decode_vkCmdCopyAccelerationStructureToMemoryKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdCopyMemoryToAccelerationStructureKHR)] = &VulkanDecoder::Decode_vkCmdCopyMemoryToAccelerationStructureKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdTraceRaysKHR)] = &VulkanDecoder::Decode_vkCmdTraceRaysKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCreateRayTracingPipelinesKHR)] = &VulkanDecoder::Decode_vkCreateRayTracingPipelinesKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetAccelerationStructureDeviceAddressKHR)] = &VulkanDecoder::Decode_vkGetAccelerationStructureDeviceAddressKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR)] = &VulkanDecoder::Decode_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkCmdTraceRaysIndirectKHR)] = &VulkanDecoder::Decode_vkCmdTraceRaysIndirectKHR;
+        functions[GetApiCallIndex(format::ApiCallId::ApiCall_vkGetDeviceAccelerationStructureCompatibilityKHR)] = &VulkanDecoder::Decode_vkGetDeviceAccelerationStructureCompatibilityKHR;
+
+        return functions;
+    }();
+
+    return decode_functions;
+}
+
 void VulkanDecoder::DecodeFunctionCall(format::ApiCallId             call_id,
                                        const ApiCallInfo&            call_info,
                                        const uint8_t*                parameter_buffer,
                                        size_t                        buffer_size)
 {
-    switch(call_id)
+    const std::vector<DecodeFunction>& decode_functions = GetDecodeFunctions();
+    size_t                             index            = GetApiCallIndex(call_id);
+    DecodeAllocator&                   decode_allocator = GetDecodeAllocator();
+
+    decode_allocator.Begin();
+    BeginCallStatistics();
+
+    if ((index < decode_functions.size()) && (decode_functions[index] != nullptr))
+    {
+        (this->*decode_functions[index])(parameter_buffer, buffer_size);
+    }
+    else
     {
-    default:
         VulkanDecoderBase::DecodeFunctionCall(call_id, call_info, parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateInstance:
-        Decode_vkCreateInstance(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyInstance:
-        Decode_vkDestroyInstance(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkEnumeratePhysicalDevices:
-        Decode_vkEnumeratePhysicalDevices(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceFeatures:
-        Decode_vkGetPhysicalDeviceFeatures(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceFormatProperties:
-        Decode_vkGetPhysicalDeviceFormatProperties(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceImageFormatProperties:
-        Decode_vkGetPhysicalDeviceImageFormatProperties(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties:
-        Decode_vkGetPhysicalDeviceProperties(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyProperties:
-        Decode_vkGetPhysicalDeviceQueueFamilyProperties(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceMemoryProperties:
-        Decode_vkGetPhysicalDeviceMemoryProperties(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateDevice:
-        Decode_vkCreateDevice(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyDevice:
-        Decode_vkDestroyDevice(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDeviceQueue:
-        Decode_vkGetDeviceQueue(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkQueueSubmit:
-        Decode_vkQueueSubmit(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkQueueWaitIdle:
-        Decode_vkQueueWaitIdle(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDeviceWaitIdle:
-        Decode_vkDeviceWaitIdle(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkAllocateMemory:
-        Decode_vkAllocateMemory(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkFreeMemory:
-        Decode_vkFreeMemory(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkMapMemory:
-        Decode_vkMapMemory(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkUnmapMemory:
-        Decode_vkUnmapMemory(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkFlushMappedMemoryRanges:
-        Decode_vkFlushMappedMemoryRanges(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkInvalidateMappedMemoryRanges:
-        Decode_vkInvalidateMappedMemoryRanges(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDeviceMemoryCommitment:
-        Decode_vkGetDeviceMemoryCommitment(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkBindBufferMemory:
-        Decode_vkBindBufferMemory(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkBindImageMemory:
-        Decode_vkBindImageMemory(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetBufferMemoryRequirements:
-        Decode_vkGetBufferMemoryRequirements(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetImageMemoryRequirements:
-        Decode_vkGetImageMemoryRequirements(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetImageSparseMemoryRequirements:
-        Decode_vkGetImageSparseMemoryRequirements(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSparseImageFormatProperties:
-        Decode_vkGetPhysicalDeviceSparseImageFormatProperties(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkQueueBindSparse:
-        Decode_vkQueueBindSparse(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateFence:
-        Decode_vkCreateFence(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyFence:
-        Decode_vkDestroyFence(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkResetFences:
-        Decode_vkResetFences(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetFenceStatus:
-        Decode_vkGetFenceStatus(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkWaitForFences:
-        Decode_vkWaitForFences(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateSemaphore:
-        Decode_vkCreateSemaphore(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroySemaphore:
-        Decode_vkDestroySemaphore(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateEvent:
-        Decode_vkCreateEvent(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyEvent:
-        Decode_vkDestroyEvent(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetEventStatus:
-        Decode_vkGetEventStatus(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkSetEvent:
-        Decode_vkSetEvent(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkResetEvent:
-        Decode_vkResetEvent(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateQueryPool:
-        Decode_vkCreateQueryPool(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyQueryPool:
-        Decode_vkDestroyQueryPool(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetQueryPoolResults:
-        Decode_vkGetQueryPoolResults(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateBuffer:
-        Decode_vkCreateBuffer(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyBuffer:
-        Decode_vkDestroyBuffer(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateBufferView:
-        Decode_vkCreateBufferView(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyBufferView:
-        Decode_vkDestroyBufferView(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateImage:
-        Decode_vkCreateImage(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyImage:
-        Decode_vkDestroyImage(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetImageSubresourceLayout:
-        Decode_vkGetImageSubresourceLayout(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateImageView:
-        Decode_vkCreateImageView(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyImageView:
-        Decode_vkDestroyImageView(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateShaderModule:
-        Decode_vkCreateShaderModule(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyShaderModule:
-        Decode_vkDestroyShaderModule(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreatePipelineCache:
-        Decode_vkCreatePipelineCache(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyPipelineCache:
-        Decode_vkDestroyPipelineCache(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPipelineCacheData:
-        Decode_vkGetPipelineCacheData(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkMergePipelineCaches:
-        Decode_vkMergePipelineCaches(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateGraphicsPipelines:
-        Decode_vkCreateGraphicsPipelines(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateComputePipelines:
-        Decode_vkCreateComputePipelines(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyPipeline:
-        Decode_vkDestroyPipeline(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreatePipelineLayout:
-        Decode_vkCreatePipelineLayout(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyPipelineLayout:
-        Decode_vkDestroyPipelineLayout(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateSampler:
-        Decode_vkCreateSampler(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroySampler:
-        Decode_vkDestroySampler(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateDescriptorSetLayout:
-        Decode_vkCreateDescriptorSetLayout(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyDescriptorSetLayout:
-        Decode_vkDestroyDescriptorSetLayout(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateDescriptorPool:
-        Decode_vkCreateDescriptorPool(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyDescriptorPool:
-        Decode_vkDestroyDescriptorPool(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkResetDescriptorPool:
-        Decode_vkResetDescriptorPool(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkAllocateDescriptorSets:
-        Decode_vkAllocateDescriptorSets(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkFreeDescriptorSets:
-        Decode_vkFreeDescriptorSets(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkUpdateDescriptorSets:
-        Decode_vkUpdateDescriptorSets(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateFramebuffer:
-        Decode_vkCreateFramebuffer(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyFramebuffer:
-        Decode_vkDestroyFramebuffer(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateRenderPass:
-        Decode_vkCreateRenderPass(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyRenderPass:
-        Decode_vkDestroyRenderPass(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetRenderAreaGranularity:
-        Decode_vkGetRenderAreaGranularity(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateCommandPool:
-        Decode_vkCreateCommandPool(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyCommandPool:
-        Decode_vkDestroyCommandPool(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkResetCommandPool:
-        Decode_vkResetCommandPool(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkAllocateCommandBuffers:
-        Decode_vkAllocateCommandBuffers(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkFreeCommandBuffers:
-        Decode_vkFreeCommandBuffers(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkBeginCommandBuffer:
-        Decode_vkBeginCommandBuffer(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkEndCommandBuffer:
-        Decode_vkEndCommandBuffer(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkResetCommandBuffer:
-        Decode_vkResetCommandBuffer(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBindPipeline:
-        Decode_vkCmdBindPipeline(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetViewport:
-        Decode_vkCmdSetViewport(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetScissor:
-        Decode_vkCmdSetScissor(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetLineWidth:
-        Decode_vkCmdSetLineWidth(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetDepthBias:
-        Decode_vkCmdSetDepthBias(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetBlendConstants:
-        Decode_vkCmdSetBlendConstants(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetDepthBounds:
-        Decode_vkCmdSetDepthBounds(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetStencilCompareMask:
-        Decode_vkCmdSetStencilCompareMask(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetStencilWriteMask:
-        Decode_vkCmdSetStencilWriteMask(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetStencilReference:
-        Decode_vkCmdSetStencilReference(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBindDescriptorSets:
-        Decode_vkCmdBindDescriptorSets(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBindIndexBuffer:
-        Decode_vkCmdBindIndexBuffer(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBindVertexBuffers:
-        Decode_vkCmdBindVertexBuffers(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDraw:
-        Decode_vkCmdDraw(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDrawIndexed:
-        Decode_vkCmdDrawIndexed(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDrawIndirect:
-        Decode_vkCmdDrawIndirect(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirect:
-        Decode_vkCmdDrawIndexedIndirect(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDispatch:
-        Decode_vkCmdDispatch(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDispatchIndirect:
-        Decode_vkCmdDispatchIndirect(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdCopyBuffer:
-        Decode_vkCmdCopyBuffer(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdCopyImage:
-        Decode_vkCmdCopyImage(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBlitImage:
-        Decode_vkCmdBlitImage(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdCopyBufferToImage:
-        Decode_vkCmdCopyBufferToImage(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdCopyImageToBuffer:
-        Decode_vkCmdCopyImageToBuffer(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdUpdateBuffer:
-        Decode_vkCmdUpdateBuffer(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdFillBuffer:
-        Decode_vkCmdFillBuffer(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdClearColorImage:
-        Decode_vkCmdClearColorImage(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdClearDepthStencilImage:
-        Decode_vkCmdClearDepthStencilImage(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdClearAttachments:
-        Decode_vkCmdClearAttachments(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdResolveImage:
-        Decode_vkCmdResolveImage(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetEvent:
-        Decode_vkCmdSetEvent(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdResetEvent:
-        Decode_vkCmdResetEvent(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdWaitEvents:
-        Decode_vkCmdWaitEvents(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdPipelineBarrier:
-        Decode_vkCmdPipelineBarrier(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBeginQuery:
-        Decode_vkCmdBeginQuery(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdEndQuery:
-        Decode_vkCmdEndQuery(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdResetQueryPool:
-        Decode_vkCmdResetQueryPool(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdWriteTimestamp:
-        Decode_vkCmdWriteTimestamp(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdCopyQueryPoolResults:
-        Decode_vkCmdCopyQueryPoolResults(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdPushConstants:
-        Decode_vkCmdPushConstants(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBeginRenderPass:
-        Decode_vkCmdBeginRenderPass(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdNextSubpass:
-        Decode_vkCmdNextSubpass(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdEndRenderPass:
-        Decode_vkCmdEndRenderPass(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdExecuteCommands:
-        Decode_vkCmdExecuteCommands(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkBindBufferMemory2:
-        Decode_vkBindBufferMemory2(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkBindImageMemory2:
-        Decode_vkBindImageMemory2(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDeviceGroupPeerMemoryFeatures:
-        Decode_vkGetDeviceGroupPeerMemoryFeatures(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetDeviceMask:
-        Decode_vkCmdSetDeviceMask(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDispatchBase:
-        Decode_vkCmdDispatchBase(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkEnumeratePhysicalDeviceGroups:
-        Decode_vkEnumeratePhysicalDeviceGroups(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetImageMemoryRequirements2:
-        Decode_vkGetImageMemoryRequirements2(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetBufferMemoryRequirements2:
-        Decode_vkGetBufferMemoryRequirements2(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetImageSparseMemoryRequirements2:
-        Decode_vkGetImageSparseMemoryRequirements2(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceFeatures2:
-        Decode_vkGetPhysicalDeviceFeatures2(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties2:
-        Decode_vkGetPhysicalDeviceProperties2(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceFormatProperties2:
-        Decode_vkGetPhysicalDeviceFormatProperties2(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceImageFormatProperties2:
-        Decode_vkGetPhysicalDeviceImageFormatProperties2(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyProperties2:
-        Decode_vkGetPhysicalDeviceQueueFamilyProperties2(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceMemoryProperties2:
-        Decode_vkGetPhysicalDeviceMemoryProperties2(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSparseImageFormatProperties2:
-        Decode_vkGetPhysicalDeviceSparseImageFormatProperties2(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkTrimCommandPool:
-        Decode_vkTrimCommandPool(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDeviceQueue2:
-        Decode_vkGetDeviceQueue2(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateSamplerYcbcrConversion:
-        Decode_vkCreateSamplerYcbcrConversion(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroySamplerYcbcrConversion:
-        Decode_vkDestroySamplerYcbcrConversion(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateDescriptorUpdateTemplate:
-        Decode_vkCreateDescriptorUpdateTemplate(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyDescriptorUpdateTemplate:
-        Decode_vkDestroyDescriptorUpdateTemplate(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalBufferProperties:
-        Decode_vkGetPhysicalDeviceExternalBufferProperties(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalFenceProperties:
-        Decode_vkGetPhysicalDeviceExternalFenceProperties(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalSemaphoreProperties:
-        Decode_vkGetPhysicalDeviceExternalSemaphoreProperties(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDescriptorSetLayoutSupport:
-        Decode_vkGetDescriptorSetLayoutSupport(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDrawIndirectCount:
-        Decode_vkCmdDrawIndirectCount(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCount:
-        Decode_vkCmdDrawIndexedIndirectCount(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateRenderPass2:
-        Decode_vkCreateRenderPass2(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBeginRenderPass2:
-        Decode_vkCmdBeginRenderPass2(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdNextSubpass2:
-        Decode_vkCmdNextSubpass2(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdEndRenderPass2:
-        Decode_vkCmdEndRenderPass2(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkResetQueryPool:
-        Decode_vkResetQueryPool(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetSemaphoreCounterValue:
-        Decode_vkGetSemaphoreCounterValue(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkWaitSemaphores:
-        Decode_vkWaitSemaphores(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkSignalSemaphore:
-        Decode_vkSignalSemaphore(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetBufferDeviceAddress:
-        Decode_vkGetBufferDeviceAddress(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetBufferOpaqueCaptureAddress:
-        Decode_vkGetBufferOpaqueCaptureAddress(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDeviceMemoryOpaqueCaptureAddress:
-        Decode_vkGetDeviceMemoryOpaqueCaptureAddress(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroySurfaceKHR:
-        Decode_vkDestroySurfaceKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceSupportKHR:
-        Decode_vkGetPhysicalDeviceSurfaceSupportKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceCapabilitiesKHR:
-        Decode_vkGetPhysicalDeviceSurfaceCapabilitiesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceFormatsKHR:
-        Decode_vkGetPhysicalDeviceSurfaceFormatsKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfacePresentModesKHR:
-        Decode_vkGetPhysicalDeviceSurfacePresentModesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateSwapchainKHR:
-        Decode_vkCreateSwapchainKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroySwapchainKHR:
-        Decode_vkDestroySwapchainKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetSwapchainImagesKHR:
-        Decode_vkGetSwapchainImagesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkAcquireNextImageKHR:
-        Decode_vkAcquireNextImageKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkQueuePresentKHR:
-        Decode_vkQueuePresentKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDeviceGroupPresentCapabilitiesKHR:
-        Decode_vkGetDeviceGroupPresentCapabilitiesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDeviceGroupSurfacePresentModesKHR:
-        Decode_vkGetDeviceGroupSurfacePresentModesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDevicePresentRectanglesKHR:
-        Decode_vkGetPhysicalDevicePresentRectanglesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkAcquireNextImage2KHR:
-        Decode_vkAcquireNextImage2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceDisplayPropertiesKHR:
-        Decode_vkGetPhysicalDeviceDisplayPropertiesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceDisplayPlanePropertiesKHR:
-        Decode_vkGetPhysicalDeviceDisplayPlanePropertiesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDisplayPlaneSupportedDisplaysKHR:
-        Decode_vkGetDisplayPlaneSupportedDisplaysKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDisplayModePropertiesKHR:
-        Decode_vkGetDisplayModePropertiesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateDisplayModeKHR:
-        Decode_vkCreateDisplayModeKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDisplayPlaneCapabilitiesKHR:
-        Decode_vkGetDisplayPlaneCapabilitiesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateDisplayPlaneSurfaceKHR:
-        Decode_vkCreateDisplayPlaneSurfaceKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateSharedSwapchainsKHR:
-        Decode_vkCreateSharedSwapchainsKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateXlibSurfaceKHR:
-        Decode_vkCreateXlibSurfaceKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceXlibPresentationSupportKHR:
-        Decode_vkGetPhysicalDeviceXlibPresentationSupportKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateXcbSurfaceKHR:
-        Decode_vkCreateXcbSurfaceKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceXcbPresentationSupportKHR:
-        Decode_vkGetPhysicalDeviceXcbPresentationSupportKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateWaylandSurfaceKHR:
-        Decode_vkCreateWaylandSurfaceKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceWaylandPresentationSupportKHR:
-        Decode_vkGetPhysicalDeviceWaylandPresentationSupportKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateAndroidSurfaceKHR:
-        Decode_vkCreateAndroidSurfaceKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateWin32SurfaceKHR:
-        Decode_vkCreateWin32SurfaceKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceWin32PresentationSupportKHR:
-        Decode_vkGetPhysicalDeviceWin32PresentationSupportKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceFeatures2KHR:
-        Decode_vkGetPhysicalDeviceFeatures2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties2KHR:
-        Decode_vkGetPhysicalDeviceProperties2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceFormatProperties2KHR:
-        Decode_vkGetPhysicalDeviceFormatProperties2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceImageFormatProperties2KHR:
-        Decode_vkGetPhysicalDeviceImageFormatProperties2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyProperties2KHR:
-        Decode_vkGetPhysicalDeviceQueueFamilyProperties2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceMemoryProperties2KHR:
-        Decode_vkGetPhysicalDeviceMemoryProperties2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSparseImageFormatProperties2KHR:
-        Decode_vkGetPhysicalDeviceSparseImageFormatProperties2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDeviceGroupPeerMemoryFeaturesKHR:
-        Decode_vkGetDeviceGroupPeerMemoryFeaturesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetDeviceMaskKHR:
-        Decode_vkCmdSetDeviceMaskKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDispatchBaseKHR:
-        Decode_vkCmdDispatchBaseKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkTrimCommandPoolKHR:
-        Decode_vkTrimCommandPoolKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkEnumeratePhysicalDeviceGroupsKHR:
-        Decode_vkEnumeratePhysicalDeviceGroupsKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalBufferPropertiesKHR:
-        Decode_vkGetPhysicalDeviceExternalBufferPropertiesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetMemoryWin32HandleKHR:
-        Decode_vkGetMemoryWin32HandleKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetMemoryWin32HandlePropertiesKHR:
-        Decode_vkGetMemoryWin32HandlePropertiesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetMemoryFdKHR:
-        Decode_vkGetMemoryFdKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetMemoryFdPropertiesKHR:
-        Decode_vkGetMemoryFdPropertiesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR:
-        Decode_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkImportSemaphoreWin32HandleKHR:
-        Decode_vkImportSemaphoreWin32HandleKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetSemaphoreWin32HandleKHR:
-        Decode_vkGetSemaphoreWin32HandleKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkImportSemaphoreFdKHR:
-        Decode_vkImportSemaphoreFdKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetSemaphoreFdKHR:
-        Decode_vkGetSemaphoreFdKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdPushDescriptorSetKHR:
-        Decode_vkCmdPushDescriptorSetKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateDescriptorUpdateTemplateKHR:
-        Decode_vkCreateDescriptorUpdateTemplateKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyDescriptorUpdateTemplateKHR:
-        Decode_vkDestroyDescriptorUpdateTemplateKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateRenderPass2KHR:
-        Decode_vkCreateRenderPass2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBeginRenderPass2KHR:
-        Decode_vkCmdBeginRenderPass2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdNextSubpass2KHR:
-        Decode_vkCmdNextSubpass2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdEndRenderPass2KHR:
-        Decode_vkCmdEndRenderPass2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetSwapchainStatusKHR:
-        Decode_vkGetSwapchainStatusKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalFencePropertiesKHR:
-        Decode_vkGetPhysicalDeviceExternalFencePropertiesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkImportFenceWin32HandleKHR:
-        Decode_vkImportFenceWin32HandleKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetFenceWin32HandleKHR:
-        Decode_vkGetFenceWin32HandleKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkImportFenceFdKHR:
-        Decode_vkImportFenceFdKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetFenceFdKHR:
-        Decode_vkGetFenceFdKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR:
-        Decode_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR:
-        Decode_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkAcquireProfilingLockKHR:
-        Decode_vkAcquireProfilingLockKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkReleaseProfilingLockKHR:
-        Decode_vkReleaseProfilingLockKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceCapabilities2KHR:
-        Decode_vkGetPhysicalDeviceSurfaceCapabilities2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceFormats2KHR:
-        Decode_vkGetPhysicalDeviceSurfaceFormats2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceDisplayProperties2KHR:
-        Decode_vkGetPhysicalDeviceDisplayProperties2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceDisplayPlaneProperties2KHR:
-        Decode_vkGetPhysicalDeviceDisplayPlaneProperties2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDisplayModeProperties2KHR:
-        Decode_vkGetDisplayModeProperties2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDisplayPlaneCapabilities2KHR:
-        Decode_vkGetDisplayPlaneCapabilities2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetImageMemoryRequirements2KHR:
-        Decode_vkGetImageMemoryRequirements2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetBufferMemoryRequirements2KHR:
-        Decode_vkGetBufferMemoryRequirements2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetImageSparseMemoryRequirements2KHR:
-        Decode_vkGetImageSparseMemoryRequirements2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateSamplerYcbcrConversionKHR:
-        Decode_vkCreateSamplerYcbcrConversionKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroySamplerYcbcrConversionKHR:
-        Decode_vkDestroySamplerYcbcrConversionKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkBindBufferMemory2KHR:
-        Decode_vkBindBufferMemory2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkBindImageMemory2KHR:
-        Decode_vkBindImageMemory2KHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDescriptorSetLayoutSupportKHR:
-        Decode_vkGetDescriptorSetLayoutSupportKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDrawIndirectCountKHR:
-        Decode_vkCmdDrawIndirectCountKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountKHR:
-        Decode_vkCmdDrawIndexedIndirectCountKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetSemaphoreCounterValueKHR:
-        Decode_vkGetSemaphoreCounterValueKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkWaitSemaphoresKHR:
-        Decode_vkWaitSemaphoresKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkSignalSemaphoreKHR:
-        Decode_vkSignalSemaphoreKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetBufferDeviceAddressKHR:
-        Decode_vkGetBufferDeviceAddressKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetBufferOpaqueCaptureAddressKHR:
-        Decode_vkGetBufferOpaqueCaptureAddressKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDeviceMemoryOpaqueCaptureAddressKHR:
-        Decode_vkGetDeviceMemoryOpaqueCaptureAddressKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateDeferredOperationKHR:
-        Decode_vkCreateDeferredOperationKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyDeferredOperationKHR:
-        Decode_vkDestroyDeferredOperationKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDeferredOperationMaxConcurrencyKHR:
-        Decode_vkGetDeferredOperationMaxConcurrencyKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDeferredOperationResultKHR:
-        Decode_vkGetDeferredOperationResultKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDeferredOperationJoinKHR:
-        Decode_vkDeferredOperationJoinKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPipelineExecutablePropertiesKHR:
-        Decode_vkGetPipelineExecutablePropertiesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPipelineExecutableStatisticsKHR:
-        Decode_vkGetPipelineExecutableStatisticsKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPipelineExecutableInternalRepresentationsKHR:
-        Decode_vkGetPipelineExecutableInternalRepresentationsKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateDebugReportCallbackEXT:
-        Decode_vkCreateDebugReportCallbackEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyDebugReportCallbackEXT:
-        Decode_vkDestroyDebugReportCallbackEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDebugReportMessageEXT:
-        Decode_vkDebugReportMessageEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDebugMarkerSetObjectTagEXT:
-        Decode_vkDebugMarkerSetObjectTagEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDebugMarkerSetObjectNameEXT:
-        Decode_vkDebugMarkerSetObjectNameEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDebugMarkerBeginEXT:
-        Decode_vkCmdDebugMarkerBeginEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDebugMarkerEndEXT:
-        Decode_vkCmdDebugMarkerEndEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDebugMarkerInsertEXT:
-        Decode_vkCmdDebugMarkerInsertEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBindTransformFeedbackBuffersEXT:
-        Decode_vkCmdBindTransformFeedbackBuffersEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBeginTransformFeedbackEXT:
-        Decode_vkCmdBeginTransformFeedbackEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdEndTransformFeedbackEXT:
-        Decode_vkCmdEndTransformFeedbackEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBeginQueryIndexedEXT:
-        Decode_vkCmdBeginQueryIndexedEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdEndQueryIndexedEXT:
-        Decode_vkCmdEndQueryIndexedEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDrawIndirectByteCountEXT:
-        Decode_vkCmdDrawIndirectByteCountEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetImageViewHandleNVX:
-        Decode_vkGetImageViewHandleNVX(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetImageViewAddressNVX:
-        Decode_vkGetImageViewAddressNVX(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDrawIndirectCountAMD:
-        Decode_vkCmdDrawIndirectCountAMD(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountAMD:
-        Decode_vkCmdDrawIndexedIndirectCountAMD(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetShaderInfoAMD:
-        Decode_vkGetShaderInfoAMD(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateStreamDescriptorSurfaceGGP:
-        Decode_vkCreateStreamDescriptorSurfaceGGP(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalImageFormatPropertiesNV:
-        Decode_vkGetPhysicalDeviceExternalImageFormatPropertiesNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetMemoryWin32HandleNV:
-        Decode_vkGetMemoryWin32HandleNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateViSurfaceNN:
-        Decode_vkCreateViSurfaceNN(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBeginConditionalRenderingEXT:
-        Decode_vkCmdBeginConditionalRenderingEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdEndConditionalRenderingEXT:
-        Decode_vkCmdEndConditionalRenderingEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetViewportWScalingNV:
-        Decode_vkCmdSetViewportWScalingNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkReleaseDisplayEXT:
-        Decode_vkReleaseDisplayEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkAcquireXlibDisplayEXT:
-        Decode_vkAcquireXlibDisplayEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetRandROutputDisplayEXT:
-        Decode_vkGetRandROutputDisplayEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceCapabilities2EXT:
-        Decode_vkGetPhysicalDeviceSurfaceCapabilities2EXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDisplayPowerControlEXT:
-        Decode_vkDisplayPowerControlEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkRegisterDeviceEventEXT:
-        Decode_vkRegisterDeviceEventEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkRegisterDisplayEventEXT:
-        Decode_vkRegisterDisplayEventEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetSwapchainCounterEXT:
-        Decode_vkGetSwapchainCounterEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetRefreshCycleDurationGOOGLE:
-        Decode_vkGetRefreshCycleDurationGOOGLE(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPastPresentationTimingGOOGLE:
-        Decode_vkGetPastPresentationTimingGOOGLE(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetDiscardRectangleEXT:
-        Decode_vkCmdSetDiscardRectangleEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkSetHdrMetadataEXT:
-        Decode_vkSetHdrMetadataEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateIOSSurfaceMVK:
-        Decode_vkCreateIOSSurfaceMVK(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateMacOSSurfaceMVK:
-        Decode_vkCreateMacOSSurfaceMVK(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkSetDebugUtilsObjectNameEXT:
-        Decode_vkSetDebugUtilsObjectNameEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkSetDebugUtilsObjectTagEXT:
-        Decode_vkSetDebugUtilsObjectTagEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkQueueBeginDebugUtilsLabelEXT:
-        Decode_vkQueueBeginDebugUtilsLabelEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkQueueEndDebugUtilsLabelEXT:
-        Decode_vkQueueEndDebugUtilsLabelEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkQueueInsertDebugUtilsLabelEXT:
-        Decode_vkQueueInsertDebugUtilsLabelEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBeginDebugUtilsLabelEXT:
-        Decode_vkCmdBeginDebugUtilsLabelEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdEndDebugUtilsLabelEXT:
-        Decode_vkCmdEndDebugUtilsLabelEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdInsertDebugUtilsLabelEXT:
-        Decode_vkCmdInsertDebugUtilsLabelEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateDebugUtilsMessengerEXT:
-        Decode_vkCreateDebugUtilsMessengerEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyDebugUtilsMessengerEXT:
-        Decode_vkDestroyDebugUtilsMessengerEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkSubmitDebugUtilsMessageEXT:
-        Decode_vkSubmitDebugUtilsMessageEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetAndroidHardwareBufferPropertiesANDROID:
-        Decode_vkGetAndroidHardwareBufferPropertiesANDROID(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetMemoryAndroidHardwareBufferANDROID:
-        Decode_vkGetMemoryAndroidHardwareBufferANDROID(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetSampleLocationsEXT:
-        Decode_vkCmdSetSampleLocationsEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceMultisamplePropertiesEXT:
-        Decode_vkGetPhysicalDeviceMultisamplePropertiesEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetImageDrmFormatModifierPropertiesEXT:
-        Decode_vkGetImageDrmFormatModifierPropertiesEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateValidationCacheEXT:
-        Decode_vkCreateValidationCacheEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyValidationCacheEXT:
-        Decode_vkDestroyValidationCacheEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkMergeValidationCachesEXT:
-        Decode_vkMergeValidationCachesEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetValidationCacheDataEXT:
-        Decode_vkGetValidationCacheDataEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBindShadingRateImageNV:
-        Decode_vkCmdBindShadingRateImageNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetViewportShadingRatePaletteNV:
-        Decode_vkCmdSetViewportShadingRatePaletteNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetCoarseSampleOrderNV:
-        Decode_vkCmdSetCoarseSampleOrderNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateAccelerationStructureNV:
-        Decode_vkCreateAccelerationStructureNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyAccelerationStructureKHR:
-        Decode_vkDestroyAccelerationStructureKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyAccelerationStructureNV:
-        Decode_vkDestroyAccelerationStructureNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetAccelerationStructureMemoryRequirementsNV:
-        Decode_vkGetAccelerationStructureMemoryRequirementsNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkBindAccelerationStructureMemoryKHR:
-        Decode_vkBindAccelerationStructureMemoryKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkBindAccelerationStructureMemoryNV:
-        Decode_vkBindAccelerationStructureMemoryNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructureNV:
-        Decode_vkCmdBuildAccelerationStructureNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureNV:
-        Decode_vkCmdCopyAccelerationStructureNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdTraceRaysNV:
-        Decode_vkCmdTraceRaysNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateRayTracingPipelinesNV:
-        Decode_vkCreateRayTracingPipelinesNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetRayTracingShaderGroupHandlesKHR:
-        Decode_vkGetRayTracingShaderGroupHandlesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetRayTracingShaderGroupHandlesNV:
-        Decode_vkGetRayTracingShaderGroupHandlesNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetAccelerationStructureHandleNV:
-        Decode_vkGetAccelerationStructureHandleNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdWriteAccelerationStructuresPropertiesKHR:
-        Decode_vkCmdWriteAccelerationStructuresPropertiesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdWriteAccelerationStructuresPropertiesNV:
-        Decode_vkCmdWriteAccelerationStructuresPropertiesNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCompileDeferredNV:
-        Decode_vkCompileDeferredNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetMemoryHostPointerPropertiesEXT:
-        Decode_vkGetMemoryHostPointerPropertiesEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdWriteBufferMarkerAMD:
-        Decode_vkCmdWriteBufferMarkerAMD(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT:
-        Decode_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetCalibratedTimestampsEXT:
-        Decode_vkGetCalibratedTimestampsEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksNV:
-        Decode_vkCmdDrawMeshTasksNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectNV:
-        Decode_vkCmdDrawMeshTasksIndirectNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectCountNV:
-        Decode_vkCmdDrawMeshTasksIndirectCountNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetExclusiveScissorNV:
-        Decode_vkCmdSetExclusiveScissorNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetCheckpointNV:
-        Decode_vkCmdSetCheckpointNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetQueueCheckpointDataNV:
-        Decode_vkGetQueueCheckpointDataNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkInitializePerformanceApiINTEL:
-        Decode_vkInitializePerformanceApiINTEL(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkUninitializePerformanceApiINTEL:
-        Decode_vkUninitializePerformanceApiINTEL(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetPerformanceMarkerINTEL:
-        Decode_vkCmdSetPerformanceMarkerINTEL(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetPerformanceStreamMarkerINTEL:
-        Decode_vkCmdSetPerformanceStreamMarkerINTEL(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetPerformanceOverrideINTEL:
-        Decode_vkCmdSetPerformanceOverrideINTEL(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkAcquirePerformanceConfigurationINTEL:
-        Decode_vkAcquirePerformanceConfigurationINTEL(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkReleasePerformanceConfigurationINTEL:
-        Decode_vkReleasePerformanceConfigurationINTEL(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkQueueSetPerformanceConfigurationINTEL:
-        Decode_vkQueueSetPerformanceConfigurationINTEL(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPerformanceParameterINTEL:
-        Decode_vkGetPerformanceParameterINTEL(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkSetLocalDimmingAMD:
-        Decode_vkSetLocalDimmingAMD(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateImagePipeSurfaceFUCHSIA:
-        Decode_vkCreateImagePipeSurfaceFUCHSIA(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateMetalSurfaceEXT:
-        Decode_vkCreateMetalSurfaceEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetBufferDeviceAddressEXT:
-        Decode_vkGetBufferDeviceAddressEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceToolPropertiesEXT:
-        Decode_vkGetPhysicalDeviceToolPropertiesEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV:
-        Decode_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV:
-        Decode_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfacePresentModes2EXT:
-        Decode_vkGetPhysicalDeviceSurfacePresentModes2EXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkAcquireFullScreenExclusiveModeEXT:
-        Decode_vkAcquireFullScreenExclusiveModeEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkReleaseFullScreenExclusiveModeEXT:
-        Decode_vkReleaseFullScreenExclusiveModeEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDeviceGroupSurfacePresentModes2EXT:
-        Decode_vkGetDeviceGroupSurfacePresentModes2EXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateHeadlessSurfaceEXT:
-        Decode_vkCreateHeadlessSurfaceEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetLineStippleEXT:
-        Decode_vkCmdSetLineStippleEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkResetQueryPoolEXT:
-        Decode_vkResetQueryPoolEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetCullModeEXT:
-        Decode_vkCmdSetCullModeEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetFrontFaceEXT:
-        Decode_vkCmdSetFrontFaceEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetPrimitiveTopologyEXT:
-        Decode_vkCmdSetPrimitiveTopologyEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetViewportWithCountEXT:
-        Decode_vkCmdSetViewportWithCountEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetScissorWithCountEXT:
-        Decode_vkCmdSetScissorWithCountEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBindVertexBuffers2EXT:
-        Decode_vkCmdBindVertexBuffers2EXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetDepthTestEnableEXT:
-        Decode_vkCmdSetDepthTestEnableEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetDepthWriteEnableEXT:
-        Decode_vkCmdSetDepthWriteEnableEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetDepthCompareOpEXT:
-        Decode_vkCmdSetDepthCompareOpEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetDepthBoundsTestEnableEXT:
-        Decode_vkCmdSetDepthBoundsTestEnableEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetStencilTestEnableEXT:
-        Decode_vkCmdSetStencilTestEnableEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdSetStencilOpEXT:
-        Decode_vkCmdSetStencilOpEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetGeneratedCommandsMemoryRequirementsNV:
-        Decode_vkGetGeneratedCommandsMemoryRequirementsNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdPreprocessGeneratedCommandsNV:
-        Decode_vkCmdPreprocessGeneratedCommandsNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdExecuteGeneratedCommandsNV:
-        Decode_vkCmdExecuteGeneratedCommandsNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBindPipelineShaderGroupNV:
-        Decode_vkCmdBindPipelineShaderGroupNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateIndirectCommandsLayoutNV:
-        Decode_vkCreateIndirectCommandsLayoutNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyIndirectCommandsLayoutNV:
-        Decode_vkDestroyIndirectCommandsLayoutNV(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreatePrivateDataSlotEXT:
-        Decode_vkCreatePrivateDataSlotEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkDestroyPrivateDataSlotEXT:
-        Decode_vkDestroyPrivateDataSlotEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkSetPrivateDataEXT:
-        Decode_vkSetPrivateDataEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPrivateDataEXT:
-        Decode_vkGetPrivateDataEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateDirectFBSurfaceEXT:
-        Decode_vkCreateDirectFBSurfaceEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetPhysicalDeviceDirectFBPresentationSupportEXT:
-        Decode_vkGetPhysicalDeviceDirectFBPresentationSupportEXT(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateAccelerationStructureKHR:
-        Decode_vkCreateAccelerationStructureKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetAccelerationStructureMemoryRequirementsKHR:
-        Decode_vkGetAccelerationStructureMemoryRequirementsKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructureIndirectKHR:
-        Decode_vkCmdBuildAccelerationStructureIndirectKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCopyAccelerationStructureKHR:
-        Decode_vkCopyAccelerationStructureKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCopyAccelerationStructureToMemoryKHR:
-        Decode_vkCopyAccelerationStructureToMemoryKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCopyMemoryToAccelerationStructureKHR:
-        Decode_vkCopyMemoryToAccelerationStructureKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkWriteAccelerationStructuresPropertiesKHR:
-        Decode_vkWriteAccelerationStructuresPropertiesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureKHR:
-        Decode_vkCmdCopyAccelerationStructureKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureToMemoryKHR:
-        Decode_vkCmdCopyAccelerationStructureToMemoryKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdCopyMemoryToAccelerationStructureKHR:
-        Decode_vkCmdCopyMemoryToAccelerationStructureKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdTraceRaysKHR:
-        Decode_vkCmdTraceRaysKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCreateRayTracingPipelinesKHR:
-        Decode_vkCreateRayTracingPipelinesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetAccelerationStructureDeviceAddressKHR:
-        Decode_vkGetAccelerationStructureDeviceAddressKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR:
-        Decode_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkCmdTraceRaysIndirectKHR:
-        Decode_vkCmdTraceRaysIndirectKHR(parameter_buffer, buffer_size);
-        break;
-    case format::ApiCallId::ApiCall_vkGetDeviceAccelerationStructureCompatibilityKHR:
-        Decode_vkGetDeviceAccelerationStructureCompatibilityKHR(parameter_buffer, buffer_size);
-        break;
     }
+
+    EndCallStatistics(call_id);
+    decode_allocator.End();
 }
 
 
@@ -28,6 +28,8 @@
 
 #include "vulkan/vulkan.h"
 
+#include <vector>
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
@@ -44,6 +46,11 @@ class VulkanDecoder : public VulkanDecoderBase
                                     size_t                        buffer_size) override;
 
   private:
+    typedef size_t (VulkanDecoder::*DecodeFunction)(const uint8_t* parameter_buffer, size_t buffer_size);
+
+    // Table of Decode_* methods indexed by API call index, with null entries for calls decoded by the base class.
+    static const std::vector<DecodeFunction>& GetDecodeFunctions();
+
     size_t Decode_vkCreateInstance(const uint8_t* parameter_buffer, size_t buffer_size);
 
     size_t Decode_vkDestroyInstance(const uint8_t* parameter_buffer, size_t buffer_size);
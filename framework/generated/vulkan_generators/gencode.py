@@ -52,6 +52,9 @@ from encode_pnext_struct_generator import EncodePNextStructGenerator,EncodePNext
 from vulkan_struct_handle_wrappers_header_generator import VulkanStructHandleWrappersHeaderGenerator,VulkanStructHandleWrappersHeaderGeneratorOptions
 from vulkan_struct_handle_wrappers_body_generator import VulkanStructHandleWrappersBodyGenerator,VulkanStructHandleWrappersBodyGeneratorOptions
 
+# Format Utilities
+from vulkan_api_call_names_generator import VulkanApiCallNamesGenerator,VulkanApiCallNamesGeneratorOptions
+
 # Simple timer functions
 startTime = None
 
@@ -419,6 +422,18 @@ def makeGenOpts(args):
             protectFeature    = False)
         ]
 
+    #
+    # Format utility generators
+    genOpts['generated_vulkan_api_call_names.cpp'] = [
+          VulkanApiCallNamesGenerator,
+          VulkanApiCallNamesGeneratorOptions(
+            filename          = 'generated_vulkan_api_call_names.cpp',
+            directory         = directory,
+            prefixText        = prefixStrings + vkPrefixStrings,
+            protectFile       = False,
+            protectFeature    = False)
+        ]
+
 # Generate a target based on the options in the matching genOpts{} object.
 # This is encapsulated in a function so it can be profiled and/or timed.
 # The args parameter is an parsed argument object containing the following
@@ -0,0 +1,93 @@
+#!/usr/bin/python3 -i
+#
+# Copyright (c) 2020 Valve Corporation
+# Copyright (c) 2020 LunarG, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import os,re,sys
+from base_generator import *
+
+#
+# Eliminates JSON blackLists and platformTypes files, which are not necessary for
+# API call name generation.  Every API call ID has a name, including the calls that
+# are blacklisted from encoding and decoding.
+class VulkanApiCallNamesGeneratorOptions(BaseGeneratorOptions):
+    """Options for generating a function that maps Vulkan API call IDs to names"""
+    def __init__(self,
+                 filename = None,
+                 directory = '.',
+                 prefixText = '',
+                 protectFile = False,
+                 protectFeature = True):
+        BaseGeneratorOptions.__init__(self, None, None,
+                                      filename, directory, prefixText,
+                                      protectFile, protectFeature)
+
+# VulkanApiCallNamesGenerator - subclass of BaseGenerator.
+# Generates the format::GetApiCallName() function, which maps Vulkan API call IDs to names for
+# reporting and statistics.
+class VulkanApiCallNamesGenerator(BaseGenerator):
+    """Generate a function that maps Vulkan API call IDs to names"""
+    def __init__(self,
+                 errFile = sys.stderr,
+                 warnFile = sys.stderr,
+                 diagFile = sys.stdout):
+        BaseGenerator.__init__(self,
+                               processCmds=True, processStructs=False, featureBreak=False,
+                               errFile=errFile, warnFile=warnFile, diagFile=diagFile)
+
+    # Method override
+    def beginFile(self, genOpts):
+        BaseGenerator.beginFile(self, genOpts)
+
+        write('#include "format/api_call_id.h"', file=self.outFile)
+        write('#include "format/format_util.h"', file=self.outFile)
+        write('#include "util/defines.h"', file=self.outFile)
+        self.newline()
+        write('GFXRECON_BEGIN_NAMESPACE(gfxrecon)', file=self.outFile)
+        write('GFXRECON_BEGIN_NAMESPACE(format)', file=self.outFile)
+        self.newline()
+        write('const char* GetApiCallName(ApiCallId call_id)', file=self.outFile)
+        write('{', file=self.outFile)
+        write('    switch (call_id)', file=self.outFile)
+        write('    {', file=self.outFile)
+
+    # Method override
+    def endFile(self):
+        write('        default:', file=self.outFile)
+        write('            break;', file=self.outFile)
+        write('    }', file=self.outFile)
+        self.newline()
+        write('    return "Unknown";', file=self.outFile)
+        write('}', file=self.outFile)
+        self.newline()
+        write('GFXRECON_END_NAMESPACE(format)', file=self.outFile)
+        write('GFXRECON_END_NAMESPACE(gfxrecon)', file=self.outFile)
+
+        # Finish processing in superclass
+        BaseGenerator.endFile(self)
+
+    #
+    # Indicates that the current feature has C++ code to generate.
+    def needFeatureGeneration(self):
+        if self.featureCmdParams:
+            return True
+        return False
+
+    #
+    # Performs C++ code generation for the feature.
+    def generateFeature(self):
+        for cmd in self.getFilteredCmdNames():
+            write('        case ApiCallId::ApiCall_{}:'.format(cmd), file=self.outFile)
+            write('            return "{}";'.format(cmd), file=self.outFile)
@@ -66,6 +66,7 @@ class VulkanDecoderBodyGenerator(BaseGenerator):
         write('#include "vulkan/vulkan.h"', file=self.outFile)
         self.newline()
         write('#include <cstddef>', file=self.outFile)
+        write('#include <vector>', file=self.outFile)
         self.newline()
         write('GFXRECON_BEGIN_NAMESPACE(gfxrecon)', file=self.outFile)
         write('GFXRECON_BEGIN_NAMESPACE(decode)', file=self.outFile)
@@ -150,6 +151,8 @@ class VulkanDecoderBodyGenerator(BaseGenerator):
         if returnType and returnType != 'void':
             arglist = ', '.join(['return_value', arglist])
 
+        body += '    EndCallDecodeStatistics();\n'
+        body += '\n'
         body += '    for (auto consumer : GetConsumers())\n'
         body += '    {\n'
         body += '        consumer->Process_{}({});\n'.format(name, arglist)
@@ -206,24 +209,46 @@ class VulkanDecoderBodyGenerator(BaseGenerator):
         return body
 
     #
-    # Generate the VulkanDecoder::DecodeFunctionCall method.
+    # Generate the VulkanDecoder::GetDecodeFunctions and VulkanDecoder::DecodeFunctionCall methods.
     def generateDecodeCases(self):
+        write('const std::vector<VulkanDecoder::DecodeFunction>& VulkanDecoder::GetDecodeFunctions()', file=self.outFile)
+        write('{', file=self.outFile)
+        write('    static const std::vector<DecodeFunction> decode_functions = []() {', file=self.outFile)
+        write('        std::vector<DecodeFunction> functions(GetApiCallIndexCount(), nullptr);', file=self.outFile)
+        write('', file=self.outFile)
+
+        for cmd in self.cmdNames:
+            cmddef = '        functions[GetApiCallIndex(format::ApiCallId::ApiCall_{0})] = &VulkanDecoder::Decode_{0};'.format(cmd)
+            write(cmddef, file=self.outFile)
+
+        write('', file=self.outFile)
+        write('        return functions;', file=self.outFile)
+        write('    }();', file=self.outFile)
+        write('', file=self.outFile)
+        write('    return decode_functions;', file=self.outFile)
+        write('}', file=self.outFile)
+        write('', file=self.outFile)
         write('void VulkanDecoder::DecodeFunctionCall(format::ApiCallId             call_id,', file=self.outFile)
         write('                                       const ApiCallInfo&            call_info,', file=self.outFile)
         write('                                       const uint8_t*                parameter_buffer,', file=self.outFile)
         write('                                       size_t                        buffer_size)', file=self.outFile)
         write('{', file=self.outFile)
-        write('    switch(call_id)', file=self.outFile)
+        write('    const std::vector<DecodeFunction>& decode_functions = GetDecodeFunctions();', file=self.outFile)
+        write('    size_t                             index            = GetApiCallIndex(call_id);', file=self.outFile)
+        write('    DecodeAllocator&                   decode_allocator = GetDecodeAllocator();', file=self.outFile)
+        write('', file=self.outFile)
+        write('    decode_allocator.Begin();', file=self.outFile)
+        write('    BeginCallStatistics();', file=self.outFile)
+        write('', file=self.outFile)
+        write('    if ((index < decode_functions.size()) && (decode_functions[index] != nullptr))', file=self.outFile)
+        write('    {', file=self.outFile)
+        write('        (this->*decode_functions[index])(parameter_buffer, buffer_size);', file=self.outFile)
+        write('    }', file=self.outFile)
+        write('    else', file=self.outFile)
         write('    {', file=self.outFile)
-        write('    default:', file=self.outFile)
         write('        VulkanDecoderBase::DecodeFunctionCall(call_id, call_info, parameter_buffer, buffer_size);', file=self.outFile)
-        write('        break;', file=self.outFile)
-
-        for cmd in self.cmdNames:
-            cmddef = '    case format::ApiCallId::ApiCall_{}:\n'.format(cmd)
-            cmddef += '        Decode_{}(parameter_buffer, buffer_size);\n'.format(cmd)
-            cmddef += '        break;'
-            write(cmddef, file=self.outFile)
-
         write('    }', file=self.outFile)
+        write('', file=self.outFile)
+        write('    EndCallStatistics(call_id);', file=self.outFile)
+        write('    decode_allocator.End();', file=self.outFile)
         write('}\n', file=self.outFile)
@@ -54,6 +54,8 @@ class VulkanDecoderHeaderGenerator(BaseGenerator):
         self.newline()
         write('#include "vulkan/vulkan.h"', file=self.outFile)
         self.newline()
+        write('#include <vector>', file=self.outFile)
+        self.newline()
         write('GFXRECON_BEGIN_NAMESPACE(gfxrecon)', file=self.outFile)
         write('GFXRECON_BEGIN_NAMESPACE(decode)', file=self.outFile)
         self.newline()
@@ -66,7 +68,10 @@ class VulkanDecoderHeaderGenerator(BaseGenerator):
         write('                                    const ApiCallInfo&            call_info,', file=self.outFile)
         write('                                    const uint8_t*                parameter_buffer,', file=self.outFile)
         write('                                    size_t                        buffer_size) override;\n', file=self.outFile)
-        write('  private:', end='', file=self.outFile)
+        write('  private:', file=self.outFile)
+        write('    typedef size_t (VulkanDecoder::*DecodeFunction)(const uint8_t* parameter_buffer, size_t buffer_size);\n', file=self.outFile)
+        write('    // Table of Decode_* methods indexed by API call index, with null entries for calls decoded by the base class.', file=self.outFile)
+        write('    static const std::vector<DecodeFunction>& GetDecodeFunctions();', file=self.outFile)
 
     # Method override
     def endFile(self):
@@ -42,6 +42,12 @@ class Compressor
                               const std::vector<uint8_t>& compressed_data,
                               const size_t                expected_uncompressed_size,
                               std::vector<uint8_t>*       uncompressed_data) = 0;
+
+    // Decompresses directly into caller provided memory, which must have space for expected_uncompressed_size bytes.
+    virtual size_t Decompress(const size_t   compressed_size,
+                              const uint8_t* compressed_data,
+                              const size_t   expected_uncompressed_size,
+                              uint8_t*       uncompressed_data) = 0;
 };
 
 GFXRECON_END_NAMESPACE(util)
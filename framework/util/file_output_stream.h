@@ -39,6 +39,8 @@ class FileOutputStream : public OutputStream
 
     virtual bool IsValid() override { return (file_ != nullptr); }
 
+    virtual int64_t Tell() override { return platform::FileTell(file_); }
+
     virtual size_t Write(const void* data, size_t len) override;
 
     virtual void Flush() override { platform::FileFlush(file_); }
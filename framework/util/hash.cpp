@@ -17,10 +17,50 @@
 
 #include "util/hash.h"
 
+#include <cstring>
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 GFXRECON_BEGIN_NAMESPACE(hash)
 
+const uint64_t kPrime64_1 = 0x9E3779B185EBCA87ull;
+const uint64_t kPrime64_2 = 0xC2B2AE3D27D4EB4Full;
+const uint64_t kPrime64_3 = 0x165667B19E3779F9ull;
+const uint64_t kPrime64_4 = 0x85EBCA77C2B2AE63ull;
+const uint64_t kPrime64_5 = 0x27D4EB2F165667C5ull;
+
+static inline uint64_t RotateLeft64(uint64_t value, uint32_t shift)
+{
+    return (value << shift) | (value >> (64 - shift));
+}
+
+static inline uint64_t Read64(const uint8_t* data)
+{
+    uint64_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+static inline uint32_t Read32(const uint8_t* data)
+{
+    uint32_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+static inline uint64_t HashRound(uint64_t accumulator, uint64_t input)
+{
+    accumulator += input * kPrime64_2;
+    accumulator = RotateLeft64(accumulator, 31);
+    return accumulator * kPrime64_1;
+}
+
+static inline uint64_t HashMergeRound(uint64_t accumulator, uint64_t value)
+{
+    accumulator ^= HashRound(0, value);
+    return (accumulator * kPrime64_1) + kPrime64_4;
+}
+
 uint32_t CheckSum(const uint32_t* code, size_t code_size)
 {
     uint32_t sum            = 0;
@@ -34,6 +74,83 @@ uint32_t CheckSum(const uint32_t* code, size_t code_size)
     return sum;
 }
 
+uint64_t GenerateHash64(const void* data, size_t size, uint64_t seed)
+{
+    const uint8_t* current = static_cast<const uint8_t*>(data);
+    const uint8_t* end     = current + size;
+    uint64_t       hash    = 0;
+
+    if (size >= 32)
+    {
+        // Process 32 byte stripes with four independent accumulators, which allows the compiler and CPU to overlap
+        // the multiply/rotate chains.
+        const uint8_t* limit = end - 32;
+        uint64_t       v1    = seed + kPrime64_1 + kPrime64_2;
+        uint64_t       v2    = seed + kPrime64_2;
+        uint64_t       v3    = seed;
+        uint64_t       v4    = seed - kPrime64_1;
+
+        do
+        {
+            v1 = HashRound(v1, Read64(current));
+            v2 = HashRound(v2, Read64(current + 8));
+            v3 = HashRound(v3, Read64(current + 16));
+            v4 = HashRound(v4, Read64(current + 24));
+            current += 32;
+        } while (current <= limit);
+
+        hash = RotateLeft64(v1, 1) + RotateLeft64(v2, 7) + RotateLeft64(v3, 12) + RotateLeft64(v4, 18);
+        hash = HashMergeRound(hash, v1);
+        hash = HashMergeRound(hash, v2);
+        hash = HashMergeRound(hash, v3);
+        hash = HashMergeRound(hash, v4);
+    }
+    else
+    {
+        hash = seed + kPrime64_5;
+    }
+
+    hash += static_cast<uint64_t>(size);
+
+    while ((current + 8) <= end)
+    {
+        hash ^= HashRound(0, Read64(current));
+        hash = (RotateLeft64(hash, 27) * kPrime64_1) + kPrime64_4;
+        current += 8;
+    }
+
+    if ((current + 4) <= end)
+    {
+        hash ^= static_cast<uint64_t>(Read32(current)) * kPrime64_1;
+        hash = (RotateLeft64(hash, 23) * kPrime64_2) + kPrime64_3;
+        current += 4;
+    }
+
+    while (current < end)
+    {
+        hash ^= static_cast<uint64_t>(*current) * kPrime64_5;
+        hash = RotateLeft64(hash, 11) * kPrime64_1;
+        ++current;
+    }
+
+    hash ^= hash >> 33;
+    hash *= kPrime64_2;
+    hash ^= hash >> 29;
+    hash *= kPrime64_3;
+    hash ^= hash >> 32;
+
+    return hash;
+}
+
+Hash128 GenerateHash128(const void* data, size_t size)
+{
+    // The halves use different seeds, so that a collision of one half is independent of a collision of the other.
+    Hash128 hash;
+    hash.low  = GenerateHash64(data, size, 0);
+    hash.high = GenerateHash64(data, size, kPrime64_3);
+    return hash;
+}
+
 GFXRECON_END_NAMESPACE(hash)
 GFXRECON_END_NAMESPACE(util)
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -21,6 +21,7 @@
 #include "util/defines.h"
 
 #include <cstddef>
+#include <cstdint>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
@@ -28,6 +29,21 @@ GFXRECON_BEGIN_NAMESPACE(hash)
 
 uint32_t CheckSum(const uint32_t* code, size_t code_size);
 
+// Fast non-cryptographic 64-bit hash, based on the XXH64 algorithm, for detecting changes to large blocks of memory.
+uint64_t GenerateHash64(const void* data, size_t size, uint64_t seed = 0);
+
+struct Hash128
+{
+    uint64_t low;
+    uint64_t high;
+
+    bool operator==(const Hash128& other) const { return (low == other.low) && (high == other.high); }
+};
+
+// Non-cryptographic 128-bit hash, combining two differently seeded 64-bit hashes, for identifying blocks of memory
+// with identical content where a 64-bit hash collision would not be detected.
+Hash128 GenerateHash128(const void* data, size_t size);
+
 GFXRECON_END_NAMESPACE(hash)
 GFXRECON_END_NAMESPACE(util)
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -62,6 +62,19 @@ size_t Lz4Compressor::Decompress(const size_t                compressed_size,
                                  const std::vector<uint8_t>& compressed_data,
                                  const size_t                expected_uncompressed_size,
                                  std::vector<uint8_t>*       uncompressed_data)
+{
+    if (nullptr == uncompressed_data)
+    {
+        return 0;
+    }
+
+    return Decompress(compressed_size, compressed_data.data(), expected_uncompressed_size, uncompressed_data->data());
+}
+
+size_t Lz4Compressor::Decompress(const size_t   compressed_size,
+                                 const uint8_t* compressed_data,
+                                 const size_t   expected_uncompressed_size,
+                                 uint8_t*       uncompressed_data)
 {
     size_t data_size = 0;
 
@@ -70,8 +83,8 @@ size_t Lz4Compressor::Decompress(const size_t                compressed_size,
         return 0;
     }
 
-    int uncompressed_size_generated = LZ4_decompress_safe(reinterpret_cast<const char*>(compressed_data.data()),
-                                                          reinterpret_cast<char*>(uncompressed_data->data()),
+    int uncompressed_size_generated = LZ4_decompress_safe(reinterpret_cast<const char*>(compressed_data),
+                                                          reinterpret_cast<char*>(uncompressed_data),
                                                           static_cast<int32_t>(compressed_size),
                                                           static_cast<int32_t>(expected_uncompressed_size));
 
@@ -38,6 +38,11 @@ class Lz4Compressor : public Compressor
                               const std::vector<uint8_t>& compressed_data,
                               const size_t                expected_uncompressed_size,
                               std::vector<uint8_t>*       uncompressed_data) override;
+
+    virtual size_t Decompress(const size_t   compressed_size,
+                              const uint8_t* compressed_data,
+                              const size_t   expected_uncompressed_size,
+                              uint8_t*       uncompressed_data) override;
 };
 
 GFXRECON_END_NAMESPACE(util)
@@ -0,0 +1,247 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#include "util/mapped_file.h"
+
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <cinttypes>
+
+#if defined(WIN32)
+#if !defined(WIN32_LEAN_AND_MEAN)
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Maximum size of the mapped window for processes with a 32-bit address space.  Processes with a 64-bit address space
+// map the entire file.
+const size_t kMaxViewSize32 = 256 * 1024 * 1024;
+
+MappedFile::MappedFile() :
+#if defined(WIN32)
+    file_handle_(INVALID_HANDLE_VALUE), mapping_handle_(nullptr),
+#else
+    file_descriptor_(-1),
+#endif
+    file_size_(0), allocation_granularity_(0), max_view_size_(0), view_(nullptr), view_offset_(0), view_size_(0)
+{}
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+bool MappedFile::Open(const std::string& filename)
+{
+    Close();
+
+#if defined(WIN32)
+    file_handle_ = CreateFileA(
+        filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file_handle_ == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file_handle_, &file_size) || (file_size.QuadPart <= 0))
+    {
+        Close();
+        return false;
+    }
+
+    file_size_ = static_cast<uint64_t>(file_size.QuadPart);
+
+    mapping_handle_ = CreateFileMappingA(file_handle_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping_handle_ == nullptr)
+    {
+        Close();
+        return false;
+    }
+
+    SYSTEM_INFO system_info;
+    GetSystemInfo(&system_info);
+    allocation_granularity_ = system_info.dwAllocationGranularity;
+#else
+    file_descriptor_ = open(filename.c_str(), O_RDONLY);
+    if (file_descriptor_ < 0)
+    {
+        return false;
+    }
+
+    struct stat file_stat;
+    if ((fstat(file_descriptor_, &file_stat) != 0) || !S_ISREG(file_stat.st_mode) || (file_stat.st_size <= 0))
+    {
+        Close();
+        return false;
+    }
+
+    file_size_              = static_cast<uint64_t>(file_stat.st_size);
+    allocation_granularity_ = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+#endif
+
+    if (sizeof(void*) < sizeof(uint64_t))
+    {
+        max_view_size_ = kMaxViewSize32;
+    }
+    else
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, file_size_);
+        max_view_size_ = static_cast<size_t>(file_size_);
+    }
+
+    if (!MapView(0, 0))
+    {
+        Close();
+        return false;
+    }
+
+    return true;
+}
+
+void MappedFile::Close()
+{
+    UnmapView();
+
+#if defined(WIN32)
+    if (mapping_handle_ != nullptr)
+    {
+        CloseHandle(mapping_handle_);
+        mapping_handle_ = nullptr;
+    }
+
+    if (file_handle_ != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(file_handle_);
+        file_handle_ = INVALID_HANDLE_VALUE;
+    }
+#else
+    if (file_descriptor_ >= 0)
+    {
+        close(file_descriptor_);
+        file_descriptor_ = -1;
+    }
+#endif
+
+    file_size_ = 0;
+}
+
+const uint8_t* MappedFile::GetData(uint64_t offset, size_t size)
+{
+    if ((offset > file_size_) || (size > (file_size_ - offset)))
+    {
+        return nullptr;
+    }
+
+    if ((view_ == nullptr) || (offset < view_offset_) || ((offset + size) > (view_offset_ + view_size_)))
+    {
+        if (!MapView(offset, size))
+        {
+            return nullptr;
+        }
+    }
+
+    return view_ + (offset - view_offset_);
+}
+
+void MappedFile::Prefetch(uint64_t offset, size_t size)
+{
+#if defined(WIN32)
+    // The file was opened with FILE_FLAG_SEQUENTIAL_SCAN, which enables read-ahead for the mapping.
+    GFXRECON_UNREFERENCED_PARAMETER(offset);
+    GFXRECON_UNREFERENCED_PARAMETER(size);
+#else
+    if ((view_ != nullptr) && (offset >= view_offset_) && (offset < (view_offset_ + view_size_)))
+    {
+        // madvise requires a page aligned address.
+        uint64_t start = (offset - view_offset_) & ~(allocation_granularity_ - 1);
+        size_t   end   = std::min(view_size_, static_cast<size_t>(offset - view_offset_) + size);
+
+        madvise(view_ + start, end - static_cast<size_t>(start), MADV_WILLNEED);
+    }
+#endif
+}
+
+bool MappedFile::MapView(uint64_t offset, size_t size)
+{
+    UnmapView();
+
+    uint64_t aligned_offset = offset - (offset % allocation_granularity_);
+    size_t   required_size  = static_cast<size_t>(offset - aligned_offset) + size;
+    size_t   view_size      = static_cast<size_t>(
+        std::min(static_cast<uint64_t>(std::max(max_view_size_, required_size)), file_size_ - aligned_offset));
+
+#if defined(WIN32)
+    void* view = MapViewOfFile(mapping_handle_,
+                               FILE_MAP_READ,
+                               static_cast<DWORD>(aligned_offset >> 32),
+                               static_cast<DWORD>(aligned_offset & 0xffffffff),
+                               view_size);
+    if (view == nullptr)
+    {
+        GFXRECON_LOG_ERROR("Failed to map view of file at offset %" PRIu64 " (error = %u)",
+                           aligned_offset,
+                           GetLastError());
+        return false;
+    }
+#else
+    void* view = mmap(nullptr, view_size, PROT_READ, MAP_PRIVATE, file_descriptor_, static_cast<off_t>(aligned_offset));
+    if (view == MAP_FAILED)
+    {
+        GFXRECON_LOG_ERROR("Failed to map view of file at offset %" PRIu64 " (errno = %d)", aligned_offset, errno);
+        return false;
+    }
+
+    // The file is processed sequentially, so the kernel can read ahead aggressively and drop pages once passed.
+    madvise(view, view_size, MADV_SEQUENTIAL);
+#endif
+
+    view_        = reinterpret_cast<uint8_t*>(view);
+    view_offset_ = aligned_offset;
+    view_size_   = view_size;
+
+    return true;
+}
+
+void MappedFile::UnmapView()
+{
+    if (view_ != nullptr)
+    {
+#if defined(WIN32)
+        UnmapViewOfFile(view_);
+#else
+        munmap(view_, view_size_);
+#endif
+        view_        = nullptr;
+        view_offset_ = 0;
+        view_size_   = 0;
+    }
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,77 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#ifndef GFXRECON_UTIL_MAPPED_FILE_H
+#define GFXRECON_UTIL_MAPPED_FILE_H
+
+#include "util/defines.h"
+
+#include <cstdint>
+#include <string>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Read-only memory mapping of a file.  When the file is larger than the address space budget for the mapping, only a
+// window of the file is mapped, and the window is moved when data outside of it is requested.
+class MappedFile
+{
+  public:
+    MappedFile();
+
+    ~MappedFile();
+
+    bool Open(const std::string& filename);
+
+    void Close();
+
+    bool IsOpen() const { return (view_ != nullptr); }
+
+    uint64_t GetFileSize() const { return file_size_; }
+
+    // Returns a pointer to the specified range of the file, or nullptr if the range extends past the end of the file or
+    // the file could not be mapped.  The pointer remains valid until the mapping is closed or data outside of the
+    // currently mapped window is requested.  When the file could not be mapped, the previous window has already been
+    // unmapped and IsOpen returns false.
+    const uint8_t* GetData(uint64_t offset, size_t size);
+
+    // Hint that the specified range of the file will be accessed soon, so the OS can start reading it into memory.
+    void Prefetch(uint64_t offset, size_t size);
+
+  private:
+    bool MapView(uint64_t offset, size_t size);
+
+    void UnmapView();
+
+  private:
+#if defined(WIN32)
+    void* file_handle_;
+    void* mapping_handle_;
+#else
+    int file_descriptor_;
+#endif
+    uint64_t file_size_;
+    uint64_t allocation_granularity_;
+    size_t   max_view_size_;
+    uint8_t* view_;
+    uint64_t view_offset_;
+    size_t   view_size_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_MAPPED_FILE_H
@@ -21,6 +21,7 @@
 #include "util/defines.h"
 
 #include <cstddef>
+#include <cstdint>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
@@ -34,6 +35,9 @@ class OutputStream
 
     virtual void Reset() {}
 
+    // Returns the current write position of the stream, or -1 if the stream does not track position.
+    virtual int64_t Tell() { return -1; }
+
     virtual size_t Write(const void* data, size_t len) = 0;
 
     virtual void Flush() {}
@@ -18,9 +18,11 @@
 
 #include "util/page_guard_manager.h"
 
+#include "util/date_time.h"
 #include "util/logging.h"
 #include "util/platform.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cinttypes>
 
@@ -185,16 +187,19 @@ PageGuardManager* PageGuardManager::instance_ = nullptr;
 PageGuardManager::PageGuardManager() :
     exception_handler_(nullptr), exception_handler_count_(0), system_page_size_(GetSystemPageSize()),
     system_page_pot_shift_(GetSystemPagePotShift()), enable_copy_on_map_(kDefaultEnableCopyOnMap),
-    enable_separate_read_(kDefaultEnableSeparateRead), enable_read_write_same_page_(kDefaultEnableReadWriteSamePage)
+    enable_separate_read_(kDefaultEnableSeparateRead), enable_statistics_(false),
+    enable_read_write_same_page_(kDefaultEnableReadWriteSamePage)
 {}
 
 PageGuardManager::PageGuardManager(bool enable_copy_on_map,
                                    bool enable_separate_read,
-                                   bool expect_read_write_same_page) :
+                                   bool expect_read_write_same_page,
+                                   bool enable_statistics) :
     exception_handler_(nullptr),
     exception_handler_count_(0), system_page_size_(GetSystemPageSize()),
     system_page_pot_shift_(GetSystemPagePotShift()), enable_copy_on_map_(enable_copy_on_map),
-    enable_separate_read_(enable_separate_read), enable_read_write_same_page_(expect_read_write_same_page)
+    enable_separate_read_(enable_separate_read), enable_statistics_(enable_statistics),
+    enable_read_write_same_page_(expect_read_write_same_page)
 {}
 
 PageGuardManager::~PageGuardManager()
@@ -205,11 +210,15 @@ PageGuardManager::~PageGuardManager()
     }
 }
 
-void PageGuardManager::Create(bool enable_copy_on_map, bool enable_separate_read, bool expect_read_write_same_page)
+void PageGuardManager::Create(bool enable_copy_on_map,
+                              bool enable_separate_read,
+                              bool expect_read_write_same_page,
+                              bool enable_statistics)
 {
     if (instance_ == nullptr)
     {
-        instance_ = new PageGuardManager(enable_copy_on_map, enable_separate_read, expect_read_write_same_page);
+        instance_ = new PageGuardManager(
+            enable_copy_on_map, enable_separate_read, expect_read_write_same_page, enable_statistics);
     }
     else
     {
@@ -432,6 +441,26 @@ void PageGuardManager::MemoryCopy(void* destination, const void* source, size_t
     util::platform::MemoryCopy(destination, size, source, size);
 }
 
+void PageGuardManager::MemoryCopy(MemoryInfo* memory_info, void* destination, const void* source, size_t size)
+{
+    assert(memory_info != nullptr);
+
+    if (memory_info->statistics == nullptr)
+    {
+        MemoryCopy(destination, source, size);
+    }
+    else
+    {
+        int64_t start_time = util::datetime::GetTimestamp();
+
+        MemoryCopy(destination, source, size);
+
+        memory_info->statistics->copy_time +=
+            util::datetime::DiffTimestamps(start_time, util::datetime::GetTimestamp());
+        memory_info->statistics->copy_bytes += size;
+    }
+}
+
 bool PageGuardManager::FindMemory(void* address, MemoryInfo** watched_memory_info)
 {
     assert((address != nullptr) && (watched_memory_info != nullptr));
@@ -486,6 +515,33 @@ bool PageGuardManager::SetMemoryProtection(void* protect_address, size_t protect
     return success;
 }
 
+bool PageGuardManager::SetMemoryProtection(MemoryInfo* memory_info,
+                                           void*       protect_address,
+                                           size_t      protect_size,
+                                           uint32_t    protect_mask)
+{
+    assert(memory_info != nullptr);
+
+    bool success = true;
+
+    if (memory_info->statistics == nullptr)
+    {
+        success = SetMemoryProtection(protect_address, protect_size, protect_mask);
+    }
+    else
+    {
+        int64_t start_time = util::datetime::GetTimestamp();
+
+        success = SetMemoryProtection(protect_address, protect_size, protect_mask);
+
+        memory_info->statistics->protect_time +=
+            util::datetime::DiffTimestamps(start_time, util::datetime::GetTimestamp());
+        ++memory_info->statistics->protect_count;
+    }
+
+    return success;
+}
+
 void PageGuardManager::LoadActiveWriteStates(MemoryInfo* memory_info)
 {
     assert((memory_info != nullptr) && (memory_info->shadow_memory == nullptr));
@@ -537,6 +593,7 @@ void PageGuardManager::ProcessEntry(uint64_t                  memory_id,
 
     bool   active_range = false;
     size_t start_index  = 0;
+    size_t dirty_pages  = 0;
 
     memory_info->is_modified = false;
 
@@ -549,6 +606,8 @@ void PageGuardManager::ProcessEntry(uint64_t                  memory_id,
             memory_info->status_tracker.SetActiveWriteBlock(i, false);
             memory_info->status_tracker.SetActiveReadBlock(i, false);
 
+            ++dirty_pages;
+
             if (!active_range)
             {
                 active_range = true;
@@ -571,7 +630,7 @@ void PageGuardManager::ProcessEntry(uint64_t                  memory_id,
 
                 memory_info->status_tracker.SetActiveReadBlock(i, false);
 
-                SetMemoryProtection(page_address, segment_size, kGuardReadWriteProtect);
+                SetMemoryProtection(memory_info, page_address, segment_size, kGuardReadWriteProtect);
             }
 
             // If the previous pages were modified by a write operation, process the modified range now.
@@ -588,6 +647,19 @@ void PageGuardManager::ProcessEntry(uint64_t                  memory_id,
     {
         ProcessActiveRange(memory_id, memory_info, start_index, memory_info->total_pages, handle_modified);
     }
+
+    ++memory_info->process_count;
+    memory_info->modified_pages += dirty_pages;
+    memory_info->processed_pages += memory_info->total_pages;
+
+    if (memory_info->statistics != nullptr)
+    {
+        MemoryStatistics* statistics = memory_info->statistics;
+
+        ++statistics->process_count;
+        statistics->dirty_pages += dirty_pages;
+        statistics->max_dirty_pages = std::max(statistics->max_dirty_pages, static_cast<uint64_t>(dirty_pages));
+    }
 }
 
 void PageGuardManager::ProcessActiveRange(uint64_t                  memory_id,
@@ -617,7 +689,7 @@ void PageGuardManager::ProcessActiveRange(uint64_t                  memory_id,
         // Page guard was disabled when these pages were accessed.  We enable it now for write, to
         // trap any writes made to the memory while we are performing the copy from shadow memory
         // to mapped memory.
-        SetMemoryProtection(guard_address, guard_range, kGuardReadOnlyProtect);
+        SetMemoryProtection(memory_info, guard_address, guard_range, kGuardReadOnlyProtect);
 
         // Copy from shadow memory to the original mapped memory.
         if (start_index == 0)
@@ -631,14 +703,19 @@ void PageGuardManager::ProcessActiveRange(uint64_t                  memory_id,
 
         void* source_address      = static_cast<uint8_t*>(memory_info->shadow_memory) + page_offset;
         void* destination_address = static_cast<uint8_t*>(memory_info->mapped_memory) + page_offset;
-        MemoryCopy(destination_address, source_address, page_range);
+        MemoryCopy(memory_info, destination_address, source_address, page_range);
+
+        if (memory_info->statistics != nullptr)
+        {
+            memory_info->statistics->modified_bytes += page_range;
+        }
 
         // The shadow memory address, page offset, and range values to be provided to the callback, which will process
         // the memory range.
         handle_modified(memory_id, memory_info->shadow_memory, page_offset, page_range);
 
         // Reset page guard to detect both read and write accesses when using shadow memory.
-        SetMemoryProtection(guard_address, guard_range, kGuardReadWriteProtect);
+        SetMemoryProtection(memory_info, guard_address, guard_range, kGuardReadWriteProtect);
     }
     else
     {
@@ -647,7 +724,7 @@ void PageGuardManager::ProcessActiveRange(uint64_t                  memory_id,
             void* guard_address = static_cast<uint8_t*>(memory_info->aligned_address) + page_offset;
 
             // Reset page guard to detect only write accesses when not using shadow memory.
-            SetMemoryProtection(guard_address, page_range, kGuardReadOnlyProtect);
+            SetMemoryProtection(memory_info, guard_address, page_range, kGuardReadOnlyProtect);
         }
 
         // Copy directly from the mapped memory.
@@ -664,6 +741,11 @@ void PageGuardManager::ProcessActiveRange(uint64_t                  memory_id,
             page_offset -= memory_info->aligned_offset;
         }
 
+        if (memory_info->statistics != nullptr)
+        {
+            memory_info->statistics->modified_bytes += page_range;
+        }
+
         // The mapped memory address, page offset, and range values to be provided to the callback, which will process
         // the memory range.
         handle_modified(memory_id, memory_info->mapped_memory, page_offset, page_range);
@@ -709,6 +791,11 @@ void* PageGuardManager::AddTrackedMemory(uint64_t  memory_id,
 
     ShadowMemoryInfo* shadow_memory_info = nullptr;
 
+    // Statistics for copies from mapped memory to shadow memory, which are performed before the memory is tracked.
+    uint64_t map_copy_bytes = 0;
+    int64_t  map_copy_time  = 0;
+    int64_t  start_time     = enable_statistics_ ? util::datetime::GetTimestamp() : 0;
+
     if (use_shadow_memory)
     {
         if (use_write_watch)
@@ -733,6 +820,7 @@ void* PageGuardManager::AddTrackedMemory(uint64_t  memory_id,
                 if (enable_copy_on_map_)
                 {
                     MemoryCopy(shadow_memory, mapped_memory, mapped_range);
+                    map_copy_bytes += mapped_range;
                 }
             }
         }
@@ -815,6 +903,7 @@ void* PageGuardManager::AddTrackedMemory(uint64_t  memory_id,
                     }
 
                     MemoryCopy(dst_page, src_page, copy_size);
+                    map_copy_bytes += copy_size;
 
                     dst_page += copy_size;
                     src_page += copy_size;
@@ -822,6 +911,11 @@ void* PageGuardManager::AddTrackedMemory(uint64_t  memory_id,
             }
         }
 
+        if (enable_statistics_)
+        {
+            map_copy_time = util::datetime::DiffTimestamps(start_time, util::datetime::GetTimestamp());
+        }
+
         bool        success       = true;
         const void* start_address = mapped_memory;
 
@@ -869,7 +963,19 @@ void* PageGuardManager::AddTrackedMemory(uint64_t  memory_id,
                                                            use_write_watch,
                                                            shadow_memory_handle == kNullShadowHandle));
 
-            if (!entry.second)
+            if (entry.second)
+            {
+                if (enable_statistics_)
+                {
+                    MemoryStatistics* statistics = &memory_statistics_[memory_id];
+
+                    statistics->copy_bytes += map_copy_bytes;
+                    statistics->copy_time += map_copy_time;
+
+                    entry.first->second.statistics = statistics;
+                }
+            }
+            else
             {
                 if (!use_write_watch)
                 {
@@ -995,6 +1101,43 @@ void PageGuardManager::ProcessMemoryEntries(const ModifiedMemoryFunc& handle_mod
     }
 }
 
+bool PageGuardManager::TakeModifiedPageCounts(uint64_t  memory_id,
+                                              uint64_t* process_count,
+                                              uint64_t* modified_pages,
+                                              uint64_t* processed_pages)
+{
+    assert((process_count != nullptr) && (modified_pages != nullptr) && (processed_pages != nullptr));
+
+    std::lock_guard<std::mutex> lock(tracked_memory_lock_);
+
+    auto entry = memory_info_.find(memory_id);
+    if (entry != memory_info_.end())
+    {
+        MemoryInfo& memory_info = entry->second;
+
+        (*process_count)   = memory_info.process_count;
+        (*modified_pages)  = memory_info.modified_pages;
+        (*processed_pages) = memory_info.processed_pages;
+
+        memory_info.process_count   = 0;
+        memory_info.modified_pages  = 0;
+        memory_info.processed_pages = 0;
+
+        return true;
+    }
+
+    return false;
+}
+
+void PageGuardManager::GetMemoryStatistics(MemoryStatisticsMap* statistics)
+{
+    assert(statistics != nullptr);
+
+    std::lock_guard<std::mutex> lock(tracked_memory_lock_);
+
+    (*statistics) = memory_statistics_;
+}
+
 bool PageGuardManager::HandleGuardPageViolation(void* address, bool is_write, bool clear_guard)
 {
     MemoryInfo* memory_info = nullptr;
@@ -1009,6 +1152,18 @@ bool PageGuardManager::HandleGuardPageViolation(void* address, bool is_write, bo
 
         memory_info->is_modified = true;
 
+        if (memory_info->statistics != nullptr)
+        {
+            if (is_write)
+            {
+                ++memory_info->statistics->write_faults;
+            }
+            else
+            {
+                ++memory_info->statistics->read_faults;
+            }
+        }
+
         // Get the offset from the start of the first protected memory page to the current address.
         size_t start_offset = static_cast<uint8_t*>(address) - static_cast<uint8_t*>(memory_info->aligned_address);
 
@@ -1021,7 +1176,7 @@ bool PageGuardManager::HandleGuardPageViolation(void* address, bool is_write, bo
         // types except WIN32 PAGE_GUARD).
         if (clear_guard)
         {
-            SetMemoryProtection(page_address, segment_size, kGuardNoProtect);
+            SetMemoryProtection(memory_info, page_address, segment_size, kGuardNoProtect);
         }
 
         // For POSIX systems, when compiled without PAGE_GUARD_ENABLE_UCONTEXT_WRITE_DETECTION, is_write is always
@@ -1047,7 +1202,7 @@ bool PageGuardManager::HandleGuardPageViolation(void* address, bool is_write, bo
 
             uint8_t* source_address      = static_cast<uint8_t*>(memory_info->mapped_memory) + page_offset;
             uint8_t* destination_address = static_cast<uint8_t*>(memory_info->shadow_memory) + page_offset;
-            MemoryCopy(destination_address, source_address, segment_size);
+            MemoryCopy(memory_info, destination_address, source_address, segment_size);
 
             memory_info->status_tracker.SetActiveReadBlock(page_index, true);
 
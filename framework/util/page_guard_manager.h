@@ -48,8 +48,28 @@ class PageGuardManager
     // the modified range pointer, and the size of the modified range.
     typedef std::function<void(uint64_t, void*, size_t, size_t)> ModifiedMemoryFunc;
 
+    // Memory tracking statistics for a memory object, collected when statistics are enabled.  Times are in nanoseconds.
+    struct MemoryStatistics
+    {
+        uint64_t write_faults{ 0 };    // Number of guard page violations triggered by write access.
+        uint64_t read_faults{ 0 };     // Number of guard page violations triggered by read access.
+        uint64_t process_count{ 0 };   // Number of times modified pages were processed for unmap, flush, or submit.
+        uint64_t dirty_pages{ 0 };     // Total number of modified pages processed.
+        uint64_t max_dirty_pages{ 0 }; // Largest number of modified pages processed at one time.
+        uint64_t modified_bytes{ 0 };  // Total size of the modified memory ranges provided to the ModifiedMemoryFunc.
+        uint64_t protect_count{ 0 };   // Number of memory protection changes.
+        int64_t  protect_time{ 0 };    // Time spent changing memory protection.
+        uint64_t copy_bytes{ 0 };      // Total size of copies between mapped memory and shadow memory.
+        int64_t  copy_time{ 0 };       // Time spent copying between mapped memory and shadow memory.
+    };
+
+    typedef std::unordered_map<uint64_t, MemoryStatistics> MemoryStatisticsMap;
+
   public:
-    static void Create(bool enable_copy_on_map, bool enable_separate_read, bool expect_read_write_same_page);
+    static void Create(bool enable_copy_on_map,
+                       bool enable_separate_read,
+                       bool expect_read_write_same_page,
+                       bool enable_statistics = false);
 
     static void Destroy();
 
@@ -57,6 +77,12 @@ class PageGuardManager
 
     bool UseSeparateRead() const { return enable_separate_read_; }
 
+    bool IsStatisticsEnabled() const { return enable_statistics_; }
+
+    // Retrieves a copy of the statistics for all memory objects that have been tracked, including memory objects that
+    // are no longer tracked.
+    void GetMemoryStatistics(MemoryStatisticsMap* statistics);
+
     bool GetTrackedMemory(uint64_t memory_id, void** memory);
 
     // The use_write_watch parameter is ignored on all platforms except Windows, and is ignored on Windows if
@@ -85,6 +111,14 @@ class PageGuardManager
 
     void ProcessMemoryEntries(const ModifiedMemoryFunc& handle_modified);
 
+    // Retrieves the number of times modified pages have been processed for a tracked memory object, the total number
+    // of pages that were modified, and the total number of pages that were checked for modification.  The counts are
+    // reset, so each call retrieves the counts accumulated since the previous call.
+    bool TakeModifiedPageCounts(uint64_t  memory_id,
+                                uint64_t* process_count,
+                                uint64_t* modified_pages,
+                                uint64_t* processed_pages);
+
     bool HandleGuardPageViolation(void* address, bool is_write, bool clear_guard);
 
     size_t GetAlignedSize(size_t size) const;
@@ -101,7 +135,10 @@ class PageGuardManager
   protected:
     PageGuardManager();
 
-    PageGuardManager(bool enable_copy_on_map, bool enable_separate_read, bool expect_read_write_same_page);
+    PageGuardManager(bool enable_copy_on_map,
+                     bool enable_separate_read,
+                     bool expect_read_write_same_page,
+                     bool enable_statistics);
 
     ~PageGuardManager();
 
@@ -123,7 +160,8 @@ class PageGuardManager
             status_tracker(tp),
             mapped_memory(mm), mapped_range(mr), shadow_memory(sm), shadow_range(sr), aligned_address(aa),
             aligned_offset(ao), total_pages(tp), last_segment_size(lss), start_address(sa), end_address(ea),
-            use_write_watch(ww), is_modified(false), own_shadow_memory(os)
+            use_write_watch(ww), is_modified(false), own_shadow_memory(os), process_count(0), modified_pages(0),
+            processed_pages(0), statistics(nullptr)
         {
 #if defined(WIN32)
             if (shadow_memory == nullptr)
@@ -150,6 +188,12 @@ class PageGuardManager
         bool        use_write_watch;
         bool        is_modified;
         bool        own_shadow_memory;
+        uint64_t    process_count;   // Number of times modified pages were processed.
+        uint64_t    modified_pages;  // Total number of modified pages processed.
+        uint64_t    processed_pages; // Total number of pages checked for modification.
+
+        // Statistics for the memory object, or nullptr when statistics are disabled.
+        MemoryStatistics* statistics;
 
 #if defined(WIN32)
         // Memory for retrieving modified pages with GetWriteWatch.
@@ -182,8 +226,13 @@ class PageGuardManager
 
     size_t GetMemorySegmentSize(const MemoryInfo* memory_info, size_t page_index) const;
     void   MemoryCopy(void* destination, const void* source, size_t size);
+    void   MemoryCopy(MemoryInfo* memory_info, void* destination, const void* source, size_t size);
     bool   FindMemory(void* address, MemoryInfo** watched_memory_info);
     bool   SetMemoryProtection(void* protect_address, size_t protect_size, uint32_t protect_mask);
+    bool   SetMemoryProtection(MemoryInfo* memory_info,
+                               void*       protect_address,
+                               size_t      protect_size,
+                               uint32_t    protect_mask);
     void   LoadActiveWriteStates(MemoryInfo* memory_info);
     void   ProcessEntry(uint64_t memory_id, MemoryInfo* memory_info, const ModifiedMemoryFunc& handle_modified);
     void   ProcessActiveRange(uint64_t                  memory_id,
@@ -212,6 +261,8 @@ class PageGuardManager
     const size_t             system_page_pot_shift_;
     const bool               enable_copy_on_map_;
     const bool               enable_separate_read_;
+    const bool               enable_statistics_;
+    MemoryStatisticsMap      memory_statistics_; // Protected by tracked_memory_lock_.
 
     // Only applies to WIN32 builds and Linux/Android builds with PAGE_GUARD_ENABLE_UCONTEXT_WRITE_DETECTION defined.
     const bool enable_read_write_same_page_;
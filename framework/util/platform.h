@@ -204,6 +204,12 @@ inline int32_t MakeDirectory(const char* filename)
     return _mkdir(filename);
 }
 
+// Replaces the destination file if it exists.
+inline int32_t FileRename(const char* old_filename, const char* new_filename)
+{
+    return MoveFileExA(old_filename, new_filename, MOVEFILE_REPLACE_EXISTING) ? 0 : -1;
+}
+
 #else // !defined(WIN32)
 
 // Error value indicating string was truncated
@@ -448,6 +454,12 @@ inline int32_t MakeDirectory(const char* filename)
     return mkdir(filename, S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
 }
 
+// Replaces the destination file if it exists.
+inline int32_t FileRename(const char* old_filename, const char* new_filename)
+{
+    return rename(old_filename, new_filename);
+}
+
 #endif // WIN32
 
 inline size_t StringLength(const char* s)
@@ -505,6 +517,11 @@ inline int32_t FileClose(FILE* stream)
     return fclose(stream);
 }
 
+inline int32_t FileRemove(const char* filename)
+{
+    return remove(filename);
+}
+
 GFXRECON_END_NAMESPACE(platform)
 GFXRECON_END_NAMESPACE(util)
 GFXRECON_END_NAMESPACE(gfxrecon)
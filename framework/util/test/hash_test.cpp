@@ -0,0 +1,202 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+
+#include "util/hash.h"
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace
+{
+
+using gfxrecon::util::hash::GenerateHash128;
+using gfxrecon::util::hash::GenerateHash64;
+using gfxrecon::util::hash::Hash128;
+
+const uint64_t kSeed = 0x9E3779B97F4A7C15ull;
+
+// Deterministic test data, with enough bytes for two full 32 byte stripes and every tail length.
+struct TestData
+{
+    TestData()
+    {
+        for (size_t i = 0; i < sizeof(bytes); ++i)
+        {
+            bytes[i] = static_cast<uint8_t>((i * 167 + 13) & 0xff);
+        }
+    }
+
+    uint8_t bytes[96];
+};
+
+struct HashVector
+{
+    size_t   size;
+    uint64_t seed;
+    uint64_t hash;
+};
+
+// Reference values from the XXH64 reference implementation, for the seeded short input path with tail lengths 0-31
+// and the unseeded stripe path with tail lengths 0-31.
+const HashVector kHash64Vectors[] = {
+    {  0, kSeed, 0xC4349FC93C010000ull },
+    {  1, kSeed, 0xA70E4906C54489B3ull },
+    {  2, kSeed, 0x82550D381E393205ull },
+    {  3, kSeed, 0xBF3EA50FF941639Eull },
+    {  4, kSeed, 0x8214CCF4F1FF646Eull },
+    {  5, kSeed, 0x109BE8CFDAC25299ull },
+    {  6, kSeed, 0x554BDBE02A57E815ull },
+    {  7, kSeed, 0x97040F7D586AB641ull },
+    {  8, kSeed, 0x845C3715DC14D7A4ull },
+    {  9, kSeed, 0x2544A5B02DD5CB50ull },
+    { 10, kSeed, 0x0137EFAB0496EA29ull },
+    { 11, kSeed, 0xF563D723B71085A8ull },
+    { 12, kSeed, 0x91F18FA8E2FB5EE1ull },
+    { 13, kSeed, 0xD9BAF87AF1B7C6D1ull },
+    { 14, kSeed, 0x7215CCDDC4D2CFFAull },
+    { 15, kSeed, 0xB3F611E337708F13ull },
+    { 16, kSeed, 0x83AA57F66088A857ull },
+    { 17, kSeed, 0x08FC10D03D7C83ADull },
+    { 18, kSeed, 0xC8EBDFC7A11240CEull },
+    { 19, kSeed, 0x8FB4203C61BEE483ull },
+    { 20, kSeed, 0xC9BFEB56892DC1DAull },
+    { 21, kSeed, 0xDB05F18E13DB4B71ull },
+    { 22, kSeed, 0x5071AAE9187136AAull },
+    { 23, kSeed, 0xABF3D8E9A433EF83ull },
+    { 24, kSeed, 0xAB37E86093BC2432ull },
+    { 25, kSeed, 0xFE8699694AC7651Bull },
+    { 26, kSeed, 0x44FB8FCA18087D8Full },
+    { 27, kSeed, 0x887B902B9E2454CCull },
+    { 28, kSeed, 0x9E873EA2EF98169Cull },
+    { 29, kSeed, 0x5B908C07952C1763ull },
+    { 30, kSeed, 0x13C15DE7104304C2ull },
+    { 31, kSeed, 0xC30F7C92C87BBE00ull },
+    { 32, 0, 0x7665C921C9BF2EC7ull },
+    { 33, 0, 0xB5A9D9EF259AE821ull },
+    { 34, 0, 0xAE0425573FF47833ull },
+    { 35, 0, 0xE0045F4586D4D91Aull },
+    { 36, 0, 0xDE4C0F568D54D497ull },
+    { 37, 0, 0xC60344DCC647A515ull },
+    { 38, 0, 0xEC2B43F049EB7EC7ull },
+    { 39, 0, 0xE2148DBBC5AB4089ull },
+    { 40, 0, 0xC94202B2B0886774ull },
+    { 41, 0, 0x55F738550A208E0Cull },
+    { 42, 0, 0xD30B02916FDECDDFull },
+    { 43, 0, 0xDDAAD9373CD92518ull },
+    { 44, 0, 0x99597B95F6740623ull },
+    { 45, 0, 0x4E4237A872CED8E6ull },
+    { 46, 0, 0x35BEC731322DBF16ull },
+    { 47, 0, 0xFFB42101C210309Eull },
+    { 48, 0, 0x487555383052A6B8ull },
+    { 49, 0, 0x0F72D661FE1AF016ull },
+    { 50, 0, 0xA933907C97A3093Cull },
+    { 51, 0, 0x11E2BF4D2C718B5Dull },
+    { 52, 0, 0x713DD26A80875BB8ull },
+    { 53, 0, 0x1C12A4288B82E52Cull },
+    { 54, 0, 0xFCF7D79ACC103487ull },
+    { 55, 0, 0x6E297F430D2B50C5ull },
+    { 56, 0, 0x6E8A76D67CE79B64ull },
+    { 57, 0, 0x0C9629D011CF1646ull },
+    { 58, 0, 0xF3A329277473D950ull },
+    { 59, 0, 0x62753FF8371D1A48ull },
+    { 60, 0, 0x99286364D889AD3Full },
+    { 61, 0, 0x529B3D71BC6FFEE4ull },
+    { 62, 0, 0x8CFCBE0A31BE33ECull },
+    { 63, 0, 0xB0289CD9324034F0ull },
+    { 64, 0, 0xFFF2525C99BF2005ull },
+    { 96, 0, 0xB4C91238BEBC5148ull },
+};
+
+struct Hash128Vector
+{
+    size_t   size;
+    uint64_t low;
+    uint64_t high;
+};
+
+// Reference values for the unseeded and 0x165667B19E3779F9 seeded XXH64 halves of the 128-bit hash.
+const Hash128Vector kHash128Vectors[] = {
+    {  0, 0xEF46DB3751D8E999ull, 0x766B3308C7FD7D49ull },
+    {  1, 0x2078E1AD38AD738Bull, 0x6F29073FCFFEC817ull },
+    {  7, 0x0DA493621D6DC898ull, 0xC592F82A7B57D03Cull },
+    { 31, 0x65C5FEB01DA7464Dull, 0x1626033541E5A0E0ull },
+    { 32, 0x7665C921C9BF2EC7ull, 0x189AA6561EDD00C9ull },
+    { 33, 0xB5A9D9EF259AE821ull, 0x7BC077760D95F1A9ull },
+    { 63, 0xB0289CD9324034F0ull, 0xC6965E8FBC8800E7ull },
+    { 96, 0xB4C91238BEBC5148ull, 0x2A793E772CFD448Cull },
+};
+
+} // namespace
+
+TEST_CASE("GenerateHash64 matches the XXH64 reference strings", "[hash]")
+{
+    REQUIRE(GenerateHash64("", 0) == 0xEF46DB3751D8E999ull);
+    REQUIRE(GenerateHash64("abc", 3) == 0x44BC2CF5AD770999ull);
+}
+
+TEST_CASE("GenerateHash64 matches the XXH64 reference for all tail lengths", "[hash]")
+{
+    TestData data;
+
+    for (const auto& vector : kHash64Vectors)
+    {
+        INFO("size " << vector.size << ", seed " << vector.seed);
+        REQUIRE(GenerateHash64(data.bytes, vector.size, vector.seed) == vector.hash);
+    }
+}
+
+TEST_CASE("GenerateHash64 does not depend on data alignment", "[hash]")
+{
+    TestData data;
+    uint64_t storage[16] = {};
+    uint8_t* unaligned   = reinterpret_cast<uint8_t*>(storage) + 3;
+
+    std::memcpy(unaligned, data.bytes, 64);
+
+    REQUIRE(GenerateHash64(unaligned, 64) == GenerateHash64(data.bytes, 64));
+    REQUIRE(GenerateHash64(unaligned, 45, kSeed) == GenerateHash64(data.bytes, 45, kSeed));
+}
+
+TEST_CASE("GenerateHash128 combines two differently seeded XXH64 hashes", "[hash]")
+{
+    TestData data;
+
+    for (const auto& vector : kHash128Vectors)
+    {
+        INFO("size " << vector.size);
+        Hash128 hash = GenerateHash128(data.bytes, vector.size);
+        REQUIRE(hash.low == vector.low);
+        REQUIRE(hash.high == vector.high);
+        REQUIRE(hash.low == GenerateHash64(data.bytes, vector.size));
+    }
+}
+
+TEST_CASE("GenerateHash128 distinguishes inputs that differ in one byte", "[hash]")
+{
+    TestData data;
+    Hash128  original = GenerateHash128(data.bytes, sizeof(data.bytes));
+
+    data.bytes[50] ^= 1;
+    Hash128 modified = GenerateHash128(data.bytes, sizeof(data.bytes));
+
+    REQUIRE(!(original == modified));
+    REQUIRE(original.low != modified.low);
+    REQUIRE(original.high != modified.high);
+}
@@ -68,6 +68,19 @@ size_t ZlibCompressor::Decompress(const size_t                compressed_size,
                                   const std::vector<uint8_t>& compressed_data,
                                   const size_t                expected_uncompressed_size,
                                   std::vector<uint8_t>*       uncompressed_data)
+{
+    if (nullptr == uncompressed_data)
+    {
+        return 0;
+    }
+
+    return Decompress(compressed_size, compressed_data.data(), expected_uncompressed_size, uncompressed_data->data());
+}
+
+size_t ZlibCompressor::Decompress(const size_t   compressed_size,
+                                  const uint8_t* compressed_data,
+                                  const size_t   expected_uncompressed_size,
+                                  uint8_t*       uncompressed_data)
 {
     size_t copy_size = 0;
 
@@ -83,11 +96,11 @@ size_t ZlibCompressor::Decompress(const size_t                compressed_size,
 
     GFXRECON_CHECK_CONVERSION_DATA_LOSS(uInt, compressed_size);
     decompress_stream.avail_in = static_cast<uInt>(compressed_size);
-    decompress_stream.next_in  = const_cast<Bytef*>(compressed_data.data());
+    decompress_stream.next_in  = const_cast<Bytef*>(compressed_data);
 
     GFXRECON_CHECK_CONVERSION_DATA_LOSS(uInt, expected_uncompressed_size);
     decompress_stream.avail_out = static_cast<uInt>(expected_uncompressed_size);
-    decompress_stream.next_out  = uncompressed_data->data();
+    decompress_stream.next_out  = uncompressed_data;
 
     // Perform the decompression (inflate the data).
     inflateInit(&decompress_stream);
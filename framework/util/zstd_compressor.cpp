@@ -67,6 +67,19 @@ size_t ZstdCompressor::Decompress(const size_t                compressed_size,
                                   const std::vector<uint8_t>& compressed_data,
                                   const size_t                expected_uncompressed_size,
                                   std::vector<uint8_t>*       uncompressed_data)
+{
+    if (nullptr == uncompressed_data)
+    {
+        return 0;
+    }
+
+    return Decompress(compressed_size, compressed_data.data(), expected_uncompressed_size, uncompressed_data->data());
+}
+
+size_t ZstdCompressor::Decompress(const size_t   compressed_size,
+                                  const uint8_t* compressed_data,
+                                  const size_t   expected_uncompressed_size,
+                                  uint8_t*       uncompressed_data)
 {
     size_t data_size = 0;
 
@@ -75,9 +88,9 @@ size_t ZstdCompressor::Decompress(const size_t                compressed_size,
         return 0;
     }
 
-    size_t uncompressed_size_generated = ZSTD_decompress(reinterpret_cast<char*>(uncompressed_data->data()),
+    size_t uncompressed_size_generated = ZSTD_decompress(reinterpret_cast<char*>(uncompressed_data),
                                                          expected_uncompressed_size,
-                                                         reinterpret_cast<const char*>(compressed_data.data()),
+                                                         reinterpret_cast<const char*>(compressed_data),
                                                          compressed_size);
 
     if (!ZSTD_isError(uncompressed_size_generated))
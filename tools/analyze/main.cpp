@@ -0,0 +1,308 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+#include "info_report.h"
+#include "project_version.h"
+
+#include "decode/analysis_driver.h"
+#include "decode/block_statistics.h"
+#include "decode/file_processor.h"
+#include "decode/vulkan_shader_extract_consumer.h"
+#include "decode/vulkan_stats_consumer.h"
+#include "format/format.h"
+#include "generated/generated_vulkan_ascii_consumer.h"
+#include "util/argument_parser.h"
+#include "util/logging.h"
+
+#include "vulkan/vulkan.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <exception>
+#include <string>
+#include <thread>
+
+const char kHelpShortOption[]              = "-h";
+const char kHelpLongOption[]               = "--help";
+const char kVersionOption[]                = "--version";
+const char kNoDebugPopup[]                 = "--no-debug-popup";
+const char kInfoOption[]                   = "--info";
+const char kExtractShadersOption[]         = "--extract-shaders";
+const char kShaderDirArgument[]            = "--shader-dir";
+const char kToAsciiOption[]                = "--to-ascii";
+const char kAsciiFileArgument[]            = "--ascii-file";
+const char kThreadedOption[]               = "--threaded";
+const char kDecompressionThreadsArgument[] = "--decompression-threads";
+
+const char kOptions[]   = "-h|--help,--version,--no-debug-popup,--info,--extract-shaders,--to-ascii,--threaded";
+const char kArguments[] = "--shader-dir,--ascii-file,--decompression-threads";
+
+static void PrintUsage(const char* exe_name)
+{
+    std::string app_name     = exe_name;
+    size_t      dir_location = app_name.find_last_of("/\\");
+    if (dir_location >= 0)
+    {
+        app_name.replace(0, dir_location + 1, "");
+    }
+    GFXRECON_WRITE_CONSOLE("\n%s - Analyze a GFXReconstruct capture file several ways in a single pass.\n",
+                           app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("Usage:");
+    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] [--info] [--extract-shaders]", app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--shader-dir <dir>] [--to-ascii] [--ascii-file <file>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--threaded] [--decompression-threads <N>] <file>\n");
+    GFXRECON_WRITE_CONSOLE("Required arguments:");
+    GFXRECON_WRITE_CONSOLE("  <file>\t\tThe GFXReconstruct capture file to be processed.");
+    GFXRECON_WRITE_CONSOLE("\nAt least one of the following analysis options must be specified:");
+    GFXRECON_WRITE_CONSOLE("  --info\t\tPrint statistics for the capture file (see gfxrecon-info).");
+    GFXRECON_WRITE_CONSOLE("  --extract-shaders\tExtract shaders from the capture file (see gfxrecon-extract).");
+    GFXRECON_WRITE_CONSOLE("  --to-ascii\t\tConvert the capture file to text (see gfxrecon-toascii).");
+    GFXRECON_WRITE_CONSOLE("\nOptional arguments:");
+    GFXRECON_WRITE_CONSOLE("  -h\t\t\tPrint usage information and exit (same as --help).");
+    GFXRECON_WRITE_CONSOLE("  --version\t\tPrint version information and exit.");
+    GFXRECON_WRITE_CONSOLE("  --shader-dir <dir>\tPlace extracted shaders into directory <dir>. Otherwise");
+    GFXRECON_WRITE_CONSOLE("             \t\tuse <file>.shaders in working directory.");
+    GFXRECON_WRITE_CONSOLE("  --ascii-file <file>\tWrite the text conversion to <file>. Otherwise use the");
+    GFXRECON_WRITE_CONSOLE("             \t\tcapture file name with a .txt extension.");
+    GFXRECON_WRITE_CONSOLE("  --threaded\t\tRun each analysis on its own worker thread. The capture");
+    GFXRECON_WRITE_CONSOLE("            \t\tfile is still read and decompressed once, but is decoded");
+    GFXRECON_WRITE_CONSOLE("            \t\tseparately for each analysis.");
+    GFXRECON_WRITE_CONSOLE("  --decompression-threads <N>");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tRead and decompress blocks of compressed capture files");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tahead of processing with N worker threads.  Default is 0,");
+    GFXRECON_WRITE_CONSOLE("       \t\t\twhich decompresses blocks on the processing thread.  N is");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tlimited to the number of available hardware threads.");
+#if defined(WIN32) && defined(_DEBUG)
+    GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
+    GFXRECON_WRITE_CONSOLE("        \t\tdisplayed when abort() is called (Windows debug only).");
+#endif
+}
+
+static bool CheckOptionPrintUsage(const char* exe_name, const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    if (arg_parser.IsOptionSet(kHelpShortOption) || arg_parser.IsOptionSet(kHelpLongOption))
+    {
+        PrintUsage(exe_name);
+        return true;
+    }
+
+    return false;
+}
+
+static bool CheckOptionPrintVersion(const char* exe_name, const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    if (arg_parser.IsOptionSet(kVersionOption))
+    {
+        std::string app_name     = exe_name;
+        size_t      dir_location = app_name.find_last_of("/\\");
+
+        if (dir_location >= 0)
+        {
+            app_name.replace(0, dir_location + 1, "");
+        }
+
+        GFXRECON_WRITE_CONSOLE("%s version info:", app_name.c_str());
+        GFXRECON_WRITE_CONSOLE("  GFXReconstruct Version %s", GFXRECON_PROJECT_VERSION_STRING);
+        GFXRECON_WRITE_CONSOLE("  Vulkan Header Version %u.%u.%u",
+                               VK_VERSION_MAJOR(VK_HEADER_VERSION_COMPLETE),
+                               VK_VERSION_MINOR(VK_HEADER_VERSION_COMPLETE),
+                               VK_VERSION_PATCH(VK_HEADER_VERSION_COMPLETE));
+
+        return true;
+    }
+
+    return false;
+}
+
+static bool HasAnalysisOption(const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    return (arg_parser.IsOptionSet(kInfoOption) || arg_parser.IsOptionSet(kExtractShadersOption) ||
+            arg_parser.IsOptionSet(kToAsciiOption));
+}
+
+static std::string GetAsciiFilename(const gfxrecon::util::ArgumentParser& arg_parser, const std::string& input_filename)
+{
+    std::string output_filename = arg_parser.GetArgumentValue(kAsciiFileArgument);
+
+    if (output_filename.empty())
+    {
+        output_filename   = input_filename;
+        size_t suffix_pos = output_filename.find(GFXRECON_FILE_EXTENSION);
+        if (suffix_pos != std::string::npos)
+        {
+            output_filename = output_filename.substr(0, suffix_pos);
+        }
+
+        output_filename += ".txt";
+    }
+
+    return output_filename;
+}
+
+// Retrieves the number of threads that read and decompress blocks ahead of processing.  Returns 0, which decompresses
+// blocks on the processing thread, when the argument was not specified or the value is not valid.
+static uint32_t GetDecompressionThreadCount(const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    // Counts with more digits than this are rejected, so that the conversion cannot overflow.
+    const size_t kMaxThreadCountDigits = 9;
+
+    std::string value = arg_parser.GetArgumentValue(kDecompressionThreadsArgument);
+
+    if (value.empty())
+    {
+        return 0;
+    }
+
+    if ((value.length() > kMaxThreadCountDigits) || (value.find_first_not_of("0123456789") != std::string::npos))
+    {
+        GFXRECON_LOG_WARNING("Ignoring invalid %s value \"%s\", which must be a non-negative integer with at most %zu "
+                             "digits; decompressing blocks on the processing thread",
+                             kDecompressionThreadsArgument,
+                             value.c_str(),
+                             kMaxThreadCountDigits);
+        return 0;
+    }
+
+    uint32_t thread_count     = static_cast<uint32_t>(std::stoul(value));
+    uint32_t max_thread_count = std::max(1u, std::thread::hardware_concurrency());
+
+    if (thread_count > max_thread_count)
+    {
+        GFXRECON_LOG_WARNING("Limiting %s value %u to the number of available hardware threads (%u)",
+                             kDecompressionThreadsArgument,
+                             thread_count,
+                             max_thread_count);
+        thread_count = max_thread_count;
+    }
+
+    return thread_count;
+}
+
+int main(int argc, const char** argv)
+{
+    gfxrecon::util::Log::Init();
+
+    gfxrecon::util::ArgumentParser arg_parser(argc, argv, kOptions, kArguments);
+
+    if (CheckOptionPrintUsage(argv[0], arg_parser) || CheckOptionPrintVersion(argv[0], arg_parser))
+    {
+        gfxrecon::util::Log::Release();
+        exit(0);
+    }
+    else if (arg_parser.IsInvalid() || (arg_parser.GetPositionalArgumentsCount() != 1) ||
+             !HasAnalysisOption(arg_parser))
+    {
+        PrintUsage(argv[0]);
+        gfxrecon::util::Log::Release();
+        exit(-1);
+    }
+    else
+    {
+#if defined(WIN32) && defined(_DEBUG)
+        if (arg_parser.IsOptionSet(kNoDebugPopup))
+        {
+            _set_abort_behavior(0, _WRITE_ABORT_MSG | _CALL_REPORTFAULT);
+        }
+#endif
+    }
+
+    const std::vector<std::string>& positional_arguments       = arg_parser.GetPositionalArguments();
+    std::string                     input_filename             = positional_arguments[0];
+    bool                            threaded                   = arg_parser.IsOptionSet(kThreadedOption);
+    uint32_t                        decompression_thread_count = GetDecompressionThreadCount(arg_parser);
+
+    gfxrecon::decode::AnalysisDriver              driver(threaded, decompression_thread_count);
+    gfxrecon::decode::BlockStatistics             block_statistics;
+    gfxrecon::decode::VulkanStatsConsumer         stats_consumer;
+    gfxrecon::decode::VulkanShaderExtractConsumer extract_consumer;
+    gfxrecon::decode::VulkanAsciiConsumer         ascii_consumer;
+
+    if (arg_parser.IsOptionSet(kInfoOption))
+    {
+        // The header scan only reads the fixed size fields at the start of each block, and is much faster than the
+        // decode pass.
+        if (!block_statistics.Scan(input_filename))
+        {
+            GFXRECON_WRITE_CONSOLE("A failure has occurred during file processing");
+            gfxrecon::util::Log::Release();
+            exit(-1);
+        }
+
+        driver.AddConsumer(&stats_consumer);
+    }
+
+    if (arg_parser.IsOptionSet(kExtractShadersOption))
+    {
+        std::string extract_dir = arg_parser.GetArgumentValue(kShaderDirArgument);
+
+        if (extract_dir.empty())
+        {
+            extract_dir = gfxrecon::decode::VulkanShaderExtractConsumer::GetDefaultExtractDirectory(input_filename);
+        }
+
+        if (!extract_consumer.Initialize(extract_dir))
+        {
+            gfxrecon::util::Log::Release();
+            exit(-1);
+        }
+
+        driver.AddConsumer(&extract_consumer);
+    }
+
+    if (arg_parser.IsOptionSet(kToAsciiOption))
+    {
+        std::string output_filename = GetAsciiFilename(arg_parser, input_filename);
+
+        if (!ascii_consumer.Initialize(output_filename))
+        {
+            GFXRECON_WRITE_CONSOLE("Failed to open output file %s", output_filename.c_str());
+            gfxrecon::util::Log::Release();
+            exit(-1);
+        }
+
+        driver.AddConsumer(&ascii_consumer);
+    }
+
+    try
+    {
+        if (!driver.Process(input_filename))
+        {
+            GFXRECON_WRITE_CONSOLE("A failure has occurred during file processing");
+            gfxrecon::util::Log::Release();
+            exit(-1);
+        }
+    }
+    catch (std::exception& error)
+    {
+        GFXRECON_WRITE_CONSOLE("A failure has occurred during file processing: %s", error.what());
+        gfxrecon::util::Log::Release();
+        exit(-1);
+    }
+
+    if (driver.GetFrameCount() == 0)
+    {
+        GFXRECON_WRITE_CONSOLE("File did not contain any frames");
+    }
+    else if (arg_parser.IsOptionSet(kInfoOption))
+    {
+        PrintInfoReport(block_statistics.GetFrameCount(), stats_consumer, &block_statistics);
+    }
+
+    ascii_consumer.Destroy();
+
+    gfxrecon::util::Log::Release();
+    return 0;
+}
@@ -43,7 +43,7 @@ def UsageMsg():
            '                           [--log-file <file>]' + os.linesep)
     if sys.platform == 'win32':
         msg += '                           [--log-debugview]' + os.linesep
-    msg += '                           [--memory-tracking-mode {page_guard,assisted,unassisted}]' + os.linesep
+    msg += '                           [--memory-tracking-mode {page_guard,assisted,unassisted,auto}]' + os.linesep
     msg += '                           <program> [<programArgs>]'
     return msg
 
@@ -80,7 +80,7 @@ def ParseArgs():
     triggerKeyChoices = ['F1','F2','F3','F4','F5','F6','F7','F8','F9','F10','F11','F12','TAB','CTRL']
     compressionTypeChoices = ['LZ4','ZLIB','ZSTD','NONE']
     logLevelChoices = ['debug','info','warn','error','fatal']
-    memoryTrackingModeChoices = ['page_guard','assisted','unassisted']
+    memoryTrackingModeChoices = ['page_guard','assisted','unassisted','auto']
 
     parser = argparse.ArgumentParser(prog=os.path.basename(sys.argv[0]), description='Create a capture of a Vulkan program.', usage=UsageMsg(), allow_abbrev=False, formatter_class=SmartFormatter)
 
@@ -102,7 +102,10 @@ def ParseArgs():
                         '   assisted: application will call vkFlushMappedMemoryRanges' + os.linesep +
                         '      for memory to be written to the capture file' + os.linesep +
                         '   unassisted: all mapped memory will be written to the' + os.linesep +
-                        '      capture file during VkQueueSubmit and VkUnmapMemory')
+                        '      capture file during VkQueueSubmit and VkUnmapMemory' + os.linesep +
+                        '   auto: select one of the above modes for each mapped' + os.linesep +
+                        '      memory object based on its memory properties and' + os.linesep +
+                        '      observed write patterns')
 
     # Required args
     parser.add_argument('programAndArgs', metavar='<program> [<program args>]', nargs=argparse.REMAINDER, help='Program to capture, optionally followed by program arguments')
@@ -17,12 +17,10 @@
 #include "project_version.h"
 
 #include "decode/file_processor.h"
+#include "decode/vulkan_shader_extract_consumer.h"
 #include "format/format.h"
-#include "generated/generated_vulkan_consumer.h"
 #include "generated/generated_vulkan_decoder.h"
 #include "util/argument_parser.h"
-#include "util/file_path.h"
-#include "util/hash.h"
 #include "util/logging.h"
 
 #include "vulkan/vulkan.h"
@@ -102,49 +100,6 @@ static bool CheckOptionPrintVersion(const char* exe_name, const gfxrecon::util::
     return false;
 }
 
-class VulkanExtractConsumer : public gfxrecon::decode::VulkanConsumer
-{
-  public:
-    VulkanExtractConsumer(std::string& extract_dir) : extract_dir_(extract_dir) {}
-
-    virtual void Process_vkCreateShaderModule(
-        VkResult                                                                                    returnValue,
-        gfxrecon::format::HandleId                                                                  shaderModule,
-        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkShaderModuleCreateInfo>* pCreateInfo,
-        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkAllocationCallbacks>*,
-        gfxrecon::decode::HandlePointerDecoder<VkShaderModule>* pShaderModule) override
-    {
-        if ((returnValue >= 0) && (pCreateInfo != nullptr) && !pCreateInfo->IsNull() && (pShaderModule != nullptr) &&
-            !pShaderModule->IsNull())
-        {
-            const uint32_t* orig_code = pCreateInfo->GetPointer()->pCode;
-            size_t          orig_size = pCreateInfo->GetPointer()->codeSize;
-            uint64_t        handle_id = *pShaderModule->GetPointer();
-            std::string     file_name = "sh" + std::to_string(handle_id);
-            std::string     file_path = gfxrecon::util::filepath::Join(extract_dir_, file_name);
-
-            FILE*   fp     = nullptr;
-            int32_t result = gfxrecon::util::platform::FileOpen(&fp, file_path.c_str(), "wb");
-            if (result == 0)
-            {
-                size_t written_size = gfxrecon::util::platform::FileWrite(orig_code, sizeof(char), orig_size, fp);
-                if (written_size != orig_size)
-                {
-                    GFXRECON_WRITE_CONSOLE("Error while writing file %s: Could not complete", file_name.c_str());
-                }
-                gfxrecon::util::platform::FileClose(fp);
-            }
-            else
-            {
-                GFXRECON_WRITE_CONSOLE("Error while writing file %s: Could not open", file_name.c_str());
-            }
-        }
-    }
-
-  private:
-    std::string extract_dir_;
-};
-
 int main(int argc, const char** argv)
 {
     gfxrecon::util::Log::Init();
@@ -183,37 +138,18 @@ int main(int argc, const char** argv)
         // If no directory argument, use trace file name, minus path, plus .shaders suffix
         if (extract_dir.empty())
         {
-            extract_dir         = input_filename;
-            size_t dir_location = extract_dir.find_last_of("/\\");
-            if (dir_location >= 0)
-            {
-                extract_dir.replace(0, dir_location + 1, "");
-            }
-            extract_dir = extract_dir + ".shaders";
+            extract_dir = gfxrecon::decode::VulkanShaderExtractConsumer::GetDefaultExtractDirectory(input_filename);
         }
 
-        if (gfxrecon::util::filepath::Exists(extract_dir))
-        {
-            if (!gfxrecon::util::filepath::IsDirectory(extract_dir))
-            {
-                GFXRECON_WRITE_CONSOLE("Error while creating directory %s: Already exists as file",
-                                       extract_dir.c_str());
-                exit(-1);
-            }
-        }
-        else
+        gfxrecon::decode::VulkanDecoder               decoder;
+        gfxrecon::decode::VulkanShaderExtractConsumer extract_consumer;
+
+        if (!extract_consumer.Initialize(extract_dir))
         {
-            int32_t result = gfxrecon::util::platform::MakeDirectory(extract_dir.c_str());
-            if (result < 0)
-            {
-                GFXRECON_WRITE_CONSOLE("Error while creating directory %s: Could not open", extract_dir.c_str());
-                exit(-1);
-            }
+            gfxrecon::util::Log::Release();
+            exit(-1);
         }
 
-        gfxrecon::decode::VulkanDecoder decoder;
-        VulkanExtractConsumer           extract_consumer(extract_dir);
-
         decoder.AddConsumer(&extract_consumer);
 
         file_processor.AddDecoder(&decoder);
@@ -18,7 +18,7 @@
 # Utility for invoking gfxrecon commands
 # Usage:
 #
-#     gfxrecon.py [capture|compress|extract|info|replay] [<args>]
+#     gfxrecon.py [analyze|capture|compress|extract|index|info|replay] [<args>]
 #
 #         args is a command-specific argument list
 
@@ -33,9 +33,11 @@ argc = len(sys.argv)
 
 # Supported commands
 valid_commands = [
+    'analyze',
     'capture',
     'compress',
     'extract',
+    'index',
     'info',
     'replay'
 ]
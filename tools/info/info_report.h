@@ -0,0 +1,237 @@
+/*
+** Copyright (c) 2020 LunarG, Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+
+#ifndef GFXRECON_INFO_REPORT_H
+#define GFXRECON_INFO_REPORT_H
+
+#include "decode/block_statistics.h"
+#include "decode/file_processor.h"
+#include "decode/vulkan_stats_consumer.h"
+#include "format/format_util.h"
+#include "util/logging.h"
+
+#include "vulkan/vulkan.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+static std::string GetVersionString(uint32_t api_version)
+{
+    uint32_t major = api_version >> 22;
+    uint32_t minor = (api_version >> 12) & 0x3ff;
+    uint32_t patch = api_version & 0xfff;
+
+    return std::to_string(major) + "." + std::to_string(minor) + "." + std::to_string(patch);
+}
+
+// Prints the capture file statistics collected by a VulkanStatsConsumer, with the statistics collected from block
+// headers when block_statistics is not null.  Shared by gfxrecon-info and gfxrecon-analyze.
+static void PrintInfoReport(uint32_t                                    frame_count,
+                            const gfxrecon::decode::VulkanStatsConsumer& stats_consumer,
+                            const gfxrecon::decode::BlockStatistics*     block_statistics)
+{
+    // Frame counts.
+    uint32_t trim_start_frame = stats_consumer.GetTrimmedStartFrame();
+
+    if (trim_start_frame == 0)
+    {
+        // Not a trimmed file.
+        GFXRECON_WRITE_CONSOLE("Total frames: %u", frame_count);
+    }
+    else
+    {
+        // Include the frame range for trimmed files.
+        GFXRECON_WRITE_CONSOLE("Total frames: %u (trimmed frame range %u-%u)",
+                               frame_count,
+                               trim_start_frame,
+                               trim_start_frame + frame_count - 1);
+    }
+
+    // Application info.
+    uint32_t api_version = stats_consumer.GetApiVersion();
+    GFXRECON_WRITE_CONSOLE("\nApplication info:");
+    GFXRECON_WRITE_CONSOLE("\tApplication name: %s", stats_consumer.GetAppName().c_str());
+    GFXRECON_WRITE_CONSOLE("\tApplication version: %u", stats_consumer.GetAppVersion());
+    GFXRECON_WRITE_CONSOLE("\tEngine name: %s", stats_consumer.GetEngineName().c_str());
+    GFXRECON_WRITE_CONSOLE("\tEngine version: %u", stats_consumer.GetEngineVersion());
+    GFXRECON_WRITE_CONSOLE("\tTarget API version: %u (%s)", api_version, GetVersionString(api_version).c_str());
+
+    // Properties for physical devices used to create logical devices.
+    std::vector<const VkPhysicalDeviceProperties*> used_device_properties;
+    auto                                           used_devices = stats_consumer.GetInstantiatedDevices();
+    for (auto entry : used_devices)
+    {
+        auto properties = stats_consumer.GetDeviceProperties(entry);
+        if (properties != nullptr)
+        {
+            used_device_properties.push_back(properties);
+        }
+    }
+
+    // Don't print anything if no queries were made for VkPhysicalDeviceProperties.
+    if (!used_device_properties.empty())
+    {
+        for (auto entry : used_device_properties)
+        {
+            GFXRECON_WRITE_CONSOLE("\nPhysical device info:");
+            GFXRECON_WRITE_CONSOLE("\tDevice name: %s", entry->deviceName);
+            GFXRECON_WRITE_CONSOLE("\tDevice ID: 0x%x", entry->deviceID);
+            GFXRECON_WRITE_CONSOLE("\tVendor ID: 0x%x", entry->vendorID);
+            GFXRECON_WRITE_CONSOLE("\tDriver version: %u (0x%x)", entry->driverVersion, entry->driverVersion);
+            GFXRECON_WRITE_CONSOLE(
+                "\tAPI version: %u (%s)", entry->apiVersion, GetVersionString(entry->apiVersion).c_str());
+        }
+    }
+
+    GFXRECON_WRITE_CONSOLE("\nDevice memory allocation info:");
+    GFXRECON_WRITE_CONSOLE("\tTotal allocations: %" PRIu64, stats_consumer.GetAllocationCount());
+    GFXRECON_WRITE_CONSOLE("\tMin allocation size: %" PRIu64, stats_consumer.GetMinAllocationSize());
+    GFXRECON_WRITE_CONSOLE("\tMax allocation size: %" PRIu64, stats_consumer.GetMaxAllocationSize());
+
+    GFXRECON_WRITE_CONSOLE("\nPipeline info:");
+    GFXRECON_WRITE_CONSOLE("\tTotal graphics pipelines: %" PRIu64, stats_consumer.GetGraphicsPipelineCount());
+    GFXRECON_WRITE_CONSOLE("\tTotal compute pipelines: %" PRIu64, stats_consumer.GetComputePipelineCount());
+
+    if (block_statistics != nullptr)
+    {
+        // This is the number of recorded draw calls, which will not reflect the number of draw calls executed when
+        // recorded once to a command buffer that is submitted/replayed more than once.
+        GFXRECON_WRITE_CONSOLE("\nDraw/dispatch call info:");
+        GFXRECON_WRITE_CONSOLE("\tTotal recorded draw calls: %" PRIu64, block_statistics->GetDrawCount());
+        GFXRECON_WRITE_CONSOLE("\tTotal recorded dispatch calls: %" PRIu64, block_statistics->GetDispatchCount());
+
+        GFXRECON_WRITE_CONSOLE("\nCapture file block info:");
+        GFXRECON_WRITE_CONSOLE("\tTotal blocks: %" PRIu64, block_statistics->GetTotalCounts().count);
+
+        for (const auto& entry : block_statistics->GetBlockTypeCounts())
+        {
+            GFXRECON_WRITE_CONSOLE("\t%s blocks: %" PRIu64,
+                                   gfxrecon::format::GetBlockTypeName(entry.first),
+                                   entry.second.count);
+        }
+
+        GFXRECON_WRITE_CONSOLE("\tUnique API calls: %zu", block_statistics->GetApiCallCounts().size());
+        GFXRECON_WRITE_CONSOLE("\tCapture threads: %zu", block_statistics->GetThreadCallCounts().size());
+    }
+}
+
+// Prints the frame index of a capture file, which is read from the end of the file or derived from the sidecar block
+// index.  Nothing is printed for files without a frame index.
+static void PrintFrameIndexReport(const gfxrecon::decode::FileProcessor& file_processor)
+{
+    if (!file_processor.HasFrameIndex())
+    {
+        return;
+    }
+
+    const std::vector<gfxrecon::format::FrameIndexEntry>& frame_index = file_processor.GetFrameIndex();
+
+    uint64_t max_block_count = 0;
+    for (const auto& entry : frame_index)
+    {
+        max_block_count = std::max(max_block_count, entry.block_count);
+    }
+
+    GFXRECON_WRITE_CONSOLE("\nFrame index info:");
+    GFXRECON_WRITE_CONSOLE("\tIndexed frames: %zu", frame_index.size());
+    GFXRECON_WRITE_CONSOLE("\tMax blocks per frame: %" PRIu64, max_block_count);
+
+    for (const auto& marker : file_processor.GetStateMarkerIndex())
+    {
+        GFXRECON_WRITE_CONSOLE("\tState snapshot %s marker: frame %" PRIu64 ", file offset %" PRIu64,
+                               (marker.marker_type == gfxrecon::format::MarkerType::kBeginMarker) ? "begin" : "end",
+                               marker.frame_number,
+                               marker.block_offset);
+    }
+}
+
+// Prints the composition of a capture file from the statistics collected by a BlockStatistics, listing the API calls
+// with the max_count largest stored sizes and the memory IDs with the max_count largest fill sizes.
+static void PrintCompositionReport(const gfxrecon::decode::BlockStatistics& block_statistics, size_t max_count)
+{
+    using gfxrecon::decode::BlockStatistics;
+
+    const BlockStatistics::BlockCounts& total = block_statistics.GetTotalCounts();
+
+    GFXRECON_WRITE_CONSOLE("\nCapture file composition:");
+    GFXRECON_WRITE_CONSOLE("\tTotal stored bytes: %" PRIu64, total.stored_size);
+    GFXRECON_WRITE_CONSOLE("\tTotal uncompressed bytes: %" PRIu64, total.uncompressed_size);
+
+    std::vector<std::pair<gfxrecon::format::ApiCallId, BlockStatistics::BlockCounts>> calls(
+        block_statistics.GetApiCallCounts().begin(), block_statistics.GetApiCallCounts().end());
+    std::stable_sort(calls.begin(), calls.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.second.stored_size > rhs.second.stored_size;
+    });
+
+    GFXRECON_WRITE_CONSOLE("\nLargest API calls by stored bytes (calls, stored bytes, uncompressed bytes):");
+    for (size_t i = 0; (i < calls.size()) && (i < max_count); ++i)
+    {
+        GFXRECON_WRITE_CONSOLE("\t%s: %" PRIu64 ", %" PRIu64 ", %" PRIu64,
+                               gfxrecon::format::GetApiCallName(calls[i].first),
+                               calls[i].second.count,
+                               calls[i].second.stored_size,
+                               calls[i].second.uncompressed_size);
+    }
+
+    GFXRECON_WRITE_CONSOLE("\nMeta-data commands (commands, stored bytes, uncompressed bytes):");
+    for (const auto& entry : block_statistics.GetMetaDataCounts())
+    {
+        GFXRECON_WRITE_CONSOLE("\t%s: %" PRIu64 ", %" PRIu64 ", %" PRIu64,
+                               gfxrecon::format::GetMetaDataTypeName(entry.first),
+                               entry.second.count,
+                               entry.second.stored_size,
+                               entry.second.uncompressed_size);
+    }
+
+    GFXRECON_WRITE_CONSOLE("\nFrame size histogram (stored bytes: frames):");
+    for (const auto& bucket : block_statistics.GetFrameSizeHistogram())
+    {
+        GFXRECON_WRITE_CONSOLE(
+            "\t%" PRIu64 "-%" PRIu64 ": %" PRIu64, bucket.min_size, bucket.max_size, bucket.frame_count);
+    }
+
+    const BlockStatistics::BlockCounts& trailing = block_statistics.GetTrailingCounts();
+    if (trailing.count > 0)
+    {
+        GFXRECON_WRITE_CONSOLE("\tBlocks after the last frame (not counted as a frame): %" PRIu64 ", %" PRIu64
+                               " stored bytes",
+                               trailing.count,
+                               trailing.stored_size);
+    }
+
+    GFXRECON_WRITE_CONSOLE("\nLargest memory fills by fill bytes (fills, stored bytes, fill bytes):");
+    for (const auto& entry : block_statistics.GetLargestMemoryFills(max_count))
+    {
+        GFXRECON_WRITE_CONSOLE("\tMemory %" PRIu64 ": %" PRIu64 ", %" PRIu64 ", %" PRIu64,
+                               entry.first,
+                               entry.second.count,
+                               entry.second.stored_size,
+                               entry.second.fill_size);
+    }
+
+    GFXRECON_WRITE_CONSOLE("\nAPI calls by capture thread:");
+    for (const auto& entry : block_statistics.GetThreadCallCounts())
+    {
+        GFXRECON_WRITE_CONSOLE("\tThread %" PRIu64 ": %" PRIu64, entry.first, entry.second);
+    }
+}
+
+#endif // GFXRECON_INFO_REPORT_H
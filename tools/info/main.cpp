@@ -14,30 +14,34 @@
 ** limitations under the License.
 */
 
+#include "info_report.h"
 #include "project_version.h"
 
+#include "decode/block_statistics.h"
 #include "decode/file_processor.h"
+#include "decode/vulkan_stats_consumer.h"
 #include "format/format.h"
-#include "generated/generated_vulkan_consumer.h"
 #include "generated/generated_vulkan_decoder.h"
 #include "util/argument_parser.h"
 #include "util/logging.h"
 
 #include "vulkan/vulkan.h"
 
-#include <cassert>
 #include <cstdlib>
-#include <limits>
-#include <set>
 #include <string>
-#include <unordered_map>
 
 const char kHelpShortOption[] = "-h";
 const char kHelpLongOption[]  = "--help";
 const char kVersionOption[]   = "--version";
 const char kNoDebugPopup[]    = "--no-debug-popup";
+const char kComposition[]     = "--composition";
+const char kCompositionFile[] = "--composition-file";
+const char kTopArgument[]     = "--top";
 
-const char kOptions[] = "-h|--help,--version,--no-debug-popup";
+const char kOptions[]   = "-h|--help,--version,--no-debug-popup,--composition";
+const char kArguments[] = "--composition-file,--top";
+
+const size_t kDefaultTopCount = 10;
 
 static void PrintUsage(const char* exe_name)
 {
@@ -49,12 +53,22 @@ static void PrintUsage(const char* exe_name)
     }
     GFXRECON_WRITE_CONSOLE("\n%s - Print statistics for a GFXReconstruct capture file.\n", app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Usage:");
-    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] <file>\n", app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] [--composition]", app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--composition-file <file>] [--top <N>] <file>\n");
     GFXRECON_WRITE_CONSOLE("Required arguments:");
     GFXRECON_WRITE_CONSOLE("  <file>\t\tThe GFXReconstruct capture file to be processed.");
     GFXRECON_WRITE_CONSOLE("\nOptional arguments:");
     GFXRECON_WRITE_CONSOLE("  -h\t\t\tPrint usage information and exit (same as --help).");
     GFXRECON_WRITE_CONSOLE("  --version\t\tPrint version information and exit.");
+    GFXRECON_WRITE_CONSOLE("  --composition\t\tPrint a breakdown of the capture file contents, with");
+    GFXRECON_WRITE_CONSOLE("             \t\tstored and uncompressed bytes by API call, meta-data");
+    GFXRECON_WRITE_CONSOLE("             \t\tcommand, and frame, the memory objects with the largest");
+    GFXRECON_WRITE_CONSOLE("             \t\tfills, and API call counts by thread.");
+    GFXRECON_WRITE_CONSOLE("  --composition-file <file>");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tWrite the capture file breakdown to <file> in JSON format,");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tincluding the sizes of all API calls and frames.");
+    GFXRECON_WRITE_CONSOLE("  --top <N>\t\tList the N API calls and memory objects with the largest");
+    GFXRECON_WRITE_CONSOLE("         \t\tsizes in the capture file breakdown.  Default is %zu.", kDefaultTopCount);
 #if defined(WIN32) && defined(_DEBUG)
     GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
     GFXRECON_WRITE_CONSOLE("        \t\tdisplayed when abort() is called (Windows debug only).");
@@ -97,343 +111,40 @@ static bool CheckOptionPrintVersion(const char* exe_name, const gfxrecon::util::
     return false;
 }
 
-static std::string GetVersionString(uint32_t api_version)
-{
-    uint32_t major = api_version >> 22;
-    uint32_t minor = (api_version >> 12) & 0x3ff;
-    uint32_t patch = api_version & 0xfff;
-
-    return std::to_string(major) + "." + std::to_string(minor) + "." + std::to_string(patch);
-}
-
-class VulkanStatsConsumer : public gfxrecon::decode::VulkanConsumer
+// Retrieves the number of API calls and memory objects to list in the capture file breakdown.  Returns the default
+// count when the argument was not specified or the value is not valid.
+static size_t GetTopCount(const gfxrecon::util::ArgumentParser& arg_parser)
 {
-  public:
-    uint32_t           GetTrimmedStartFrame() const { return trimmed_frame_; }
-    const std::string& GetAppName() const { return app_name_; }
-    uint32_t           GetAppVersion() const { return app_version_; }
-    const std::string& GetEngineName() const { return engine_name_; }
-    uint32_t           GetEngineVersion() const { return engine_version_; }
-    uint32_t           GetApiVersion() const { return api_version_; }
-    uint64_t           GetGraphicsPipelineCount() const { return graphics_pipelines_; }
-    uint64_t           GetComputePipelineCount() const { return compute_pipelines_; }
-    uint64_t           GetDrawCount() const { return draw_count_; }
-    uint64_t           GetDispatchCount() const { return dispatch_count_; }
-    uint64_t           GetAllocationCount() const { return allocation_count_; }
-    uint64_t           GetMinAllocationSize() const { return min_allocation_size_; }
-    uint64_t           GetMaxAllocationSize() const { return max_allocation_size_; }
-
-    const std::set<gfxrecon::format::HandleId>& GetInstantiatedDevices() const { return used_physical_devices_; }
-    const VkPhysicalDeviceProperties*           GetDeviceProperties(gfxrecon::format::HandleId id) const
-    {
-        auto entry = physical_device_properties_.find(id);
-        if (entry != physical_device_properties_.end())
-        {
-            return &entry->second;
-        }
-
-        return nullptr;
-    }
-
-    virtual void ProcessStateBeginMarker(uint64_t frame_number) override
-    {
-        // Theres should only be one of these in a capture file.
-        trimmed_frame_ = static_cast<uint32_t>(frame_number);
-    }
-
-    virtual void Process_vkCreateInstance(
-        VkResult                                                                                returnValue,
-        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkInstanceCreateInfo>* pCreateInfo,
-        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkAllocationCallbacks>*,
-        gfxrecon::decode::HandlePointerDecoder<VkInstance>*) override
-    {
-        if ((pCreateInfo != nullptr) && (returnValue >= 0) && !pCreateInfo->IsNull())
-        {
-            auto create_info = pCreateInfo->GetPointer();
-            auto app_info    = create_info->pApplicationInfo;
-            if (app_info != nullptr)
-            {
-                if (app_info->pApplicationName != nullptr)
-                {
-                    app_name_ = app_info->pApplicationName;
-                }
-
-                if (app_info->pEngineName != nullptr)
-                {
-                    engine_name_ = app_info->pEngineName;
-                }
-
-                app_version_    = app_info->applicationVersion;
-                engine_version_ = app_info->engineVersion;
-                api_version_    = app_info->apiVersion;
-            }
-        }
-    }
+    // Counts with more digits than this are rejected, so that the conversion cannot overflow.
+    const size_t kMaxTopDigits = 9;
 
-    virtual void Process_vkGetPhysicalDeviceProperties(
-        gfxrecon::format::HandleId                                                                    physicalDevice,
-        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkPhysicalDeviceProperties>* pProperties)
-        override
-    {
-        if ((pProperties != nullptr) && !pProperties->IsNull())
-        {
-            physical_device_properties_[physicalDevice] = *pProperties->GetPointer();
-        }
-    }
-
-    virtual void Process_vkGetPhysicalDeviceProperties2(
-        gfxrecon::format::HandleId                                                                     physicalDevice,
-        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkPhysicalDeviceProperties2>* pProperties)
-        override
-    {
-        if ((pProperties != nullptr) && !pProperties->IsNull())
-        {
-            auto properties2                            = pProperties->GetPointer();
-            physical_device_properties_[physicalDevice] = properties2->properties;
-        }
-    }
-
-    virtual void Process_vkGetPhysicalDeviceProperties2KHR(
-        gfxrecon::format::HandleId                                                                     physicalDevice,
-        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkPhysicalDeviceProperties2>* pProperties)
-        override
-    {
-        if ((pProperties != nullptr) && !pProperties->IsNull())
-        {
-            auto properties2                            = pProperties->GetPointer();
-            physical_device_properties_[physicalDevice] = properties2->properties;
-        }
-    }
-
-    virtual void
-    Process_vkCreateDevice(VkResult                   returnValue,
-                           gfxrecon::format::HandleId physicalDevice,
-                           gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkDeviceCreateInfo>*,
-                           gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkAllocationCallbacks>*,
-                           gfxrecon::decode::HandlePointerDecoder<VkDevice>*) override
-    {
-        if (returnValue >= 0)
-        {
-            used_physical_devices_.insert(physicalDevice);
-        }
-    }
-
-    virtual void Process_vkCreateGraphicsPipelines(
-        VkResult returnValue,
-        gfxrecon::format::HandleId,
-        gfxrecon::format::HandleId,
-        uint32_t createInfoCount,
-        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkGraphicsPipelineCreateInfo>*,
-        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkAllocationCallbacks>*,
-        gfxrecon::decode::HandlePointerDecoder<VkPipeline>*) override
-    {
-        if (returnValue >= 0)
-        {
-            graphics_pipelines_ += createInfoCount;
-        }
-    }
-
-    virtual void Process_vkCreateComputePipelines(
-        VkResult returnValue,
-        gfxrecon::format::HandleId,
-        gfxrecon::format::HandleId,
-        uint32_t createInfoCount,
-        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkComputePipelineCreateInfo>*,
-        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkAllocationCallbacks>*,
-        gfxrecon::decode::HandlePointerDecoder<VkPipeline>*) override
-    {
-        if (returnValue >= 0)
-        {
-            compute_pipelines_ += createInfoCount;
-        }
-    }
-
-    virtual void Process_vkCmdDraw(gfxrecon::format::HandleId, uint32_t, uint32_t, uint32_t, uint32_t) override
-    {
-        ++draw_count_;
-    }
-
-    virtual void
-        Process_vkCmdDrawIndexed(gfxrecon::format::HandleId, uint32_t, uint32_t, uint32_t, int32_t, uint32_t) override
-    {
-        ++draw_count_;
-    }
-
-    virtual void Process_vkCmdDrawIndirect(
-        gfxrecon::format::HandleId, gfxrecon::format::HandleId, VkDeviceSize, uint32_t, uint32_t) override
-    {
-        ++draw_count_;
-    }
-
-    virtual void Process_vkCmdDrawIndexedIndirect(
-        gfxrecon::format::HandleId, gfxrecon::format::HandleId, VkDeviceSize, uint32_t, uint32_t) override
-    {
-        ++draw_count_;
-    }
+    std::string value = arg_parser.GetArgumentValue(kTopArgument);
 
-    virtual void Process_vkCmdDrawIndirectCountKHR(gfxrecon::format::HandleId,
-                                                   gfxrecon::format::HandleId,
-                                                   VkDeviceSize,
-                                                   gfxrecon::format::HandleId,
-                                                   VkDeviceSize,
-                                                   uint32_t,
-                                                   uint32_t) override
+    if (value.empty())
     {
-        ++draw_count_;
+        return kDefaultTopCount;
     }
 
-    virtual void Process_vkCmdDrawIndexedIndirectCountKHR(gfxrecon::format::HandleId,
-                                                          gfxrecon::format::HandleId,
-                                                          VkDeviceSize,
-                                                          gfxrecon::format::HandleId,
-                                                          VkDeviceSize,
-                                                          uint32_t,
-                                                          uint32_t) override
+    if ((value.length() > kMaxTopDigits) || (value.find_first_not_of("0123456789") != std::string::npos) ||
+        (std::stoul(value) == 0))
     {
-        ++draw_count_;
+        GFXRECON_LOG_WARNING("Ignoring invalid %s value \"%s\", which must be a positive integer with at most %zu "
+                             "digits; using the default count of %zu",
+                             kTopArgument,
+                             value.c_str(),
+                             kMaxTopDigits,
+                             kDefaultTopCount);
+        return kDefaultTopCount;
     }
 
-    virtual void Process_vkCmdDrawIndirectByteCountEXT(gfxrecon::format::HandleId,
-                                                       uint32_t,
-                                                       uint32_t,
-                                                       gfxrecon::format::HandleId,
-                                                       VkDeviceSize,
-                                                       uint32_t,
-                                                       uint32_t) override
-    {
-        ++draw_count_;
-    }
-
-    virtual void Process_vkCmdDrawIndirectCountAMD(gfxrecon::format::HandleId,
-                                                   gfxrecon::format::HandleId,
-                                                   VkDeviceSize,
-                                                   gfxrecon::format::HandleId,
-                                                   VkDeviceSize,
-                                                   uint32_t,
-                                                   uint32_t) override
-    {
-        ++draw_count_;
-    }
-
-    virtual void Process_vkCmdDrawIndexedIndirectCountAMD(gfxrecon::format::HandleId,
-                                                          gfxrecon::format::HandleId,
-                                                          VkDeviceSize,
-                                                          gfxrecon::format::HandleId,
-                                                          VkDeviceSize,
-                                                          uint32_t,
-                                                          uint32_t) override
-    {
-        ++draw_count_;
-    }
-
-    virtual void Process_vkCmdDrawMeshTasksNV(gfxrecon::format::HandleId, uint32_t, uint32_t) override
-    {
-        ++draw_count_;
-    }
-
-    virtual void Process_vkCmdDrawMeshTasksIndirectNV(
-        gfxrecon::format::HandleId, gfxrecon::format::HandleId, VkDeviceSize, uint32_t, uint32_t) override
-    {
-        ++draw_count_;
-    }
-
-    virtual void Process_vkCmdDrawMeshTasksIndirectCountNV(gfxrecon::format::HandleId,
-                                                           gfxrecon::format::HandleId,
-                                                           VkDeviceSize,
-                                                           gfxrecon::format::HandleId,
-                                                           VkDeviceSize,
-                                                           uint32_t,
-                                                           uint32_t) override
-    {
-        ++draw_count_;
-    }
-
-    virtual void Process_vkCmdDispatch(gfxrecon::format::HandleId, uint32_t, uint32_t, uint32_t) override
-    {
-        ++dispatch_count_;
-    }
-
-    virtual void
-        Process_vkCmdDispatchIndirect(gfxrecon::format::HandleId, gfxrecon::format::HandleId, VkDeviceSize) override
-    {
-        ++dispatch_count_;
-    }
-
-    virtual void Process_vkCmdDispatchBase(
-        gfxrecon::format::HandleId, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t) override
-    {
-        ++dispatch_count_;
-    }
-
-    virtual void Process_vkCmdDispatchBaseKHR(
-        gfxrecon::format::HandleId, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t) override
-    {
-        ++dispatch_count_;
-    }
-
-    virtual void Process_vkAllocateMemory(
-        VkResult returnValue,
-        gfxrecon::format::HandleId,
-        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkMemoryAllocateInfo>* pAllocateInfo,
-        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkAllocationCallbacks>*,
-        gfxrecon::decode::HandlePointerDecoder<VkDeviceMemory>*) override
-    {
-        assert(pAllocateInfo != nullptr);
-
-        if (returnValue >= 0)
-        {
-            ++allocation_count_;
-
-            if (!pAllocateInfo->IsNull())
-            {
-                auto allocate_info = pAllocateInfo->GetPointer();
-
-                if (allocate_info->allocationSize < min_allocation_size_)
-                {
-                    min_allocation_size_ = allocate_info->allocationSize;
-                }
-
-                if (allocate_info->allocationSize > max_allocation_size_)
-                {
-                    max_allocation_size_ = allocate_info->allocationSize;
-                }
-            }
-        }
-    }
-
-  private:
-    uint32_t trimmed_frame_{ 0 };
-
-    // Application info.
-    std::string app_name_;
-    uint32_t    app_version_{ 0 };
-    std::string engine_name_;
-    uint32_t    engine_version_{ 0 };
-    uint32_t    api_version_{ 0 };
-
-    // Physical device info.
-    std::set<gfxrecon::format::HandleId>                                       used_physical_devices_;
-    std::unordered_map<gfxrecon::format::HandleId, VkPhysicalDeviceProperties> physical_device_properties_;
-
-    // Total pipeline counts by type.
-    uint64_t graphics_pipelines_{ 0 };
-    uint64_t compute_pipelines_{ 0 };
-
-    // Total draw/dispatch counts.
-    uint64_t draw_count_{ 0 };
-    uint64_t dispatch_count_{ 0 };
-
-    // Memory allocation info.
-    uint64_t allocation_count_{ 0 };
-    uint64_t min_allocation_size_{ std::numeric_limits<uint64_t>::max() };
-    uint64_t max_allocation_size_{ 0 };
-};
+    return static_cast<size_t>(std::stoul(value));
+}
 
 int main(int argc, const char** argv)
 {
     gfxrecon::util::Log::Init();
 
-    gfxrecon::util::ArgumentParser arg_parser(argc, argv, kOptions, "");
+    gfxrecon::util::ArgumentParser arg_parser(argc, argv, kOptions, kArguments);
 
     if (CheckOptionPrintUsage(argv[0], arg_parser) || CheckOptionPrintVersion(argv[0], arg_parser))
     {
@@ -458,89 +169,56 @@ int main(int argc, const char** argv)
 
     const std::vector<std::string>& positional_arguments = arg_parser.GetPositionalArguments();
     std::string                     input_filename       = positional_arguments[0];
+    std::string                     composition_file     = arg_parser.GetArgumentValue(kCompositionFile);
+    bool                            composition          = arg_parser.IsOptionSet(kComposition);
+    size_t                          top_count            = GetTopCount(arg_parser);
+
+    // Statistics for all blocks are collected from block headers, without decoding or decompressing block data.  The
+    // fill memory command headers are also read for the capture file breakdown.
+    gfxrecon::decode::BlockStatistics block_statistics(composition || !composition_file.empty());
+    if (!block_statistics.Scan(input_filename))
+    {
+        GFXRECON_WRITE_CONSOLE("A failure has occurred during file processing");
+        gfxrecon::util::Log::Release();
+        exit(-1);
+    }
 
+    // Only the API calls with parameters that are reported are decoded.
     gfxrecon::decode::FileProcessor file_processor;
     if (file_processor.Initialize(input_filename))
     {
-        gfxrecon::decode::VulkanDecoder decoder;
-        VulkanStatsConsumer             stats_consumer;
+        gfxrecon::decode::VulkanDecoder       decoder;
+        gfxrecon::decode::VulkanStatsConsumer stats_consumer;
 
         decoder.AddConsumer(&stats_consumer);
 
         file_processor.AddDecoder(&decoder);
         file_processor.ProcessAllFrames();
 
-        if ((file_processor.GetCurrentFrameNumber() > 0) &&
-            (file_processor.GetErrorState() == gfxrecon::decode::FileProcessor::kErrorNone))
+        // The frame count is taken from the block statistics, so that it matches the frame counts of the capture file
+        // breakdown.
+        uint32_t frame_count = block_statistics.GetFrameCount();
+
+        if ((frame_count > 0) && (file_processor.GetErrorState() == gfxrecon::decode::FileProcessor::kErrorNone))
         {
-            // Frame counts.
-            uint32_t trim_start_frame = stats_consumer.GetTrimmedStartFrame();
-            uint32_t frame_count      = file_processor.GetCurrentFrameNumber();
+            PrintInfoReport(frame_count, stats_consumer, &block_statistics);
+            PrintFrameIndexReport(file_processor);
 
-            if (trim_start_frame == 0)
-            {
-                // Not a trimmed file.
-                GFXRECON_WRITE_CONSOLE("Total frames: %u", frame_count);
-            }
-            else
+            if (composition)
             {
-                // Include the frame range for trimmed files.
-                GFXRECON_WRITE_CONSOLE("Total frames: %u (trimmed frame range %u-%u)",
-                                       frame_count,
-                                       trim_start_frame,
-                                       trim_start_frame + frame_count - 1);
+                PrintCompositionReport(block_statistics, top_count);
             }
 
-            // Application info.
-            uint32_t api_version = stats_consumer.GetApiVersion();
-            GFXRECON_WRITE_CONSOLE("\nApplication info:");
-            GFXRECON_WRITE_CONSOLE("\tApplication name: %s", stats_consumer.GetAppName().c_str());
-            GFXRECON_WRITE_CONSOLE("\tApplication version: %u", stats_consumer.GetAppVersion());
-            GFXRECON_WRITE_CONSOLE("\tEngine name: %s", stats_consumer.GetEngineName().c_str());
-            GFXRECON_WRITE_CONSOLE("\tEngine version: %u", stats_consumer.GetEngineVersion());
-            GFXRECON_WRITE_CONSOLE("\tTarget API version: %u (%s)", api_version, GetVersionString(api_version).c_str());
-
-            // Properties for physical devices used to create logical devices.
-            std::vector<const VkPhysicalDeviceProperties*> used_device_properties;
-            auto                                           used_devices = stats_consumer.GetInstantiatedDevices();
-            for (auto entry : used_devices)
+            if (!composition_file.empty())
             {
-                auto properties = stats_consumer.GetDeviceProperties(entry);
-                if (properties != nullptr)
+                if (!block_statistics.WriteJsonReport(composition_file, top_count))
                 {
-                    used_device_properties.push_back(properties);
+                    gfxrecon::util::Log::Release();
+                    exit(-1);
                 }
-            }
 
-            // Don't print anything if no queries were made for VkPhysicalDeviceProperties.
-            if (!used_device_properties.empty())
-            {
-                for (auto entry : used_device_properties)
-                {
-                    GFXRECON_WRITE_CONSOLE("\nPhysical device info:");
-                    GFXRECON_WRITE_CONSOLE("\tDevice name: %s", entry->deviceName);
-                    GFXRECON_WRITE_CONSOLE("\tDevice ID: 0x%x", entry->deviceID);
-                    GFXRECON_WRITE_CONSOLE("\tVendor ID: 0x%x", entry->vendorID);
-                    GFXRECON_WRITE_CONSOLE("\tDriver version: %u (0x%x)", entry->driverVersion, entry->driverVersion);
-                    GFXRECON_WRITE_CONSOLE(
-                        "\tAPI version: %u (%s)", entry->apiVersion, GetVersionString(entry->apiVersion).c_str());
-                }
+                GFXRECON_WRITE_CONSOLE("\nWrote capture file breakdown to %s", composition_file.c_str());
             }
-
-            GFXRECON_WRITE_CONSOLE("\nDevice memory allocation info:");
-            GFXRECON_WRITE_CONSOLE("\tTotal allocations: %" PRIu64, stats_consumer.GetAllocationCount());
-            GFXRECON_WRITE_CONSOLE("\tMin allocation size: %" PRIu64, stats_consumer.GetMinAllocationSize());
-            GFXRECON_WRITE_CONSOLE("\tMax allocation size: %" PRIu64, stats_consumer.GetMaxAllocationSize());
-
-            GFXRECON_WRITE_CONSOLE("\nPipeline info:");
-            GFXRECON_WRITE_CONSOLE("\tTotal graphics pipelines: %" PRIu64, stats_consumer.GetGraphicsPipelineCount());
-            GFXRECON_WRITE_CONSOLE("\tTotal compute pipelines: %" PRIu64, stats_consumer.GetComputePipelineCount());
-
-            // TODO: This is the number of recorded draw calls, which will not reflect the number of draw calls executed
-            // when recorded once to a command buffer that is submitted/replayed more than once.
-            // GFXRECON_WRITE_CONSOLE("\nDraw/dispatch call info:");
-            // GFXRECON_WRITE_CONSOLE("\tTotal draw calls: %" PRIu64, stats_consumer.GetDrawCount());
-            // GFXRECON_WRITE_CONSOLE("\tTotal dispatch calls: %" PRIu64, stats_consumer.GetDispatchCount());
         }
         else if (file_processor.GetErrorState() != gfxrecon::decode::FileProcessor::kErrorNone)
         {
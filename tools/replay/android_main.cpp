@@ -20,6 +20,9 @@
 #include "application/android_application.h"
 #include "application/android_window.h"
 #include "decode/file_processor.h"
+#include "decode/frame_loop_decoder.h"
+#include "decode/replay_statistics.h"
+#include "decode/threaded_decoder.h"
 #include "decode/vulkan_replay_options.h"
 #include "format/format.h"
 #include "generated/generated_vulkan_decoder.h"
@@ -91,6 +94,8 @@ void android_main(struct android_app* app)
             }
             else
             {
+                file_processor.StartBlockPipeline(GetDecompressionThreadCount(arg_parser));
+
                 // Setup platform specific application and window factory.
                 application    = std::make_unique<gfxrecon::application::AndroidApplication>(kApplicationName, app);
                 window_factory = std::make_unique<gfxrecon::application::AndroidWindowFactory>(application.get());
@@ -103,15 +108,80 @@ void android_main(struct android_app* app)
                 }
                 else
                 {
+                    // Declared before the replay consumer, which records the GPU times of pending queue
+                    // submissions when it is destroyed.
+                    std::unique_ptr<gfxrecon::decode::ReplayStatistics> statistics;
+                    std::string perf_report_file = arg_parser.GetArgumentValue(kPerfReportArgument);
+
+                    uint32_t loop_first_frame = 0;
+                    uint32_t loop_last_frame  = 0;
+                    uint32_t loop_count       = 0;
+
+                    bool loop_frames = GetFrameLoop(arg_parser, &loop_first_frame, &loop_last_frame, &loop_count);
+
+                    gfxrecon::decode::ReplayOptions replay_options =
+                        GetReplayOptions(arg_parser, filename, file_processor.GetFileSize());
+
+                    if (loop_frames)
+                    {
+                        // Looped frames acquire their swapchain images again, which is only possible with offscreen
+                        // swapchains that acquire the image index that was acquired during capture.
+                        GFXRECON_LOG_INFO("Replaying with offscreen swapchains for %s", kLoopFramesArgument);
+                        replay_options.offscreen_swapchain = true;
+                    }
+
                     gfxrecon::decode::VulkanDecoder        decoder;
-                    gfxrecon::decode::VulkanReplayConsumer replay_consumer(window_factory.get(),
-                                                                           GetReplayOptions(arg_parser));
+                    gfxrecon::decode::VulkanReplayConsumer replay_consumer(window_factory.get(), replay_options);
 
                     replay_consumer.SetFatalErrorHandler(
                         [](const char* message) { throw std::runtime_error(message); });
 
                     decoder.AddConsumer(&replay_consumer);
-                    file_processor.AddDecoder(&decoder);
+
+                    if (arg_parser.IsOptionSet(kPrecompilePipelinesOption) &&
+                        !replay_consumer.EnablePipelinePrecompilation(filename, GetPipelinePrecompileThreadCount()))
+                    {
+                        GFXRECON_LOG_WARNING("Pipelines will not be precompiled");
+                    }
+
+                    if (!perf_report_file.empty())
+                    {
+                        statistics = std::make_unique<gfxrecon::decode::ReplayStatistics>();
+                        decoder.SetReplayStatistics(statistics.get());
+                        replay_consumer.SetReplayStatistics(statistics.get());
+                        application->SetReplayStatistics(statistics.get());
+                    }
+
+                    // Declared after the replay consumer, so that calls still queued for the worker threads are
+                    // processed before the consumer is destroyed.
+                    std::unique_ptr<gfxrecon::decode::ThreadedDecoder>  threaded_decoder;
+                    std::unique_ptr<gfxrecon::decode::FrameLoopDecoder> loop_decoder;
+                    gfxrecon::decode::ApiDecoder*                       replay_decoder = &decoder;
+
+                    if (arg_parser.IsOptionSet(kThreadedReplayOption))
+                    {
+                        threaded_decoder = std::make_unique<gfxrecon::decode::ThreadedDecoder>(&decoder);
+                        replay_decoder   = threaded_decoder.get();
+                    }
+
+                    if (loop_frames)
+                    {
+                        loop_decoder   = std::make_unique<gfxrecon::decode::FrameLoopDecoder>(replay_decoder);
+                        replay_decoder = loop_decoder.get();
+                        application->SetFrameLoop(loop_decoder.get(), loop_first_frame, loop_last_frame, loop_count);
+                    }
+
+                    uint32_t preload_first_frame = 0;
+                    uint32_t preload_last_frame  = 0;
+                    bool     preload_decompress  = true;
+
+                    if (GetPreloadFrames(arg_parser, &preload_first_frame, &preload_last_frame, &preload_decompress))
+                    {
+                        application->SetPreloadFrames(preload_first_frame, preload_last_frame, preload_decompress);
+                    }
+
+                    file_processor.AddDecoder(replay_decoder);
+
                     application->SetPauseFrame(GetPauseFrame(arg_parser));
 
                     // Warn if the capture layer is active.
@@ -123,6 +193,17 @@ void android_main(struct android_app* app)
 
                     app->userData = application.get();
                     application->Run();
+
+                    if (threaded_decoder != nullptr)
+                    {
+                        threaded_decoder->Flush();
+                    }
+
+                    if (statistics != nullptr)
+                    {
+                        replay_consumer.CollectSubmissionGpuTimes();
+                        statistics->WriteReport(perf_report_file);
+                    }
                 }
             }
         }
@@ -18,7 +18,12 @@
 #include "replay_settings.h"
 
 #include "application/application.h"
+#include "application/headless_application.h"
+#include "application/headless_window.h"
 #include "decode/file_processor.h"
+#include "decode/frame_loop_decoder.h"
+#include "decode/replay_statistics.h"
+#include "decode/threaded_decoder.h"
 #include "decode/vulkan_replay_options.h"
 #include "generated/generated_vulkan_decoder.h"
 #include "generated/generated_vulkan_replay_consumer.h"
@@ -89,6 +94,8 @@ int main(int argc, const char** argv)
         }
         else
         {
+            file_processor.StartBlockPipeline(GetDecompressionThreadCount(arg_parser));
+
             auto wsi_platform = GetWsiPlatform(arg_parser);
 
             // Setup platform specific application and window factory.
@@ -132,6 +139,27 @@ int main(int argc, const char** argv)
 #endif
 #endif
 
+            // Replay without a window system when requested, or when no window system is available.
+            bool offscreen_swapchain = false;
+
+            if (wsi_platform == WsiPlatform::kHeadless || (wsi_platform == WsiPlatform::kAuto && !application))
+            {
+                auto headless_application =
+                    std::make_unique<gfxrecon::application::HeadlessApplication>(kApplicationName);
+                if (headless_application->Initialize(&file_processor))
+                {
+                    if (wsi_platform == WsiPlatform::kAuto)
+                    {
+                        GFXRECON_LOG_INFO("No window system is available; replaying with offscreen swapchains");
+                    }
+
+                    window_factory =
+                        std::make_unique<gfxrecon::application::HeadlessWindowFactory>(headless_application.get());
+                    application         = std::move(headless_application);
+                    offscreen_swapchain = true;
+                }
+            }
+
             if (!window_factory || !application)
             {
                 GFXRECON_WRITE_CONSOLE(
@@ -141,14 +169,80 @@ int main(int argc, const char** argv)
             }
             else
             {
+                // Declared before the replay consumer, which records the GPU times of pending queue submissions
+                // when it is destroyed.
+                std::unique_ptr<gfxrecon::decode::ReplayStatistics> statistics;
+                std::string perf_report_file = arg_parser.GetArgumentValue(kPerfReportArgument);
+
+                uint32_t loop_first_frame = 0;
+                uint32_t loop_last_frame  = 0;
+                uint32_t loop_count       = 0;
+
+                bool loop_frames = GetFrameLoop(arg_parser, &loop_first_frame, &loop_last_frame, &loop_count);
+
+                gfxrecon::decode::ReplayOptions replay_options =
+                    GetReplayOptions(arg_parser, filename, file_processor.GetFileSize());
+                replay_options.offscreen_swapchain = offscreen_swapchain;
+
+                if (loop_frames && !offscreen_swapchain)
+                {
+                    // Looped frames acquire their swapchain images again, which is only possible with offscreen
+                    // swapchains that acquire the image index that was acquired during capture.
+                    GFXRECON_LOG_INFO("Replaying with offscreen swapchains for %s", kLoopFramesArgument);
+                    replay_options.offscreen_swapchain = true;
+                }
+
                 gfxrecon::decode::VulkanDecoder        decoder;
-                gfxrecon::decode::VulkanReplayConsumer replay_consumer(window_factory.get(),
-                                                                       GetReplayOptions(arg_parser));
+                gfxrecon::decode::VulkanReplayConsumer replay_consumer(window_factory.get(), replay_options);
 
                 replay_consumer.SetFatalErrorHandler([](const char* message) { throw std::runtime_error(message); });
 
                 decoder.AddConsumer(&replay_consumer);
-                file_processor.AddDecoder(&decoder);
+
+                if (arg_parser.IsOptionSet(kPrecompilePipelinesOption) &&
+                    !replay_consumer.EnablePipelinePrecompilation(filename, GetPipelinePrecompileThreadCount()))
+                {
+                    GFXRECON_LOG_WARNING("Pipelines will not be precompiled");
+                }
+
+                if (!perf_report_file.empty())
+                {
+                    statistics = std::make_unique<gfxrecon::decode::ReplayStatistics>();
+                    decoder.SetReplayStatistics(statistics.get());
+                    replay_consumer.SetReplayStatistics(statistics.get());
+                    application->SetReplayStatistics(statistics.get());
+                }
+
+                // Declared after the replay consumer, so that calls still queued for the worker threads are processed
+                // before the consumer is destroyed.
+                std::unique_ptr<gfxrecon::decode::ThreadedDecoder>  threaded_decoder;
+                std::unique_ptr<gfxrecon::decode::FrameLoopDecoder> loop_decoder;
+                gfxrecon::decode::ApiDecoder*                       replay_decoder = &decoder;
+
+                if (arg_parser.IsOptionSet(kThreadedReplayOption))
+                {
+                    threaded_decoder = std::make_unique<gfxrecon::decode::ThreadedDecoder>(&decoder);
+                    replay_decoder   = threaded_decoder.get();
+                }
+
+                if (loop_frames)
+                {
+                    loop_decoder   = std::make_unique<gfxrecon::decode::FrameLoopDecoder>(replay_decoder);
+                    replay_decoder = loop_decoder.get();
+                    application->SetFrameLoop(loop_decoder.get(), loop_first_frame, loop_last_frame, loop_count);
+                }
+
+                uint32_t preload_first_frame = 0;
+                uint32_t preload_last_frame  = 0;
+                bool     preload_decompress  = true;
+
+                if (GetPreloadFrames(arg_parser, &preload_first_frame, &preload_last_frame, &preload_decompress))
+                {
+                    application->SetPreloadFrames(preload_first_frame, preload_last_frame, preload_decompress);
+                }
+
+                file_processor.AddDecoder(replay_decoder);
+
                 application->SetPauseFrame(GetPauseFrame(arg_parser));
 
                 // Warn if the capture layer is active.
@@ -160,6 +254,11 @@ int main(int argc, const char** argv)
 
                 application->Run();
 
+                if (threaded_decoder != nullptr)
+                {
+                    threaded_decoder->Flush();
+                }
+
                 if ((file_processor.GetCurrentFrameNumber() > 0) &&
                     (file_processor.GetErrorState() == gfxrecon::decode::FileProcessor::kErrorNone))
                 {
@@ -168,7 +267,7 @@ int main(int argc, const char** argv)
                     double  diff_time_sec = gfxrecon::util::datetime::ConvertTimestampToSeconds(
                         gfxrecon::util::datetime::DiffTimestamps(start_time, end_time));
                     uint32_t end_frame    = file_processor.GetCurrentFrameNumber();
-                    uint32_t total_frames = (end_frame - start_frame) + 1;
+                    uint32_t total_frames = (end_frame - start_frame) + 1 + application->GetLoopFrameCount();
                     double   fps          = static_cast<double>(total_frames) / diff_time_sec;
                     GFXRECON_WRITE_CONSOLE("%f fps, %f seconds, %u frame%s, 1 loop, framerange %u-%u",
                                            fps,
@@ -187,6 +286,16 @@ int main(int argc, const char** argv)
                 {
                     GFXRECON_WRITE_CONSOLE("File did not contain any frames");
                 }
+
+                if (statistics != nullptr)
+                {
+                    replay_consumer.CollectSubmissionGpuTimes();
+
+                    if (statistics->WriteReport(perf_report_file))
+                    {
+                        GFXRECON_WRITE_CONSOLE("Wrote replay performance report to %s", perf_report_file.c_str());
+                    }
+                }
             }
         }
     }
@@ -26,8 +26,11 @@
 
 #include "vulkan/vulkan_core.h"
 
+#include <algorithm>
 #include <cstdlib>
+#include <limits>
 #include <string>
+#include <thread>
 
 #ifndef GFXRECON_REPLAY_SETTINGS_H
 #define GFXRECON_REPLAY_SETTINGS_H
@@ -50,23 +53,38 @@ const char kMemoryPortabilityShortOption[]     = "-m";
 const char kMemoryPortabilityLongOption[]      = "--memory-translation";
 const char kShaderReplaceArgument[]            = "--replace-shaders";
 const char kNoDebugPopup[]                     = "--no-debug-popup";
+const char kDecompressionThreadsArgument[]     = "--decompression-threads";
+const char kThreadedReplayOption[]             = "--threaded-replay";
+const char kPrecompilePipelinesOption[]        = "--precompile-pipelines";
+const char kPipelineCacheDirArgument[]         = "--pipeline-cache-dir";
+const char kLoopFramesArgument[]               = "--loop-frames";
+const char kLoopCountArgument[]                = "--loop-count";
+const char kPerfReportArgument[]               = "--perf-report";
+const char kPreloadFramesArgument[]            = "--preload-frames";
+const char kPreloadCompressedOption[]          = "--preload-compressed";
+const char kFastForwardFramesArgument[]        = "--fast-forward-frames";
 
 const char kOptions[] =
-    "-h|--help,--version,--paused,--sfa|--skip-failed-allocations,--opcd|--omit-pipeline-cache-data,--no-debug-popup";
-const char kArguments[] = "--gpu,--pause-frame,--wsi,-m|--memory-translation,--replace-shaders";
+    "-h|--help,--version,--paused,--sfa|--skip-failed-allocations,--opcd|--omit-pipeline-cache-data,--no-debug-popup,"
+    "--threaded-replay,--precompile-pipelines,--preload-compressed";
+const char kArguments[] =
+    "--gpu,--pause-frame,--wsi,-m|--memory-translation,--replace-shaders,--decompression-threads,--pipeline-cache-dir,"
+    "--loop-frames,--loop-count,--perf-report,--preload-frames,--fast-forward-frames";
 
 enum class WsiPlatform
 {
     kAuto,
     kWin32,
     kXcb,
-    kWayland
+    kWayland,
+    kHeadless
 };
 
-const char kWsiPlatformAuto[]    = "auto";
-const char kWsiPlatformWin32[]   = "win32";
-const char kWsiPlatformXcb[]     = "xcb";
-const char kWsiPlatformWayland[] = "wayland";
+const char kWsiPlatformAuto[]     = "auto";
+const char kWsiPlatformWin32[]    = "win32";
+const char kWsiPlatformXcb[]      = "xcb";
+const char kWsiPlatformWayland[]  = "wayland";
+const char kWsiPlatformHeadless[] = "headless";
 
 const char kMemoryTranslationNone[]   = "none";
 const char kMemoryTranslationRemap[]  = "remap";
@@ -129,6 +147,154 @@ static uint32_t GetPauseFrame(const gfxrecon::util::ArgumentParser& arg_parser)
     return pause_frame;
 }
 
+// Converts a string of decimal digits to an unsigned 32-bit integer.  Returns false when the string contains characters
+// other than digits or the value is out of range.
+static bool ParseUnsignedValue(const std::string& value, uint32_t* result)
+{
+    if (value.empty() || (value.length() > 10) || (value.find_first_not_of("0123456789") != std::string::npos))
+    {
+        return false;
+    }
+
+    // Ten digits cannot overflow an unsigned 64-bit integer.
+    unsigned long long parsed_value = std::stoull(value);
+
+    if (parsed_value > std::numeric_limits<uint32_t>::max())
+    {
+        return false;
+    }
+
+    (*result) = static_cast<uint32_t>(parsed_value);
+
+    return true;
+}
+
+const uint32_t kDefaultLoopCount = 10;
+
+// Retrieves a range of frames specified as <first>-<last> for the specified argument.  Returns false when the argument
+// was not specified or the range is not valid.
+static bool GetFrameRange(const gfxrecon::util::ArgumentParser& arg_parser,
+                          const char*                           argument,
+                          uint32_t*                             first_frame,
+                          uint32_t*                             last_frame)
+{
+    std::string range = arg_parser.GetArgumentValue(argument);
+
+    if (range.empty())
+    {
+        return false;
+    }
+
+    size_t separator = range.find('-');
+
+    if ((separator == std::string::npos) || !ParseUnsignedValue(range.substr(0, separator), first_frame) ||
+        !ParseUnsignedValue(range.substr(separator + 1), last_frame))
+    {
+        GFXRECON_LOG_WARNING("Ignoring invalid %s frame range \"%s\", which must be specified as <first>-<last>",
+                             argument,
+                             range.c_str());
+        return false;
+    }
+
+    if (((*first_frame) == 0) || ((*first_frame) > (*last_frame)))
+    {
+        GFXRECON_LOG_WARNING("Ignoring invalid %s frame range \"%s\": frame numbers start at 1, and the first frame "
+                             "must not be greater than the last frame",
+                             argument,
+                             range.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+// Retrieves the range of frames to replay in a loop, specified as <first>-<last>.  Returns false when no frame loop was
+// requested or the range is not valid.
+static bool GetFrameLoop(const gfxrecon::util::ArgumentParser& arg_parser,
+                         uint32_t*                             first_frame,
+                         uint32_t*                             last_frame,
+                         uint32_t*                             loop_count)
+{
+    if (!GetFrameRange(arg_parser, kLoopFramesArgument, first_frame, last_frame))
+    {
+        return false;
+    }
+
+    std::string value = arg_parser.GetArgumentValue(kLoopCountArgument);
+    (*loop_count)     = kDefaultLoopCount;
+
+    if (!value.empty() && (!ParseUnsignedValue(value, loop_count) || ((*loop_count) == 0)))
+    {
+        GFXRECON_LOG_WARNING("Ignoring invalid %s value \"%s\", which must be a positive integer; using the default "
+                             "count of %u",
+                             kLoopCountArgument,
+                             value.c_str(),
+                             kDefaultLoopCount);
+        (*loop_count) = kDefaultLoopCount;
+    }
+
+    return true;
+}
+
+// Retrieves the range of frames to read into memory before they are replayed, specified as <first>-<last>.  Returns
+// false when no frames are to be preloaded or the range is not valid.
+static bool GetPreloadFrames(const gfxrecon::util::ArgumentParser& arg_parser,
+                             uint32_t*                             first_frame,
+                             uint32_t*                             last_frame,
+                             bool*                                 decompress)
+{
+    if (!GetFrameRange(arg_parser, kPreloadFramesArgument, first_frame, last_frame))
+    {
+        return false;
+    }
+
+    (*decompress) = !arg_parser.IsOptionSet(kPreloadCompressedOption);
+
+    return true;
+}
+
+static uint32_t GetDecompressionThreadCount(const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    // By default, use half of the available hardware threads, leaving the rest for replay and the driver.
+    uint32_t    max_thread_count = std::max(1u, std::thread::hardware_concurrency());
+    uint32_t    thread_count     = std::max(1u, max_thread_count / 2);
+    std::string value            = arg_parser.GetArgumentValue(kDecompressionThreadsArgument);
+
+    if (!value.empty())
+    {
+        uint32_t requested_count = 0;
+
+        if (!ParseUnsignedValue(value, &requested_count))
+        {
+            GFXRECON_LOG_WARNING("Ignoring invalid %s value \"%s\", which must be a non-negative integer; using the "
+                                 "default count of %u",
+                                 kDecompressionThreadsArgument,
+                                 value.c_str(),
+                                 thread_count);
+        }
+        else if (requested_count > max_thread_count)
+        {
+            GFXRECON_LOG_WARNING("Limiting %s value %u to the number of available hardware threads (%u)",
+                                 kDecompressionThreadsArgument,
+                                 requested_count,
+                                 max_thread_count);
+            thread_count = max_thread_count;
+        }
+        else
+        {
+            thread_count = requested_count;
+        }
+    }
+
+    return thread_count;
+}
+
+static uint32_t GetPipelinePrecompileThreadCount()
+{
+    // Use half of the available hardware threads, leaving the rest for replay and the driver.
+    return std::max(1u, std::thread::hardware_concurrency() / 2);
+}
+
 static WsiPlatform GetWsiPlatform(const gfxrecon::util::ArgumentParser& arg_parser)
 {
     WsiPlatform wsi_platform = WsiPlatform::kAuto;
@@ -164,6 +330,10 @@ static WsiPlatform GetWsiPlatform(const gfxrecon::util::ArgumentParser& arg_pars
             GFXRECON_LOG_WARNING("Ignoring wsi option %s, which is not enabled on this system", value.c_str());
 #endif
         }
+        else if (gfxrecon::util::platform::StringCompareNoCase(kWsiPlatformHeadless, value.c_str()) == 0)
+        {
+            wsi_platform = WsiPlatform::kHeadless;
+        }
         else
         {
             GFXRECON_LOG_WARNING("Ignoring unrecongized wsi option %s", value.c_str());
@@ -188,6 +358,8 @@ const std::string GetWsiArgString()
     wsi_args += ',';
     wsi_args += kWsiPlatformWayland;
 #endif
+    wsi_args += ',';
+    wsi_args += kWsiPlatformHeadless;
     return wsi_args;
 }
 
@@ -216,7 +388,24 @@ GetCreateResourceAllocatorFunc(const gfxrecon::util::ArgumentParser& arg_parser)
     return func;
 }
 
-static gfxrecon::decode::ReplayOptions GetReplayOptions(const gfxrecon::util::ArgumentParser& arg_parser)
+// Identifies a capture file by name and size, so that persistent pipeline cache files are not shared by different
+// capture files.
+static std::string GetCaptureFileKey(const std::string& filename, uint64_t file_size)
+{
+    std::string key          = filename;
+    size_t      dir_location = key.find_last_of("/\\");
+
+    if (dir_location != std::string::npos)
+    {
+        key.replace(0, dir_location + 1, "");
+    }
+
+    return key + "_" + std::to_string(file_size);
+}
+
+static gfxrecon::decode::ReplayOptions GetReplayOptions(const gfxrecon::util::ArgumentParser& arg_parser,
+                                                        const std::string&                    filename,
+                                                        uint64_t                              file_size)
 {
     gfxrecon::decode::ReplayOptions replay_options;
     std::string                     override_gpu = arg_parser.GetArgumentValue(kOverrideGpuArgument);
@@ -238,8 +427,23 @@ static gfxrecon::decode::ReplayOptions GetReplayOptions(const gfxrecon::util::Ar
         replay_options.omit_pipeline_cache_data = true;
     }
 
+    uint32_t fast_forward_first_frame = 0;
+    uint32_t fast_forward_last_frame  = 0;
+
+    if (GetFrameRange(arg_parser, kFastForwardFramesArgument, &fast_forward_first_frame, &fast_forward_last_frame))
+    {
+        replay_options.fast_forward_first_frame = fast_forward_first_frame;
+        replay_options.fast_forward_last_frame  = fast_forward_last_frame;
+    }
+
     replay_options.create_resource_allocator = GetCreateResourceAllocatorFunc(arg_parser);
     replay_options.replace_dir               = arg_parser.GetArgumentValue(kShaderReplaceArgument);
+    replay_options.pipeline_cache_dir        = arg_parser.GetArgumentValue(kPipelineCacheDirArgument);
+
+    if (!replay_options.pipeline_cache_dir.empty())
+    {
+        replay_options.capture_file_key = GetCaptureFileKey(filename, file_size);
+    }
 
     return replay_options;
 }
@@ -285,6 +489,11 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("\t\t\t[--pause-frame <N>] [--paused]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--sfa | --skip-failed-allocations] [--replace-shaders <dir>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--opcd | --omit-pipeline-cache-data] [--wsi <platform>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--decompression-threads <N>] [--threaded-replay]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--precompile-pipelines] [--pipeline-cache-dir <dir>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--loop-frames <first>-<last>] [--loop-count <N>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--perf-report <file>] [--preload-frames <first>-<last>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--preload-compressed] [--fast-forward-frames <first>-<last>]");
 #if defined(WIN32) && defined(_DEBUG)
     GFXRECON_WRITE_CONSOLE("\t\t\t[--no-debug-popup]");
 #endif
@@ -313,6 +522,64 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("        \t\tvkCreatePipelineCache (same as --omit-pipeline-cache-data).");
     GFXRECON_WRITE_CONSOLE("  --wsi <platform>\tForce replay to use the specified wsi platform.");
     GFXRECON_WRITE_CONSOLE("                  \tAvailable platforms are: %s", GetWsiArgString().c_str());
+    GFXRECON_WRITE_CONSOLE("                  \tThe headless platform replays without a window system,");
+    GFXRECON_WRITE_CONSOLE("                  \treplacing swapchains with offscreen images, and is used");
+    GFXRECON_WRITE_CONSOLE("                  \tby auto when no window system is available.  It requires");
+    GFXRECON_WRITE_CONSOLE("                  \tthe VK_EXT_headless_surface extension.");
+    GFXRECON_WRITE_CONSOLE("  --decompression-threads <N>");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tRead and decompress blocks of compressed capture files");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tahead of replay with N worker threads.  A value of 0");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tdecompresses blocks on the replay thread.  Default is half");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tof the available hardware threads, and N is limited to the");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tnumber of available hardware threads.");
+    GFXRECON_WRITE_CONSOLE("  --threaded-replay\tRecord command buffers on worker threads.  Command");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tbuffers from the same command pool are recorded by one");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tthread in capture order.  All other calls wait for the");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tworker threads and are replayed in capture order on the");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tmain thread.");
+    GFXRECON_WRITE_CONSOLE("  --precompile-pipelines");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tScan the capture file for pipeline creation calls before");
+    GFXRECON_WRITE_CONSOLE("       \t\t\treplay, and create the pipelines on worker threads as soon");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tas the objects that they reference have been created.");
+    GFXRECON_WRITE_CONSOLE("  --pipeline-cache-dir <dir>");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tCreate pipelines with a pipeline cache that is loaded from");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tand saved to a file in <dir>, so that later replays of the");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tsame capture file on the same device and driver reuse the");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tcompiled pipelines.");
+    GFXRECON_WRITE_CONSOLE("  --loop-frames <first>-<last>");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tAfter replaying the specified range of frames, replay the");
+    GFXRECON_WRITE_CONSOLE("       \t\t\trange again from memory the number of times specified by");
+    GFXRECON_WRITE_CONSOLE("       \t\t\t--loop-count, and report the frame times of each loop.");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tObject state and resource contents are not restored");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tbetween loops, so ranges that create, destroy, allocate, or");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tfree objects are not looped.  Swapchains are replaced with");
+    GFXRECON_WRITE_CONSOLE("       \t\t\toffscreen images, as with --wsi headless, so that acquired");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tswapchain images can be acquired again.");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tThe range length should be a multiple of the number of");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tframes the application kept in flight.");
+    GFXRECON_WRITE_CONSOLE("  --loop-count <N>\tNumber of times to replay the --loop-frames range.");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tDefault is %u.", kDefaultLoopCount);
+    GFXRECON_WRITE_CONSOLE("  --perf-report <file>\tWrite a replay performance report to <file>, with");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tpercentiles of the frame times split into decode, replay,");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tand file time, the GPU time of each frame measured with");
+    GFXRECON_WRITE_CONSOLE("       \t\t\ttimestamp queries, and the total time of each API call.");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tThe report is written as CSV when <file> has a .csv");
+    GFXRECON_WRITE_CONSOLE("       \t\t\textension, and as JSON otherwise.");
+    GFXRECON_WRITE_CONSOLE("  --preload-frames <first>-<last>");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tRead the specified range of frames into memory before");
+    GFXRECON_WRITE_CONSOLE("       \t\t\treplaying them, with compressed blocks decompressed, so");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tthat the frames are replayed without file reads.  Reports");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tthe memory used for the frames and their replay time.");
+    GFXRECON_WRITE_CONSOLE("  --preload-compressed\tKeep the blocks of the --preload-frames range");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tcompressed in memory, decompressing them during replay.");
+    GFXRECON_WRITE_CONSOLE("  --fast-forward-frames <first>-<last>");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tReplay the specified range of frames without waiting for");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tfences, events, and query results that were waited for");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tduring capture, waiting for the device to become idle");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tonce at the end of each frame instead.  Use to quickly");
+    GFXRECON_WRITE_CONSOLE("       \t\t\treach a frame late in a capture when replay fidelity of");
+    GFXRECON_WRITE_CONSOLE("       \t\t\tthe skipped frames is not required.  Combine with --wsi");
+    GFXRECON_WRITE_CONSOLE("       \t\t\theadless to also avoid presenting the frames.");
 #if defined(WIN32) && defined(_DEBUG)
     GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
     GFXRECON_WRITE_CONSOLE("       \t\t\tdisplayed when abort() is called (Windows debug only).");